@@ -0,0 +1,130 @@
+// Compares the times of first intersection and closest point queries on an
+// AABB tree, one query at a time or by packets, for the coherent queries of
+// a ray casting and of a distance field sampled on a grid.
+// Usage: tree_packet_queries [mesh] [grid resolution]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef K::Vector_3 Vector_3;
+typedef K::Ray_3 Ray_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef std::optional<Tree::Intersection_and_primitive_id<Ray_3>::Type> Ray_intersection;
+
+template <class Run>
+void run(const std::string& name, const Run& f)
+{
+  CGAL::Real_timer time;
+  time.start();
+  std::size_t nb = f();
+  time.stop();
+  std::cout << name << ": " << time.time() << " s (" << nb << ")" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const int resolution = (argc > 2) ? std::atoi(argv[2]) : 300;
+
+  Mesh tm;
+  if(!CGAL::IO::read_polygon_mesh(filename, tm))
+  {
+    std::cerr << "Cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << num_faces(tm) << " faces" << std::endl;
+
+  Tree tree(faces(tm).begin(), faces(tm).end(), tm);
+  tree.build();
+  tree.accelerate_distance_queries();
+
+  // Rays cast from a point in front of the mesh through the pixels of an
+  // image covering it, and samples of a grid in its bounding box
+  CGAL::Bbox_3 bb = CGAL::Polygon_mesh_processing::bbox(tm);
+  const Point_3 eye(0.5 * (bb.xmin() + bb.xmax()), 0.5 * (bb.ymin() + bb.ymax()),
+                    bb.zmax() + 2 * (bb.zmax() - bb.zmin()));
+  std::vector<Ray_3> rays;
+  for(int i = 0; i < resolution; ++i)
+    for(int j = 0; j < resolution; ++j)
+      rays.push_back(Ray_3(eye, Point_3(bb.xmin() + (bb.xmax() - bb.xmin()) * i / resolution,
+                                        bb.ymin() + (bb.ymax() - bb.ymin()) * j / resolution,
+                                        bb.zmax())));
+
+  const int grid = static_cast<int>(std::cbrt(double(resolution) * resolution));
+  std::vector<Point_3> points;
+  for(int i = 0; i < grid; ++i)
+    for(int j = 0; j < grid; ++j)
+      for(int k = 0; k < grid; ++k)
+        points.push_back(Point_3(bb.xmin() + (bb.xmax() - bb.xmin()) * i / grid,
+                                 bb.ymin() + (bb.ymax() - bb.ymin()) * j / grid,
+                                 bb.zmin() + (bb.zmax() - bb.zmin()) * k / grid));
+  std::cout << rays.size() << " rays, " << points.size() << " points" << std::endl;
+
+  run("First intersections, one at a time", [&]()
+  {
+    std::size_t nb = 0;
+    for(const Ray_3& r : rays)
+      nb += bool(tree.first_intersection(r));
+    return nb;
+  });
+  run("First intersections, by packets", [&]()
+  {
+    std::vector<Ray_intersection> res;
+    tree.first_intersections(rays.begin(), rays.end(), std::back_inserter(res));
+    return std::size_t(std::count_if(res.begin(), res.end(), [](const Ray_intersection& r) { return bool(r); }));
+  });
+#ifdef CGAL_LINKED_WITH_TBB
+  run("First intersections, by packets in parallel", [&]()
+  {
+    std::vector<Ray_intersection> res;
+    tree.first_intersections<CGAL::Parallel_tag>(rays.begin(), rays.end(), std::back_inserter(res));
+    return std::size_t(std::count_if(res.begin(), res.end(), [](const Ray_intersection& r) { return bool(r); }));
+  });
+#endif
+
+  run("Closest points, one at a time", [&]()
+  {
+    std::size_t nb = 0;
+    for(const Point_3& p : points)
+      nb += std::size_t(tree.closest_point_and_primitive(p).second);
+    return nb;
+  });
+  run("Closest points, by packets", [&]()
+  {
+    std::vector<Tree::Point_and_primitive_id> res;
+    tree.closest_points_and_primitives(points.begin(), points.end(), std::back_inserter(res));
+    std::size_t nb = 0;
+    for(const Tree::Point_and_primitive_id& pp : res)
+      nb += std::size_t(pp.second);
+    return nb;
+  });
+#ifdef CGAL_LINKED_WITH_TBB
+  run("Closest points, by packets in parallel", [&]()
+  {
+    std::vector<Tree::Point_and_primitive_id> res;
+    tree.closest_points_and_primitives<CGAL::Parallel_tag>(points.begin(), points.end(), std::back_inserter(res));
+    std::size_t nb = 0;
+    for(const Tree::Point_and_primitive_id& pp : res)
+      nb += std::size_t(pp.second);
+    return nb;
+  });
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+// Compares the construction and query times of an AABB tree built with the
+// median split or the surface area heuristic, sequentially or in parallel.
+// Usage: tree_parallel_construction [mesh] [number of queries]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef K::Ray_3 Ray_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+template <class Build>
+void run(const std::string& name, const Mesh& tm,
+         const std::vector<Point_3>& queries, const Build& build)
+{
+  Tree tree(faces(tm).begin(), faces(tm).end(), tm);
+
+  CGAL::Real_timer time;
+  time.start();
+  build(tree);
+  time.stop();
+  std::cout << name << ": construction " << time.time() << " s";
+
+  time.reset();
+  time.start();
+  double sum = 0;
+  for(const Point_3& q : queries)
+    sum += tree.squared_distance(q);
+  time.stop();
+  std::cout << ", closest point queries " << time.time() << " s";
+
+  time.reset();
+  time.start();
+  std::size_t nb = 0;
+  for(std::size_t i = 0; i + 1 < queries.size(); ++i)
+    nb += tree.number_of_intersected_primitives(Ray_3(queries[i], queries[i+1]));
+  time.stop();
+  std::cout << ", ray queries " << time.time() << " s"
+            << " (" << sum << ", " << nb << ")" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::size_t nb_queries = (argc > 2) ? std::atoi(argv[2]) : 100000;
+
+  Mesh tm;
+  if(!CGAL::IO::read_polygon_mesh(filename, tm))
+  {
+    std::cerr << "Cannot read " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << num_faces(tm) << " faces" << std::endl;
+
+  // Reproducible queries in the bounding box of the mesh
+  CGAL::Bbox_3 bb = CGAL::Polygon_mesh_processing::bbox(tm);
+  CGAL::Random rng(0);
+  std::vector<Point_3> queries;
+  for(std::size_t i = 0; i < nb_queries; ++i)
+    queries.push_back(Point_3(rng.get_double(bb.xmin(), bb.xmax()),
+                              rng.get_double(bb.ymin(), bb.ymax()),
+                              rng.get_double(bb.zmin(), bb.zmax())));
+
+  run("Median split, sequential", tm, queries,
+      [](Tree& tree) { tree.build<CGAL::Sequential_tag>(); });
+  run("SAH split, sequential", tm, queries,
+      [](Tree& tree) { tree.build_with_surface_area_heuristic<CGAL::Sequential_tag>(); });
+#ifdef CGAL_LINKED_WITH_TBB
+  run("Median split, parallel", tm, queries,
+      [](Tree& tree) { tree.build<CGAL::Parallel_tag>(); });
+  run("SAH split, parallel", tm, queries,
+      [](Tree& tree) { tree.build_with_surface_area_heuristic<CGAL::Parallel_tag>(); });
+#endif
+
+  return EXIT_SUCCESS;
+}
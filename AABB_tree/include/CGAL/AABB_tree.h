@@ -23,15 +23,25 @@
 #include <iterator>
 #include <CGAL/AABB_tree/internal/AABB_traversal_traits.h>
 #include <CGAL/AABB_tree/internal/AABB_node.h>
+#include <CGAL/AABB_tree/internal/AABB_sah_split.h>
 #include <CGAL/AABB_tree/internal/AABB_search_tree.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Primitive_helper.h>
+#include <CGAL/tags.h>
 #include <optional>
+#include <functional>
+#include <type_traits>
 
 #ifdef CGAL_HAS_THREADS
 #include <CGAL/mutex.h>
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
 /// \file AABB_tree.h
 
 namespace CGAL {
@@ -146,6 +156,25 @@ namespace CGAL {
     /// primitives of the tree.
     template<typename ... T>
     void build(T&& ...);
+
+    /// triggers the (re)construction of the internal tree structure, as `build()`.
+    /// With `Parallel_tag`, the subtrees are built in parallel TBB tasks.
+    /// The tree is the same whatever the concurrency tag.
+    /// \tparam ConcurrencyTag enables sequential versus parallel construction.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    template<typename ConcurrencyTag>
+    void build();
+
+    /// triggers the (re)construction of the internal tree structure, as `build<ConcurrencyTag>()`,
+    /// but the primitives of each node are split along the axis minimizing the
+    /// surface area heuristic (the sum of the areas of the bounding boxes of the two children)
+    /// instead of the longest axis of the bounding box of the node.
+    /// The construction is slower, but the resulting tree usually answers
+    /// ray and distance queries faster.
+    /// The traits functors `Split_primitives` must split the primitives along the
+    /// longest axis of the bounding box it is given, as the one of `AABB_traits`.
+    template<typename ConcurrencyTag = Sequential_tag>
+    void build_with_surface_area_heuristic();
 #ifndef DOXYGEN_RUNNING
     void build();
 
@@ -165,6 +194,33 @@ namespace CGAL {
     template<typename ConstPrimitiveIterator,typename ... T>
     void rebuild(ConstPrimitiveIterator first, ConstPrimitiveIterator beyond,T&& ...);
 
+    /// recomputes the bounding boxes of the nodes of the tree after the
+    /// geometry of its primitives has changed, keeping the hierarchy of the nodes.
+    /// This is meant for deforming meshes, the primitives referring to
+    /// geometric objects that were moved but not replaced, and has a complexity
+    /// of \cgalBigO{n}, where \f$n\f$ is the number of primitives of the tree.
+    /// The queries remain exact, but they slow down as the deformation grows;
+    /// `surface_area_cost_ratio()` tells when `build()` is worth being called again.
+    /// The internal KD-tree used to accelerate the distance queries, which
+    /// refers to the former positions, is cleared. If it was built from the
+    /// primitives, it is reconstructed at the next distance query.
+    /// If the tree was not built yet, this is equivalent to `build<ConcurrencyTag>()`.
+    /// \tparam ConcurrencyTag enables sequential versus parallel computation.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    template<typename ConcurrencyTag = Sequential_tag>
+    void refit();
+
+    /// returns the ratio of the surface area heuristic cost of the tree, as refitted by the last call to `refit()`,
+    /// to the cost of the tree when it was built. The cost is the sum of the
+    /// areas of the bounding boxes of the nodes, relative to the one of the root,
+    /// which estimates the number of nodes visited by a random ray.
+    /// The ratio is `1` if `refit()` was not called since the last build. When it exceeds
+    /// about `1.5`, the queries are slow enough for `build()` to pay off.
+    double surface_area_cost_ratio() const
+    {
+      return (m_build_cost > 0 && m_refit_cost > 0) ? m_refit_cost / m_build_cost : 1.;
+    }
+
 
     /// adds a sequence of primitives to the set of primitives of the AABB tree.
     /// `%InputIterator` is any iterator and the parameter pack `T` contains any types
@@ -353,6 +409,36 @@ public:
       return first_intersected_primitive(query, [](Primitive_id){ return false; });
     }
     /// \endcond
+
+    /// puts in `out` the result of `first_intersection(r, skip)` for each ray `r`
+    /// of the range [`first`, `beyond`), in the same order.
+    /// The rays are processed by packets traversing the tree together, which
+    /// is faster than calling `first_intersection()` on each of them when the
+    /// rays are coherent, e.g.\ when they are sorted by origin and direction.
+    /// \tparam ConcurrencyTag enables sequential versus parallel traversals.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// \tparam InputIterator an input iterator with value type `AABBTraits::Ray_3`
+    /// \tparam OutputIterator an output iterator accepting
+    /// `std::optional< Intersection_and_primitive_id<Ray>::Type >`
+    ///
+    /// `AABBTraits` must be a model of `AABBRayIntersectionTraits` to
+    /// call this member function.
+    template<typename ConcurrencyTag = Sequential_tag,
+             typename InputIterator, typename OutputIterator, typename SkipFunctor>
+    OutputIterator
+    first_intersections(InputIterator first, InputIterator beyond,
+                        OutputIterator out, const SkipFunctor& skip) const;
+
+    /// \cond
+    template<typename ConcurrencyTag = Sequential_tag,
+             typename InputIterator, typename OutputIterator>
+    OutputIterator
+    first_intersections(InputIterator first, InputIterator beyond,
+                        OutputIterator out) const
+    {
+      return first_intersections<ConcurrencyTag>(first, beyond, out, [](Primitive_id){ return false; });
+    }
+    /// \endcond
     ///@}
 
     /// \name Distance Queries
@@ -377,6 +463,23 @@ public:
     /// \pre `!empty()`
     Point_and_primitive_id closest_point_and_primitive(const Point& query) const;
 
+    /// puts in `out` the result of `closest_point_and_primitive(q)` for each
+    /// point `q` of the range [`first`, `beyond`), in the same order.
+    /// The points are processed by packets traversing the tree together, which
+    /// is faster than calling `closest_point_and_primitive()` on each of them
+    /// when the points are close to one another, e.g.\ for the samples of a
+    /// regular grid computing a distance field.
+    /// \tparam ConcurrencyTag enables sequential versus parallel traversals.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// \tparam InputIterator an input iterator with value type `Point`
+    /// \tparam OutputIterator an output iterator accepting `Point_and_primitive_id`
+    /// \pre `!empty()`
+    template<typename ConcurrencyTag = Sequential_tag,
+             typename InputIterator, typename OutputIterator>
+    OutputIterator
+    closest_points_and_primitives(InputIterator first, InputIterator beyond,
+                                  OutputIterator out) const;
+
 
     ///@}
 
@@ -487,6 +590,8 @@ public:
     void clear_nodes()
     {
       m_nodes.clear();
+      m_build_cost = 0;
+      m_refit_cost = 0;
     }
 
     // clears internal KD tree
@@ -559,6 +664,10 @@ public:
   private:
     typedef AABB_node<AABBTraits> Node;
 
+    template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+    void custom_build_impl(const ComputeBbox& compute_bbox,
+                           const SplitPrimitives& split_primitives);
+
     /**
      * @brief Builds the tree by recursive expansion.
      * @param node the root node of the subtree to generate
@@ -569,8 +678,10 @@ public:
      * @param split_primitives a functor
      *
      * [first,beyond[ is the range of primitives to be added to the tree.
+     * The `range-1` nodes of the subtree are stored contiguously from `node`,
+     * in depth-first order, so that subtrees can be expanded in parallel.
      */
-    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
     void expand(Node& node,
                 ConstPrimitiveIterator first,
                 ConstPrimitiveIterator beyond,
@@ -578,6 +689,27 @@ public:
                 const ComputeBbox& compute_bbox,
                 const SplitPrimitives& split_primitives);
 
+    template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox>
+    typename AABBTraits::Bounding_box
+    compute_range_bbox(ConstPrimitiveIterator first,
+                       ConstPrimitiveIterator beyond,
+                       const ComputeBbox& compute_bbox) const;
+
+    // Ranges of primitives larger than this are processed in parallel
+    static constexpr std::size_t parallel_expansion_threshold = 4096;
+
+    // Recomputes the bounding boxes of the subtree of `node`, whose
+    // primitives are [first,first+range[
+    template<typename ConcurrencyTag>
+    const Bounding_box& refit_node(Node& node,
+                                   typename Primitives::const_iterator first,
+                                   const std::size_t range);
+
+    // Returns the sum of the half areas of the bounding boxes of the nodes,
+    // relative to the one of the root
+    template<typename ConcurrencyTag>
+    double surface_area_cost() const;
+
   public:
     // returns a point which must be on one primitive
     Point_and_primitive_id any_reference_point_and_id() const
@@ -663,6 +795,11 @@ public:
       return *m_primitives.begin();
     }
 
+    // surface area heuristic costs of the tree, when built and when last refitted,
+    // or 0 if unknown
+    double m_build_cost = 0;
+    double m_refit_cost = 0;
+
     // search KD-tree
     mutable std::unique_ptr<const Search_tree> m_p_search_tree;
     bool m_use_default_search_tree = true; // indicates whether the internal kd-tree should be built
@@ -696,6 +833,8 @@ public:
     m_nodes = std::move(tree.m_nodes);
     m_p_search_tree = std::move(tree.m_p_search_tree);
     m_use_default_search_tree = std::exchange(tree.m_use_default_search_tree, true);
+    m_build_cost = std::exchange(tree.m_build_cost, 0.);
+    m_refit_cost = std::exchange(tree.m_refit_cost, 0.);
 #ifdef CGAL_HAS_THREADS
     m_atomic_need_build = tree.m_atomic_need_build.load(std::memory_order_relaxed);
     m_atomic_search_tree_constructed = tree.m_atomic_search_tree_constructed.load(std::memory_order_relaxed);
@@ -785,7 +924,32 @@ public:
   }
 
   template<typename Tr>
-  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+  template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox>
+  typename Tr::Bounding_box
+  AABB_tree<Tr>::compute_range_bbox(ConstPrimitiveIterator first,
+                                    ConstPrimitiveIterator beyond,
+                                    const ComputeBbox& compute_bbox) const
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+       && std::size_t(beyond - first) > parallel_expansion_threshold)
+    {
+      typedef typename Tr::Bounding_box Bounding_box;
+      return tbb::parallel_reduce(
+        tbb::blocked_range<ConstPrimitiveIterator>(first, beyond, parallel_expansion_threshold),
+        compute_bbox(first, first+1),
+        [&](const tbb::blocked_range<ConstPrimitiveIterator>& r, const Bounding_box& bbox)
+        {
+          return bbox + compute_bbox(r.begin(), r.end());
+        },
+        [](const Bounding_box& b1, const Bounding_box& b2) { return b1 + b2; });
+    }
+#endif
+    return compute_bbox(first, beyond);
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
   void
   AABB_tree<Tr>::expand(Node& node,
                         ConstPrimitiveIterator first,
@@ -794,25 +958,39 @@ public:
                         const ComputeBbox& compute_bbox,
                         const SplitPrimitives& split_primitives)
   {
-    node.set_bbox(compute_bbox(first, beyond));
+    node.set_bbox(compute_range_bbox<ConcurrencyTag>(first, beyond, compute_bbox));
 
     // sort primitives along longest axis aabb
     split_primitives(first, beyond, node.bbox());
 
+    Node* const children = std::addressof(node) + 1;
     switch(range)
     {
     case 2:
       node.set_children(*first, *(first+1));
       break;
     case 3:
-      node.set_children(*first, new_node());
-      expand(node.right_child(), first+1, beyond, 2, compute_bbox, split_primitives);
+      node.set_children(*first, children[0]);
+      expand<ConcurrencyTag>(children[0], first+1, beyond, 2, compute_bbox, split_primitives);
       break;
     default:
       const std::size_t new_range = range/2;
-      node.set_children(new_node(), new_node());
-      expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives);
-      expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives);
+      // the left subtree has new_range-1 nodes
+      node.set_children(children[0], children[new_range-1]);
+#ifdef CGAL_LINKED_WITH_TBB
+      if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+         && range > parallel_expansion_threshold)
+      {
+        tbb::parallel_invoke(
+          [&]{ expand<ConcurrencyTag>(node.left_child(), first, first + new_range, new_range,
+                                      compute_bbox, split_primitives); },
+          [&]{ expand<ConcurrencyTag>(node.right_child(), first + new_range, beyond, range - new_range,
+                                      compute_bbox, split_primitives); });
+        break;
+      }
+#endif
+      expand<ConcurrencyTag>(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives);
+      expand<ConcurrencyTag>(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives);
     }
   }
 
@@ -824,6 +1002,24 @@ public:
     custom_build(m_traits.compute_bbox_object(),
                  m_traits.split_primitives_object());
   }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  void AABB_tree<Tr>::build()
+  {
+    custom_build_impl<ConcurrencyTag>(m_traits.compute_bbox_object(),
+                                      m_traits.split_primitives_object());
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  void AABB_tree<Tr>::build_with_surface_area_heuristic()
+  {
+    typedef typename Tr::Compute_bbox Compute_bbox;
+    custom_build_impl<ConcurrencyTag>(
+      m_traits.compute_bbox_object(),
+      internal::AABB_tree::SAH_split_primitives<Tr, Compute_bbox>(m_traits, m_traits.compute_bbox_object()));
+  }
 #ifndef DOXYGEN_RUNNING
   // Build the data structure, after calls to insert(..)
   template<typename Tr>
@@ -832,19 +1028,34 @@ public:
     const ComputeBbox& compute_bbox,
     const SplitPrimitives& split_primitives)
   {
+    custom_build_impl<Sequential_tag>(compute_bbox, split_primitives);
+  }
+#endif
+
+  template<typename Tr>
+  template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+  void AABB_tree<Tr>::custom_build_impl(
+    const ComputeBbox& compute_bbox,
+    const SplitPrimitives& split_primitives)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     clear_nodes();
 
     if(m_primitives.size() > 1) {
 
       // allocates tree nodes
-      m_nodes.reserve(m_primitives.size()-1);
+      m_nodes.resize(m_primitives.size()-1);
 
       // constructs the tree
-      expand(new_node(),
-             m_primitives.begin(), m_primitives.end(),
-             m_primitives.size(),
-             compute_bbox,
-             split_primitives);
+      expand<ConcurrencyTag>(m_nodes[0],
+                             m_primitives.begin(), m_primitives.end(),
+                             m_primitives.size(),
+                             compute_bbox,
+                             split_primitives);
     }
 #ifdef CGAL_HAS_THREADS
     m_atomic_need_build.store(false, std::memory_order_release); // in case build() is triggered by a call to root_node()
@@ -852,7 +1063,114 @@ public:
     m_need_build = false;
 #endif
   }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  const typename AABB_tree<Tr>::Bounding_box&
+  AABB_tree<Tr>::refit_node(Node& node,
+                            typename Primitives::const_iterator first,
+                            const std::size_t range)
+  {
+    typename Tr::Compute_bbox compute_bbox = m_traits.compute_bbox_object();
+    switch(range)
+    {
+    case 2:
+      node.set_bbox(compute_bbox(first, first+2));
+      break;
+    case 3:
+      node.set_bbox(compute_bbox(first, first+1) +
+                    refit_node<ConcurrencyTag>(node.right_child(), first+1, 2));
+      break;
+    default:
+      const std::size_t new_range = range/2;
+#ifdef CGAL_LINKED_WITH_TBB
+      if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+         && range > parallel_expansion_threshold)
+      {
+        tbb::parallel_invoke(
+          [&]{ refit_node<ConcurrencyTag>(node.left_child(), first, new_range); },
+          [&]{ refit_node<ConcurrencyTag>(node.right_child(), first + new_range, range - new_range); });
+        node.set_bbox(node.left_child().bbox() + node.right_child().bbox());
+        break;
+      }
 #endif
+      node.set_bbox(refit_node<ConcurrencyTag>(node.left_child(), first, new_range) +
+                    refit_node<ConcurrencyTag>(node.right_child(), first + new_range, range - new_range));
+    }
+    return node.bbox();
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  double AABB_tree<Tr>::surface_area_cost() const
+  {
+    auto half_area = [](const Bounding_box& bbox)
+    {
+      const double dx = bbox.xmax() - bbox.xmin();
+      const double dy = bbox.ymax() - bbox.ymin();
+      const double dz = bbox.zmax() - bbox.zmin();
+      return dx*dy + dy*dz + dz*dx;
+    };
+
+    double sum = 0;
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+       && m_nodes.size() > parallel_expansion_threshold)
+    {
+      sum = tbb::parallel_reduce(
+        tbb::blocked_range<std::size_t>(0, m_nodes.size(), parallel_expansion_threshold),
+        0.,
+        [&](const tbb::blocked_range<std::size_t>& r, double partial_sum)
+        {
+          for(std::size_t i = r.begin(); i != r.end(); ++i)
+            partial_sum += half_area(m_nodes[i].bbox());
+          return partial_sum;
+        },
+        std::plus<double>());
+    }
+    else
+#endif
+    {
+      for(const Node& node : m_nodes)
+        sum += half_area(node.bbox());
+    }
+
+    const double root_area = half_area(m_nodes[0].bbox());
+    return (root_area > 0) ? sum / root_area : 0.;
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  void AABB_tree<Tr>::refit()
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+#ifdef CGAL_HAS_THREADS
+    bool m_need_build = m_atomic_need_build.load(std::memory_order_acquire);
+#endif
+    if(m_need_build)
+    {
+      build<ConcurrencyTag>();
+      return;
+    }
+
+    // the reference points of the search tree are on the former primitives
+    clear_search_tree();
+
+    if(m_primitives.size() < 2)
+      return;
+
+    // the cost of the tree as built is computed before its first refit
+    if(m_build_cost == 0)
+      m_build_cost = surface_area_cost<ConcurrencyTag>();
+
+    refit_node<ConcurrencyTag>(m_nodes[0], m_primitives.begin(), m_primitives.size());
+    m_refit_cost = surface_area_cost<ConcurrencyTag>();
+  }
+
   // constructs the search KD tree from given points
   // to accelerate the distance queries
   template<typename Tr>
@@ -1058,6 +1376,7 @@ public:
 } // end namespace CGAL
 
 #include <CGAL/AABB_tree/internal/AABB_ray_intersection.h>
+#include <CGAL/AABB_tree/internal/AABB_packet_traversal.h>
 
 #include <CGAL/enable_warnings.h>
 
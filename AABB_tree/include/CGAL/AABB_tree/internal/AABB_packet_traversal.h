@@ -0,0 +1,564 @@
+// Copyright (c) 2023 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : Pierre Alliez, Stephane Tayeb
+
+#ifndef CGAL_AABB_PACKET_TRAVERSAL_H
+#define CGAL_AABB_PACKET_TRAVERSAL_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+/*
+ * Packets of queries traverse the tree together: a node is visited once for
+ * all the queries of the packet whose current answer it may improve, and its
+ * bounding box is tested against all of them at once. The coordinates of the
+ * queries are stored by lane in fixed size arrays, so that the loops over the
+ * lanes are vectorized by the compiler.
+ *
+ * The box tests are done with doubles, with enough slack to never discard a
+ * box that the exact predicates would visit. The primitives are then tested
+ * with the exact functors of the traits, so the answers are the ones of the
+ * query-at-a-time traversals, up to ties.
+ */
+constexpr std::size_t packet_size = 8;
+
+// Bit mask of the lanes of a packet
+typedef unsigned int Lane_mask;
+
+struct Packet_traversal_base
+{
+  static constexpr double infinity = std::numeric_limits<double>::infinity();
+  static constexpr double eps = std::numeric_limits<double>::epsilon();
+
+  // relative error bound of a product of sums of doubles
+  static constexpr double robust = 1. + 8. * eps;
+
+  // absolute slack covering the rounding of a coordinate to a double
+  template <typename FT>
+  static double padded(const FT& x, double& pad)
+  {
+    const std::pair<double, double> i = CGAL::to_interval(x);
+    pad = (std::max)(pad, (i.second - i.first) + 4. * eps * (std::max)(std::abs(i.first), std::abs(i.second)));
+    return CGAL::to_double(x);
+  }
+};
+
+/*
+ * First intersections of a packet of rays, as AABB_ray_intersection.
+ * The parameter of a point along a ray is the one of `as_ray_param_visitor`,
+ * that is the slab parameter `t` of `source + t * to_vector()`.
+ */
+template <typename AABBTree, typename SkipFunctor>
+class AABB_ray_packet_intersection
+  : private Packet_traversal_base
+{
+  typedef typename AABBTree::AABB_traits AABB_traits;
+  typedef typename AABB_traits::Ray_3 Ray;
+  typedef typename AABB_traits::Geom_traits::Vector_3 Vector;
+  typedef typename AABBTree::template Intersection_and_primitive_id<Ray>::Type Ray_intersection_and_primitive_id;
+  typedef typename AABBTree::Point Point;
+  typedef typename AABBTree::FT FT;
+  typedef ::CGAL::AABB_node<AABB_traits> Node;
+  typedef typename AABBTree::Primitive Primitive;
+  typedef typename AABBTree::Bounding_box Bounding_box;
+
+public:
+  typedef std::optional<Ray_intersection_and_primitive_id> Result;
+
+  AABB_ray_packet_intersection(const AABBTree& tree, const SkipFunctor& skip)
+    : m_tree(tree), m_skip(skip)
+  {}
+
+  // Computes the first intersections of the `n <= packet_size` rays `rays`
+  void operator()(const Ray* rays, std::size_t n, Result* results)
+  {
+    CGAL_precondition(n <= packet_size);
+    CGAL_precondition(m_tree.size() > 1);
+
+    m_rays = rays;
+    m_results = results;
+    for(std::size_t l = 0; l < packet_size; ++l)
+    {
+      if(l < n)
+      {
+        const Point s = rays[l].source();
+        const Vector v = rays[l].to_vector();
+        double pad = 0;
+        m_ox[l] = padded(s.x(), pad);
+        m_oy[l] = padded(s.y(), pad);
+        m_oz[l] = padded(s.z(), pad);
+        m_pad[l] = pad;
+        // a null component gives an infinite inverse, made positive so
+        // that the NaN of an origin on a slab is an unbounded slab side
+        m_ix[l] = inverse(CGAL::to_double(v.x()));
+        m_iy[l] = inverse(CGAL::to_double(v.y()));
+        m_iz[l] = inverse(CGAL::to_double(v.z()));
+        m_tbest[l] = infinity;
+        m_max_i[l] = 0;
+        for(int i=1; i<3; ++i)
+          if(CGAL::abs(v[i]) > CGAL::abs(v[m_max_i[l]]))
+            m_max_i[l] = i;
+        results[l] = std::nullopt;
+      }
+      else
+      {
+        // inactive lane: never hits anything
+        m_ox[l] = m_oy[l] = m_oz[l] = m_pad[l] = 0;
+        m_ix[l] = m_iy[l] = m_iz[l] = 1;
+        m_tbest[l] = -infinity;
+      }
+    }
+    m_t.assign(n, FT(0));
+
+    const Lane_mask all = (Lane_mask(1) << n) - 1;
+    traverse(all);
+  }
+
+private:
+  static double inverse(double d)
+  {
+    return (d == 0) ? infinity : 1. / d;
+  }
+
+  // Returns the lanes of `mask` whose ray may hit `bbox` before their
+  // current first intersection, and in `tmin` the smallest entry parameter.
+  Lane_mask box_mask(const Bounding_box& bbox, Lane_mask mask, double& tmin) const
+  {
+    double tnear[packet_size], tfar[packet_size];
+    for(std::size_t l = 0; l < packet_size; ++l)
+    {
+      double t0 = (bbox.xmin() - m_pad[l] - m_ox[l]) * m_ix[l];
+      double t1 = (bbox.xmax() + m_pad[l] - m_ox[l]) * m_ix[l];
+      t0 = (t0 == t0) ? t0 : -infinity;
+      t1 = (t1 == t1) ? t1 : infinity;
+      double tn = (std::max)(0., (std::min)(t0, t1));
+      double tf = (std::max)(t0, t1);
+
+      t0 = (bbox.ymin() - m_pad[l] - m_oy[l]) * m_iy[l];
+      t1 = (bbox.ymax() + m_pad[l] - m_oy[l]) * m_iy[l];
+      t0 = (t0 == t0) ? t0 : -infinity;
+      t1 = (t1 == t1) ? t1 : infinity;
+      tn = (std::max)(tn, (std::min)(t0, t1));
+      tf = (std::min)(tf, (std::max)(t0, t1));
+
+      t0 = (bbox.zmin() - m_pad[l] - m_oz[l]) * m_iz[l];
+      t1 = (bbox.zmax() + m_pad[l] - m_oz[l]) * m_iz[l];
+      t0 = (t0 == t0) ? t0 : -infinity;
+      t1 = (t1 == t1) ? t1 : infinity;
+      tn = (std::max)(tn, (std::min)(t0, t1));
+      tf = (std::min)(tf, (std::max)(t0, t1));
+
+      tnear[l] = tn;
+      tfar[l] = (std::min)(tf * robust, m_tbest[l]);
+    }
+
+    Lane_mask result = 0;
+    tmin = infinity;
+    for(std::size_t l = 0; l < packet_size; ++l)
+    {
+      if((mask >> l) & 1u && tnear[l] <= tfar[l])
+      {
+        result |= Lane_mask(1) << l;
+        tmin = (std::min)(tmin, tnear[l]);
+      }
+    }
+    return result;
+  }
+
+  FT ray_parameter(std::size_t l, const Point& p) const
+  {
+    Vector x(m_rays[l].source(), p);
+    Vector v = m_rays[l].to_vector();
+    return x[m_max_i[l]] / v[m_max_i[l]];
+  }
+
+  struct Parameter_visitor
+  {
+    const AABB_ray_packet_intersection* self;
+    std::size_t l;
+
+    FT operator()(const Point& p) const { return self->ray_parameter(l, p); }
+
+    template<typename T>
+    FT operator()(const T& s) const
+    {
+      // intersection is a segment, returns the min relative distance
+      // of its endpoints
+      return (std::min)(operator()(s[0]), operator()(s[1]));
+    }
+  };
+
+  void intersect(const Primitive& primitive, Lane_mask mask)
+  {
+    if(m_skip(primitive.id()))
+      return;
+    typename AABB_traits::Intersection intersection_obj = m_tree.traits().intersection_object();
+    for(std::size_t l = 0; l < packet_size; ++l)
+    {
+      if(!((mask >> l) & 1u))
+        continue;
+      Result intersection = intersection_obj(m_rays[l], primitive);
+      if(!intersection)
+        continue;
+      FT t = std::visit(Parameter_visitor{this, l}, intersection->first);
+      if(!m_results[l] || t < m_t[l])
+      {
+        m_t[l] = t;
+        m_results[l] = intersection;
+        m_tbest[l] = (std::max)(0., CGAL::to_interval(t).second * robust);
+      }
+    }
+  }
+
+  void traverse(Lane_mask all)
+  {
+    struct Entry { const Node* node; std::size_t nb_primitives; Lane_mask mask; };
+    std::vector<Entry> stack;
+    stack.push_back(Entry{m_tree.root_node(), m_tree.size(), all});
+
+    while(!stack.empty())
+    {
+      Entry current = stack.back();
+      stack.pop_back();
+
+      // discard the lanes that found a closer intersection since the push
+      double tmin;
+      Lane_mask mask = box_mask(current.node->bbox(), current.mask, tmin);
+      if(mask == 0)
+        continue;
+
+      switch(current.nb_primitives)
+      {
+      case 2:
+        intersect(current.node->left_data(), mask);
+        intersect(current.node->right_data(), mask);
+        break;
+      case 3:
+        intersect(current.node->left_data(), mask);
+        stack.push_back(Entry{&current.node->right_child(), 2, mask});
+        break;
+      default:
+      {
+        const Node* left = &current.node->left_child();
+        const Node* right = &current.node->right_child();
+        const std::size_t nb_left = current.nb_primitives/2;
+        double tl, tr;
+        Lane_mask ml = box_mask(left->bbox(), mask, tl);
+        Lane_mask mr = box_mask(right->bbox(), mask, tr);
+        // the nearest child is visited first
+        if(tl <= tr)
+        {
+          if(mr) stack.push_back(Entry{right, current.nb_primitives - nb_left, mr});
+          if(ml) stack.push_back(Entry{left, nb_left, ml});
+        }
+        else
+        {
+          if(ml) stack.push_back(Entry{left, nb_left, ml});
+          if(mr) stack.push_back(Entry{right, current.nb_primitives - nb_left, mr});
+        }
+      }
+      }
+    }
+  }
+
+  const AABBTree& m_tree;
+  const SkipFunctor& m_skip;
+  const Ray* m_rays = nullptr;
+  Result* m_results = nullptr;
+  std::vector<FT> m_t;
+
+  double m_ox[packet_size], m_oy[packet_size], m_oz[packet_size];
+  double m_ix[packet_size], m_iy[packet_size], m_iz[packet_size];
+  double m_pad[packet_size];
+  double m_tbest[packet_size];
+  int m_max_i[packet_size];
+};
+
+/*
+ * Closest points of a packet of points, as Projection_traits.
+ */
+template <typename AABBTree>
+class AABB_point_packet_projection
+  : private Packet_traversal_base
+{
+  typedef typename AABBTree::AABB_traits AABB_traits;
+  typedef typename AABBTree::Point Point;
+  typedef ::CGAL::AABB_node<AABB_traits> Node;
+  typedef typename AABBTree::Primitive Primitive;
+  typedef typename AABBTree::Bounding_box Bounding_box;
+  typedef typename AABBTree::Point_and_primitive_id Point_and_primitive_id;
+
+public:
+  typedef Point_and_primitive_id Result;
+
+  AABB_point_packet_projection(const AABBTree& tree)
+    : m_tree(tree)
+  {}
+
+  // Computes the closest points of the `n <= packet_size` points `queries`
+  void operator()(const Point* queries, std::size_t n, Result* results)
+  {
+    CGAL_precondition(n <= packet_size);
+    CGAL_precondition(m_tree.size() > 1);
+
+    m_queries = queries;
+    m_results = results;
+    for(std::size_t l = 0; l < packet_size; ++l)
+    {
+      if(l < n)
+      {
+        double pad = 0;
+        m_qx[l] = padded(queries[l].x(), pad);
+        m_qy[l] = padded(queries[l].y(), pad);
+        m_qz[l] = padded(queries[l].z(), pad);
+        m_pad[l] = pad;
+        // the queries of a packet being close to one another, the hint of
+        // the first one is a good enough hint for the others
+        results[l] = (l == 0) ? m_tree.best_hint(queries[l]) : results[0];
+        update_bound(l);
+      }
+      else
+      {
+        // inactive lane: never closer to anything
+        m_qx[l] = m_qy[l] = m_qz[l] = m_pad[l] = 0;
+        m_dbest[l] = -infinity;
+      }
+    }
+
+    const Lane_mask all = (Lane_mask(1) << n) - 1;
+    traverse(all);
+  }
+
+private:
+  void update_bound(std::size_t l)
+  {
+    const double d = CGAL::to_interval(
+      m_tree.traits().squared_distance_object()(m_queries[l], m_results[l].first)).second;
+    m_dbest[l] = d * robust;
+  }
+
+  // Returns the lanes of `mask` whose current closest point may be improved
+  // in `bbox`, and in `dmin` the smallest squared distance to `bbox`.
+  Lane_mask box_mask(const Bounding_box& bbox, Lane_mask mask, double& dmin) const
+  {
+    double dist[packet_size];
+    for(std::size_t l = 0; l < packet_size; ++l)
+    {
+      const double dx = (std::max)(0., (std::max)(bbox.xmin() - m_pad[l] - m_qx[l], m_qx[l] - bbox.xmax() - m_pad[l]));
+      const double dy = (std::max)(0., (std::max)(bbox.ymin() - m_pad[l] - m_qy[l], m_qy[l] - bbox.ymax() - m_pad[l]));
+      const double dz = (std::max)(0., (std::max)(bbox.zmin() - m_pad[l] - m_qz[l], m_qz[l] - bbox.zmax() - m_pad[l]));
+      dist[l] = (dx*dx + dy*dy + dz*dz) / robust;
+    }
+
+    Lane_mask result = 0;
+    dmin = infinity;
+    for(std::size_t l = 0; l < packet_size; ++l)
+    {
+      if((mask >> l) & 1u && dist[l] <= m_dbest[l])
+      {
+        result |= Lane_mask(1) << l;
+        dmin = (std::min)(dmin, dist[l]);
+      }
+    }
+    return result;
+  }
+
+  void project(const Primitive& primitive, Lane_mask mask)
+  {
+    typename AABB_traits::Closest_point closest_point = m_tree.traits().closest_point_object();
+    typename AABB_traits::Equal_3 equal = m_tree.traits().equal_3_object();
+    for(std::size_t l = 0; l < packet_size; ++l)
+    {
+      if(!((mask >> l) & 1u))
+        continue;
+      Point p = closest_point(m_queries[l], primitive, m_results[l].first);
+      if(!equal(p, m_results[l].first))
+      {
+        m_results[l] = Result(p, primitive.id());
+        update_bound(l);
+      }
+    }
+  }
+
+  void traverse(Lane_mask all)
+  {
+    struct Entry { const Node* node; std::size_t nb_primitives; Lane_mask mask; };
+    std::vector<Entry> stack;
+    stack.push_back(Entry{m_tree.root_node(), m_tree.size(), all});
+
+    while(!stack.empty())
+    {
+      Entry current = stack.back();
+      stack.pop_back();
+
+      // discard the lanes that found a closer point since the push
+      double dmin;
+      Lane_mask mask = box_mask(current.node->bbox(), current.mask, dmin);
+      if(mask == 0)
+        continue;
+
+      switch(current.nb_primitives)
+      {
+      case 2:
+        project(current.node->left_data(), mask);
+        project(current.node->right_data(), mask);
+        break;
+      case 3:
+        project(current.node->left_data(), mask);
+        stack.push_back(Entry{&current.node->right_child(), 2, mask});
+        break;
+      default:
+      {
+        const Node* left = &current.node->left_child();
+        const Node* right = &current.node->right_child();
+        const std::size_t nb_left = current.nb_primitives/2;
+        double dl, dr;
+        Lane_mask ml = box_mask(left->bbox(), mask, dl);
+        Lane_mask mr = box_mask(right->bbox(), mask, dr);
+        // the nearest child is visited first
+        if(dl <= dr)
+        {
+          if(mr) stack.push_back(Entry{right, current.nb_primitives - nb_left, mr});
+          if(ml) stack.push_back(Entry{left, nb_left, ml});
+        }
+        else
+        {
+          if(ml) stack.push_back(Entry{left, nb_left, ml});
+          if(mr) stack.push_back(Entry{right, current.nb_primitives - nb_left, mr});
+        }
+      }
+      }
+    }
+  }
+
+  const AABBTree& m_tree;
+  const Point* m_queries = nullptr;
+  Result* m_results = nullptr;
+
+  double m_qx[packet_size], m_qy[packet_size], m_qz[packet_size];
+  double m_pad[packet_size];
+  double m_dbest[packet_size];
+};
+
+// Calls `traverse(queries + i, m, results + i)` on the packets of at most
+// `packet_size` consecutive queries
+template <typename ConcurrencyTag, typename Query, typename Result, typename Traversal>
+void traverse_packets(const std::vector<Query>& queries,
+                      std::vector<Result>& results,
+                      const Traversal& traversal)
+{
+  const std::size_t nb_packets = (queries.size() + packet_size - 1) / packet_size;
+  auto traverse_packet = [&](Traversal& traverse, std::size_t i)
+  {
+    const std::size_t first = i * packet_size;
+    const std::size_t m = (std::min)(packet_size, queries.size() - first);
+    traverse(queries.data() + first, m, results.data() + first);
+  };
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_packets),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      Traversal traverse(traversal);
+      for(std::size_t i = r.begin(); i != r.end(); ++i)
+        traverse_packet(traverse, i);
+    });
+    return;
+  }
+#endif
+
+  Traversal traverse(traversal);
+  for(std::size_t i = 0; i != nb_packets; ++i)
+    traverse_packet(traverse, i);
+}
+
+} // namespace AABB_tree
+} // namespace internal
+
+template<typename AABBTraits>
+template<typename ConcurrencyTag, typename InputIterator, typename OutputIterator, typename SkipFunctor>
+OutputIterator
+AABB_tree<AABBTraits>::first_intersections(InputIterator first, InputIterator beyond,
+                                           OutputIterator out, const SkipFunctor& skip) const
+{
+  typedef typename AABBTraits::Ray_3 Ray;
+  typedef internal::AABB_tree::AABB_ray_packet_intersection<AABB_tree<AABBTraits>, SkipFunctor> Traversal;
+
+  if(size() < 2)
+  {
+    for(; first != beyond; ++first)
+      *out++ = first_intersection(*first, skip);
+    return out;
+  }
+
+  const std::vector<Ray> rays(first, beyond);
+  std::vector<typename Traversal::Result> results(rays.size());
+
+  // build the tree once, before the packets are spread among threads
+  root_node();
+  internal::AABB_tree::traverse_packets<ConcurrencyTag>(rays, results, Traversal(*this, skip));
+  return std::copy(results.begin(), results.end(), out);
+}
+
+template<typename AABBTraits>
+template<typename ConcurrencyTag, typename InputIterator, typename OutputIterator>
+OutputIterator
+AABB_tree<AABBTraits>::closest_points_and_primitives(InputIterator first, InputIterator beyond,
+                                                     OutputIterator out) const
+{
+  typedef internal::AABB_tree::AABB_point_packet_projection<AABB_tree<AABBTraits> > Traversal;
+  CGAL_precondition(!empty());
+
+  if(size() < 2)
+  {
+    for(; first != beyond; ++first)
+      *out++ = closest_point_and_primitive(*first);
+    return out;
+  }
+
+  const std::vector<Point> points(first, beyond);
+  std::vector<Point_and_primitive_id> results(points.size(), any_reference_point_and_id());
+
+  // build the tree and the internal KD-tree once, before the packets are spread among threads
+  root_node();
+  if(!points.empty())
+    best_hint(points.front());
+  internal::AABB_tree::traverse_packets<ConcurrencyTag>(points, results, Traversal(*this));
+  return std::copy(results.begin(), results.end(), out);
+}
+
+} // namespace CGAL
+
+#endif // CGAL_AABB_PACKET_TRAVERSAL_H
@@ -0,0 +1,105 @@
+// Copyright (c) 2023 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : Pierre Alliez, Stephane Tayeb
+
+#ifndef CGAL_AABB_SAH_SPLIT_H
+#define CGAL_AABB_SAH_SPLIT_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/Bbox_3.h>
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+/*
+ * Split functor choosing the axis along which the primitives are split
+ * with the surface area heuristic (SAH).
+ *
+ * The nodes of an `AABB_tree` split their primitives in two halves of the
+ * same size, so the split position is fixed, but not the axis: instead of
+ * the longest axis of the bounding box of the node, this functor picks the
+ * axis minimizing the sum of the surface areas of the bounding boxes of the
+ * two halves, which are the probabilities that a random ray hits them.
+ *
+ * The primitives are sorted along an axis with the `Split_primitives`
+ * functor of the traits, given a flat box elongated along that axis.
+ */
+template <typename AABBTraits, typename ComputeBbox>
+class SAH_split_primitives
+{
+  typedef typename AABBTraits::Bounding_box Bounding_box;
+  typedef typename AABBTraits::Split_primitives Split_primitives;
+
+  Split_primitives m_split_primitives;
+  ComputeBbox m_compute_bbox;
+
+  static double half_area(const Bounding_box& bbox)
+  {
+    const double dx = bbox.xmax() - bbox.xmin();
+    const double dy = bbox.ymax() - bbox.ymin();
+    const double dz = bbox.zmax() - bbox.zmin();
+    return dx*dy + dy*dz + dz*dx;
+  }
+
+  static Bounding_box axis_box(int axis)
+  {
+    return Bounding_box(0., 0., 0.,
+                        axis == 0 ? 1. : 0.,
+                        axis == 1 ? 1. : 0.,
+                        axis == 2 ? 1. : 0.);
+  }
+
+public:
+  SAH_split_primitives(const AABBTraits& traits, const ComputeBbox& compute_bbox)
+    : m_split_primitives(traits.split_primitives_object())
+    , m_compute_bbox(compute_bbox)
+  {}
+
+  typedef void result_type;
+  template<typename PrimitiveIterator>
+  void operator()(PrimitiveIterator first,
+                  PrimitiveIterator beyond,
+                  const Bounding_box& bbox) const
+  {
+    // below this size, the cost of the evaluation outweighs its gain
+    if(beyond - first < 8)
+    {
+      m_split_primitives(first, beyond, bbox);
+      return;
+    }
+
+    PrimitiveIterator middle = first + (beyond - first)/2;
+    int best_axis = -1, last_axis = -1;
+    double best_cost = 0;
+    for(int axis = 0; axis < 3; ++axis)
+    {
+      m_split_primitives(first, beyond, axis_box(axis));
+      last_axis = axis;
+      const double cost = half_area(m_compute_bbox(first, middle))
+                        + half_area(m_compute_bbox(middle, beyond));
+      if(best_axis == -1 || cost < best_cost)
+      {
+        best_axis = axis;
+        best_cost = cost;
+      }
+    }
+    if(best_axis != last_axis)
+      m_split_primitives(first, beyond, axis_box(best_axis));
+  }
+};
+
+} // namespace AABB_tree
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_AABB_SAH_SPLIT_H
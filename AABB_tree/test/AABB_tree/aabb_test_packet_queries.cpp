@@ -0,0 +1,145 @@
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_triangle_primitive.h>
+#include <CGAL/point_generators_3.h>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Segment_3 Segment;
+typedef K::Triangle_3 Triangle;
+
+typedef std::vector<Triangle>::const_iterator Iterator;
+typedef CGAL::AABB_triangle_primitive<K,Iterator> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef std::optional<Tree::Intersection_and_primitive_id<Ray>::Type> Ray_intersection;
+
+Iterator first_triangle;
+
+// squared distance from the source of `ray` to its intersection
+FT distance(const Ray& ray, const Ray_intersection& intersection)
+{
+  if(const Point* p = std::get_if<Point>(&intersection->first))
+    return CGAL::squared_distance(ray.source(), *p);
+  const Segment* s = std::get_if<Segment>(&intersection->first);
+  return (std::min)(CGAL::squared_distance(ray.source(), s->source()),
+                    CGAL::squared_distance(ray.source(), s->target()));
+}
+
+template <typename ConcurrencyTag>
+void check_rays(const Tree& tree, const std::vector<Ray>& rays)
+{
+  std::vector<Ray_intersection> intersections;
+  tree.first_intersections<ConcurrencyTag>(rays.begin(), rays.end(), std::back_inserter(intersections));
+  assert(intersections.size() == rays.size());
+
+  // skip the primitives of even index
+  auto skip = [&](Iterator id) { return (id - first_triangle) % 2 == 0; };
+  std::vector<Ray_intersection> skipped;
+  tree.first_intersections<ConcurrencyTag>(rays.begin(), rays.end(), std::back_inserter(skipped), skip);
+  assert(skipped.size() == rays.size());
+
+  for(std::size_t i = 0; i < rays.size(); ++i)
+  {
+    Ray_intersection ref = tree.first_intersection(rays[i]);
+    assert(bool(ref) == bool(intersections[i]));
+    if(ref)
+      assert(distance(rays[i], ref) == distance(rays[i], intersections[i]));
+
+    ref = tree.first_intersection(rays[i], skip);
+    assert(bool(ref) == bool(skipped[i]));
+    if(ref)
+    {
+      assert(tree.size() < 2 || !skip(skipped[i]->second));
+      assert(distance(rays[i], ref) == distance(rays[i], skipped[i]));
+    }
+  }
+}
+
+template <typename ConcurrencyTag>
+void check_points(const Tree& tree, const std::vector<Point>& points)
+{
+  std::vector<Tree::Point_and_primitive_id> closest;
+  tree.closest_points_and_primitives<ConcurrencyTag>(points.begin(), points.end(), std::back_inserter(closest));
+  assert(closest.size() == points.size());
+  for(std::size_t i = 0; i < points.size(); ++i)
+  {
+    assert(CGAL::squared_distance(points[i], closest[i].first) == tree.squared_distance(points[i]));
+    assert(closest[i].second->has_on(closest[i].first) ||
+           CGAL::squared_distance(*closest[i].second, closest[i].first) < 1e-20);
+  }
+}
+
+template <typename ConcurrencyTag>
+void check(const Tree& tree, const std::vector<Ray>& rays, const std::vector<Point>& points)
+{
+  check_rays<ConcurrencyTag>(tree, rays);
+  check_points<ConcurrencyTag>(tree, points);
+}
+
+int main()
+{
+  // A soup of small random triangles
+  CGAL::Random random(42);
+  CGAL::Random_points_in_cube_3<Point> gen(1., random);
+  std::vector<Triangle> triangles;
+  for(int i = 0; i < 5000; ++i)
+  {
+    Point p = *gen++;
+    const Vector u(random.get_double(-0.1, 0.1), random.get_double(-0.1, 0.1), random.get_double(-0.1, 0.1));
+    const Vector v(random.get_double(-0.1, 0.1), random.get_double(-0.1, 0.1), random.get_double(-0.1, 0.1));
+    triangles.push_back(Triangle(p, p + u, p + v));
+  }
+
+  // Random rays, coherent rays from a grid of origins, and axis-aligned
+  // rays whose origins lie on the planes of the boxes of the nodes
+  std::vector<Ray> rays;
+  for(int i = 0; i < 300; ++i)
+  {
+    Point p = *gen++;
+    rays.push_back(Ray(p, *gen++));
+  }
+  for(int i = 0; i < 20; ++i)
+    for(int j = 0; j < 20; ++j)
+      rays.push_back(Ray(Point(-2, -1 + 0.1 * i, -1 + 0.1 * j), Vector(1, 0.01 * i, -0.01 * j)));
+  for(int i = 0; i < 100; ++i)
+  {
+    const Point& p = triangles[i].vertex(0);
+    rays.push_back(Ray(p, Vector(0, 0, (i % 2) ? 1 : -1)));
+    rays.push_back(Ray(Point(p.x(), p.y(), 2), Vector(0, 0, -1)));
+  }
+
+  // Random points, and a grid of points as for a distance field
+  std::vector<Point> points;
+  std::copy_n(gen, 300, std::back_inserter(points));
+  for(int i = 0; i < 10; ++i)
+    for(int j = 0; j < 10; ++j)
+      for(int k = 0; k < 10; ++k)
+        points.push_back(Point(-1.5 + 0.3 * i, -1.5 + 0.3 * j, -1.5 + 0.3 * k));
+
+  first_triangle = triangles.begin();
+  Tree tree(triangles.begin(), triangles.end());
+  check<CGAL::Sequential_tag>(tree, rays, points);
+  check<CGAL::Parallel_if_available_tag>(tree, rays, points);
+
+  // Small trees, and ranges that do not fill the last packet
+  for(std::size_t n = 0; n < 6; ++n)
+  {
+    Tree small(triangles.begin(), triangles.begin() + n);
+    check_rays<CGAL::Sequential_tag>(small, std::vector<Ray>(rays.begin(), rays.begin() + 13));
+    if(n > 0)
+      check_points<CGAL::Parallel_if_available_tag>(small, std::vector<Point>(points.begin(), points.begin() + 13));
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
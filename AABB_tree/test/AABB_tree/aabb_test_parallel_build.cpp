@@ -0,0 +1,84 @@
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_triangle_primitive.h>
+#include <CGAL/point_generators_3.h>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Ray_3 Ray;
+typedef K::Triangle_3 Triangle;
+
+typedef std::vector<Triangle>::const_iterator Iterator;
+typedef CGAL::AABB_triangle_primitive<K,Iterator> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+// Compares the answers of `tree` to the ones of `ref` on random queries
+void check(const Tree& tree, const Tree& ref, const std::vector<Point>& queries)
+{
+  assert(tree.size() == ref.size());
+  assert(tree.bbox() == ref.bbox());
+  for(std::size_t i = 0; i + 1 < queries.size(); ++i)
+  {
+    const Point& q = queries[i];
+    assert(tree.squared_distance(q) == ref.squared_distance(q));
+    Ray ray(q, queries[i+1]);
+    assert(tree.number_of_intersected_primitives(ray) ==
+           ref.number_of_intersected_primitives(ray));
+  }
+}
+
+int main()
+{
+  // A soup of small random triangles, large enough to trigger parallel expansion
+  CGAL::Random random(42);
+  CGAL::Random_points_in_cube_3<Point> gen(1., random);
+  std::vector<Triangle> triangles;
+  for(int i = 0; i < 20000; ++i)
+  {
+    Point p = *gen++;
+    const K::Vector_3 u(random.get_double(-0.05, 0.05), random.get_double(-0.05, 0.05), random.get_double(-0.05, 0.05));
+    const K::Vector_3 v(random.get_double(-0.05, 0.05), random.get_double(-0.05, 0.05), random.get_double(-0.05, 0.05));
+    triangles.push_back(Triangle(p, p + u, p + v));
+  }
+  std::vector<Point> queries;
+  std::copy_n(gen, 200, std::back_inserter(queries));
+
+  Tree ref(triangles.begin(), triangles.end());
+  ref.build();
+
+  Tree tree(triangles.begin(), triangles.end());
+  tree.build<CGAL::Sequential_tag>();
+  check(tree, ref, queries);
+
+  tree.build_with_surface_area_heuristic();
+  check(tree, ref, queries);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  tree.build<CGAL::Parallel_tag>();
+  check(tree, ref, queries);
+
+  tree.build_with_surface_area_heuristic<CGAL::Parallel_tag>();
+  check(tree, ref, queries);
+#endif
+
+  // Small trees
+  for(std::size_t n = 0; n < 6; ++n)
+  {
+    Tree small_ref(triangles.begin(), triangles.begin() + n);
+    Tree small(triangles.begin(), triangles.begin() + n);
+    small.build_with_surface_area_heuristic<CGAL::Parallel_if_available_tag>();
+    if(n > 0)
+      check(small, small_ref, queries);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_triangle_primitive.h>
+#include <CGAL/point_generators_3.h>
+#include <cassert>
+#include <cmath>
+
+typedef CGAL::Simple_cartesian<double> K;
+
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Ray_3 Ray;
+typedef K::Triangle_3 Triangle;
+
+typedef std::vector<Triangle>::const_iterator Iterator;
+typedef CGAL::AABB_triangle_primitive<K,Iterator> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+// Compares the answers of `tree` to the ones of `ref` on random queries
+void check(const Tree& tree, const Tree& ref, const std::vector<Point>& queries)
+{
+  assert(tree.size() == ref.size());
+  assert(tree.bbox() == ref.bbox());
+  for(std::size_t i = 0; i + 1 < queries.size(); ++i)
+  {
+    const Point& q = queries[i];
+    assert(tree.squared_distance(q) == ref.squared_distance(q));
+    Ray ray(q, queries[i+1]);
+    assert(tree.number_of_intersected_primitives(ray) ==
+           ref.number_of_intersected_primitives(ray));
+    assert(bool(tree.first_intersected_primitive(ray)) ==
+           bool(ref.first_intersected_primitive(ray)));
+  }
+}
+
+// Moves the triangles in place, with a smooth twist growing with `t`
+void deform(std::vector<Triangle>& triangles, const std::vector<Triangle>& rest, double t)
+{
+  auto move = [t](const Point& p)
+  {
+    const double a = t * p.z();
+    return Point(std::cos(a) * p.x() - std::sin(a) * p.y(),
+                 std::sin(a) * p.x() + std::cos(a) * p.y(),
+                 p.z() * (1 + 0.1 * t));
+  };
+  for(std::size_t i = 0; i < rest.size(); ++i)
+    triangles[i] = Triangle(move(rest[i][0]), move(rest[i][1]), move(rest[i][2]));
+}
+
+template <typename ConcurrencyTag>
+void test(std::vector<Triangle>& triangles, const std::vector<Triangle>& rest,
+          const std::vector<Point>& queries)
+{
+  deform(triangles, rest, 0);
+  Tree tree(triangles.begin(), triangles.end());
+
+  // refitting a tree that was not built builds it
+  tree.refit<ConcurrencyTag>();
+  assert(tree.surface_area_cost_ratio() == 1.);
+
+  // the search tree is reconstructed from the deformed primitives
+  tree.accelerate_distance_queries();
+
+  for(int step = 1; step <= 4; ++step)
+  {
+    deform(triangles, rest, 0.5 * step);
+    tree.refit<ConcurrencyTag>();
+
+    Tree ref(triangles.begin(), triangles.end());
+    ref.build();
+    check(tree, ref, queries);
+  }
+
+  // the twist scatters the primitives of the nodes
+  std::cout << "cost ratio: " << tree.surface_area_cost_ratio() << std::endl;
+  assert(tree.surface_area_cost_ratio() > 1.);
+
+  // a new build restores the quality of the tree
+  tree.build();
+  assert(tree.surface_area_cost_ratio() == 1.);
+}
+
+int main()
+{
+  // A soup of small random triangles, large enough to trigger parallel refitting
+  CGAL::Random random(42);
+  CGAL::Random_points_in_cube_3<Point> gen(1., random);
+  std::vector<Triangle> rest;
+  for(int i = 0; i < 20000; ++i)
+  {
+    Point p = *gen++;
+    const Vector u(random.get_double(-0.05, 0.05), random.get_double(-0.05, 0.05), random.get_double(-0.05, 0.05));
+    const Vector v(random.get_double(-0.05, 0.05), random.get_double(-0.05, 0.05), random.get_double(-0.05, 0.05));
+    rest.push_back(Triangle(p, p + u, p + v));
+  }
+  std::vector<Point> queries;
+  std::copy_n(gen, 200, std::back_inserter(queries));
+
+  std::vector<Triangle> triangles(rest);
+  test<CGAL::Sequential_tag>(triangles, rest, queries);
+  test<CGAL::Parallel_if_available_tag>(triangles, rest, queries);
+
+  // Small trees
+  for(std::size_t n = 0; n < 6; ++n)
+  {
+    Tree small(triangles.begin(), triangles.begin() + n);
+    small.build();
+    deform(triangles, rest, 1.);
+    small.refit();
+    Tree small_ref(triangles.begin(), triangles.begin() + n);
+    if(n > 0)
+      check(small, small_ref, queries);
+    deform(triangles, rest, 0.);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,250 @@
+#ifndef CGAL_DDT_BENCHMARK_H
+#define CGAL_DDT_BENCHMARK_H
+
+#include <CGAL/Distributed_triangulation.h>
+#include <CGAL/DDT/kernel/Uniform_point_in_bbox_generator.h>
+#include <CGAL/DDT/point_set/Random_point_set.h>
+#include <CGAL/DDT/serializer/File_points_serializer.h>
+#include <CGAL/Memory_sizer.h>
+#include <CGAL/Real_timer.h>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+// Forwards to a serializer, while counting the number of tile loads (reads) and unloads (writes).
+// Counters are shared by all copies, as the tile container stores its serializer by value.
+template<typename Serializer>
+struct Counting_serializer
+{
+  struct Counters {
+    std::atomic<std::size_t> loads = 0;
+    std::atomic<std::size_t> saves = 0;
+  };
+
+  Counting_serializer(const Serializer& serializer) : serializer_(serializer), counters_(std::make_shared<Counters>()) {}
+
+  template <typename TileIndex>
+  bool is_readable(TileIndex id) const { return serializer_.is_readable(id); }
+
+  template<typename TileTriangulation>
+  bool read(TileTriangulation& tri) const { ++counters_->loads; return serializer_.read(tri); }
+
+  template<typename TileTriangulation>
+  bool write(const TileTriangulation& tri) const { ++counters_->saves; return serializer_.write(tri); }
+
+  std::size_t number_of_loads() const { return counters_->loads; }
+  std::size_t number_of_saves() const { return counters_->saves; }
+  const Serializer& serializer() const { return serializer_; }
+
+private:
+  Serializer serializer_;
+  std::shared_ptr<Counters> counters_;
+};
+
+// Generates points around `clusters` centers drawn uniformly in a bbox, with normally distributed offsets
+// of standard deviation `sigma` times the bbox extent along each axis. Points are clamped to the bbox.
+// This mimics the strongly non-uniform tile loads of real-world datasets (urban LiDAR, astronomy...).
+template<typename Point>
+class Clustered_points_in_bbox
+{
+  typedef CGAL::DDT::Kernel_traits<Point> Traits;
+  typedef typename Traits::Bbox           Bbox;
+
+public:
+  Clustered_points_in_bbox(const Bbox& bbox, std::size_t clusters, double sigma, unsigned int seed)
+    : bbox_(bbox), sigma_(sigma), gen_(seed), coords_(bbox.dimension())
+  {
+    int D = bbox_.dimension();
+    std::uniform_real_distribution<> uniform;
+    centers_.resize(std::max<std::size_t>(clusters, 1) * D);
+    for(std::size_t i = 0; i < centers_.size(); ++i)
+      centers_[i] = bbox_.min(i%D) + uniform(gen_)*(bbox_.max(i%D)-bbox_.min(i%D));
+    next();
+  }
+
+  const Point& operator*() const { return point_; }
+  const Point* operator->() const { return &point_; }
+  Clustered_points_in_bbox& operator++() { next(); return *this; }
+
+private:
+  void next() {
+    int D = bbox_.dimension();
+    std::size_t c = std::uniform_int_distribution<std::size_t>(0, centers_.size()/D - 1)(gen_);
+    for(int i=0; i<D; ++i) {
+      double x = centers_[c*D+i] + normal_(gen_)*sigma_*(bbox_.max(i)-bbox_.min(i));
+      coords_[i] = std::clamp(x, bbox_.min(i), bbox_.max(i));
+    }
+    CGAL::DDT::assign(point_, coords_.begin(), coords_.end());
+  }
+
+  Bbox bbox_;
+  double sigma_;
+  std::mt19937 gen_;
+  std::normal_distribution<> normal_;
+  std::vector<double> centers_;
+  std::vector<double> coords_;
+  Point point_;
+};
+
+// Runs the insertion of a reproducible synthetic point set in a distributed Delaunay triangulation,
+// and appends one CSV row per repetition with the timing, memory, communication and serialization counters.
+// Strong scaling is benchmarked with a fixed `--points` count and weak scaling with a fixed `--points-per-tile` count.
+template<
+        class Triangulation,
+        class TileIndexProperty,
+        class Partitioner,
+        class Scheduler>
+int DDT_benchmark(int argc, char **argv, const std::string& scheduler_name)
+{
+  typedef typename Partitioner::Point                                                 Point;
+  typedef typename Partitioner::Tile_index                                            Tile_index;
+  typedef CGAL::DDT::Kernel_traits<Point>                                             Traits;
+  typedef typename Traits::Bbox                                                       Bbox;
+  typedef Counting_serializer<CGAL::DDT::File_points_serializer>                      Serializer;
+  typedef CGAL::Distributed_triangulation<Triangulation, TileIndexProperty, Serializer> Distributed_triangulation;
+  typedef typename Distributed_triangulation::Tile_triangulation                      Tile_triangulation;
+  typedef typename Tile_triangulation::Vertex_index                                   Tile_vertex_index;
+  typedef CGAL::DDT::Uniform_point_in_bbox_generator<Point>                           Uniform_generator;
+  typedef CGAL::DDT::Random_point_set<Uniform_generator>                              Uniform_point_set;
+  typedef typename Traits::template Point_set_with_id<Tile_index>                     Point_set;
+  typedef CGAL::Distributed_point_set<Point_set, CGAL::DDT::Internal_property_map<Point_set>> Clustered_point_set;
+
+  std::size_t NP, NPT, clusters;
+  int max_concurrency, max_number_of_tiles, repeat;
+  std::vector<int> NT;
+  std::string distribution, csv, label, ser;
+  double sigma;
+  int dimension = Traits::D;
+  unsigned int seed;
+
+  po::options_description desc("Allowed options");
+  desc.add_options()
+  ("help,h", "produce help message")
+  ("points,p", po::value<std::size_t>(&NP)->default_value(100000), "total number of points (strong scaling)")
+  ("points-per-tile", po::value<std::size_t>(&NPT)->default_value(0), "number of points per tile, overrides --points (weak scaling)")
+  ("tiles,t", po::value<std::vector<int>>(&NT), "number of tiles along each axis")
+  ("distribution", po::value<std::string>(&distribution)->default_value("uniform"), "point distribution : uniform or clustered")
+  ("clusters", po::value<std::size_t>(&clusters)->default_value(16), "number of clusters of the clustered distribution")
+  ("sigma", po::value<double>(&sigma)->default_value(0.05), "relative standard deviation of the clustered distribution")
+  ("seed", po::value<unsigned int>(&seed)->default_value(0), "seed of the random point generator")
+  ("max_concurrency,j", po::value<int>(&max_concurrency)->default_value(0), "maximum concurrency (0=automatic)")
+  ("memory,m", po::value<int>(&max_number_of_tiles)->default_value(0), "max number of tiles in memory (0=unlimited)")
+  ("serialize,s", po::value<std::string>(&ser), "directory for tile serialization")
+  ("repeat,n", po::value<int>(&repeat)->default_value(1), "number of repetitions")
+  ("csv", po::value<std::string>(&csv), "CSV file where results are appended (default: standard output)")
+  ("label", po::value<std::string>(&label)->default_value(""), "free label identifying the run (e.g. commit hash)")
+  ;
+
+  if ( Traits::D == 0 )
+      desc.add_options()
+      ("dimension,d", po::value<int>(&dimension)->default_value(4), "ambient dimension");
+
+  po::variables_map vm;
+  try
+  {
+      po::store(po::parse_command_line(argc, argv, desc), vm);
+      if ( vm.count("help")  )
+      {
+          std::cout << "Distributed Delaunay Triangulation benchmark" << std::endl
+                    << desc << std::endl;
+          return 0;
+      }
+      po::notify(vm);
+      if ( distribution != "uniform" && distribution != "clustered" ) {
+          std::cerr << "Unknown distribution : " << distribution << std::endl;
+          return -1;
+      }
+      if ( (int)(NT.size()) > dimension )
+          NT.resize(dimension);
+  }
+  catch(po::error& e)
+  {
+      std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+      std::cerr << desc << std::endl;
+      return -1;
+  }
+
+  std::vector<double> coord0(dimension, -1);
+  std::vector<double> coord1(dimension,  1);
+  Bbox bbox;
+  CGAL::DDT::assign(bbox, coord0.begin(), coord0.end(), coord1.begin(), coord1.end());
+  Partitioner partitioner(1, bbox, NT.begin(), NT.end());
+  if (NPT > 0) NP = NPT * partitioner.size();
+
+  std::string grid;
+  for(int i = 0; i < dimension; ++i)
+    grid += (i ? "x" : "") + std::to_string(i < (int)NT.size() ? NT[i] : (NT.empty() ? 1 : NT.back()));
+
+  // the CSV header is only written to new files, so that successive runs may be appended
+  std::ofstream csv_file;
+  bool header = true;
+  if (!csv.empty()) {
+    header = !std::ifstream(csv).good();
+    csv_file.open(csv, std::ios::app);
+  }
+  std::ostream& out = csv_file.is_open() ? csv_file : std::cout;
+  if (header)
+    out << "label,program,scheduler,dimension,distribution,seed,tiles,grid,memory_tiles,concurrency,points,"
+           "vertices,foreign_vertices,time_s,points_per_s,peak_rss_bytes,loads,saves" << std::endl;
+
+  CGAL::Memory_sizer memory;
+  for(int r = 0; r < repeat; ++r)
+  {
+    std::size_t peak_rss = memory.resident_size();
+    Scheduler scheduler(max_concurrency);
+    Serializer serializer{CGAL::DDT::File_points_serializer(ser)};
+    Distributed_triangulation tri(dimension, {}, max_number_of_tiles, serializer);
+
+    CGAL::Real_timer timer;
+    std::size_t count = 0;
+    if (distribution == "uniform") {
+      Uniform_point_set ps(NP, bbox, seed);
+      auto points = CGAL::DDT::make_distributed_point_set(ps, partitioner);
+      peak_rss = std::max(peak_rss, memory.resident_size());
+      timer.start();
+      count = tri.insert(points, scheduler);
+      timer.stop();
+    } else {
+      Clustered_points_in_bbox<Point> generator(bbox, clusters, sigma, seed);
+      Clustered_point_set points;
+      points.insert(generator, NP, partitioner);
+      peak_rss = std::max(peak_rss, memory.resident_size());
+      timer.start();
+      count = tri.insert(points, scheduler);
+      timer.stop();
+    }
+    peak_rss = std::max(peak_rss, memory.resident_size());
+    std::size_t loads = serializer.number_of_loads();
+    std::size_t saves = serializer.number_of_saves();
+
+    // Each foreign vertex of a tile has been received from another tile during the star splaying,
+    // so their total count is a lower bound of the point message volume.
+    std::size_t foreign = scheduler.ranges_reduce(tri.tiles, [](auto first, auto last) {
+      std::size_t n = 0;
+      const Tile_triangulation& t = first->second;
+      for(Tile_vertex_index v = t.vertices_begin(); v != t.vertices_end(); ++v)
+        if(!t.vertex_is_infinite(v) && t.vertex_is_foreign(v)) ++n;
+      return n;
+    }, std::size_t(0), std::plus<>());
+
+    double time = timer.time();
+    out << label << "," << argv[0] << "," << scheduler_name << "," << dimension << "," << distribution << ","
+        << seed << "," << partitioner.size() << "," << grid << "," << max_number_of_tiles << ","
+        << scheduler.max_concurrency() << "," << NP << "," << count << "," << foreign << ","
+        << time << "," << (time > 0 ? NP/time : 0.) << "," << peak_rss << ","
+        << loads << "," << saves << std::endl;
+  }
+  return 0;
+}
+
+#endif // CGAL_DDT_BENCHMARK_H
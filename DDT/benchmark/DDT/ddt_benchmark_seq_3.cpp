@@ -0,0 +1,25 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/DDT/triangulation/Delaunay_triangulation_3.h>
+#include <CGAL/DDT/property_map/Vertex_info_property_map.h>
+#include <CGAL/DDT/partitioner/Grid_partitioner.h>
+#include <CGAL/DDT/scheduler/Sequential_scheduler.h>
+
+#include "DDT_benchmark.h"
+
+typedef int Tile_index;
+typedef CGAL::Exact_predicates_inexact_constructions_kernel                  Geom_traits;
+typedef CGAL::Triangulation_vertex_base_with_info_3<Tile_index, Geom_traits> Vb;
+typedef CGAL::Triangulation_data_structure_3<Vb>                             TDS;
+typedef CGAL::Delaunay_triangulation_3<Geom_traits, TDS>                     Triangulation;
+typedef CGAL::DDT::Vertex_info_property_map<Triangulation>                   TileIndexProperty;
+typedef Geom_traits::Point_3                                                 Point;
+
+int main(int argc, char **argv) {
+    return DDT_benchmark<
+            Triangulation,
+            TileIndexProperty,
+            CGAL::DDT::Grid_partitioner<Tile_index, Point>,
+            CGAL::DDT::Sequential_scheduler
+            >(argc, argv, "sequential");
+}
@@ -0,0 +1,25 @@
+#include <CGAL/Epick_d.h>
+#include <CGAL/DDT/triangulation/Delaunay_triangulation.h>
+#include <CGAL/DDT/property_map/Vertex_data_property_map.h>
+#include <CGAL/DDT/partitioner/Grid_partitioner.h>
+#include <CGAL/DDT/scheduler/TBB_scheduler.h>
+
+#include "DDT_benchmark.h"
+
+typedef int Tile_index;
+typedef CGAL::Dynamic_dimension_tag                               Dim_tag;
+typedef CGAL::Epick_d<Dim_tag>                                    Geom_traits;
+typedef CGAL::Triangulation_vertex<Geom_traits,Tile_index>        Vb;
+typedef CGAL::Triangulation_data_structure<Dim_tag,Vb>            TDS;
+typedef CGAL::Delaunay_triangulation<Geom_traits, TDS>            Triangulation;
+typedef CGAL::DDT::Vertex_data_property_map<Triangulation>        TileIndexProperty;
+typedef Geom_traits::Point_d                                      Point;
+
+int main(int argc, char **argv) {
+    return DDT_benchmark<
+            Triangulation,
+            TileIndexProperty,
+            CGAL::DDT::Grid_partitioner<Tile_index, Point>,
+            CGAL::DDT::TBB_scheduler
+            >(argc, argv, "tbb");
+}
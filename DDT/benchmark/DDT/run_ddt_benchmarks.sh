@@ -0,0 +1,65 @@
+#!/bin/bash
+
+# Usage run_ddt_benchmarks.sh [results.csv] [label]
+#   Sweeps the DDT benchmarks over dimensions, schedulers, tile counts, point distributions
+#   and memory budgets, and appends one CSV row per run to the result file.
+#   The label (default: the current git commit) identifies the runs, so that strong and
+#   weak scaling regressions can be tracked over time by comparing rows with the same parameters.
+
+# Requirement: the ddt_benchmark_* executables, built from this directory, in the current directory.
+
+CSV=${1:-ddt_benchmarks.csv}
+LABEL=${2:-`git rev-parse --short HEAD 2>/dev/null`}
+SEED=0
+POINTS=1000000
+POINTS_PER_TILE=100000
+
+run() {
+  EXE=$1
+  shift
+  if [ -x ./${EXE} ]
+  then
+    ./${EXE} --csv ${CSV} --label "${LABEL}" --seed ${SEED} "$@" || echo "FAILED: ${EXE} $@"
+  fi
+}
+
+for SCHEDULER in seq tbb
+do
+  for DISTRIBUTION in uniform clustered
+  do
+    # strong scaling: fixed number of points, increasing number of tiles
+    for T in 1 2 4 8
+    do
+      run ddt_benchmark_${SCHEDULER}_2 --distribution ${DISTRIBUTION} -p ${POINTS} -t ${T}
+      run ddt_benchmark_${SCHEDULER}_3 --distribution ${DISTRIBUTION} -p ${POINTS} -t ${T}
+    done
+
+    # weak scaling: fixed number of points per tile, increasing number of tiles
+    for T in 1 2 4 8
+    do
+      run ddt_benchmark_${SCHEDULER}_2 --distribution ${DISTRIBUTION} --points-per-tile ${POINTS_PER_TILE} -t ${T}
+      run ddt_benchmark_${SCHEDULER}_3 --distribution ${DISTRIBUTION} --points-per-tile ${POINTS_PER_TILE} -t ${T}
+    done
+
+    # dD, with fewer points as the triangulation size grows quickly with the dimension
+    for D in 2 3 4
+    do
+      run ddt_benchmark_${SCHEDULER}_d --distribution ${DISTRIBUTION} -d ${D} -p $((POINTS/100)) -t 2
+    done
+    # static dimension 4, which uses the bulk insertion of full dimensional triangulations
+    run ddt_benchmark_${SCHEDULER}_d4 --distribution ${DISTRIBUTION} -p $((POINTS/100)) -t 2
+
+    # out-of-core: limited number of tiles in memory (only supported by the sequential scheduler for now)
+    if [ ${SCHEDULER} = seq ]
+    then
+      for M in 0 16 4
+      do
+        run ddt_benchmark_${SCHEDULER}_2 --distribution ${DISTRIBUTION} -p ${POINTS} -t 8 -m ${M}
+      done
+    fi
+
+    # partitioning: same number of tiles, with different grid shapes
+    run ddt_benchmark_${SCHEDULER}_2 --distribution ${DISTRIBUTION} -p ${POINTS} -t 16 1
+    run ddt_benchmark_${SCHEDULER}_2 --distribution ${DISTRIBUTION} -p ${POINTS} -t 4 4
+  done
+done
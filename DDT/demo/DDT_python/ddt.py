@@ -1,101 +1,53 @@
 #!/usr/bin/env python
 
-from itertools import islice, count
-from pyddt import *
-import random
+import numpy as np
 import os
 import sys
-
-
+import time
+from pyddt import *
 
 print("\n\n======= Start computation ======")
 # Params
 
-nb_threads=1
+number_of_points = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+nb_tile_side = 5
+nb_threads = 0
 extent = 1
-nb_tile_side=5
 
-Dim=2
-bbox = Bbox(-extent,extent)
-rand_points = Random_points(2,extent)
-tri1 = DDT(nb_threads)
-number_of_vertex=3000
-test_io = False
+try:
+    scheduler = TBB_scheduler(nb_threads)
+except NameError:
+    scheduler = Sequential_scheduler()
 
-## usefull function
-def dump_vrt(output_path_vrt,tt) :
-    if(not os.path.isdir(output_path_vrt)):
-        os.mkdir(output_path_vrt)
-    tt.write_vrt_cells(output_path_vrt)
-    tt.write_vrt_verts(output_path_vrt)
-    tt.write_vrt_bbox(output_path_vrt + "/bbox.vrt")
-    tt.write_vrt_bbox_vert(output_path_vrt +  "/bbox_vert.vrt")
-    tt.write_vrt_vert(output_path_vrt + "/out_full_vert.vrt")
-    tt.write_vrt_cell(output_path_vrt +  "/out_full_cell.vrt")
-    tt.write_vrt_facet(output_path_vrt +  "/out_full_facet.vrt")
-    #tt.write_json_tri(output_path_vrt +  "/full_tri.json")
+# Points are read in place from any (n, 2) float64 array, including strided views : no copy is made
+rng = np.random.default_rng(0)
+points = rng.uniform(-extent, extent, size=(number_of_points, 2))
 
-# Insertion
-tri1.send_points(rand_points, number_of_vertex, Grid_partitioner(bbox,nb_tile_side))
-print(tri1.insert_received_points(True))
-print(tri1.send_all_axis_extreme_points())
-print(tri1.splay_stars())
-tri1.finalize()
+partitioner = Grid_partitioner_2((-extent, -extent, extent, extent), nb_tile_side)
+tri = Distributed_triangulation_2()
 
-print("Is tri1 valid? " + str(tri1.is_valid()))
+# Insertion
+start = time.time()
+inserted = tri.insert(points, partitioner, scheduler)
+print("inserted %d points in %.3fs" % (inserted, time.time() - start))
+print("Is tri valid? " + str(tri.is_valid()))
 
 #### Output ########
-nbc=tri1.number_of_cells()
-nbv=tri1.number_of_vertices()
-nbf=tri1.number_of_facets()
-ee=nbv-nbf+nbc
-print("number of cells     :" + str(nbc))
-print("number of vertices  :" + str(nbv))
-print("number of facets    :" + str(nbf))
-print("Euler : Vertices - facets + Cells = " + str(ee))
-
+print("number of tiles          : " + str(tri.number_of_tiles()))
+print("number of finite vertices: " + str(tri.number_of_finite_vertices()))
+print("number of finite cells   : " + str(tri.number_of_finite_cells()))
+
+# Vertices and cells as contiguous arrays, built per tile in parallel
+start = time.time()
+vertices, tiles, cells = tri.mesh(scheduler)
+print("mesh arrays built in %.3fs" % (time.time() - start))
+print("vertices: " + str(vertices.shape) + ", cells: " + str(cells.shape))
+assert len(vertices) == tri.number_of_finite_vertices() and len(cells) == tri.number_of_finite_cells()
+assert cells.min() >= 0 and cells.max() < len(vertices)
 
 #### Dump vrt for visualization
-print("=== Dump vrt / json ===")
-dump_vrt("./python/",tri1)
-
-### Dump tri1angulation
-if test_io :  
-    print("=== Dump CGAL ===")
-    output_path_cgal="./cgal/"
-    if(not os.path.isdir(output_path_cgal)):
-        os.mkdir(output_path_cgal)
-    tri1.write_cgal(output_path_cgal)
-    ### Load triangulation
-    print("=== Load triangulation === ")
-    # Load with file dir
-    tri2 = DDT(nb_threads)
-    print("=== read cgal === ")
-    tri2.read_cgal(output_path_cgal)
-    print("=== read cgal done === ")
-    dump_vrt("./vrt_2/",tri2);
-    print("=== Load triangulation done === ")
-    print("Is tri1 valid? " + tri2.is_valid())
-
-
-
-# c = 0
-# for tile in tri1.tiles():
-#     tid = tile.id()
-#     for cell in tile.cells():
-#         p = cell.point(0)
-#         c = c + 1
-
-
-
-# c = 0
-# for tile in tri1.tiles():
-#     tid = tile.id()
-#     for cell in tile.cells():
-#         if not cell.is_infinite():
-#             p = cell.point(0)
-#             c = c+1
-
-        
-tri1.write_adjacency_graph_dot("./python/quotient_u.dot", False)
-tri1.write_adjacency_graph_dot("./python/quotient_d.dot", True)
+print("=== Dump vrt ===")
+output_path_vrt = "./python/"
+if not os.path.isdir(output_path_vrt):
+    os.mkdir(output_path_vrt)
+tri.write_vrt(output_path_vrt, scheduler)
@@ -1,302 +1,238 @@
-#include <CGAL/DDT/Tile.h>
-#include <CGAL/DDT/IO/read.h>
-#include <CGAL/DDT/IO/write.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/DDT/triangulation/Delaunay_triangulation_2.h>
+#include <CGAL/DDT/triangulation/Delaunay_triangulation_3.h>
+#include <CGAL/DDT/property_map/Vertex_info_property_map.h>
+#include <CGAL/DDT/partitioner/Const_partitioner.h>
+#include <CGAL/DDT/partitioner/Grid_partitioner.h>
+#include <CGAL/DDT/scheduler/Sequential_scheduler.h>
+#ifdef CGAL_LINKED_WITH_TBB
+#include <CGAL/DDT/scheduler/TBB_scheduler.h>
+#endif
+#include <CGAL/Distributed_triangulation.h>
+#include <CGAL/DDT/point_set/Array_point_set.h>
+#include <CGAL/DDT/serializer/VRT_file_serializer.h>
+#include <CGAL/DDT/IO/write_arrays.h>
+#include <CGAL/DDT/IO/write_ply.h>
 
-#include <vector>
 #include <boost/python.hpp>
-#include <sstream>
+#include <boost/python/numpy.hpp>
 
-typedef int Id;
-typedef int Flag;
-//
+#include <cstdint>
+#include <string>
+#include <vector>
 
-#include <CGAL/DDT/triangulation/Delaunay_triangulation.h>
-typedef CGAL::DDT::Triangulation_traits_d<2,Id,Flag> Traits;
-typedef Traits::Random_points_in_box Random_points;
+namespace p  = boost::python;
+namespace np = boost::python::numpy;
 
+typedef int Tile_index;
+typedef CGAL::Exact_predicates_inexact_constructions_kernel                    Geom_traits;
 
-typedef CGAL::DDT::Tile<Traits> Tile;
+typedef CGAL::Triangulation_vertex_base_with_info_2<Tile_index, Geom_traits>   Vb_2;
+typedef CGAL::Triangulation_data_structure_2<Vb_2>                             TDS_2;
+typedef CGAL::Delaunay_triangulation_2<Geom_traits, TDS_2>                     Triangulation_2;
 
-class py_vertex_iterator
-{
-private:
-    Tile::Vertex_iterator v;
-    const Tile& tile;
+typedef CGAL::Triangulation_vertex_base_with_info_3<Tile_index, Geom_traits>   Vb_3;
+typedef CGAL::Triangulation_data_structure_3<Vb_3>                             TDS_3;
+typedef CGAL::Delaunay_triangulation_3<Geom_traits, TDS_3>                     Triangulation_3;
 
-public:
-    using iterator_category = std::forward_iterator_tag;
-    using value_type = py_vertex_iterator;
-    using difference_type = std::ptrdiff_t;
-    using pointer = value_type*;
-    using reference = value_type&;
+typedef CGAL::DDT::Sequential_scheduler Sequential_scheduler;
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::DDT::TBB_scheduler TBB_scheduler;
+#endif
 
-    py_vertex_iterator(Tile::Vertex_iterator i, const Tile& t) : v(i), tile(t) {}
-    py_vertex_iterator(const py_vertex_iterator& i) : v(i.v), tile(i.tile) {}
-
-    py_vertex_iterator& operator++()
-    {
-        ++v;
-        return *this;
-    }
-
-    py_vertex_iterator operator++(int)
-    {
-        py_vertex_iterator tmp(*this);
-        operator++();
-        return tmp;
-    }
-
-    bool operator==(const py_vertex_iterator& rhs) const { return v==rhs.v; }
-    bool operator!=(const py_vertex_iterator& rhs) const { return v!=rhs.v; }
-
-    py_vertex_iterator& operator*() { return *this; }
-
-    boost::python::tuple point() const
-    {
-        const Tile::Point& p = tile.point(v);
-        return boost::python::make_tuple(p[0], p[1], tile.vertex_id(v));
-    }
+// releases the Python global interpreter lock while the scheduler computes, so that other Python threads may run.
+// No Python object may be accessed while the lock is released.
+struct Release_gil
+{
+    Release_gil() : state(PyEval_SaveThread()) {}
+    ~Release_gil() { PyEval_RestoreThread(state); }
+    PyThreadState* state;
 };
 
-class py_cell_iterator
+inline void throw_value_error(const std::string& msg)
 {
-private:
-    Tile::Cell_iterator c;
-    const Tile& tile;
-
-public:
-    using iterator_category = std::forward_iterator_tag;
-    using value_type = py_cell_iterator;
-    using difference_type = std::ptrdiff_t;
-    using pointer = value_type*;
-    using reference = value_type&;
-
-    py_cell_iterator(Tile::Cell_iterator i, const Tile& t) : c(i), tile(t) {}
-    py_cell_iterator(const py_cell_iterator& i) : c(i.c), tile(i.tile) {}
-
-    py_cell_iterator& operator++()
-    {
-        ++c;
-        return *this;
-    }
-
-    py_cell_iterator operator++(int)
-    {
-        py_cell_iterator tmp(*this);
-        operator++();
-        return tmp;
-    }
-
-    bool operator==(const py_cell_iterator& rhs) const { return c==rhs.c; }
-    bool operator!=(const py_cell_iterator& rhs) const { return c!=rhs.c; }
-
-    py_cell_iterator& operator*()
-    {
-        return *this;
-    }
+    PyErr_SetString(PyExc_ValueError, msg.c_str());
+    p::throw_error_already_set();
+}
 
-    boost::python::tuple point(int iv) const
-    {
-        Tile::Vertex_const_handle v = tile.vertex(c, iv);
-        Tile::Point p = tile.point(v);
-        return boost::python::make_tuple(p[0], p[1], tile.vertex_id(v));
-    }
+// constructs a view of a (n, D) float64 NumPy array, using its strides so that sliced or transposed arrays are not copied
+template<typename Point>
+CGAL::DDT::Array_point_set<Point> make_array_point_set(const np::ndarray& points, int D)
+{
+    if (points.get_dtype() != np::dtype::get_builtin<double>())
+        throw_value_error("points must be a float64 array");
+    if (points.get_nd() != 2 || points.shape(1) != D)
+        throw_value_error("points must be an array of shape (n, " + std::to_string(D) + ")");
+    Py_intptr_t row_stride    = points.strides(0);
+    Py_intptr_t column_stride = points.strides(1);
+    if (row_stride % sizeof(double) || column_stride % sizeof(double))
+        throw_value_error("points must have strides that are multiples of 8 bytes");
+    return { reinterpret_cast<const double*>(points.get_data()), D,
+             std::ptrdiff_t(row_stride / Py_intptr_t(sizeof(double))), std::ptrdiff_t(column_stride / Py_intptr_t(sizeof(double))),
+             0, std::size_t(points.shape(0)) };
+}
 
-    inline bool is_infinite() const
-    {
-        return tile.cell_is_infinite(c);
-    }
-};
+template<typename Bbox>
+Bbox make_bbox(const p::object& bbox, int D)
+{
+    if (p::len(bbox) != 2*D)
+        throw_value_error("bbox must be a sequence of " + std::to_string(2*D) + " coordinates (minimum coordinates, then maximum coordinates)");
+    std::vector<double> coords;
+    for(int i = 0; i < 2*D; ++i)
+        coords.push_back(p::extract<double>(bbox[i]));
+    Bbox b;
+    CGAL::DDT::assign(b, coords.begin(), coords.begin()+D, coords.begin()+D, coords.end());
+    return b;
+}
 
-class py_point_iterator
+template<typename Partitioner>
+std::shared_ptr<Partitioner> make_grid_partitioner(const p::object& bbox, const p::object& tiles, Tile_index id0)
 {
-private:
-    const boost::python::list& points;
-    int i;
-    Tile::Point p;
+    typedef typename CGAL::DDT::Kernel_traits<typename Partitioner::Point>::Bbox Bbox;
+    constexpr int D = CGAL::DDT::Kernel_traits<typename Partitioner::Point>::D;
+    Bbox b = make_bbox<Bbox>(bbox, D);
+    p::extract<int> n(tiles);
+    if (n.check())
+        return std::make_shared<Partitioner>(id0, b, std::size_t(n()));
+    std::vector<int> nt;
+    for(int i = 0; i < p::len(tiles); ++i)
+        nt.push_back(p::extract<int>(tiles[i]));
+    return std::make_shared<Partitioner>(id0, b, nt.begin(), nt.end());
+}
 
+// Python wrapper of a distributed triangulation, whose tiles are kept in memory.
+template<typename DistributedTriangulation>
+class py_DDT : public DistributedTriangulation
+{
 public:
-    using iterator_category = std::forward_iterator_tag;
-    using value_type = Tile::Point;
-    using difference_type = std::ptrdiff_t;
-    using pointer = value_type*;
-    using reference = value_type&;
+    typedef typename DistributedTriangulation::Tile_triangulation Tile_triangulation;
+    typedef typename Tile_triangulation::Point                    Point;
+    static constexpr int D = CGAL::DDT::Kernel_traits<Point>::D;
 
-    py_point_iterator(const boost::python::list& p) : points(p), i(0) {}
-    py_point_iterator(const py_point_iterator& p) : points(p.points), i(p.i) {}
+    py_DDT() : DistributedTriangulation(D) {}
 
-    py_point_iterator& operator++()
+    // triangulates the rows of a (n, D) float64 NumPy array, without copying them
+    template<typename Partitioner, typename Scheduler>
+    std::size_t insert(const np::ndarray& points, const Partitioner& partitioner, Scheduler& sch)
     {
-        i+=2;
-        return *this;
+        CGAL::DDT::Array_point_set<Point> ps = make_array_point_set<Point>(points, D);
+        Release_gil unlocked;
+        auto dpoints = CGAL::DDT::make_distributed_point_set(ps, partitioner, sch);
+        return DistributedTriangulation::insert(dpoints, sch);
     }
 
-    py_point_iterator operator++(int)
+    // returns the (points, tiles, cells) arrays of the indexed mesh of the finite main vertices and cells
+    template<typename Scheduler>
+    p::tuple mesh(Scheduler& sch) const
     {
-        py_point_iterator tmp(*this);
-        operator++();
-        return tmp;
+        std::unique_ptr<CGAL::DDT::Array_writer<DistributedTriangulation>> writer;
+        {
+            Release_gil unlocked;
+            writer = std::make_unique<CGAL::DDT::Array_writer<DistributedTriangulation>>(*this, sch);
+        }
+        std::size_t nv = writer->number_of_vertices();
+        std::size_t nc = writer->number_of_cells();
+        np::ndarray points = np::empty(p::make_tuple(nv, D),   np::dtype::get_builtin<double>());
+        np::ndarray tiles  = np::empty(p::make_tuple(nv),      np::dtype::get_builtin<Tile_index>());
+        np::ndarray cells  = np::empty(p::make_tuple(nc, D+1), np::dtype::get_builtin<std::int64_t>());
+        double* p_points = reinterpret_cast<double*>(points.get_data());
+        Tile_index* p_tiles = reinterpret_cast<Tile_index*>(tiles.get_data());
+        std::int64_t* p_cells = reinterpret_cast<std::int64_t*>(cells.get_data());
+        {
+            Release_gil unlocked;
+            writer->write_vertices(*this, sch, p_points, p_tiles);
+            writer->write_cells(*this, sch, p_cells);
+        }
+        return p::make_tuple(points, tiles, cells);
     }
 
-    bool operator==(const py_point_iterator& rhs) const { return i==rhs.i; }
-    bool operator!=(const py_point_iterator& rhs) const { return i!=rhs.i; }
-
-    Tile::Point operator*()
+    template<typename Scheduler>
+    bool write_vrt(const std::string& dirname, Scheduler& sch) const
     {
-        double x = boost::python::extract<double>(points[i  ]);
-        double y = boost::python::extract<double>(points[i+1]);
-        return p = Tile::Point(x,y);
+        Release_gil unlocked;
+        return this->write(CGAL::DDT::VRT_serializer(dirname), sch);
     }
-};
-
-class py_tile : public Tile
-{
-public:
-    py_tile(int id, int dimension = D) : Tile(id, dimension) {}
-
-    py_vertex_iterator py_vertices_begin() const { return py_vertex_iterator(vertices_begin(), *this); }
-    py_vertex_iterator py_vertices_end  () const { return py_vertex_iterator(vertices_end  (), *this); }
-
-    py_cell_iterator py_cells_begin() const { return py_cell_iterator(cells_begin(), *this); }
-    py_cell_iterator py_cells_end()   const { return py_cell_iterator(cells_end  (), *this); }
-};
-
-#include <CGAL/DDT/scheduler/Multithread_scheduler.h>
-typedef CGAL::DDT::Multithread_scheduler<py_tile> Scheduler;
 
-#include <CGAL/DDT.h>
-class py_DDT : public CGAL::DDT::DDT<Traits, Scheduler, py_tile>
-{
-private:
-    typedef CGAL::DDT::DDT<Traits, Scheduler, py_tile> DDT;
-
-public:
-    py_DDT(int max_concurrency=0) : DDT(max_concurrency) {}
-
-    boost::python::tuple py_vertex(int id) const
+    void write_ply(const std::string& filename) const
     {
-        Vertex_iterator v = vertices_begin();
-        v += id;
-        Point p = point(v);
-        return boost::python::make_tuple(p[0], p[1], tile_id(v));
+        Release_gil unlocked;
+        CGAL::DDT::write_ply(*this, filename);
     }
 
-    boost::python::tuple py_cell(int id) const
+    bool is_valid() const
     {
-        Cell_iterator c = cells_begin();
-        c += id;
-        Tile_const_iterator tile = c.tile();
-        std::vector<int> vid;
-        assert(tile->current_dimension() == 2);
-        for(int d = 0; d <= tile->current_dimension(); ++d)
-        {
-            Vertex_iterator vit = main(vertex(c, d));
-            vid.push_back(vertex_id(vit));
-        }
-
-        return boost::python::make_tuple(vid[0], vid[1], vid[2]);
+        Release_gil unlocked;
+        return DistributedTriangulation::is_valid();
     }
 
-//    void write_vrt_ring(int id, int deg)
-//    {
-//        auto c = cells_begin();
-//        c += id;
-//        std::string filename(std::string("./vrt/ring_") +
-//                             std::to_string(id)+ "_" + std::to_string(deg) +
-//                             std::string(".vrt"));
-
-//        std::set<Cell_iterator> lnb;
-//        get_ring(c, deg, lnb);
-//        write_vrt_cell_range(lnb.begin(), lnb.end(), filename);
-//    }
-
+    std::size_t number_of_tiles() const { return this->tiles.size(); }
 };
 
-#include <CGAL/DDT/partitioner/Const_partitioner.h>
-#include <CGAL/DDT/partitioner/Grid_partitioner.h>
-#include <CGAL/DDT/partitioner/Random_partitioner.h>
-typedef CGAL::DDT::Const_partitioner<Traits> Const_partitioner;
-typedef CGAL::DDT::Grid_partitioner<Traits> Grid_partitioner;
-typedef CGAL::DDT::Random_partitioner<Traits> Random_partitioner;
-
-typedef CGAL::DDT::Bbox<Traits::D, double> Bbox;
-
-template<typename Iterator, typename Param, typename Partitioner>
-inline void send_points(py_DDT& tri, Param p, int count, Partitioner& part)
+template<typename Scheduler, typename Class>
+void def_scheduler(Class& c)
 {
-    tri.send_points(Iterator(p), count, part);
+    typedef typename Class::wrapped_type                             DDT;
+    typedef typename DDT::Point                                      Point;
+    typedef CGAL::DDT::Grid_partitioner<Tile_index, Point>           Grid_partitioner;
+    typedef CGAL::DDT::Const_partitioner<Tile_index, Point>          Const_partitioner;
+    c.def("insert", &DDT::template insert<Grid_partitioner, Scheduler>, (p::arg("points"), p::arg("partitioner"), p::arg("scheduler")),
+          "triangulates the rows of a (n, D) float64 array, without copying them, and returns the number of inserted vertices");
+    c.def("insert", &DDT::template insert<Const_partitioner, Scheduler>, (p::arg("points"), p::arg("partitioner"), p::arg("scheduler")));
+    c.def("mesh", &DDT::template mesh<Scheduler>, (p::arg("scheduler")),
+          "returns the (points, tiles, cells) arrays of the finite main vertices and cells, built per tile in parallel");
+    c.def("write_vrt", &DDT::template write_vrt<Scheduler>, (p::arg("dirname"), p::arg("scheduler")));
 }
 
-using namespace boost::python;
-BOOST_PYTHON_MODULE(pyddt)
+template<typename Triangulation>
+void def_dimension(const char* suffix)
 {
-    class_<Bbox>("Bbox", init<double,double>())
-    ;
-
-    class_<Const_partitioner>("Const_partitioner", init<Id>())
-    ;
-
-    class_<Grid_partitioner>("Grid_partitioner", init<Bbox,int>())
+    typedef CGAL::DDT::Vertex_info_property_map<Triangulation>       TileIndexProperty;
+    typedef CGAL::Distributed_triangulation<Triangulation, TileIndexProperty> Distributed_triangulation;
+    typedef py_DDT<Distributed_triangulation>                        DDT;
+    typedef typename DDT::Point                                      Point;
+    typedef CGAL::DDT::Grid_partitioner<Tile_index, Point>           Grid_partitioner;
+    typedef CGAL::DDT::Const_partitioner<Tile_index, Point>          Const_partitioner;
+    std::string s(suffix);
+
+    p::class_<Grid_partitioner, std::shared_ptr<Grid_partitioner>>(("Grid_partitioner" + s).c_str(), p::no_init)
+    .def("__init__", p::make_constructor(&make_grid_partitioner<Grid_partitioner>, p::default_call_policies(),
+         (p::arg("bbox"), p::arg("tiles"), p::arg("id0") = 1)))
+    .def("size", &Grid_partitioner::size)
     ;
 
-    class_<Random_partitioner>("Random_partitioner", init<Id,Id,unsigned int>())
+    p::class_<Const_partitioner>(("Const_partitioner" + s).c_str(), p::init<Tile_index>(p::arg("id")))
     ;
 
-    class_<Random_points>("Random_points", init<int,double>())
+    p::class_<DDT, boost::noncopyable> c(("Distributed_triangulation" + s).c_str(), p::init<>());
+    c.def("number_of_finite_vertices", &DDT::number_of_finite_vertices)
+     .def("number_of_finite_cells", &DDT::number_of_finite_cells)
+     .def("number_of_tiles", &DDT::number_of_tiles)
+     .def("is_valid", &DDT::is_valid)
+     .def("write_ply", &DDT::write_ply, (p::arg("filename")))
     ;
+    def_scheduler<Sequential_scheduler>(c);
+#ifdef CGAL_LINKED_WITH_TBB
+    def_scheduler<TBB_scheduler>(c);
+#endif
+}
 
-    class_<py_cell_iterator>("Cell", no_init)
-    .def("is_infinite", &py_cell_iterator::is_infinite)
-    .def("point", &py_cell_iterator::point)
-    ;
+BOOST_PYTHON_MODULE(pyddt)
+{
+    Py_Initialize();
+    np::initialize();
 
-    Id (py_tile::*Tile_id)() const = &py_tile::id;
-    class_<py_tile>("Tile", no_init)
-    .def("id", Tile_id)
-    .def("number_of_vertices", &py_tile::number_of_vertices)
-    .def("number_of_cells", &py_tile::number_of_cells)
-    .def("cells", range(&py_tile::py_cells_begin, &py_tile::py_cells_end))
-    .def("vertices", range(&py_tile::py_vertices_begin, &py_tile::py_vertices_end))
+    p::class_<Sequential_scheduler, boost::noncopyable>("Sequential_scheduler", p::init<p::optional<int>>(p::arg("max_concurrency")))
+    .def("max_concurrency", &Sequential_scheduler::max_concurrency)
     ;
 
-    py_DDT::Tile_const_iterator (py_DDT::*DDT_tiles_begin)() const = &py_DDT::tiles_begin;
-    py_DDT::Tile_const_iterator (py_DDT::*DDT_tiles_end)()   const = &py_DDT::tiles_end;
-    bool (py_DDT::*DDT_is_valid)()   const = &py_DDT::is_valid;
-
-    class_<py_DDT>("DDT", init<int>())
-    .def("send_points", &send_points<py_point_iterator, list, Random_partitioner>)
-    .def("send_points", &send_points<py_point_iterator, list, Grid_partitioner>)
-    .def("send_points", &py_DDT::send_points<Random_points, Random_partitioner>)
-    .def("send_points", &py_DDT::send_points<Random_points, Grid_partitioner>)
-    //.def("insert_received_points", &py_DDT::insert_received_points)
-    //.def("send_all_axis_extreme_points", &py_DDT::send_all_axis_extreme_points)
-    //.def("splay_stars", &py_DDT::splay_stars)
-    .def("read_cgal", &CGAL::DDT::read_cgal<py_DDT>)
-    .def("write_ply", &CGAL::DDT::write_ply<py_DDT>)
-    .def("write_cgal", &CGAL::DDT::write_cgal<py_DDT>)
-    .def("write_vrt_vert", &CGAL::DDT::write_vrt_vert<py_DDT>)
-    .def("write_vrt_cell", &CGAL::DDT::write_vrt_cell<py_DDT>)
-    .def("write_vrt_facet", &CGAL::DDT::write_vrt_facet<py_DDT>)
-    .def("write_vrt_cells", &CGAL::DDT::write_vrt_cells<py_DDT>)
-    .def("write_vrt_verts", &CGAL::DDT::write_vrt_verts<py_DDT>)
-    .def("write_vrt_bbox_vert", &CGAL::DDT::write_vrt_bbox_vert<py_DDT>)
-    .def("write_vrt_bbox", &CGAL::DDT::write_vrt_bbox<py_DDT>)
-    .def("write_vrt_tin", &CGAL::DDT::write_vrt_tin<py_DDT>)
-    .def("write_json_tri",&CGAL::DDT::write_geojson_tri<py_DDT>)
-    .def("write_adjacency_graph_dot", &CGAL::DDT::write_adjacency_graph_dot<py_DDT>)
-//    .def("write_vrt_ring", &py_DDT::write_vrt_ring)
-    .def("number_of_cells", &py_DDT::number_of_cells)
-    .def("number_of_vertices", &py_DDT::number_of_vertices)
-    .def("number_of_facets", &py_DDT::number_of_facets)
-    .def("is_adjacency_graph_symmetric", &py_DDT::is_adjacency_graph_symmetric)
-    .def("tiles", range(DDT_tiles_begin, DDT_tiles_end))
-    // .def("cells", range(&py_DDT::cells_begin,&py_DDT::cells_end)) // Cell_iterator::operator* does not exist
-    .def("vertex", &py_DDT::py_vertex)
-    .def("cell", &py_DDT::py_cell)
-    .def("is_valid", DDT_is_valid)
-    .def("finalize", &py_DDT::finalize)
+#ifdef CGAL_LINKED_WITH_TBB
+    p::class_<TBB_scheduler, boost::noncopyable>("TBB_scheduler", p::init<p::optional<int>>(p::arg("max_concurrency")))
+    .def("max_concurrency", &TBB_scheduler::max_concurrency)
     ;
+#endif
 
-
-
+    def_dimension<Triangulation_2>("_2");
+    def_dimension<Triangulation_3>("_3");
 }
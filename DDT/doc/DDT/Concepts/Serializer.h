@@ -14,6 +14,7 @@ MB: it is currently used for many things : initial loading of an immutable datas
 \cgalHasModels{CGAL::DDT::No_serializer}
 \cgalHasModels{CGAL::DDT::File_serializer}
 \cgalHasModels{CGAL::DDT::File_points_serializer}
+\cgalHasModels{CGAL::DDT::Binary_points_serializer}
 \cgalHasModelsEnd
 
 */
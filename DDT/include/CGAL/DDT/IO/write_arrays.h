@@ -0,0 +1,191 @@
+// Copyright (c) 2022 Institut Géographique National - IGN (France)
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Mathieu Brédif and Laurent Caraffa
+
+#ifndef CGAL_DDT_WRITE_ARRAYS_H
+#define CGAL_DDT_WRITE_ARRAYS_H
+
+#include <CGAL/assertions.h>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace CGAL {
+namespace DDT {
+
+/// \ingroup PkgDDTRef
+/// Writes the finite main vertices and cells of a distributed triangulation to contiguous arrays, such as NumPy arrays,
+/// in an indexed mesh layout : vertices are numbered consecutively tile by tile, and cells are given by the indices of their vertices.
+/// The construction numbers the vertices of each tile concurrently under a scheduler, so that the array sizes are known
+/// before the arrays are allocated by the caller. The arrays are then filled concurrently, each tile writing its own slices.
+/// The indices of the foreign vertices of the main cells of a tile are requested to their main tiles, which answer concurrently.
+/// \pre All the tiles are in memory, and the triangulation is not modified during the lifetime of the `Array_writer`.
+/// \tparam DistributedTriangulation a `CGAL::Distributed_triangulation`
+template<typename DistributedTriangulation>
+class Array_writer
+{
+    typedef typename DistributedTriangulation::Tile_index          Tile_index;
+    typedef typename DistributedTriangulation::Tile_triangulation  Tile_triangulation;
+    typedef typename Tile_triangulation::Vertex_index              Vertex_index;
+    typedef typename Tile_triangulation::Cell_index                Cell_index;
+    typedef typename Tile_triangulation::Point                     Point;
+    typedef typename Tile_triangulation::Point_const_reference     Point_const_reference;
+
+    struct Tile_numbering {
+        const Tile_triangulation* tri = nullptr;
+        std::map<Vertex_index, std::size_t> vertices; // local number of the main vertices
+        std::map<Tile_index, std::vector<Vertex_index>> foreign; // foreign vertices of the main cells, by main tile
+        std::map<Vertex_index, std::size_t> foreign_indices; // global index of the foreign vertices
+        std::size_t number_of_cells = 0;
+        std::size_t vertex_offset = 0;
+        std::size_t cell_offset = 0;
+    };
+
+    typedef std::pair<Tile_index, std::vector<Point>>       Request; // (requesting tile, points)
+    typedef std::pair<Tile_index, std::vector<std::size_t>> Answer;  // (main tile, global indices)
+
+public:
+    /// numbers the finite main vertices and counts the finite main cells of each tile of `tri`.
+    template<typename Scheduler>
+    Array_writer(const DistributedTriangulation& tri, Scheduler& sch) : dimension_(tri.maximal_dimension())
+    {
+        // the numbering map is filled sequentially, so that its entries are only accessed by their own tile afterwards
+        for(auto it = tri.tiles.begin(); it != tri.tiles.end(); ++it)
+            tiles_[it->first].tri = &(it->second);
+
+        std::multimap<Tile_index, Request> requests;
+        sch.template ranges_transform<typename std::multimap<Tile_index, Request>::value_type>(tri.tiles,
+            [this](auto first, auto, auto out) {
+                Tile_numbering& n = tiles_.find(first->first)->second;
+                const Tile_triangulation& t = *n.tri;
+                for(Vertex_index v = t.vertices_begin(); v != t.vertices_end(); ++v)
+                    if(t.vertex_is_main(v))
+                        n.vertices.emplace_hint(n.vertices.end(), v, n.vertices.size());
+                std::set<Vertex_index> foreign;
+                for(Cell_index c = t.cells_begin(); c != t.cells_end(); ++c) {
+                    if(!t.cell_is_main(c) || t.cell_is_infinite(c)) continue;
+                    ++n.number_of_cells;
+                    for(int i = 0; i <= dimension_; ++i) {
+                        Vertex_index v = t.vertex(c, i);
+                        if(t.vertex_is_foreign(v)) foreign.insert(v);
+                    }
+                }
+                for(Vertex_index v : foreign)
+                    n.foreign[t.vertex_id(v)].push_back(v);
+                for(const auto& [id, vertices] : n.foreign) {
+                    std::vector<Point> points;
+                    points.reserve(vertices.size());
+                    for(Vertex_index v : vertices)
+                        points.push_back(t.triangulation_point(v));
+                    *out++ = { id, { t.id(), std::move(points) } };
+                }
+                return out;
+            }, std::inserter(requests, requests.begin()));
+
+        for(auto& [id, n] : tiles_) {
+            n.vertex_offset = number_of_vertices_;
+            n.cell_offset = number_of_cells_;
+            number_of_vertices_ += n.vertices.size();
+            number_of_cells_ += n.number_of_cells;
+        }
+
+        // each main tile locates the requested points, in the order of the request
+        std::multimap<Tile_index, Answer> answers;
+        sch.template ranges_transform<typename std::multimap<Tile_index, Answer>::value_type>(requests,
+            [this](auto first, auto last, auto out) {
+                const Tile_numbering& m = tiles_.find(first->first)->second;
+                for(auto it = first; it != last; ++it) {
+                    const auto& [id, points] = it->second;
+                    std::vector<std::size_t> indices;
+                    indices.reserve(points.size());
+                    Vertex_index w;
+                    for(const Point& p : points) {
+                        w = m.tri->locate_vertex(p, w);
+                        CGAL_assertion(w != m.tri->vertices_end());
+                        indices.push_back(m.vertex_offset + m.vertices.find(w)->second);
+                    }
+                    *out++ = { id, { first->first, std::move(indices) } };
+                }
+                return out;
+            }, std::inserter(answers, answers.begin()));
+
+        sch.ranges_reduce(answers, [this](auto first, auto last) {
+            Tile_numbering& n = tiles_.find(first->first)->second;
+            for(auto it = first; it != last; ++it) {
+                const auto& [id, indices] = it->second;
+                const std::vector<Vertex_index>& vertices = n.foreign[id];
+                for(std::size_t k = 0; k < indices.size(); ++k)
+                    n.foreign_indices.emplace(vertices[k], indices[k]);
+            }
+            return 0;
+        }, 0, std::plus<>());
+    }
+
+    /// number of finite main vertices, which is the number of rows of the vertex arrays
+    std::size_t number_of_vertices() const { return number_of_vertices_; }
+    /// number of finite main cells, which is the number of rows of the cell array
+    std::size_t number_of_cells() const { return number_of_cells_; }
+    /// dimension of the triangulation, which is the number of columns of the coordinate array, and one less than the number of columns of the cell array
+    int dimension() const { return dimension_; }
+
+    /// writes the coordinates of the vertices in the row-major `number_of_vertices()` x `dimension()` array `coords`,
+    /// and, if `ids` is not null, the tile indices of the vertices in the array `ids` of size `number_of_vertices()`.
+    template<typename Scheduler, typename TileIndex>
+    void write_vertices(const DistributedTriangulation& tri, Scheduler& sch, double* coords, TileIndex* ids) const
+    {
+        int D = dimension_;
+        sch.ranges_reduce(tri.tiles, [this, D, coords, ids](auto first, auto) {
+            const Tile_numbering& n = tiles_.find(first->first)->second;
+            const Tile_triangulation& t = *n.tri;
+            for(const auto& [v, k] : n.vertices) {
+                std::size_t i = n.vertex_offset + k;
+                Point_const_reference p = t.triangulation_point(v);
+                for(int d = 0; d < D; ++d)
+                    coords[i*D + d] = approximate_cartesian_coordinate(p, d);
+                if (ids) ids[i] = TileIndex(t.id());
+            }
+            return 0;
+        }, 0, std::plus<>());
+    }
+
+    /// writes the vertex indices of the cells in the row-major `number_of_cells()` x (`dimension()`+1) array `cells`.
+    /// \tparam Index an integral type
+    template<typename Scheduler, typename Index>
+    void write_cells(const DistributedTriangulation& tri, Scheduler& sch, Index* cells) const
+    {
+        int D = dimension_;
+        sch.ranges_reduce(tri.tiles, [this, D, cells](auto first, auto) {
+            const Tile_numbering& n = tiles_.find(first->first)->second;
+            const Tile_triangulation& t = *n.tri;
+            Index* out = cells + n.cell_offset * (D+1);
+            for(Cell_index c = t.cells_begin(); c != t.cells_end(); ++c) {
+                if(!t.cell_is_main(c) || t.cell_is_infinite(c)) continue;
+                for(int i = 0; i <= D; ++i) {
+                    Vertex_index v = t.vertex(c, i);
+                    *out++ = Index(t.vertex_is_main(v) ? n.vertex_offset + n.vertices.find(v)->second : n.foreign_indices.find(v)->second);
+                }
+            }
+            return 0;
+        }, 0, std::plus<>());
+    }
+
+private:
+    int dimension_;
+    std::size_t number_of_vertices_ = 0;
+    std::size_t number_of_cells_ = 0;
+    std::map<Tile_index, Tile_numbering> tiles_;
+};
+
+}
+}
+
+#endif // CGAL_DDT_WRITE_ARRAYS_H
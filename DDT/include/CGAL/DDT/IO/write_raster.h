@@ -0,0 +1,308 @@
+// Copyright (c) 2022 Institut Géographique National - IGN (France)
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Mathieu Brédif and Laurent Caraffa
+
+#ifndef CGAL_DDT_WRITE_RASTER_H
+#define CGAL_DDT_WRITE_RASTER_H
+
+#include <boost/filesystem.hpp>
+#include <CGAL/assertions.h>
+#include <CGAL/DDT/IO/trace_logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace DDT {
+
+/// \ingroup PkgDDTRef
+/// A north-up raster grid of `width` x `height` pixels of size `step_x` x `step_y`,
+/// whose lower left corner is (`x0`,`y0`). Row 0 is the northernmost row, as in GDAL.
+struct Raster_grid
+{
+    double x0, y0;
+    double step_x, step_y;
+    std::size_t width, height;
+
+    /// x coordinate of the center of the pixels of column `i`
+    inline double x(std::size_t i) const { return x0 + (i + 0.5) * step_x; }
+    /// y coordinate of the center of the pixels of row `j`
+    inline double y(std::size_t j) const { return y0 + (height - j - 0.5) * step_y; }
+};
+
+/// \ingroup PkgDDTRef
+/// Functor returning the third cartesian coordinate of a point, which is the elevation of the points
+/// of a triangulation with `CGAL::Projection_traits_xy_3` geometric traits.
+struct Point_z
+{
+    template<typename Point>
+    double operator()(const Point& p) const { return approximate_cartesian_coordinate(p, 2); }
+};
+
+namespace impl {
+
+// Pixel blocks of a raster grid that are aligned with the xy tiling of a Grid_partitioner :
+// the block of a tile gathers the pixels whose centers fall in the domain of the tile.
+template<typename Partitioner>
+struct Raster_blocks
+{
+    typedef typename Partitioner::Tile_index Tile_index;
+
+    Raster_blocks(const Partitioner& partitioner, const Raster_grid& grid) : grid(grid), id0(partitioner.begin())
+    {
+        auto n = partitioner.size_begin();
+        nx = *n++;
+        ny = *n++;
+        for(; n != partitioner.size_end(); ++n)
+            CGAL_precondition_msg(*n == 1, "raster blocks require a partitioner that only splits the x and y axes");
+        auto bbox = partitioner.bbox();
+        column_tile = tile_coordinates(grid.width,  nx, bbox.min(0), bbox.max(0), [&grid](std::size_t i){ return grid.x(i); });
+        row_tile    = tile_coordinates(grid.height, ny, bbox.min(1), bbox.max(1), [&grid](std::size_t j){ return grid.y(j); });
+        column_range = ranges(column_tile, nx);
+        row_range    = ranges(row_tile, ny);
+    }
+
+    // tile index of the pixel (i,j)
+    inline Tile_index tile(std::size_t i, std::size_t j) const { return id0 + Tile_index(column_tile[i] + nx*row_tile[j]); }
+
+    // pixel rectangle [i0,i1)x[j0,j1) of the block of tile `id`
+    void block(Tile_index id, std::size_t& i0, std::size_t& j0, std::size_t& i1, std::size_t& j1) const
+    {
+        std::size_t k = id - id0;
+        std::size_t ix = k % nx, iy = k / nx;
+        i0 = column_range[ix].first; i1 = column_range[ix].second;
+        j0 = row_range[iy].first;    j1 = row_range[iy].second;
+    }
+
+    Raster_grid grid;
+    Tile_index id0;
+    std::size_t nx, ny;
+    std::vector<std::size_t> column_tile, row_tile;
+    std::vector<std::pair<std::size_t, std::size_t>> column_range, row_range;
+
+private:
+    template<typename Center>
+    static std::vector<std::size_t> tile_coordinates(std::size_t size, std::size_t n, double min, double max, Center center)
+    {
+        std::vector<std::size_t> tiles(size);
+        double inv_step = n / (max - min);
+        for(std::size_t i = 0; i < size; ++i) {
+            double f = (center(i) - min) * inv_step;
+            if (f <  0) f = 0;
+            if (f >= n) f = n-1;
+            tiles[i] = std::size_t(f);
+        }
+        return tiles;
+    }
+
+    // tile coordinates are monotonic along each axis (decreasing along rows, as they are numbered from the top),
+    // so that blocks are pixel rectangles. Empty ranges are returned as [0,0).
+    static std::vector<std::pair<std::size_t, std::size_t>> ranges(const std::vector<std::size_t>& tiles, std::size_t n)
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> r(n, { tiles.size(), 0 });
+        for(std::size_t i = 0; i < tiles.size(); ++i) {
+            r[tiles[i]].first  = std::min(r[tiles[i]].first,  i);
+            r[tiles[i]].second = std::max(r[tiles[i]].second, i+1);
+        }
+        for(auto& ri : r)
+            if (ri.second < ri.first) ri = { 0, 0 };
+        return r;
+    }
+};
+
+// scan-converts the triangle of vertices (x[k],y[k]) and values z[k] over the pixel centers of `grid`,
+// calling out(i, j, value) with the linearly interpolated value for each covered pixel (i,j).
+template<typename PixelOutput>
+void scan_triangle(const Raster_grid& grid, const double (&x)[3], const double (&y)[3], const double (&z)[3], PixelOutput out)
+{
+    double det = (x[1]-x[0])*(y[2]-y[0]) - (x[2]-x[0])*(y[1]-y[0]);
+    if (det == 0) return;
+    // plane z = a*x + b*y + c
+    double a = ((z[1]-z[0])*(y[2]-y[0]) - (z[2]-z[0])*(y[1]-y[0])) / det;
+    double b = ((x[1]-x[0])*(z[2]-z[0]) - (x[2]-x[0])*(z[1]-z[0])) / det;
+    double c = z[0] - a*x[0] - b*y[0];
+
+    double ymin = std::min({y[0], y[1], y[2]});
+    double ymax = std::max({y[0], y[1], y[2]});
+    // rows are numbered from the top of the grid
+    double jmin = std::ceil (grid.height - 0.5 - (ymax - grid.y0) / grid.step_y);
+    double jmax = std::floor(grid.height - 0.5 - (ymin - grid.y0) / grid.step_y);
+    if (jmin < 0) jmin = 0;
+    if (jmax > double(grid.height) - 1) jmax = double(grid.height) - 1;
+    for(double jj = jmin; jj <= jmax; ++jj) {
+        std::size_t j = std::size_t(jj);
+        double yj = grid.y(j);
+        // horizontal span of the triangle along row j
+        double xl = std::numeric_limits<double>::infinity(), xr = -xl;
+        for(int e = 0; e < 3; ++e) {
+            int f = (e+1)%3;
+            if ((y[e] - yj) * (y[f] - yj) > 0) continue;
+            if (y[e] == y[f]) {
+                xl = std::min({xl, x[e], x[f]});
+                xr = std::max({xr, x[e], x[f]});
+            } else {
+                double xe = x[e] + (yj - y[e]) * (x[f] - x[e]) / (y[f] - y[e]);
+                xl = std::min(xl, xe);
+                xr = std::max(xr, xe);
+            }
+        }
+        if (xr < xl) continue;
+        double imin = std::ceil ((xl - grid.x0) / grid.step_x - 0.5);
+        double imax = std::floor((xr - grid.x0) / grid.step_x - 0.5);
+        if (imin < 0) imin = 0;
+        if (imax > double(grid.width) - 1) imax = double(grid.width) - 1;
+        for(double ii = imin; ii <= imax; ++ii) {
+            std::size_t i = std::size_t(ii);
+            out(i, j, a*grid.x(i) + b*yj + c);
+        }
+    }
+}
+
+inline bool is_little_endian()
+{
+    std::uint16_t one = 1;
+    return *reinterpret_cast<unsigned char*>(&one) == 1;
+}
+
+inline bool write_raster_block_vrt(std::ostream& vrt, const std::string& stem, const Raster_grid& grid,
+    std::size_t i0, std::size_t j0, std::size_t w, std::size_t h, float nodata)
+{
+    vrt << std::setprecision(17);
+    vrt << "<VRTDataset rasterXSize=\"" << w << "\" rasterYSize=\"" << h << "\">" << std::endl;
+    vrt <<  "<GeoTransform>" << grid.x0 + i0*grid.step_x << ", " << grid.step_x << ", 0, "
+        << grid.y0 + (grid.height - j0)*grid.step_y << ", 0, " << -grid.step_y << "</GeoTransform>" << std::endl;
+    vrt <<  "<VRTRasterBand dataType=\"Float32\" band=\"1\" subClass=\"VRTRawRasterBand\">" << std::endl;
+    vrt <<    "<NoDataValue>" << nodata << "</NoDataValue>" << std::endl;
+    vrt <<    "<SourceFilename relativeToVRT=\"1\">" << stem << ".raw</SourceFilename>" << std::endl;
+    vrt <<    "<ImageOffset>0</ImageOffset>" << std::endl;
+    vrt <<    "<PixelOffset>" << sizeof(float) << "</PixelOffset>" << std::endl;
+    vrt <<    "<LineOffset>" << w*sizeof(float) << "</LineOffset>" << std::endl;
+    vrt <<    "<ByteOrder>" << (is_little_endian() ? "LSB" : "MSB") << "</ByteOrder>" << std::endl;
+    vrt <<  "</VRTRasterBand>" << std::endl;
+    vrt << "</VRTDataset>" << std::endl;
+    return !vrt.fail();
+}
+
+template<typename Blocks>
+bool write_raster_mosaic_vrt(std::ostream& vrt, const std::string& dirname, const Blocks& blocks, float nodata)
+{
+    typedef typename Blocks::Tile_index Tile_index;
+    const Raster_grid& grid = blocks.grid;
+    vrt << std::setprecision(17);
+    vrt << "<VRTDataset rasterXSize=\"" << grid.width << "\" rasterYSize=\"" << grid.height << "\">" << std::endl;
+    vrt <<  "<GeoTransform>" << grid.x0 << ", " << grid.step_x << ", 0, "
+        << grid.y0 + grid.height*grid.step_y << ", 0, " << -grid.step_y << "</GeoTransform>" << std::endl;
+    vrt <<  "<VRTRasterBand dataType=\"Float32\" band=\"1\">" << std::endl;
+    vrt <<    "<NoDataValue>" << nodata << "</NoDataValue>" << std::endl;
+    for(std::size_t k = 0; k < blocks.nx*blocks.ny; ++k) {
+        Tile_index id = blocks.id0 + Tile_index(k);
+        std::string stem = std::to_string(id);
+        if (!boost::filesystem::exists(dirname + "/" + stem + ".vrt")) continue; // block without any pixel
+        std::size_t i0, j0, i1, j1;
+        blocks.block(id, i0, j0, i1, j1);
+        vrt << "<SimpleSource>" << std::endl;
+        vrt <<   "<SourceFilename relativeToVRT=\"1\">" << stem << ".vrt</SourceFilename>" << std::endl;
+        vrt <<   "<SourceBand>1</SourceBand>" << std::endl;
+        vrt <<   "<SrcRect xOff=\"0\" yOff=\"0\" xSize=\"" << i1-i0 << "\" ySize=\"" << j1-j0 << "\"/>" << std::endl;
+        vrt <<   "<DstRect xOff=\"" << i0 << "\" yOff=\"" << j0 << "\" xSize=\"" << i1-i0 << "\" ySize=\"" << j1-j0 << "\"/>" << std::endl;
+        vrt << "</SimpleSource>" << std::endl;
+    }
+    vrt <<  "</VRTRasterBand>" << std::endl;
+    vrt << "</VRTDataset>" << std::endl;
+    return !vrt.fail();
+}
+
+} // namespace impl
+
+/// \ingroup PkgDDTRef
+/// rasterizes a 2D distributed triangulation into the pixels of `grid`, linearly interpolating the `value` of the triangle vertices (by default, their elevation).
+/// Each tile scan-converts its main finite cells, so that each triangle is rasterized exactly once. The pixels are then sent to the tile whose
+/// domain in the `Grid_partitioner` contains their centers, which writes its raster block concurrently with the other tiles under the given scheduler.
+/// Each block is written as the raw Float32 file "{dirname}/{tile_index}.raw", along with its GDAL VRT header "{dirname}/{tile_index}.vrt".
+/// The GDAL VRT mosaic of all the blocks is finally written as "{dirname}/raster.vrt". Pixels that are not covered by any triangle are set to `nodata`.
+/// \tparam Partitioner a `Grid_partitioner` that only splits the x and y axes.
+/// \tparam ValueFunctor a functor that returns the value as a double, given a point of the triangulation.
+template<typename DistributedTriangulation, typename Partitioner, typename Scheduler, typename ValueFunctor = Point_z>
+bool write_raster(const DistributedTriangulation& tri, const Partitioner& partitioner, const Raster_grid& grid,
+    const std::string& dirname, Scheduler& sch, ValueFunctor value = {}, float nodata = -9999.f)
+{
+    typedef typename DistributedTriangulation::Tile_index          Tile_index;
+    typedef typename DistributedTriangulation::Tile_triangulation  Tile_triangulation;
+    typedef typename Tile_triangulation::Cell_index                Cell_index;
+    typedef typename Tile_triangulation::Point_const_reference     Point_const_reference;
+    typedef std::vector<std::pair<std::size_t, float>>             Pixels; // (row-major pixel index, value)
+    typedef std::multimap<Tile_index, Pixels>                      PixelContainer;
+
+    CGAL_DDT_TRACE0(sch, "DDT", "write_raster", 0, "B");
+    CGAL_precondition(tri.maximal_dimension() == 2);
+    boost::filesystem::create_directories(dirname);
+    impl::Raster_blocks<Partitioner> blocks(partitioner, grid);
+
+    PixelContainer pixels;
+    sch.template ranges_transform<typename PixelContainer::value_type>(tri.tiles,
+        [&blocks, &grid, &value](auto first, auto last, auto out) {
+            std::map<Tile_index, Pixels> sent;
+            for(auto it = first; it != last; ++it) {
+                const Tile_triangulation& t = it->second;
+                for(Cell_index c = t.cells_begin(); c != t.cells_end(); ++c) {
+                    if (t.cell_is_infinite(c) || !t.cell_is_main(c)) continue;
+                    double x[3], y[3], z[3];
+                    for(int k = 0; k < 3; ++k) {
+                        Point_const_reference p = t.triangulation_point(t.vertex(c, k));
+                        x[k] = approximate_cartesian_coordinate(p, 0);
+                        y[k] = approximate_cartesian_coordinate(p, 1);
+                        z[k] = value(p);
+                    }
+                    impl::scan_triangle(grid, x, y, z, [&](std::size_t i, std::size_t j, double v) {
+                        sent[blocks.tile(i, j)].emplace_back(j*grid.width + i, float(v));
+                    });
+                }
+            }
+            for(auto& [id, p] : sent)
+                *out++ = { id, std::move(p) };
+            return out;
+        }, std::inserter(pixels, pixels.begin()));
+
+    bool ok = sch.ranges_reduce(pixels, [&blocks, &grid, &dirname, nodata](auto first, auto last) {
+        Tile_index id = first->first;
+        std::size_t i0, j0, i1, j1;
+        blocks.block(id, i0, j0, i1, j1);
+        std::size_t w = i1 - i0, h = j1 - j0;
+        if (w == 0 || h == 0) return true;
+        std::vector<float> block(w*h, nodata);
+        for(auto it = first; it != last; ++it)
+            for(const auto& [k, v] : it->second)
+                block[(k / grid.width - j0) * w + (k % grid.width - i0)] = v;
+        std::string stem = std::to_string(id);
+        std::ofstream raw(dirname + "/" + stem + ".raw", std::ios::out | std::ios::binary);
+        raw.write(reinterpret_cast<const char*>(block.data()), block.size()*sizeof(float));
+        std::ofstream vrt(dirname + "/" + stem + ".vrt");
+        return !raw.fail() && impl::write_raster_block_vrt(vrt, stem, grid, i0, j0, w, h, nodata);
+    }, true, std::logical_and<>());
+
+    std::ofstream vrt(dirname + "/raster.vrt");
+    ok = ok && impl::write_raster_mosaic_vrt(vrt, dirname, blocks, nodata);
+    CGAL_DDT_TRACE0(sch, "DDT", "write_raster", 0, "E");
+    return ok;
+}
+
+}
+}
+
+#endif // CGAL_DDT_WRITE_RASTER_H
@@ -12,19 +12,23 @@
 #ifndef CGAL_DDT_PARITIONER_CONST_PARTITIONER_H
 #define CGAL_DDT_PARITIONER_CONST_PARTITIONER_H
 
+#include <CGAL/DDT/kernel/Kernel_traits.h>
+#include <iostream>
+
 namespace CGAL {
 namespace DDT {
 
 /// \ingroup PkgDDTPartitionerClasses
 /// Partitioner that assigns all points to a single tile.
 /// \cgalModels{Partitioner}
-template<typename TileIndex, typename Triangulation>
+template<typename TileIndex, typename Point_>
 class Const_partitioner
 {
-    typedef CGAL::DDT::Triangulation_traits<Triangulation> Traits;
+    typedef CGAL::DDT::Kernel_traits<Point_> Traits;
 public:
     typedef TileIndex Tile_index;
     typedef typename Traits::Point Point;
+    typedef typename Traits::Point_const_reference Point_const_reference;
 
     /// Construction with the constant tile index `id`
     Const_partitioner(Tile_index id) : id_(id) {}
@@ -40,8 +44,8 @@ private:
     Tile_index id_;
 };
 
-template<typename Traits>
-std::ostream& operator<<(std::ostream& out, const Const_partitioner<Traits>& partitioner) {
+template<typename TileIndex, typename Point>
+std::ostream& operator<<(std::ostream& out, const Const_partitioner<TileIndex, Point>& partitioner) {
     return out << "Const_partitioner( " << partitioner.id() << " )";
 }
 
@@ -0,0 +1,206 @@
+// Copyright (c) 2022 Institut Géographique National - IGN (France)
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Mathieu Brédif and Laurent Caraffa
+
+#ifndef CGAL_DDT_ARRAY_POINT_SET_H
+#define CGAL_DDT_ARRAY_POINT_SET_H
+
+#include <CGAL/Distributed_point_set.h>
+#include <CGAL/assertions.h>
+#include <CGAL/DDT/point_set/Point_set_traits.h>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace CGAL {
+namespace DDT {
+
+/// \ingroup PkgDDTPointSetClasses
+/// A point set that is a non-owning view of the rows of a 2D array of double coordinates, such as a NumPy array
+/// or a buffer of a point cloud library. The rows and columns of the array may be strided, and the viewed rows may
+/// be restricted to a range of a shared array of row indices, so that the points of a tile are gathered without copying their coordinates.
+/// The coordinate array must outlive the point set. Points are constructed on the fly in a storage shared by all the iterators
+/// of the point set, so that the `const_reference` returned by an iterator is invalidated as soon as an iterator is dereferenced again.
+/// \cgalModels{PointSet}
+/// \tparam Point type.
+template<typename Point>
+class Array_point_set {
+public:
+    /// Point type
+    typedef Point value_type;
+    /// const reference to Point type
+    typedef typename Kernel_traits<Point>::Point_const_reference const_reference;
+    /// shared array of row indices
+    typedef std::shared_ptr<const std::vector<std::size_t>> Rows;
+
+private:
+    // iterator over the coordinates of a row
+    struct Coordinate_iterator : public boost::iterator_facade<Coordinate_iterator, const double, boost::random_access_traversal_tag> {
+        Coordinate_iterator(const double* p = nullptr, std::ptrdiff_t stride = 1) : p_(p), stride_(stride) {}
+    private:
+        friend class boost::iterator_core_access;
+        const double& dereference() const { return *p_; }
+        bool equal(const Coordinate_iterator& it) const { return p_ == it.p_; }
+        void increment() { p_ += stride_; }
+        void decrement() { p_ -= stride_; }
+        void advance(std::ptrdiff_t n) { p_ += n * stride_; }
+        std::ptrdiff_t distance_to(const Coordinate_iterator& it) const { return (it.p_ - p_) / stride_; }
+        const double* p_;
+        std::ptrdiff_t stride_;
+    };
+
+public:
+#ifdef DOXYGEN_RUNNING
+private:
+    struct unspecified_type {};
+public:
+    /// const iterator, which constructs the point of the current row on dereferencing.
+    typedef unspecified_type const_iterator;
+    typedef unspecified_type iterator;
+#else
+    struct const_iterator {
+        const_iterator(const Array_point_set* ps = nullptr, std::size_t i = 0) : ps_(ps), i_(i) {}
+        const_iterator& operator++() { ++i_; return *this; }
+        bool operator==(const const_iterator& it) const { return i_ == it.i_; }
+        bool operator!=(const const_iterator& it) const { return i_ != it.i_; }
+        const_reference operator*() const {
+            const double *p = ps_->coords_ + std::ptrdiff_t(ps_->row(i_)) * ps_->row_stride_;
+            Coordinate_iterator begin(p, ps_->column_stride_);
+            assign(ps_->point_, begin, begin + ps_->dimension_);
+            return ps_->point_;
+        }
+        /// index of the current row in the coordinate array
+        std::size_t row() const { return ps_->row(i_); }
+
+    private:
+        const Array_point_set* ps_;
+        std::size_t i_;
+    };
+    typedef const_iterator iterator;
+#endif
+
+    /// default constructor of an empty point set.
+    Array_point_set() : coords_(nullptr), dimension_(0), row_stride_(0), column_stride_(1), first_(0), last_(0) {}
+
+    /// constructs a view of the rows `first` to `last-1` of the array of `dimension` columns pointed by `coords`.
+    /// Strides are given as a number of doubles. If `rows` is not null, the viewed rows are `(*rows)[first]` to `(*rows)[last-1]`.
+    Array_point_set(const double* coords, int dimension, std::ptrdiff_t row_stride, std::ptrdiff_t column_stride,
+                    std::size_t first, std::size_t last, Rows rows = {})
+        : coords_(coords), dimension_(dimension), row_stride_(row_stride), column_stride_(column_stride),
+          first_(first), last_(last), rows_(rows)
+    {}
+
+    /// begin const iterator
+    const_iterator begin() const { return { this, first_ }; }
+    /// end const iterator
+    const_iterator end  () const { return { this, last_  }; }
+    /// number of points
+    std::size_t size() const { return last_ - first_; }
+    /// returns `size() == 0`
+    bool empty() const { return first_ == last_; }
+    /// number of columns of the viewed array
+    int dimension() const { return dimension_; }
+
+    const double* coordinates() const { return coords_; }
+    std::ptrdiff_t row_stride() const { return row_stride_; }
+    std::ptrdiff_t column_stride() const { return column_stride_; }
+    const Rows& rows() const { return rows_; }
+
+private:
+    inline std::size_t row(std::size_t i) const { return rows_ ? (*rows_)[i] : i; }
+
+    const double* coords_;
+    int dimension_;
+    std::ptrdiff_t row_stride_, column_stride_;
+    std::size_t first_, last_;
+    Rows rows_;
+    mutable Point point_;
+};
+
+template <typename P>
+typename Point_set_traits<Array_point_set<P>>::const_reference
+point(const Array_point_set<P>& ps, typename Point_set_traits<Array_point_set<P>>::const_iterator v) {
+    return *v;
+}
+
+/// \ingroup PkgDDTPointSetClasses
+/// constructs a distributed point set from an `Array_point_set` and a `Partitioner`, without copying the point coordinates.
+/// The tile indices of the points are computed concurrently by chunks of rows under the given scheduler.
+/// The rows are then bucketed by tile into a single shared array of row indices, which the tile point sets are views of.
+/// \pre `points` is a view of a range of consecutive rows, without row indices.
+/// \tparam Point type.
+/// \tparam Partitioner model of the Partitioner concept.
+/// \tparam Scheduler model of the Scheduler concept.
+template<typename Point, typename Partitioner, typename Scheduler>
+CGAL::Distributed_point_set<
+    Array_point_set<Point>,
+    boost::static_property_map<typename Partitioner::Tile_index>
+>
+make_distributed_point_set(const Array_point_set<Point>& points, const Partitioner& partitioner, Scheduler& sch)
+{
+    typedef Array_point_set<Point>                        Point_set;
+    typedef typename Partitioner::Tile_index              Tile_index;
+    typedef boost::static_property_map<Tile_index>        PropertyMap;
+    typedef Distributed_point_set<Point_set, PropertyMap> Distributed_point_set;
+    typedef std::map<Tile_index, std::size_t>             Histogram;
+
+    CGAL_precondition(!points.rows());
+    std::size_t n = points.size();
+    std::size_t row0 = points.empty() ? 0 : points.begin().row();
+
+    // split the rows in chunks, so that the load is balanced among the available threads
+    std::size_t chunk_size = std::max<std::size_t>(4096, n / (16 * std::max(1, sch.max_concurrency())) + 1);
+    std::map<std::size_t, std::size_t> chunks; // (first point, last point)
+    for(std::size_t i = 0; i < n; i += chunk_size)
+        chunks.emplace(i, std::min(n, i + chunk_size));
+
+    // compute the tile index of each point, and the number of points of each tile
+    std::vector<Tile_index> ids(n);
+    Histogram counts = sch.ranges_reduce(chunks, [&points, &partitioner, &ids, row0](auto first, auto) {
+        Histogram h;
+        std::size_t i = first->first;
+        Point_set chunk(points.coordinates(), points.dimension(), points.row_stride(), points.column_stride(),
+                        row0 + i, row0 + first->second);
+        for(auto it = chunk.begin(); it != chunk.end(); ++it, ++i)
+            ++h[ids[i] = partitioner(*it)];
+        return h;
+    }, Histogram(), [](Histogram h0, const Histogram& h1) {
+        for(const auto& [id, count] : h1) h0[id] += count;
+        return h0;
+    });
+
+    // bucket the rows by tile index (counting sort)
+    std::map<Tile_index, std::size_t> offsets;
+    std::size_t offset = 0;
+    for(const auto& [id, count] : counts) {
+        offsets[id] = offset;
+        offset += count;
+    }
+    auto rows = std::make_shared<std::vector<std::size_t>>(n);
+    {
+        std::map<Tile_index, std::size_t> next(offsets);
+        for(std::size_t i = 0; i < n; ++i)
+            (*rows)[next[ids[i]]++] = row0 + i;
+    }
+
+    Distributed_point_set dpoints;
+    for(const auto& [id, first] : offsets)
+        dpoints.try_emplace(id, id, points.coordinates(), points.dimension(), points.row_stride(), points.column_stride(),
+                            first, first + counts[id], rows);
+    return dpoints;
+}
+
+}
+}
+
+#endif // CGAL_DDT_ARRAY_POINT_SET_H
@@ -0,0 +1,240 @@
+// Copyright (c) 2022 Institut Géographique National - IGN (France)
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Mathieu Brédif and Laurent Caraffa
+
+#ifndef CGAL_DDT_BINARY_POINTS_SERIALIZER_H
+#define CGAL_DDT_BINARY_POINTS_SERIALIZER_H
+
+#include <CGAL/DDT/kernel/Kernel_traits.h>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace CGAL {
+namespace DDT {
+
+namespace impl {
+
+// little endian base 128 encoding of unsigned integers : small values use few bytes
+inline void write_varint(std::vector<unsigned char>& buf, std::uint64_t x)
+{
+    while (x >= 0x80) {
+        buf.push_back((unsigned char)(x | 0x80));
+        x >>= 7;
+    }
+    buf.push_back((unsigned char)x);
+}
+
+inline bool read_varint(const unsigned char*& p, const unsigned char* end, std::uint64_t& x)
+{
+    x = 0;
+    for(int shift = 0; p != end && shift < 64; shift += 7) {
+        unsigned char c = *p++;
+        x |= std::uint64_t(c & 0x7f) << shift;
+        if (!(c & 0x80)) return true;
+    }
+    return false;
+}
+
+// maps signed integers to unsigned integers, so that values of small magnitude use few bytes
+inline std::uint64_t zigzag_encode(std::int64_t x) { return (std::uint64_t(x) << 1) ^ std::uint64_t(x >> 63); }
+inline std::int64_t  zigzag_decode(std::uint64_t x) { return std::int64_t(x >> 1) ^ -std::int64_t(x & 1); }
+
+// maps doubles to unsigned integers with the same ordering, so that close doubles have close keys, even across 0
+inline std::uint64_t double_to_key(double d)
+{
+    std::uint64_t u;
+    std::memcpy(&u, &d, sizeof(u));
+    return (u >> 63) ? ~u : (u | (std::uint64_t(1) << 63));
+}
+
+inline double key_to_double(std::uint64_t u)
+{
+    u = (u >> 63) ? (u & ~(std::uint64_t(1) << 63)) : ~u;
+    double d;
+    std::memcpy(&d, &u, sizeof(d));
+    return d;
+}
+
+}
+
+struct Binary_points_serializer;
+std::ostream& operator<<(std::ostream& out, const Binary_points_serializer& serializer);
+
+/// \ingroup PkgDDTSerializerClasses
+/// This serializer may be used to save and load a distributed triangulation on disk, as a more compact and faster alternative to `File_points_serializer`.
+/// Like `File_points_serializer`, it writes only the spatially sorted point set of each tile, and recomputes the Delaunay triangulation upon reading.
+/// Each point is stored as the differences of its coordinates and tile index with those of the previous point, using a variable length binary integer encoding.
+/// As consecutive points are close after the spatial sort, these differences are small and most points use only a few bytes.
+/// Coordinates along an axis are encoded losslessly either as integer multiples of a quantum (such as the scale of LAS files) if all the coordinates
+/// of the tile along this axis are exact multiples of it, or as the ordered bit patterns of their double representations otherwise.
+/// \pre The point coordinates are doubles, such as with `CGAL::Exact_predicates_inexact_constructions_kernel`.
+/// Files are written with the byte order of the machine, and are meant to be read back by the same process or machine.
+/// \cgalModels{Serializer}
+struct Binary_points_serializer
+{
+  /// Each tile is saved as the file "{dirname}/{tile_index}.bin".
+  /// If `quantum` is positive, coordinates are encoded as integer multiples of `quantum` whenever this is lossless.
+  Binary_points_serializer(const std::string& dirname = "", double quantum = 0) : dirname_(dirname), quantum_(quantum)
+  {
+      if(dirname_.empty()) {
+          dirname_ = "tmp/" + boost::filesystem::unique_path().string();
+      }
+      boost::filesystem::path p(dirname_);
+      dirname_ = p.string()+"/";
+      boost::filesystem::create_directories(p);
+  }
+
+  /// tests whether a tile is readable, given its index.
+  template <typename TileIndex>
+  bool is_readable(TileIndex id) const
+  {
+    const std::string fname = filename(id);
+    std::ifstream in(fname, std::ios::in | std::ios::binary);
+    return in.is_open();
+  }
+
+  /// reads a point set from disk and insert them in `tri`, using its index `tri.id()`.
+  template<typename TileTriangulation> bool read(TileTriangulation& tri) const
+  {
+    typedef typename TileTriangulation::Point Point;
+    typedef typename TileTriangulation::Vertex_index Vertex_index;
+    typedef typename TileTriangulation::Tile_index Tile_index;
+
+    std::vector<unsigned char> buf;
+    {
+      std::ifstream in(filename(tri.id()), std::ios::in | std::ios::binary | std::ios::ate);
+      if (!in.is_open()) return false;
+      buf.resize(std::size_t(in.tellg()));
+      in.seekg(0);
+      if (!in.read(reinterpret_cast<char*>(buf.data()), buf.size())) return false;
+    }
+    const unsigned char *p = buf.data(), *end = p + buf.size();
+    if (buf.size() < sizeof(magic) + sizeof(double) || std::memcmp(p, magic, sizeof(magic))) return false;
+    p += sizeof(magic);
+    double quantum;
+    std::memcpy(&quantum, p, sizeof(double));
+    p += sizeof(double);
+
+    std::uint64_t dim, count;
+    if (!impl::read_varint(p, end, dim) || !impl::read_varint(p, end, count) || std::uint64_t(end - p) < dim) return false;
+    std::vector<unsigned char> quantized(p, p + dim);
+    p += dim;
+
+    std::vector<std::uint64_t> keys(dim, 0);
+    std::vector<double> coords(dim);
+    std::int64_t id = 0;
+    Vertex_index v;
+    Point point;
+    for(std::uint64_t i = 0; i < count; ++i) {
+      for(std::size_t d = 0; d < dim; ++d) {
+        std::uint64_t delta;
+        if (!impl::read_varint(p, end, delta)) { tri.clear(); return false; }
+        keys[d] += std::uint64_t(impl::zigzag_decode(delta));
+        coords[d] = quantized[d] ? double(std::int64_t(keys[d])) * quantum : impl::key_to_double(keys[d]);
+      }
+      std::uint64_t delta;
+      if (!impl::read_varint(p, end, delta)) { tri.clear(); return false; }
+      id += impl::zigzag_decode(delta);
+      assign(point, coords.begin(), coords.end());
+      v = tri.insert(point, Tile_index(id), v).first;
+    }
+    return true;
+  }
+
+  /// writes the sorted points of a tile triangulation to disk, as a binary file of delta encoded coordinates and tile indices.
+  template<typename TileTriangulation> bool write(const TileTriangulation& tri) const {
+    typedef typename TileTriangulation::Point Point;
+    typedef typename TileTriangulation::Vertex_index Vertex_index;
+    std::vector<std::size_t> indices;
+    std::vector<Point>  points;
+    std::vector<Vertex_index> vertices;
+    for(Vertex_index v = tri.vertices_begin(); v != tri.vertices_end(); ++v) {
+      if (!tri.vertex_is_infinite(v)) {
+        indices.push_back(points.size());
+        points.push_back(tri.triangulation_point(v));
+        vertices.push_back(v);
+      }
+    }
+    tri.spatial_sort(indices, points);
+
+    int dim = Kernel_traits<Point>::D ? Kernel_traits<Point>::D : tri.maximal_dimension();
+    // an axis is quantized if all its coordinates are exact multiples of the quantum
+    std::vector<unsigned char> quantized(dim, quantum_ > 0);
+    for(std::size_t i = 0; i < points.size(); ++i)
+      for(int d = 0; d < dim; ++d)
+        if (quantized[d] && !is_quantized(approximate_cartesian_coordinate(points[i], d)))
+          quantized[d] = false;
+
+    std::vector<unsigned char> buf(magic, magic + sizeof(magic));
+    buf.resize(sizeof(magic) + sizeof(double));
+    std::memcpy(buf.data() + sizeof(magic), &quantum_, sizeof(double));
+    impl::write_varint(buf, dim);
+    impl::write_varint(buf, points.size());
+    buf.insert(buf.end(), quantized.begin(), quantized.end());
+    buf.reserve(buf.size() + points.size() * (dim + 1) * 4);
+
+    std::vector<std::uint64_t> keys(dim, 0);
+    std::int64_t id = 0;
+    for (std::size_t index : indices) {
+      for(int d = 0; d < dim; ++d) {
+        double x = approximate_cartesian_coordinate(points[index], d);
+        std::uint64_t key = quantized[d] ? std::uint64_t(std::llround(x / quantum_)) : impl::double_to_key(x);
+        impl::write_varint(buf, impl::zigzag_encode(std::int64_t(key - keys[d])));
+        keys[d] = key;
+      }
+      std::int64_t vid = std::int64_t(tri.vertex_id(vertices[index]));
+      impl::write_varint(buf, impl::zigzag_encode(vid - id));
+      id = vid;
+    }
+
+    std::ofstream out(filename(tri.id()), std::ios::out | std::ios::binary);
+    out.write(reinterpret_cast<const char*>(buf.data()), buf.size());
+    return !out.fail();
+  }
+
+  /// returns the directory on the disk where file are written and read
+  const std::string& dirname() const { return dirname_; }
+
+  /// returns the quantum of the coordinates, or 0 if coordinates are not quantized
+  double quantum() const { return quantum_; }
+
+private:
+  static constexpr char magic[4] = { 'D', 'D', 'T', '1' };
+
+  bool is_quantized(double x) const
+  {
+    double k = std::round(x / quantum_);
+    return std::abs(k) < 9007199254740992. && k * quantum_ == x; // 2^53
+  }
+
+  template <typename TileIndex>
+  std::string filename(TileIndex i) const
+  {
+    return dirname_+std::to_string(i)+".bin";
+  }
+
+  std::string dirname_;
+  double quantum_;
+};
+
+inline std::ostream& operator<<(std::ostream& out, const Binary_points_serializer& serializer) {
+    return out << "Binary_points_serializer(dirname=" << serializer.dirname() << ", quantum=" << serializer.quantum() << ")";
+}
+
+}
+}
+
+#endif // CGAL_DDT_BINARY_POINTS_SERIALIZER_H
@@ -104,12 +104,11 @@ struct File_points_serializer
     std::vector<std::size_t> indices;
     std::vector<Point>  points;
     std::vector<Vertex_index> vertices;
-    std::size_t index = 0;
-    for(Vertex_index v = tri.vertices_begin(); v != tri.vertices_end(); ++v, ++index) {
+    for(Vertex_index v = tri.vertices_begin(); v != tri.vertices_end(); ++v) {
       if (!tri.vertex_is_infinite(v)) {
+        indices.push_back(points.size());
         points.push_back(tri.triangulation_point(v));
         vertices.push_back(v);
-        indices.push_back(index);
       }
     }
     tri.spatial_sort(indices, points);
@@ -19,6 +19,10 @@
 #include <CGAL/DDT/triangulation/Triangulation_traits.h>
 #include <CGAL/DDT/point_set/Point_set_traits.h>
 #include <CGAL/Spatial_sort_traits_adapter_d.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
 
 namespace CGAL {
 namespace DDT {
@@ -165,10 +169,100 @@ public:
             v->set_point(p);
             return std::make_pair(v, false);
         }
+        if constexpr (D > 0) {
+            if(tri.current_dimension() == D)
+                return std::make_pair(insert_in_conflict_zone(tri, p, c), true);
+        }
         Vertex_iterator v = tri.insert(p, lt, f, ft, c);
         return std::make_pair(v, true);
     }
 
+private:
+    // Inserts `p` in the full dimensional triangulation `tri` with a static dimension, given a cell `c` in conflict with `p`.
+    // This is equivalent to `tri.insert_in_conflicting_cell(p, c)`, but faster for the repeated insertions of bulk loading:
+    // the conflict zone is gathered in thread local buffers that are reused across insertions, so that no heap allocation occurs
+    // once they have grown, and visited marks are cleared by scanning the gathered cells rather than by a second traversal.
+    // The hole is then filled with one new cell per boundary facet, and the new cells are connected by matching their ridges
+    // in a small open addressing hash table, rather than by rotating around each ridge inside the conflict zone.
+    static Vertex_iterator insert_in_conflict_zone(Triangulation& tri, Point_const_reference p, Cell_iterator c)
+    {
+        typedef typename Triangulation::template Conflict_predicate<typename GT::Orientation_d, typename GT::Side_of_oriented_sphere_d> Conflict_predicate;
+        struct Ridge {
+            std::array<const void*, (D > 1 ? D-1 : 1)> vertices; // sorted addresses of the ridge vertices, other than the inserted vertex
+            Cell_iterator cell;
+            int index;
+        };
+        static thread_local std::vector<Cell_iterator> conflicts, boundary;
+        static thread_local std::vector<Ridge> ridges;
+        static thread_local std::vector<std::size_t> used;
+
+        Conflict_predicate in_conflict(tri, p, tri.geom_traits().orientation_d_object(), tri.geom_traits().side_of_oriented_sphere_d_object());
+        conflicts.clear();
+        boundary.clear();
+        conflicts.push_back(c);
+        c->tds_data().mark_visited();
+        for(std::size_t k = 0; k < conflicts.size(); ++k) {
+            Cell_iterator s = conflicts[k];
+            for(int i = 0; i <= D; ++i) {
+                Cell_iterator n = s->neighbor(i);
+                if(n->tds_data().is_visited()) continue;
+                n->tds_data().mark_visited();
+                if(in_conflict(n)) conflicts.push_back(n);
+                else boundary.push_back(n);
+            }
+        }
+        // only the cells in conflict remain marked
+        for(Cell_iterator n : boundary) n->tds_data().clear_visited();
+
+        std::size_t size = 64;
+        while(size < std::size_t(D+1) * D * conflicts.size()) size *= 2; // load factor below 1/2
+        if(ridges.size() < size) ridges.resize(size);
+        std::size_t mask = size - 1;
+        used.clear();
+
+        auto& tds = tri.tds();
+        Vertex_iterator v = tds.new_vertex();
+        v->set_point(p);
+        for(Cell_iterator s : conflicts) {
+            for(int j = 0; j <= D; ++j) {
+                Cell_iterator n = s->neighbor(j);
+                if(n->tds_data().is_visited()) continue;
+                // (s, j) is a boundary facet : its new cell replaces the vertex j of s by v, which preserves the orientation
+                Cell_iterator t = tds.new_full_cell();
+                for(int i = 0; i <= D; ++i)
+                    tds.associate_vertex_with_full_cell(t, i, i == j ? v : s->vertex(i));
+                tds.set_neighbors(t, j, n, s->mirror_index(j));
+                // the neighbor of t opposite to its vertex i != j is the other new cell incident to the ridge of v and the facet vertices other than i
+                for(int i = 0; i <= D; ++i) {
+                    if(i == j) continue;
+                    Ridge r;
+                    for(int k = 0, l = 0; k <= D; ++k)
+                        if(k != i && k != j) r.vertices[l++] = &*s->vertex(k);
+                    std::sort(r.vertices.begin(), r.vertices.end());
+                    std::size_t h = 0;
+                    for(const void* w : r.vertices) h = (h ^ reinterpret_cast<std::uintptr_t>(w)) * 0x9E3779B97F4A7C15ull;
+                    for(h = (h >> 32) & mask; ; h = (h + 1) & mask) {
+                        Ridge& e = ridges[h];
+                        if(e.cell == Cell_iterator()) {
+                            e = { r.vertices, t, i };
+                            used.push_back(h);
+                            break;
+                        }
+                        if(e.vertices == r.vertices) {
+                            tds.set_neighbors(t, i, e.cell, e.index);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        for(std::size_t h : used) ridges[h].cell = Cell_iterator();
+        tds.delete_full_cells(conflicts.begin(), conflicts.end());
+        return v;
+    }
+
+public:
+
     static inline void remove(Triangulation& tri, Vertex_index v)
     {
         tri.remove(remove_const_workaround(v));
@@ -0,0 +1,102 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/DDT/triangulation/Delaunay_triangulation_2.h>
+#include <CGAL/DDT/property_map/Vertex_info_property_map.h>
+#include <CGAL/DDT/partitioner/Grid_partitioner.h>
+#include <CGAL/Distributed_triangulation.h>
+#include <CGAL/DDT/point_set/Array_point_set.h>
+#include <CGAL/DDT/scheduler/Sequential_scheduler.h>
+#include <CGAL/DDT/IO/write_arrays.h>
+#include <CGAL/Random.h>
+
+#include <array>
+#include <algorithm>
+#include <map>
+#include <set>
+
+typedef int                                                                  Tile_index;
+typedef CGAL::Exact_predicates_inexact_constructions_kernel                  Geom_traits;
+typedef CGAL::Triangulation_vertex_base_with_info_2<Tile_index, Geom_traits> Vb;
+typedef CGAL::Triangulation_data_structure_2<Vb>                             TDS;
+typedef CGAL::Delaunay_triangulation_2<Geom_traits, TDS>                     Triangulation;
+typedef CGAL::DDT::Vertex_info_property_map<Triangulation>                   TileIndexProperty;
+typedef Triangulation::Point                                                 Point;
+typedef CGAL::DDT::Grid_partitioner<Tile_index, Point>                       Partitioner;
+typedef CGAL::Distributed_triangulation<Triangulation, TileIndexProperty>    Distributed_triangulation;
+typedef CGAL::DDT::Array_point_set<Point>                                    Array_point_set;
+
+int main(int, char **)
+{
+    int errors = 0;
+    // xyz rows, of which only xy coordinates are triangulated, to test strided access
+    const std::size_t N = 1000;
+    CGAL::Random random(0);
+    std::vector<double> coords(3*N);
+    for(double& c : coords) c = random.get_double(-1, 1);
+
+    std::vector<int> NT = { 3, 2 };
+    CGAL::Bbox_2 bbox(-1, -1, 1, 1);
+    Partitioner partitioner(1, bbox, NT.begin(), NT.end());
+    CGAL::DDT::Sequential_scheduler scheduler;
+
+    Array_point_set points(coords.data(), 2, 3, 1, 0, N);
+    auto pointset = CGAL::DDT::make_distributed_point_set(points, partitioner, scheduler);
+    std::size_t count = 0;
+    for(const auto& [id, ps] : pointset) {
+        for(auto it = ps.begin(); it != ps.end(); ++it, ++count) {
+            if (partitioner(*it) != id || (*it).x() != coords[3*it.row()] || (*it).y() != coords[3*it.row()+1]) {
+                std::cerr << "Point of row " << it.row() << " is not viewed correctly in tile " << id << std::endl;
+                ++errors;
+            }
+        }
+    }
+    if (count != N) {
+        std::cerr << count << " points in the distributed point set instead of " << N << std::endl;
+        ++errors;
+    }
+
+    Distributed_triangulation tri(2);
+    tri.insert(pointset, scheduler);
+
+    CGAL::DDT::Array_writer<Distributed_triangulation> writer(tri, scheduler);
+    std::vector<double> vertices(writer.number_of_vertices()*2);
+    std::vector<Tile_index> ids(writer.number_of_vertices());
+    std::vector<std::size_t> cells(writer.number_of_cells()*3);
+    writer.write_vertices(tri, scheduler, vertices.data(), ids.data());
+    writer.write_cells(tri, scheduler, cells.data());
+
+    // compare with a sequential triangulation of the same points
+    Triangulation dt;
+    for(std::size_t i = 0; i < N; ++i)
+        dt.insert(Point(coords[3*i], coords[3*i+1]));
+    if (writer.number_of_vertices() != dt.number_of_vertices() || writer.number_of_cells() != dt.number_of_faces()) {
+        std::cerr << writer.number_of_vertices() << " vertices and " << writer.number_of_cells() << " cells instead of "
+                  << dt.number_of_vertices() << " and " << dt.number_of_faces() << std::endl;
+        ++errors;
+    }
+    std::map<Point, std::size_t> index;
+    for(std::size_t i = 0; i < writer.number_of_vertices(); ++i) {
+        Point p(vertices[2*i], vertices[2*i+1]);
+        if (partitioner(p) != ids[i] || !index.emplace(p, i).second) {
+            std::cerr << "Vertex " << i << " is duplicated or has a wrong tile index" << std::endl;
+            ++errors;
+        }
+    }
+    std::set<std::array<std::size_t, 3>> faces;
+    for(auto f = dt.finite_faces_begin(); f != dt.finite_faces_end(); ++f) {
+        std::array<std::size_t, 3> face;
+        for(int i = 0; i < 3; ++i) face[i] = index[f->vertex(i)->point()];
+        std::sort(face.begin(), face.end());
+        faces.insert(face);
+    }
+    for(std::size_t c = 0; c < writer.number_of_cells(); ++c) {
+        std::array<std::size_t, 3> face = { cells[3*c], cells[3*c+1], cells[3*c+2] };
+        std::sort(face.begin(), face.end());
+        if (faces.erase(face) != 1) {
+            std::cerr << "Cell " << c << " is not a face of the Delaunay triangulation" << std::endl;
+            ++errors;
+        }
+    }
+    std::cout << errors << " error(s)." << std::endl;
+    return errors;
+}
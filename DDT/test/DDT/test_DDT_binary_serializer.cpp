@@ -0,0 +1,105 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/DDT/triangulation/Delaunay_triangulation_2.h>
+#include <CGAL/DDT/property_map/Vertex_info_property_map.h>
+#include <CGAL/DDT/partitioner/Grid_partitioner.h>
+#include <CGAL/DDT/scheduler/Sequential_scheduler.h>
+#include <CGAL/DDT/serializer/Binary_points_serializer.h>
+#include <CGAL/DDT/serializer/File_points_serializer.h>
+#include <CGAL/Distributed_triangulation.h>
+#include <CGAL/Random.h>
+
+#include <set>
+
+typedef int                                                                  Tile_index;
+typedef CGAL::Exact_predicates_inexact_constructions_kernel                  Geom_traits;
+typedef CGAL::Triangulation_vertex_base_with_info_2<Tile_index, Geom_traits> Vb;
+typedef CGAL::Triangulation_data_structure_2<Vb>                             TDS;
+typedef CGAL::Delaunay_triangulation_2<Geom_traits, TDS>                     Triangulation;
+typedef CGAL::DDT::Vertex_info_property_map<Triangulation>                   TileIndexProperty;
+typedef Triangulation::Point                                                 Point;
+typedef CGAL::DDT::Grid_partitioner<Tile_index, Point>                       Partitioner;
+typedef CGAL::DDT::Sequential_scheduler                                      Scheduler;
+typedef CGAL::DDT::Binary_points_serializer                                  Serializer;
+typedef CGAL::Distributed_triangulation<Triangulation, TileIndexProperty, Serializer> Distributed_triangulation;
+typedef Distributed_triangulation::Tile_triangulation                        Tile_triangulation;
+typedef Tile_triangulation::Vertex_index                                     Vertex_index;
+typedef std::vector<std::pair<Tile_index, Point>>                            Point_set;
+typedef CGAL::Distributed_point_set<Point_set, CGAL::DDT::Internal_property_map<Point_set>> Distributed_point_set;
+
+std::set<std::pair<Point, Tile_index>> vertices(const Tile_triangulation& tri)
+{
+    std::set<std::pair<Point, Tile_index>> s;
+    for(Vertex_index v = tri.vertices_begin(); v != tri.vertices_end(); ++v)
+        if (!tri.vertex_is_infinite(v))
+            s.emplace(tri.triangulation_point(v), tri.vertex_id(v));
+    return s;
+}
+
+// writes and reads back each tile with both serializers, and returns the number of errors
+int test_round_trip(const Distributed_triangulation& tri, const Serializer& binary, std::uintmax_t& binary_size, std::uintmax_t& text_size)
+{
+    int errors = 0;
+    CGAL::DDT::File_points_serializer text;
+    for(const auto& [id, t] : tri.tiles) {
+        if (!binary.write(t) || !text.write(t)) {
+            std::cerr << "Tile " << id << " could not be written" << std::endl;
+            ++errors;
+            continue;
+        }
+        binary_size += boost::filesystem::file_size(binary.dirname() + std::to_string(id) + ".bin");
+        text_size   += boost::filesystem::file_size(text.dirname() + std::to_string(id) + ".txt");
+        Tile_triangulation t2(id, 2, {});
+        if (!binary.read(t2) || vertices(t) != vertices(t2) || t2.number_of_cells() != t.number_of_cells()) {
+            std::cerr << "Tile " << id << " is not read back identically" << std::endl;
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int main(int, char **)
+{
+    int errors = 0;
+    const int N = 10000;
+    CGAL::Random random(0);
+    CGAL::Bbox_2 bbox(-1, -1, 1, 1);
+    Partitioner partitioner(1, bbox, 3);
+    Scheduler scheduler;
+
+    // random doubles, and points on a grid of step 1/1024, which are exact multiples of the quantum
+    std::vector<Point> points1, points2;
+    for(int i = 0; i < N; ++i) {
+        points1.emplace_back(random.get_double(-1, 1), random.get_double(-1, 1));
+        points2.emplace_back(random.get_int(-1024, 1024) / 1024., random.get_int(-1024, 1024) / 1024.);
+    }
+    Distributed_point_set random_points, grid_points;
+    random_points.insert(points1.begin(), points1.end(), partitioner);
+    grid_points.insert(points2.begin(), points2.end(), partitioner);
+
+    for(Distributed_point_set* points : { &random_points, &grid_points }) {
+        Serializer serializer("", 1./1024);
+        Distributed_triangulation tri(2, {}, 0, serializer);
+        tri.insert(*points, scheduler);
+
+        std::uintmax_t binary_size = 0, text_size = 0;
+        errors += test_round_trip(tri, serializer, binary_size, text_size);
+        std::cout << "binary: " << binary_size << " bytes, text: " << text_size << " bytes" << std::endl;
+        if (3 * binary_size > 2 * text_size) {
+            std::cerr << "Binary tiles are not smaller than text tiles" << std::endl;
+            ++errors;
+        }
+
+        // out of core triangulation, with at most two tiles in memory, in a new temporary directory
+        Distributed_triangulation tri2(2, {}, 2, Serializer("", 1./1024));
+        tri2.insert(*points, scheduler);
+        if (tri2.number_of_finite_vertices() != tri.number_of_finite_vertices() ||
+            tri2.number_of_finite_cells() != tri.number_of_finite_cells()) {
+            std::cerr << "Out of core triangulation differs from the in memory triangulation" << std::endl;
+            ++errors;
+        }
+    }
+
+    std::cout << errors << " error(s)." << std::endl;
+    return errors;
+}
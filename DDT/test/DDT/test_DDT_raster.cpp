@@ -0,0 +1,98 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Projection_traits_xy_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/DDT/triangulation/Delaunay_triangulation_2.h>
+#include <CGAL/DDT/kernel/Kernel_traits_3.h>
+#include <CGAL/DDT/property_map/Vertex_info_property_map.h>
+#include <CGAL/DDT/partitioner/Grid_partitioner.h>
+#include <CGAL/DDT/scheduler/Sequential_scheduler.h>
+#include <CGAL/DDT/IO/write_raster.h>
+#include <CGAL/Distributed_triangulation.h>
+#include <CGAL/Random.h>
+
+typedef int                                                                  Tile_index;
+typedef CGAL::Exact_predicates_inexact_constructions_kernel                  Kernel;
+typedef CGAL::Projection_traits_xy_3<Kernel>                                 Geom_traits;
+typedef CGAL::Triangulation_vertex_base_with_info_2<Tile_index, Geom_traits> Vb;
+typedef CGAL::Triangulation_data_structure_2<Vb>                             TDS;
+typedef CGAL::Delaunay_triangulation_2<Geom_traits, TDS>                     Triangulation;
+typedef CGAL::DDT::Vertex_info_property_map<Triangulation>                   TileIndexProperty;
+typedef Kernel::Point_3                                                      Point;
+typedef CGAL::DDT::Grid_partitioner<Tile_index, Point>                       Partitioner;
+typedef CGAL::Distributed_triangulation<Triangulation, TileIndexProperty>    Distributed_triangulation;
+typedef std::vector<std::pair<Tile_index, Point>>                            Point_set;
+typedef CGAL::Distributed_point_set<Point_set, CGAL::DDT::Internal_property_map<Point_set>> Distributed_point_set;
+
+// elevation model, which is exactly interpolated by any triangulation
+double plane(double x, double y) { return 2*x - 3*y + 1; }
+
+int main(int, char **)
+{
+    int errors = 0;
+    CGAL::Random random(0);
+    std::vector<Point> points;
+    for(int i = 0; i < 2000; ++i) {
+        double x = random.get_double(-1, 1);
+        double y = random.get_double(-1, 1);
+        points.emplace_back(x, y, plane(x, y));
+    }
+    // corners, so that the convex hull covers the whole raster
+    for(double x : {-1., 1.})
+        for(double y : {-1., 1.})
+            points.emplace_back(x, y, plane(x, y));
+
+    std::vector<int> NT = { 3, 2, 1 };
+    CGAL::Bbox_3 bbox(-1, -1, -10, 1, 1, 10);
+    Partitioner partitioner(1, bbox, NT.begin(), NT.end());
+    CGAL::DDT::Sequential_scheduler scheduler;
+    Distributed_triangulation tri(2);
+    Distributed_point_set pointset;
+    pointset.insert(points.begin(), points.end(), partitioner);
+    tri.insert(pointset, scheduler);
+
+    // 50x40 pixels, so that blocks have different sizes
+    CGAL::DDT::Raster_grid grid = { -1, -1, 2./50, 2./40, 50, 40 };
+    const std::string dirname = "out/test_DDT_raster";
+    const float nodata = -9999.f;
+    if (!CGAL::DDT::write_raster(tri, partitioner, grid, dirname, scheduler, CGAL::DDT::Point_z(), nodata)) {
+        std::cerr << "write_raster failed" << std::endl;
+        return 1;
+    }
+
+    // read back the blocks and check that they tile the raster with the interpolated elevations
+    CGAL::DDT::impl::Raster_blocks<Partitioner> blocks(partitioner, grid);
+    std::size_t count = 0;
+    for(Tile_index id = partitioner.begin(); id < partitioner.end(); ++id) {
+        std::size_t i0, j0, i1, j1;
+        blocks.block(id, i0, j0, i1, j1);
+        std::vector<float> block((i1-i0)*(j1-j0));
+        std::ifstream raw(dirname + "/" + std::to_string(id) + ".raw", std::ios::in | std::ios::binary);
+        raw.read(reinterpret_cast<char*>(block.data()), block.size()*sizeof(float));
+        if (!raw) {
+            std::cerr << "Block " << id << " could not be read" << std::endl;
+            ++errors;
+            continue;
+        }
+        for(std::size_t j = j0; j < j1; ++j) {
+            for(std::size_t i = i0; i < i1; ++i) {
+                float v = block[(j-j0)*(i1-i0) + (i-i0)];
+                double expected = plane(grid.x(i), grid.y(j));
+                if (v == nodata || std::abs(v - expected) > 1e-4) {
+                    std::cerr << "Pixel (" << i << "," << j << ") = " << v << " != " << expected << std::endl;
+                    ++errors;
+                }
+                ++count;
+            }
+        }
+    }
+    if (count != grid.width*grid.height) {
+        std::cerr << count << " pixels in blocks, instead of " << grid.width*grid.height << std::endl;
+        ++errors;
+    }
+    if (!std::ifstream(dirname + "/raster.vrt").good()) {
+        std::cerr << "Missing mosaic VRT file" << std::endl;
+        ++errors;
+    }
+    std::cout << errors << " error(s)." << std::endl;
+    return errors;
+}
@@ -0,0 +1,91 @@
+// Times the refinement and grading of an octree, sequentially and in
+// parallel, as well as nearest neighbor queries on the resulting tree.
+// Usage: parallel_construction [output csv] [max number of points]
+
+#define CGAL_TRACE_STREAM std::cerr
+
+#include "util.h"
+
+#include <CGAL/Simple_cartesian.h>
+
+#include <CGAL/Octree.h>
+#include <CGAL/point_generators_3.h>
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::Point_3 Point;
+typedef CGAL::Point_set_3<Point> Point_set;
+typedef Point_set::Point_map Point_map;
+
+typedef CGAL::Octree<Kernel, Point_set, Point_map> Octree;
+
+using std::chrono::milliseconds;
+
+template <typename ConcurrencyTag>
+void run(Point_set points, const std::vector<Point>& queries, std::ofstream& file) {
+
+  Octree octree(points, points.point_map());
+
+  auto refine_time = bench<milliseconds>(
+          [&] {
+            octree.refine<ConcurrencyTag>(10, 20);
+          }
+  );
+
+  auto grade_time = bench<milliseconds>(
+          [&] {
+            octree.grade<ConcurrencyTag>();
+          }
+  );
+
+  std::vector<Point> neighbors;
+  auto search_time = bench<milliseconds>(
+          [&] {
+            for (const Point& query : queries) {
+              neighbors.clear();
+              octree.nearest_neighbors(query, 10, std::back_inserter(neighbors));
+            }
+          }
+  );
+
+  file << "," << refine_time.count() << "," << grade_time.count() << "," << search_time.count();
+}
+
+int main(int argc, char **argv) {
+
+  // Set output file
+  std::ofstream file;
+  file.open((argc > 1) ? argv[1] : "../parallel_construction_benchmark.csv");
+  const std::size_t max_points = (argc > 2) ? std::atol(argv[2]) : 10000000;
+
+  // Add header for CSV
+  file << "Number of Points,Refine,Grade,Search,Parallel Refine,Parallel Grade,Parallel Search \n";
+
+  CGAL::Random_points_on_sphere_3<Point> generator;
+  std::vector<Point> queries;
+  std::copy_n(generator, 100000, std::back_inserter(queries));
+
+  // Perform tests for various dataset sizes
+  for (size_t num_points = 1000; num_points <= max_points; num_points *= 2) {
+
+    // Create a collection of the right number of points
+    auto points = generate<Kernel>(num_points);
+
+    file << num_points;
+    run<CGAL::Sequential_tag>(points, queries, file);
+#ifdef CGAL_LINKED_WITH_TBB
+    run<CGAL::Parallel_tag>(points, queries, file);
+#endif
+    file << "\n";
+
+    std::cout << num_points << std::endl;
+  }
+
+  file.close();
+
+  return 0;
+}
@@ -24,6 +24,7 @@
 #include <CGAL/intersections.h>
 #include <CGAL/squared_distance_3.h>
 #include <CGAL/Dimension.h>
+#include <CGAL/tags.h>
 
 #include <boost/function.hpp>
 #include <boost/iterator/iterator_facade.hpp>
@@ -34,12 +35,20 @@
 #include <ostream>
 #include <functional>
 
+#include <algorithm>
 #include <bitset>
 #include <stack>
 #include <queue>
+#include <type_traits>
 #include <vector>
 #include <math.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#endif
+
 namespace CGAL {
 
 /*!
@@ -283,17 +292,7 @@ public:
   // Destructor
   ~Orthtree()
   {
-    std::queue<Node> nodes;
-    nodes.push(m_root);
-    while (!nodes.empty())
-    {
-      Node node = nodes.front();
-      nodes.pop();
-      if (!node.is_leaf())
-        for (std::size_t i = 0; i < Degree::value; ++ i)
-          nodes.push (node[i]);
-      node.free();
-    }
+    m_root.free();
   }
 
   // move constructor
@@ -314,60 +313,54 @@ public:
     while nodes that were not split and for which `split_predicate`
     returns `true` are split.
 
+    The tree is refined one depth level at a time. With `Parallel_tag`,
+    the split predicate is evaluated on the nodes of a level in parallel,
+    and the points of the nodes that are split are distributed to their
+    children in parallel, so `split_predicate` must be safe to call
+    concurrently. The tree is the same whatever the concurrency tag.
+
+    \tparam ConcurrencyTag enables sequential versus parallel refinement.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
     \param split_predicate determines whether or not a node needs to
     be subdivided.
    */
+  template <typename ConcurrencyTag = Sequential_tag>
   void refine(const Split_predicate& split_predicate) {
 
     // If the tree has already been refined, reset it
-    if (!m_root.is_leaf()){
-      std::queue<Node> nodes;
-      for (std::size_t i = 0; i < Degree::value; ++ i)
-            nodes.push (m_root[i]);
-      while (!nodes.empty())
-      {
-        Node node = nodes.front();
-        nodes.pop();
-        if (!node.is_leaf())
-          for (std::size_t i = 0; i < Degree::value; ++ i)
-            nodes.push (node[i]);
-        node.free();
-      }
-      m_root.unsplit();
-    }
+    m_root.unsplit();
 
     // Reset the side length map, too
     m_side_per_depth.resize(1);
 
-    // Initialize a queue of nodes that need to be refined
-    std::queue<Node> todo;
-    todo.push(m_root);
-
-    // Process items in the queue until it's consumed fully
-    while (!todo.empty()) {
+    // The nodes of the current depth level, and the ones of them that must be split
+    std::vector<Node> level(1, m_root);
+    std::vector<Node> to_split;
 
-      // Get the next element
-      Node current = todo.front();
-      todo.pop();
+    while (!level.empty()) {
 
-      // Check if this node needs to be processed
-      if (split_predicate(current)) {
+      // Check which nodes need to be processed
+      to_split.clear();
+      select_nodes<ConcurrencyTag>(level, split_predicate, to_split);
+      if (to_split.empty())
+        break;
 
-        // Check if we've reached a new max depth
-        if (current.depth() == depth()) {
+      // Check if we've reached a new max depth
+      if (to_split.front().depth() == depth()) {
 
-          // Update the side length map
-          m_side_per_depth.push_back(*(m_side_per_depth.end() - 1) / 2);
-        }
+        // Update the side length map
+        m_side_per_depth.push_back(*(m_side_per_depth.end() - 1) / 2);
+      }
 
-        // Split the node, redistributing its points to its children
-        split(current);
+      // Split the nodes, redistributing their points to their children
+      split<ConcurrencyTag>(to_split);
 
-        // Process each of its children
+      // Process their children
+      level.clear();
+      for (const Node& node : to_split)
         for (int i = 0; i < Degree::value; ++i)
-          todo.push(current[i]);
-
-      }
+          level.push_back(node[i]);
     }
   }
 
@@ -378,7 +371,7 @@ public:
     predicate.
 
     This is equivalent to calling
-    `refine(Orthtrees::Maximum_depth_and_maximum_number_of_inliers(max_depth,
+    `refine<ConcurrencyTag>(Orthtrees::Maximum_depth_and_maximum_number_of_inliers(max_depth,
     bucket_size))`.
 
     The refinement is stopped as soon as one of the conditions is
@@ -387,69 +380,117 @@ public:
     at a depth smaller than `max_depth` but already has fewer inliers
     than `bucket_size`, it is not split.
 
+    \tparam ConcurrencyTag enables sequential versus parallel refinement.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
     \param max_depth deepest a tree is allowed to be (nodes at this depth will not be split).
     \param bucket_size maximum points a node is allowed to contain.
    */
+  template <typename ConcurrencyTag = Sequential_tag>
   void refine(size_t max_depth = 10, size_t bucket_size = 20) {
-    refine(Orthtrees::Maximum_depth_and_maximum_number_of_inliers(max_depth, bucket_size));
+    refine<ConcurrencyTag>(Orthtrees::Maximum_depth_and_maximum_number_of_inliers(max_depth, bucket_size));
   }
 
   /*!
     \brief refines the orthtree such that the difference of depth
     between two immediate neighbor leaves is never more than 1.
+
+    The leaves are checked in rounds: the neighbors of the leaves of a
+    round that are too large are split together, and their children, as
+    well as the leaves that required them to be split, are checked in
+    the next round. With `Parallel_tag`, the leaves of a round are
+    checked in parallel, and the points of the nodes that are split are
+    distributed to their children in parallel.
+    The tree is the same whatever the concurrency tag.
+
+    \tparam ConcurrencyTag enables sequential versus parallel grading.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
    */
+  template <typename ConcurrencyTag = Sequential_tag>
   void grade() {
 
-    // Collect all the leaf nodes
-    std::queue<Node> leaf_nodes;
-    for (Node leaf : traverse(Orthtrees::Leaves_traversal())) {
-      // TODO: I'd like to find a better (safer) way of doing this
-      leaf_nodes.push(leaf);
-    }
+    constexpr int nb_directions = 2 * Dimension::value;
+    typedef std::bitset<nb_directions> Directions;
 
-    // Iterate over the nodes
-    while (!leaf_nodes.empty()) {
+    // Collect all the leaf nodes
+    std::vector<Node> leaves;
+    for (Node leaf : traverse(Orthtrees::Leaves_traversal()))
+      leaves.push_back(leaf);
+
+    std::vector<Directions> too_large_neighbors;
+    std::vector<bool> is_selected;
+    std::vector<Node> to_split, next_leaves;
+    while (!leaves.empty()) {
+
+      // Find the directions in which each leaf has a neighbor that breaks our grading rule
+      too_large_neighbors.assign(leaves.size(), Directions());
+      for_each_index<ConcurrencyTag>(leaves.size(), [&](std::size_t l)
+      {
+        const Node& node = leaves[l];
 
-      // Get the next node
-      Node node = leaf_nodes.front();
-      leaf_nodes.pop();
+        // Iterate over each of the neighbors
+        for (int direction = 0; direction < nb_directions; ++direction) {
 
-      // Skip this node if it isn't a leaf anymore
-      if (!node.is_leaf())
-        continue;
+          // Get the neighbor
+          Node neighbor = node.adjacent_node(direction);
 
-      // Iterate over each of the neighbors
-      for (int direction = 0; direction < 6; ++direction) {
+          // If it doesn't exist, skip it
+          if (neighbor.is_null())
+            continue;
 
-        // Get the neighbor
-        Node neighbor = node.adjacent_node(direction);
+          // Skip if this neighbor is a direct sibling (it's guaranteed to be the same depth)
+          if (neighbor.parent() == node.parent())
+            continue;
 
-        // If it doesn't exist, skip it
-        if (neighbor.is_null())
-          continue;
+          // If it's already been split, skip it
+          if (!neighbor.is_leaf())
+            continue;
 
-        // Skip if this neighbor is a direct sibling (it's guaranteed to be the same depth)
-        // TODO: This check might be redundant, if it doesn't affect performance maybe I could remove it
-        if (neighbor.parent() == node.parent())
-          continue;
+          // Check if the neighbor breaks our grading rule
+          if ((node.depth() - neighbor.depth()) > 1)
+            too_large_neighbors[l][direction] = true;
+        }
+      });
 
-        // If it's already been split, skip it
-        if (!neighbor.is_leaf())
+      // Gather the neighbors to split, each once, in the order of the leaves
+      to_split.clear();
+      next_leaves.clear();
+      is_selected.assign(m_root.m_storage->size(), false);
+      for (std::size_t l = 0; l < leaves.size(); ++l) {
+        if (too_large_neighbors[l].none())
           continue;
 
-        // Check if the neighbor breaks our grading rule
-        // TODO: could the rule be parametrized?
-        if ((node.depth() - neighbor.depth()) > 1) {
+        bool still_too_large = false;
+        for (int direction = 0; direction < nb_directions; ++direction) {
+          if (!too_large_neighbors[l][direction])
+            continue;
 
-          // Split the neighbor
-          split(neighbor);
-
-          // Add newly created children to the queue
-          for (int i = 0; i < Degree::value; ++i) {
-            leaf_nodes.push(neighbor[i]);
+          Node neighbor = leaves[l].adjacent_node(direction);
+          if (!is_selected[neighbor.m_index]) {
+            is_selected[neighbor.m_index] = true;
+            to_split.push_back(neighbor);
           }
+
+          // Splitting the neighbor only reduces the difference of depth by one
+          if ((leaves[l].depth() - neighbor.depth()) > 2)
+            still_too_large = true;
         }
+
+        // This leaf may still break the grading rule with the children of its neighbors
+        if (still_too_large)
+          next_leaves.push_back(leaves[l]);
       }
+      if (to_split.empty())
+        break;
+
+      // Split the neighbors
+      split<ConcurrencyTag>(to_split);
+
+      // Add newly created children to the next round
+      for (const Node& node : to_split)
+        for (int i = 0; i < Degree::value; ++i)
+          next_leaves.push_back(node[i]);
+      leaves.swap(next_leaves);
     }
   }
 
@@ -688,6 +729,7 @@ public:
 
 private: // functions :
 
+  template <typename ConcurrencyTag = Sequential_tag>
   void reassign_points(Node &node, Range_iterator begin, Range_iterator end, const Point &center,
                        std::bitset<Dimension::value> coord = {},
                        std::size_t dimension = 0) {
@@ -712,28 +754,100 @@ private: // functions :
     // Further subdivide the first side of the split
     std::bitset<Dimension::value> coord_left = coord;
     coord_left[dimension] = false;
-    reassign_points(node, begin, split_point, center, coord_left, dimension + 1);
 
     // Further subdivide the second side of the split
     std::bitset<Dimension::value> coord_right = coord;
     coord_right[dimension] = true;
-    reassign_points(node, split_point, end, center, coord_right, dimension + 1);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+        && std::size_t(std::distance(begin, end)) > parallel_threshold)
+    {
+      tbb::parallel_invoke(
+        [&]{ reassign_points<ConcurrencyTag>(node, begin, split_point, center, coord_left, dimension + 1); },
+        [&]{ reassign_points<ConcurrencyTag>(node, split_point, end, center, coord_right, dimension + 1); });
+      return;
+    }
+#endif
+
+    reassign_points<ConcurrencyTag>(node, begin, split_point, center, coord_left, dimension + 1);
+    reassign_points<ConcurrencyTag>(node, split_point, end, center, coord_right, dimension + 1);
 
   }
 
-  void split(Node& node) {
+  // Ranges of points or nodes larger than this are processed in parallel
+  static constexpr std::size_t parallel_threshold = 4096;
+
+  // Calls `f(i)` for each `i` in [0, n)
+  template <typename ConcurrencyTag, typename Function>
+  static void for_each_index(std::size_t n, const Function& f) {
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for (std::size_t i = r.begin(); i != r.end(); ++i)
+          f(i);
+      });
+      return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < n; ++i)
+      f(i);
+  }
 
-    // Make sure the node hasn't already been split
-    CGAL_precondition (node.is_leaf());
+  // Appends to `selected` the nodes of `nodes` for which `predicate` holds, in order
+  template <typename ConcurrencyTag>
+  static void select_nodes(const std::vector<Node>& nodes,
+                           const Split_predicate& predicate,
+                           std::vector<Node>& selected) {
 
-    // Split the node to create children
-    node.split();
+    std::vector<char> is_selected(nodes.size());
+    for_each_index<ConcurrencyTag>(nodes.size(), [&](std::size_t i)
+    {
+      is_selected[i] = predicate(nodes[i]);
+    });
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+      if (is_selected[i])
+        selected.push_back(nodes[i]);
+  }
 
-    // Find the point to around which the node is split
-    Point center = barycenter(node);
+  // Splits the leaves `nodes`, redistributing their points to their children.
+  // The storage of all the children is allocated first, so that the
+  // nodes can then be processed independently.
+  template <typename ConcurrencyTag>
+  void split(const std::vector<Node>& nodes) {
 
-    // Add the node's points to its children
-    reassign_points(node, node.points().begin(), node.points().end(), center);
+    typename Node::Storage& storage = *m_root.m_storage;
+    const std::size_t first_child = storage.size();
+    storage.resize(first_child + nodes.size() * Degree::value);
+
+    for_each_index<ConcurrencyTag>(nodes.size(), [&](std::size_t i)
+    {
+      Node node = nodes[i];
+
+      // Make sure the node hasn't already been split
+      CGAL_precondition (node.is_leaf());
+
+      // Split the node to create children
+      storage.set_children(node.m_index, first_child + i * Degree::value);
+
+      // Find the point to around which the node is split
+      Point center = barycenter(node);
+
+      // Add the node's points to its children
+      reassign_points<ConcurrencyTag>(node, node.points().begin(), node.points().end(), center);
+    });
+  }
+
+  void split(Node& node) {
+    split<Sequential_tag>(std::vector<Node>(1, node));
   }
 
   bool do_intersect(const Node &node, const Sphere &sphere) const {
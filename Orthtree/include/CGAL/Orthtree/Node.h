@@ -18,11 +18,16 @@
 
 #include <boost/range/iterator_range.hpp>
 
+#include <CGAL/use.h>
+
 #include <array>
 #include <memory>
 #include <bitset>
 #include <cassert>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 namespace CGAL {
 
@@ -46,23 +51,7 @@ struct Node_access
   static void split(Node node) { return node.split(); }
 
   template <typename Node>
-  static void free(Node node)
-  {
-    typedef Dimension_tag<(2 << (Node::Dimension::value - 1))> Degree;
-    std::queue<Node> nodes;
-    nodes.push(node);
-    while (!nodes.empty())
-    {
-      Node node = nodes.front();
-      nodes.pop();
-      if (!node.is_leaf()){
-        for (std::size_t i = 0; i < Degree::value; ++ i){
-          nodes.push (node[i]);
-        }
-      }
-      node.free();
-    }
-  }
+  static void free(Node node) { node.free(); }
 
 };
 
@@ -98,13 +87,6 @@ public:
   typedef typename Orthtree<Traits, PointRange, PointMap>::Node Self;
 
 
-  /// \cond SKIP_IN_MANUAL
-  /*!
-   * \brief Array for containing the child nodes of this node.
-   */
-  typedef std::array<Self, Degree::value> Children;
-  /// \endcond
-
   /*!
     \brief Set of bits representing this node's relationship to its parent.
 
@@ -144,20 +126,49 @@ private:
   typedef boost::iterator_range<iterator> Point_range;
   /// \endcond
 
-  // make Node trivially copiabled
-  struct Data
+  // The nodes of a tree are stored in arrays, one per property, and are
+  // addressed by their index in these arrays. The children of a node are
+  // consecutive, so that a node only stores the index of its first child.
+  struct Storage
   {
-    Point_range points;
-    Self parent;
-    std::uint8_t depth;
-    Global_coordinates global_coordinates;
-    std::unique_ptr<Children> children;
-
-    Data (Self parent)
-      : parent (parent), depth (0) { }
+    static constexpr std::size_t invalid = (std::numeric_limits<std::size_t>::max)();
+
+    std::vector<Point_range> points;
+    std::vector<std::size_t> parents;
+    std::vector<std::size_t> children; // index of the first child, or `invalid` for a leaf
+    std::vector<std::uint8_t> depths;
+    std::vector<Global_coordinates> global_coordinates;
+
+    std::size_t size() const { return parents.size(); }
+
+    // New nodes are roots without children
+    void resize(std::size_t n)
+    {
+      points.resize(n);
+      parents.resize(n, invalid);
+      children.resize(n, invalid);
+      depths.resize(n, 0);
+      global_coordinates.resize(n, Global_coordinates());
+    }
+
+    // Makes the `Degree::value` nodes starting at `first_child` the children of `node`
+    void set_children(std::size_t node, std::size_t first_child)
+    {
+      children[node] = first_child;
+      for (std::size_t index = 0; index < Degree::value; ++ index)
+      {
+        const std::size_t child = first_child + index;
+        parents[child] = node;
+        children[child] = invalid;
+        depths[child] = std::uint8_t(depths[node] + 1);
+        for (int i = 0; i < Dimension::value; i++)
+          global_coordinates[child][i] = (2 * global_coordinates[node][i]) + ((index >> i) & 1);
+      }
+    }
   };
 
-  Data* m_data;
+  Storage* m_storage;
+  std::size_t m_index;
 
 
   /// \cond SKIP_IN_MANUAL
@@ -169,68 +180,49 @@ private:
   // Hidden class to access methods for testing purposes
   friend Orthtrees::Node_access;
 
+  Node(Storage* storage, std::size_t index)
+    : m_storage (storage), m_index (index) { }
+
   /*!
    * \brief Access to the content held by this node
    * \return a reference to the collection of point indices
    */
-  Point_range &points() { return m_data->points; }
-  const Point_range &points() const { return m_data->points; }
+  Point_range &points() { return m_storage->points[m_index]; }
+  const Point_range &points() const { return m_storage->points[m_index]; }
 
   /// \name Construction
   /// @{
 
   /*!
-    \brief creates a new node, optionally as the child of a parent
-
-    If no parent is provided, the node created is assumed to be the
-    root of a tree.  This means that `parent.is_null()` returns
-    `true`, and the depth is zero.  If a parent is provided, the node
-    becomes the child of that parent.  In that case, an index should
-    be passed, telling this node its relationship to its parent.
-    Depth and global coordinates are automatically determined in the
-    constructor, and should generally be considered immutable after
-    construction.
-
-    \param parent the node containing this one
-    \param index this node's relationship to its parent
-  */
-  explicit Node(Self parent, Local_coordinates local_coordinates)
-    : m_data (new Data(parent)) {
+    \brief creates the root node of a new tree.
 
-    if (!parent.is_null()) {
+    The node has a depth of zero, and its storage is released by `free()`.
 
-      m_data->depth = parent.m_data->depth + 1;
-
-      for (int i = 0; i < Dimension::value; i++)
-        m_data->global_coordinates[i] = (2 * parent.m_data->global_coordinates[i]) + local_coordinates[i];
+    \param parent must be a null node
+  */
+  explicit Node(Self parent, Local_coordinates)
+    : m_storage (new Storage), m_index (0) {
 
-    }
-    else
-      for (int i = 0; i < Dimension::value; i++)
-        m_data->global_coordinates[i] = 0;
+    CGAL_precondition (parent.is_null());
+    CGAL_USE (parent);
+    m_storage->resize(1);
   }
 
-  void free() { delete m_data; }
+  // Releases the storage of the tree, if this node is its root
+  void free()
+  {
+    if (!is_null() && is_root())
+      delete m_storage;
+  }
 
-  Node deep_copy(Self parent = Node()) const
+  // Copies the tree of this root node
+  Node deep_copy() const
   {
     if (is_null())
       return Node();
 
-    Node out;
-    out.m_data = new Data(parent);
-
-    out.m_data->points = m_data->points;
-    out.m_data->depth = m_data->depth;
-    out.m_data->global_coordinates = m_data->global_coordinates;
-    std::unique_ptr<Children> children;
-    if (!is_leaf())
-    {
-      out.m_data->children = std::make_unique<Children>();
-      for (int index = 0; index < Degree::value; index++)
-        (*out.m_data->children)[index] = (*this)[index].deep_copy(out);
-    }
-    return out;
+    CGAL_precondition (is_root());
+    return Node(new Storage(*m_storage), m_index);
   }
 
   /// @}
@@ -251,23 +243,23 @@ private:
 
     CGAL_precondition (is_leaf());
 
-    m_data->children = std::make_unique<Children>();
-    for (int index = 0; index < Degree::value; index++) {
-
-      (*m_data->children)[index] = std::move(Self(*this, {Local_coordinates(index)}));
-
-    }
+    const std::size_t first_child = m_storage->size();
+    m_storage->resize(first_child + Degree::value);
+    m_storage->set_children(m_index, first_child);
   }
 
   /*!
    * \brief eliminates this node's children, making it a leaf node.
    *
-   * When a node is un-split, its children are automatically deleted.
    * After un-splitting a node it will be considered a leaf node.
+   * The storage of the descendants of the root is released, while
+   * the descendants of other nodes are only detached.
    */
   void unsplit() {
 
-    m_data->children.reset();
+    m_storage->children[m_index] = Storage::invalid;
+    if (is_root())
+      m_storage->resize(1);
   }
 
   /// @}
@@ -279,10 +271,15 @@ public:
 
   /// \cond SKIP_IN_MANUAL
   // Default creates null node
-  Node() : m_data(nullptr) { }
+  Node() : m_storage(nullptr), m_index(0) { }
 
   // Comparison operator
-  bool operator< (const Node& other) const { return m_data < other.m_data; }
+  bool operator< (const Node& other) const
+  {
+    if (m_storage != other.m_storage)
+      return std::less<Storage*>()(m_storage, other.m_storage);
+    return m_index < other.m_index;
+  }
   /// \endcond
 
   /// \name Type & Location
@@ -291,7 +288,7 @@ public:
   /*!
     \brief returns `true` if the node is null, `false` otherwise.
   */
-  bool is_null() const { return (m_data == nullptr); }
+  bool is_null() const { return (m_storage == nullptr); }
 
   /*!
     \brief returns `true` if the node has no parent, `false` otherwise.
@@ -300,7 +297,7 @@ public:
   bool is_root() const
   {
     CGAL_precondition(!is_null());
-    return m_data->parent.is_null();
+    return m_storage->parents[m_index] == Storage::invalid;
   }
 
   /*!
@@ -310,7 +307,7 @@ public:
   bool is_leaf() const
   {
     CGAL_precondition(!is_null());
-    return (!m_data->children);
+    return m_storage->children[m_index] == Storage::invalid;
   }
 
   /*!
@@ -320,7 +317,7 @@ public:
   std::uint8_t depth() const
   {
     CGAL_precondition (!is_null());
-    return m_data->depth;
+    return m_storage->depths[m_index];
   }
 
   /*!
@@ -347,7 +344,7 @@ public:
   Global_coordinates global_coordinates() const
   {
     CGAL_precondition (!is_null());
-    return m_data->global_coordinates;
+    return m_storage->global_coordinates[m_index];
   }
 
 
@@ -361,7 +358,9 @@ public:
   Self parent() const
   {
     CGAL_precondition (!is_null());
-    return m_data->parent;
+    if (is_root())
+      return Self();
+    return Self(m_storage, m_storage->parents[m_index]);
   }
 
   /*!
@@ -424,7 +423,7 @@ public:
     CGAL_precondition (!is_leaf());
     CGAL_precondition (index < Degree::value);
 
-    return (*m_data->children)[index];
+    return Self(m_storage, m_storage->children[m_index] + index);
   }
 
   /*!
@@ -544,27 +543,27 @@ public:
     \brief checks whether the node is empty of points or not.
    */
   bool empty() const {
-    return m_data->points.empty();
+    return points().empty();
   }
 
   /*!
     \brief returns the number of points of this node.
    */
   std::size_t size() const {
-    return std::size_t(std::distance(m_data->points.begin(), m_data->points.end()));
+    return std::size_t(std::distance(points().begin(), points().end()));
   }
 
   /*!
     \brief returns the iterator at the start of the collection of
     points held by this node.
    */
-  const_iterator begin() const { return m_data->points.begin(); }
+  const_iterator begin() const { return points().begin(); }
 
   /*!
     \brief returns the iterator at the end of the collection of
     points held by this node.
    */
-  const_iterator end() const { return m_data->points.end(); }
+  const_iterator end() const { return points().end(); }
 
   /// @}
 
@@ -581,7 +580,7 @@ public:
    * \return whether the nodes have different topology.
    */
   bool operator==(const Self &rhs) const {
-    return m_data == rhs.m_data;
+    return m_storage == rhs.m_storage && m_index == rhs.m_index;
   }
 
   static bool is_topology_equal (const Self& a, const Self& b)
@@ -0,0 +1,128 @@
+#define CGAL_TRACE_STREAM std::cerr
+
+#include <iostream>
+#include <CGAL/Octree.h>
+#include <CGAL/Quadtree.h>
+#include <CGAL/Orthtree/Traversals.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Point_set_3.h>
+
+#include <cassert>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::Point_2 Point_2;
+typedef Kernel::Point_3 Point;
+typedef CGAL::Point_set_3<Point> Point_set;
+typedef CGAL::Octree<Kernel, Point_set, typename Point_set::Point_map> Octree;
+typedef CGAL::Quadtree<Kernel, std::vector<Point_2> > Quadtree;
+typedef CGAL::Orthtrees::Preorder_traversal Preorder_traversal;
+typedef CGAL::Orthtrees::Leaves_traversal Leaves_traversal;
+
+// Checks that both trees have the same nodes, with the same points in the same order
+template <typename Tree>
+void assert_identical(const Tree& a, const Tree& b) {
+
+  assert(a == b);
+  assert(a.depth() == b.depth());
+
+  auto range_a = a.traverse(Preorder_traversal());
+  auto range_b = b.traverse(Preorder_traversal());
+  auto it_b = range_b.begin();
+  for (auto node_a : range_a) {
+    auto node_b = *(it_b++);
+    assert(node_a.depth() == node_b.depth());
+    assert(node_a.global_coordinates() == node_b.global_coordinates());
+    assert(std::equal(node_a.begin(), node_a.end(), node_b.begin(), node_b.end()));
+  }
+}
+
+template <typename Tree>
+std::size_t count_jumps(const Tree& tree) {
+
+  std::size_t jumps = 0;
+
+  for (auto node : tree.traverse(Leaves_traversal())) {
+
+    for (int direction = 0; direction < 2 * Tree::Dimension::value; ++direction) {
+
+      auto adjacent_node = node.adjacent_node(direction);
+
+      if (adjacent_node.is_null())
+        continue;
+
+      if ((node.depth() - adjacent_node.depth()) > 1)
+        jumps++;
+    }
+  }
+
+  return jumps;
+}
+
+void test_octree(std::size_t dataset_size) {
+
+  // Create a dataset, clustered so that the tree is unbalanced
+  Point_set points;
+  CGAL::Random random(42);
+  CGAL::Random_points_in_cube_3<Point> cube(1., random);
+  CGAL::Random_points_in_sphere_3<Point> ball(0.01, random);
+  points.reserve(dataset_size);
+  for (std::size_t i = 0; i < dataset_size; ++i)
+    points.insert((i % 4 == 0) ? *(ball++) : *(cube++));
+
+  Octree sequential(points, points.point_map());
+  Octree parallel(points, points.point_map());
+
+  // Refine the octrees
+  sequential.refine<CGAL::Sequential_tag>(12, 10);
+  parallel.refine<CGAL::Parallel_if_available_tag>(12, 10);
+  assert_identical(sequential, parallel);
+
+  // Grade the octrees
+  sequential.grade<CGAL::Sequential_tag>();
+  parallel.grade<CGAL::Parallel_if_available_tag>();
+  assert_identical(sequential, parallel);
+  assert(count_jumps(parallel) == 0);
+
+  // Refining again resets the tree
+  parallel.refine<CGAL::Parallel_if_available_tag>(4, 10);
+  sequential.refine(4, 10);
+  assert_identical(sequential, parallel);
+
+  // The copy of a tree is identical to it
+  Octree copy(parallel);
+  assert_identical(copy, parallel);
+}
+
+void test_quadtree(std::size_t dataset_size) {
+
+  CGAL::Random random(42);
+  CGAL::Random_points_in_disc_2<Point_2> disc(0.01, random);
+  CGAL::Random_points_in_square_2<Point_2> square(1., random);
+  std::vector<Point_2> points;
+  for (std::size_t i = 0; i < dataset_size; ++i)
+    points.push_back((i % 4 == 0) ? *(disc++) : *(square++));
+
+  std::vector<Point_2> parallel_points(points);
+  Quadtree sequential(points);
+  Quadtree parallel(parallel_points);
+
+  sequential.refine(15, 5);
+  parallel.refine<CGAL::Parallel_if_available_tag>(15, 5);
+  assert_identical(sequential, parallel);
+
+  sequential.grade();
+  parallel.grade<CGAL::Parallel_if_available_tag>();
+  assert_identical(sequential, parallel);
+  assert(count_jumps(parallel) == 0);
+}
+
+int main(void) {
+
+  test_octree(10);
+  test_octree(200000);
+  test_quadtree(100000);
+
+  return EXIT_SUCCESS;
+}
@@ -17,9 +17,11 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/IO/PLY.h>
 #include <CGAL/IO/io.h>
+#include <CGAL/tags.h>
 
 #include <fstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace CGAL {
@@ -43,6 +45,8 @@ private:
   {
     virtual ~Abstract_ply_property_to_point_set_property() { }
     virtual void assign(PLY_element& element, typename Point_set::Index index) = 0;
+    virtual void assign(PLY_element& element, const char* data, std::size_t nb_items,
+                        std::size_t first, bool parallel) = 0;
   };
 
   template <typename Type>
@@ -67,6 +71,18 @@ private:
       element.assign(t, m_name.c_str());
       put(m_pmap, index, t);
     }
+
+    // Fills the points [first, first + nb_items) from a block of binary items
+    virtual void assign(PLY_element& element, const char* data, std::size_t nb_items,
+                        std::size_t first, bool parallel)
+    {
+      const PLY_column<Type> column(element, m_name);
+      for_each_PLY_range(nb_items, parallel, [&](std::size_t begin, std::size_t end)
+      {
+        for(std::size_t i = begin; i < end; ++ i)
+          put(m_map, typename Point_set::Index(first + i), column(data, i));
+      });
+    }
   };
 
   Point_set& m_point_set;
@@ -184,6 +200,30 @@ public:
       m_properties[i]->assign(element, *(m_point_set.end() - 1));
   }
 
+  // Fills the points [first, first + nb_items), which must exist, from a
+  // block of binary items, as returned by `PLY_reader::read_items()`
+  void process_block(PLY_element& element, const char* data, std::size_t nb_items,
+                     std::size_t first, bool parallel)
+  {
+    const PLY_column<double> x(element, "x"), y(element, "y"), z(element, "z");
+    const PLY_column<double> nx(element, "nx"), ny(element, "ny"), nz(element, "nz");
+    const bool has_normals = m_point_set.has_normal_map();
+
+    for_each_PLY_range(nb_items, parallel, [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; ++ i)
+      {
+        const typename Point_set::Index index(first + i);
+        m_point_set.point(index) = Point(x(data, i), y(data, i), z(data, i));
+        if(has_normals)
+          m_point_set.normal(index) = Vector(nx(data, i), ny(data, i), nz(data, i));
+      }
+    });
+
+    for(std::size_t i=0; i<m_properties.size(); ++i)
+      m_properties[i]->assign(element, data, nb_items, first, parallel);
+  }
+
   template <typename FT>
   void process_line(PLY_element& element)
   {
@@ -228,19 +268,31 @@ public:
   header. Each line starting by "comment " in the header is
   appended to the `comments` string (without the "comment " word).
 
+  In binary files, vertices with no list property are read and decoded
+  by large blocks, which is much faster than reading them one by one.
+
   \attention To read a binary file, the flag `std::ios::binary` must be set during the creation of the `ifstream`.
 
+  \tparam ConcurrencyTag enables sequential versus parallel decoding of the blocks of binary vertices.
+  Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
   \param is the input stream
   \param point_set the point set
   \param comments optional PLY comments.
 
   \return `true` if the reading was successful, `false` otherwise.
  */
-template <typename Point, typename Vector>
+template <typename ConcurrencyTag = Sequential_tag, typename Point, typename Vector>
 bool read_PLY(std::istream& is,
               CGAL::Point_set_3<Point, Vector>& point_set,
               std::string& comments)
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  const bool parallel = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+
   if(!is)
   {
     std::cerr << "Error: cannot open file" << std::endl;
@@ -269,31 +321,45 @@ bool read_PLY(std::istream& is,
       filler.instantiate_properties(element);
     }
 
-    for(std::size_t j=0; j<element.number_of_items(); ++j)
+    // Binary vertices of fixed size are decoded by blocks
+    if(is_vertex && reader.is_binary() && element.item_size() != 0 && !point_set.has_garbage())
     {
-      for(std::size_t k=0; k<element.number_of_properties(); ++k)
+      const std::size_t first = point_set.size();
+      point_set.resize(first + element.number_of_items());
+
+      const std::size_t block_size = reader.items_per_block(element);
+      for(std::size_t j=0; j<element.number_of_items(); j+=block_size)
       {
-        internal::PLY_read_number* property = element.property(k);
-        property->get(is);
-        if(is.fail())
+        const std::size_t nb_items = (std::min)(block_size, element.number_of_items() - j);
+        const char* data = reader.read_items(is, element, nb_items);
+        if(data == nullptr)
           return false;
+        filler.process_block(element, data, nb_items, first + j, parallel);
       }
+      continue;
+    }
+
+    for(std::size_t j=0; j<element.number_of_items(); ++j)
+    {
+      if(!reader.read_item(is, element))
+        return false;
 
       if(is_vertex)
         filler.process_line(element);
     }
   }
 
+  reader.release(is);
   return !is.bad();
 }
 
 /// \cond SKIP_IN_MANUAL
 
-template <typename Point, typename Vector>
+template <typename ConcurrencyTag = Sequential_tag, typename Point, typename Vector>
 bool read_PLY(std::istream& is, CGAL::Point_set_3<Point, Vector>& point_set)
 {
   std::string dummy;
-  return read_PLY(is, point_set, dummy);
+  return read_PLY<ConcurrencyTag>(is, point_set, dummy);
 }
 
 /// \endcond
@@ -314,6 +380,8 @@ bool read_PLY(std::istream& is, CGAL::Point_set_3<Point, Vector>& point_set)
   header. Each line starting by "comment " in the header is
   appended to the `comments` string (without the "comment " word).
 
+  \tparam ConcurrencyTag enables sequential versus parallel decoding of the blocks of binary vertices.
+  Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
   \tparam Point the point type of the `Point_set_3`
   \tparam Vector the vector type of the `Point_set_3`
   \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
@@ -333,7 +401,8 @@ bool read_PLY(std::istream& is, CGAL::Point_set_3<Point, Vector>& point_set)
 
   \return `true` if the reading was successful, `false` otherwise.
 */
-template <typename Point, typename Vector, typename CGAL_NP_TEMPLATE_PARAMETERS>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Point, typename Vector, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_PLY(const std::string& fname,
               CGAL::Point_set_3<Point, Vector>& point_set,
               std::string& comments,
@@ -344,22 +413,23 @@ bool read_PLY(const std::string& fname,
   {
     std::ifstream is(fname, std::ios::binary);
     CGAL::IO::set_mode(is, CGAL::IO::BINARY);
-    return read_PLY(is, point_set, comments);
+    return read_PLY<ConcurrencyTag>(is, point_set, comments);
   }
   else
   {
     std::ifstream is(fname);
     CGAL::IO::set_mode(is, CGAL::IO::ASCII);
-    return read_PLY(is, point_set, comments);
+    return read_PLY<ConcurrencyTag>(is, point_set, comments);
   }
 }
 
 /// \cond SKIP_IN_MANUAL
-template <typename Point, typename Vector, typename CGAL_NP_TEMPLATE_PARAMETERS>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Point, typename Vector, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_PLY(const std::string& fname, CGAL::Point_set_3<Point, Vector>& point_set, const CGAL_NP_CLASS& np = parameters::default_values())
 {
   std::string unused_comments;
-  return read_PLY(fname, point_set, unused_comments, np);
+  return read_PLY<ConcurrencyTag>(fname, point_set, unused_comments, np);
 }
 /// \endcond
 
@@ -0,0 +1,161 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/IO.h>
+#include <CGAL/point_generators_3.h>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+
+typedef CGAL::Point_set_3<Point> Point_set;
+
+// Checks that both point sets have the same points, normals and properties
+void assert_same(const Point_set& a, const Point_set& b)
+{
+  assert(a.size() == b.size());
+  assert(a.has_normal_map() == b.has_normal_map());
+
+  auto a_label = a.property_map<std::int16_t>("label").first;
+  auto b_label = b.property_map<std::int16_t>("label");
+  auto a_id = a.property_map<std::int32_t>("id").first;
+  auto b_id = b.property_map<std::int32_t>("id");
+  auto a_weight = a.property_map<float>("weight").first;
+  auto b_weight = b.property_map<float>("weight");
+  assert(b_label.second && b_id.second && b_weight.second);
+
+  for(std::size_t i = 0; i < a.size(); ++ i)
+  {
+    Point_set::Index ia = *(a.begin() + i), ib = *(b.begin() + i);
+    assert(a.point(ia) == b.point(ib));
+    if(a.has_normal_map())
+      assert(a.normal(ia) == b.normal(ib));
+    assert(a_label[ia] == b_label.first[ib]);
+    assert(a_id[ia] == b_id.first[ib]);
+    assert(a_weight[ia] == b_weight.first[ib]);
+  }
+}
+
+// Writes a value in big endian order
+template <typename T>
+void write_big_endian(std::ostream& os, T t)
+{
+  char data[sizeof(T)];
+  std::memcpy(data, &t, sizeof(T));
+  for(std::size_t i = sizeof(T); i > 0; -- i)
+    os.put(data[i-1]);
+}
+
+int main()
+{
+  // Large enough to be read by several blocks
+  const std::size_t nb_points = 300000;
+
+  Point_set point_set;
+  point_set.add_normal_map();
+  auto label = point_set.add_property_map<std::int16_t>("label", 0).first;
+  auto id = point_set.add_property_map<std::int32_t>("id", 0).first;
+  auto weight = point_set.add_property_map<float>("weight", 0.f).first;
+
+  CGAL::Random random(42);
+  CGAL::Random_points_in_cube_3<Point> generator(1., random);
+  for(std::size_t i = 0; i < nb_points; ++ i)
+  {
+    Point_set::iterator it = point_set.insert(*(generator++), Vector(random.get_double(), random.get_double(), 1.));
+    label[*it] = std::int16_t(i % 1000);
+    id[*it] = - std::int32_t(i);
+    weight[*it] = float(i) / 7.f;
+  }
+
+  std::stringstream binary;
+  CGAL::IO::set_binary_mode(binary);
+  bool ok = CGAL::IO::write_PLY(binary, point_set);
+  assert(ok);
+  const std::string binary_data = binary.str();
+
+  std::stringstream ascii;
+  ascii.precision(17);
+  ok = CGAL::IO::write_PLY(ascii, point_set);
+  assert(ok);
+
+  // Binary vertices are read by blocks, sequentially and in parallel
+  {
+    std::istringstream is(binary_data);
+    Point_set read;
+    ok = CGAL::IO::read_PLY(is, read);
+    assert(ok);
+    assert_same(point_set, read);
+  }
+  {
+    std::istringstream is(binary_data);
+    Point_set read;
+    ok = CGAL::IO::read_PLY<CGAL::Parallel_if_available_tag>(is, read);
+    assert(ok);
+    assert_same(point_set, read);
+  }
+
+  // ASCII vertices are still read one by one
+  {
+    Point_set read;
+    ok = CGAL::IO::read_PLY(ascii, read);
+    assert(ok);
+    assert_same(point_set, read);
+  }
+
+  // The stream is left right after the PLY data
+  {
+    std::istringstream is(binary_data + "after");
+    Point_set read;
+    ok = CGAL::IO::read_PLY(is, read);
+    assert(ok);
+    std::string after;
+    is >> after;
+    assert(after == "after");
+  }
+
+  // Truncated binary data is an error
+  {
+    std::istringstream is(binary_data.substr(0, binary_data.size() - 10));
+    Point_set read;
+    ok = CGAL::IO::read_PLY(is, read);
+    assert(!ok);
+  }
+
+  // Big endian binary data
+  {
+    std::ostringstream os;
+    os << "ply\nformat binary_big_endian 1.0\nelement vertex 3\n"
+       << "property float x\nproperty float y\nproperty float z\nproperty short id\nend_header\n";
+    for(int i = 0; i < 3; ++ i)
+    {
+      write_big_endian(os, float(i));
+      write_big_endian(os, float(i) + 0.5f);
+      write_big_endian(os, float(-i));
+      write_big_endian(os, std::int16_t(-300 * i));
+    }
+
+    std::istringstream is(os.str());
+    Point_set read;
+    ok = CGAL::IO::read_PLY(is, read);
+    assert(ok);
+    assert(read.size() == 3);
+    auto read_id = read.property_map<std::int16_t>("id");
+    assert(read_id.second);
+    for(int i = 0; i < 3; ++ i)
+    {
+      Point_set::Index index = *(read.begin() + i);
+      assert(read.point(index) == Point(i, i + 0.5, -i));
+      assert(read_id.first[index] == -300 * i);
+    }
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
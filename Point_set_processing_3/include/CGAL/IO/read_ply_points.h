@@ -157,14 +157,8 @@ bool read_PLY_with_properties(std::istream& is,
 
     for(std::size_t j = 0; j < element.number_of_items(); ++ j)
     {
-      for(std::size_t k = 0; k < element.number_of_properties(); ++ k)
-      {
-        internal::PLY_read_number* property = element.property(k);
-        property->get(is);
-
-        if(is.fail())
-          return false;
-      }
+      if(!reader.read_item(is, element))
+        return false;
 
       if(element.name() == "vertex" || element.name() == "vertices")
       {
@@ -175,6 +169,7 @@ bool read_PLY_with_properties(std::istream& is,
     }
   }
 
+  reader.release(is);
   return true;
 }
 
@@ -0,0 +1,500 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+
+#ifndef CGAL_POLYGON_MESH_PROCESSING_AUTOREFINEMENT_H
+#define CGAL_POLYGON_MESH_PROCESSING_AUTOREFINEMENT_H
+
+#include <CGAL/license/Polygon_mesh_processing/geometric_repair.h>
+
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+
+#include <CGAL/Cartesian_converter.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
+#include <CGAL/Container_helper.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/for_each.h>
+#include <CGAL/intersections.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Projection_traits_3.h>
+#include <CGAL/Triangulation_data_structure_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+
+#include <boost/range/irange.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Polygon_mesh_processing {
+namespace internal {
+namespace autorefinement {
+
+// The intersection of two triangles, described by points and segments.
+// If the triangles are coplanar, the segments are the edges of their common polygon.
+template <class EK>
+struct Pair_intersection
+{
+  std::vector<typename EK::Point_3> points;
+  std::vector<typename EK::Segment_3> segments;
+  bool coplanar = false;
+};
+
+template <class EK>
+void intersect_triangles(const typename EK::Triangle_3& t1,
+                         const typename EK::Triangle_3& t2,
+                         Pair_intersection<EK>& res)
+{
+  typedef typename EK::Point_3                                    Point_3;
+  typedef typename EK::Segment_3                                  Segment_3;
+  typedef typename EK::Triangle_3                                 Triangle_3;
+
+  const auto inter = CGAL::intersection(t1, t2);
+  if(!inter)
+    return;
+
+  if(const Point_3* p = std::get_if<Point_3>(&*inter))
+  {
+    res.points.push_back(*p);
+  }
+  else if(const Segment_3* s = std::get_if<Segment_3>(&*inter))
+  {
+    res.segments.push_back(*s);
+    res.coplanar = coplanar(t1[0], t1[1], t1[2], t2[0]) && coplanar(t1[0], t1[1], t1[2], t2[1]) &&
+                   coplanar(t1[0], t1[1], t1[2], t2[2]);
+  }
+  else if(const Triangle_3* t = std::get_if<Triangle_3>(&*inter))
+  {
+    for(int i=0; i<3; ++i)
+      res.segments.emplace_back(t->vertex(i), t->vertex(i+1));
+    res.coplanar = true;
+  }
+  else if(const std::vector<Point_3>* poly = std::get_if<std::vector<Point_3> >(&*inter))
+  {
+    for(std::size_t i=0; i<poly->size(); ++i)
+      res.segments.emplace_back((*poly)[i], (*poly)[(i+1) % poly->size()]);
+    res.coplanar = true;
+  }
+}
+
+// The intersection of a triangle with all the triangles it intersects, described by points
+// and segments lying in the triangle. Each segment comes with a plane that cuts the triangle
+// along the segment: the intersections of the segments are computed as intersections of three
+// planes, rather than from the segments, which keeps the constructions shallow.
+template <class EK>
+struct Triangle_constraints
+{
+  std::vector<typename EK::Point_3> points;
+  std::vector<typename EK::Segment_3> segments;
+  std::vector<typename EK::Plane_3> cutting_planes;
+};
+
+// The triangulation of a triangle constrained by the intersection with other triangles.
+// The vertices of a sub-triangle are numbered as follows: `0`, `1`, and `2` are the corners
+// of the input triangle, and `3 + i` is the point `new_points[i]`.
+template <class EK>
+struct Triangle_refinement
+{
+  std::vector<typename EK::Point_3> new_points;
+  std::vector<std::array<std::size_t, 3> > triangles;
+};
+
+template <class EK>
+void triangulate_triangle(const std::array<typename EK::Point_3, 3>& corners,
+                          const typename EK::Plane_3& plane,
+                          Triangle_constraints<EK>& constraints,
+                          Triangle_refinement<EK>& res)
+{
+  typedef typename EK::Point_3                                    Point_3;
+  typedef typename EK::Segment_3                                  Segment_3;
+
+  typedef Projection_traits_3<EK>                                 P_traits;
+  typedef Triangulation_vertex_base_with_info_2<std::size_t, P_traits> Vb;
+  typedef Constrained_triangulation_face_base_2<P_traits>         Fb;
+  typedef Triangulation_data_structure_2<Vb, Fb>                  Tds;
+  // the constraints are split at their intersections beforehand, so that no construction is needed
+  typedef Constrained_Delaunay_triangulation_2<P_traits, Tds,
+            No_constraint_intersection_requiring_constructions_tag> CDT;
+  typedef typename CDT::Vertex_handle                             Vertex_handle;
+
+  auto less_xyz = [](const Point_3& a, const Point_3& b) { return compare_xyz(a, b) == SMALLER; };
+
+  std::vector<Point_3>& points = constraints.points;
+  const std::vector<Segment_3>& segments = constraints.segments;
+  const std::vector<typename EK::Plane_3>& cutting_planes = constraints.cutting_planes;
+
+  // the corners and the intersections of the segments are also vertices of the triangulation,
+  // so that the segments can be split at all the vertices they contain
+  points.insert(points.end(), corners.begin(), corners.end());
+  for(std::size_t i=0; i<segments.size(); ++i)
+  {
+    points.push_back(segments[i].source());
+    points.push_back(segments[i].target());
+    for(std::size_t j=i+1; j<segments.size(); ++j)
+    {
+      if(!do_intersect(segments[i], segments[j]))
+        continue;
+
+      // collinear segments overlap between endpoints, which are already vertices
+      if(collinear(segments[i].source(), segments[i].target(), segments[j].source()) &&
+         collinear(segments[i].source(), segments[i].target(), segments[j].target()))
+        continue;
+
+      const auto inter = CGAL::intersection(plane, cutting_planes[i], cutting_planes[j]);
+      CGAL_assertion(inter && std::get_if<Point_3>(&*inter) != nullptr);
+      points.push_back(std::get<Point_3>(*inter));
+    }
+  }
+
+  std::sort(points.begin(), points.end(), less_xyz);
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+
+  CDT cdt(P_traits(plane.orthogonal_vector()));
+
+  std::array<Vertex_handle, 3> corner_vertices;
+  for(std::size_t i=0; i<3; ++i)
+  {
+    corner_vertices[i] = cdt.insert(corners[i]);
+    corner_vertices[i]->info() = i;
+  }
+
+  std::vector<Vertex_handle> point_vertices(points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    point_vertices[i] = cdt.insert(points[i]);
+    if(point_vertices[i] != corner_vertices[0] &&
+       point_vertices[i] != corner_vertices[1] &&
+       point_vertices[i] != corner_vertices[2])
+    {
+      point_vertices[i]->info() = 3 + res.new_points.size();
+      res.new_points.push_back(points[i]);
+    }
+  }
+
+  // Each segment is split at the points it contains. Since the points lying on a line are
+  // sorted along that line by the lexicographic order, the points on the segment are consecutive
+  for(const Segment_3& s : segments)
+  {
+    Vertex_handle previous;
+    for(std::size_t i=0; i<points.size(); ++i)
+    {
+      if(!s.has_on(points[i]))
+        continue;
+      if(previous != Vertex_handle() && previous != point_vertices[i])
+        cdt.insert_constraint(previous, point_vertices[i]);
+      previous = point_vertices[i];
+    }
+  }
+
+  // faces are counterclockwise with respect to the normal, hence have the orientation of the input triangle
+  for(auto fh : cdt.finite_face_handles())
+    res.triangles.push_back(make_array(fh->vertex(0)->info(), fh->vertex(1)->info(), fh->vertex(2)->info()));
+}
+
+} // namespace autorefinement
+} // namespace internal
+
+/**
+ * \ingroup PMP_geometric_repair_grp
+ *
+ * \brief refines a soup of triangles so that no pair of triangles intersects in their interiors.
+ *
+ * Each triangle intersecting other triangles is triangulated, with the intersection
+ * of the triangles as constraints. Intersection points are computed exactly and then rounded
+ * to the point type of `soup_points`, before being appended to `soup_points`.
+ * Intersection points that are equal to an input point are not duplicated.
+ * The triangles that do not intersect any other triangle are not modified, and the triangles
+ * replacing an input triangle have its orientation.
+ *
+ * Note that the rounding of the intersection points might create new self-intersections,
+ * unless the point type of `soup_points` has exact coordinates.
+ *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ * @tparam PointRange a model of the concepts `RandomAccessContainer` and `BackInsertionSequence`
+ *         whose value type is the point type
+ * @tparam TriIdsRange a model of the concepts `RandomAccessContainer` and `BackInsertionSequence` whose
+ *         value type is a model of the concept `RandomAccessContainer` whose value type is `std::size_t`
+ * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+ *
+ * @param soup_points points of the soup of triangles
+ * @param soup_triangles each element in the range describes a triangle using the indices of the points in `soup_points`
+ * @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+ *
+ * \cgalNamedParamsBegin
+ *   \cgalParamNBegin{geom_traits}
+ *     \cgalParamDescription{an instance of a geometric traits class}
+ *     \cgalParamType{a class model of `Kernel`}
+ *     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+ *     \cgalParamExtra{The geometric traits class must be compatible with the point type.}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * In parallel, the intersections of the pairs of triangles, the triangulations of the
+ * intersecting triangles, and the rounding of the new points are computed concurrently.
+ * The output does not depend on the concurrency tag.
+ *
+ * \pre `soup_triangles` does not contain any degenerate triangle
+ *
+ * @sa `triangle_soup_self_intersections()`
+ */
+template <class ConcurrencyTag = Sequential_tag,
+          class PointRange,
+          class TriIdsRange,
+          class NamedParameters = parameters::Default_named_parameters>
+void autorefine_triangle_soup(PointRange& soup_points,
+                              TriIdsRange& soup_triangles,
+                              const NamedParameters& np = parameters::default_values())
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename GetPolygonSoupGeomTraits<PointRange, NamedParameters>::type GT;
+  GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
+
+  typedef Exact_predicates_exact_constructions_kernel             EK;
+  typedef typename EK::Point_3                                    EK_point_3;
+  typedef typename std::iterator_traits<typename TriIdsRange::iterator>::value_type Triangle_ids;
+
+  typedef typename EK::Plane_3                                    EK_plane_3;
+
+  typedef internal::autorefinement::Pair_intersection<EK>         Pair_intersection;
+  typedef internal::autorefinement::Triangle_constraints<EK>      Triangle_constraints;
+  typedef internal::autorefinement::Triangle_refinement<EK>       Triangle_refinement;
+
+  const std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+  // 1 - the pairs of intersecting triangles
+  std::vector<std::pair<std::size_t, std::size_t> > si_pairs;
+  triangle_soup_self_intersections<ConcurrencyTag>(soup_points, soup_triangles, std::back_inserter(si_pairs),
+                                                   parameters::geom_traits(gt));
+  CGAL_precondition_code(for(const auto& p : si_pairs) CGAL_precondition(p.first != p.second);)
+
+  if(si_pairs.empty())
+    return;
+
+  // the order of the pairs found in parallel is not deterministic, and would change the
+  // order of the constraints, hence the triangulations in case of cocircular points
+  for(auto& p : si_pairs)
+    if(p.second < p.first)
+      std::swap(p.first, p.second);
+  std::sort(si_pairs.begin(), si_pairs.end());
+
+  // 2 - exact points and triangles, for the triangles involved in an intersection only
+  std::vector<std::size_t> tri_id(soup_triangles.size(), npos);
+  std::vector<std::size_t> involved_triangles;
+  for(const auto& p : si_pairs)
+  {
+    for(std::size_t t : { p.first, p.second })
+    {
+      if(tri_id[t] != npos)
+        continue;
+      tri_id[t] = involved_triangles.size();
+      involved_triangles.push_back(t);
+    }
+  }
+  std::sort(involved_triangles.begin(), involved_triangles.end());
+  for(std::size_t i=0; i<involved_triangles.size(); ++i)
+    tri_id[involved_triangles[i]] = i;
+
+  std::vector<std::size_t> point_id(soup_points.size(), npos);
+  std::vector<std::size_t> involved_points;
+  for(std::size_t t : involved_triangles)
+  {
+    for(int i=0; i<3; ++i)
+    {
+      const std::size_t v = soup_triangles[t][i];
+      if(point_id[v] != npos)
+        continue;
+      point_id[v] = involved_points.size();
+      involved_points.push_back(v);
+    }
+  }
+
+  const Cartesian_converter<GT, EK> to_exact;
+  std::vector<EK_point_3> exact_points(involved_points.size());
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, involved_points.size()), [&](const std::size_t i) -> bool
+  {
+    exact_points[i] = to_exact(soup_points[involved_points[i]]);
+    return true;
+  });
+
+  auto exact_corners = [&](const std::size_t t)
+  {
+    const Triangle_ids& tri = soup_triangles[t];
+    return make_array(exact_points[point_id[tri[0]]], exact_points[point_id[tri[1]]], exact_points[point_id[tri[2]]]);
+  };
+
+  std::vector<EK_plane_3> planes(involved_triangles.size());
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, involved_triangles.size()), [&](const std::size_t i) -> bool
+  {
+    const std::array<EK_point_3, 3> c = exact_corners(involved_triangles[i]);
+    planes[i] = EK_plane_3(c[0], c[1], c[2]);
+    return true;
+  });
+
+  // 3 - the intersections of the pairs of triangles
+  std::vector<Pair_intersection> pair_intersections(si_pairs.size());
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, si_pairs.size()), [&](const std::size_t i) -> bool
+  {
+    const std::array<EK_point_3, 3> c1 = exact_corners(si_pairs[i].first);
+    const std::array<EK_point_3, 3> c2 = exact_corners(si_pairs[i].second);
+    internal::autorefinement::intersect_triangles<EK>(typename EK::Triangle_3(c1[0], c1[1], c1[2]),
+                                                      typename EK::Triangle_3(c2[0], c2[1], c2[2]),
+                                                      pair_intersections[i]);
+    return true;
+  });
+
+  // 4 - the constraints of each triangle, gathered in the order of the pairs. A segment cuts
+  //     a triangle along the plane of the other triangle, or along a plane orthogonal to
+  //     the triangle if both triangles are coplanar
+  std::vector<Triangle_constraints> constraints(involved_triangles.size());
+  for(std::size_t i=0; i<si_pairs.size(); ++i)
+  {
+    const Pair_intersection& pi = pair_intersections[i];
+    for(int k=0; k<2; ++k)
+    {
+      const std::size_t t = tri_id[k == 0 ? si_pairs[i].first : si_pairs[i].second];
+      const std::size_t other = tri_id[k == 0 ? si_pairs[i].second : si_pairs[i].first];
+
+      Triangle_constraints& tc = constraints[t];
+      tc.points.insert(tc.points.end(), pi.points.begin(), pi.points.end());
+      tc.segments.insert(tc.segments.end(), pi.segments.begin(), pi.segments.end());
+      for(const typename EK::Segment_3& seg : pi.segments)
+      {
+        if(pi.coplanar)
+          tc.cutting_planes.emplace_back(seg.source(), seg.target(), seg.source() + planes[t].orthogonal_vector());
+        else
+          tc.cutting_planes.push_back(planes[other]);
+      }
+    }
+  }
+  pair_intersections.clear();
+  pair_intersections.shrink_to_fit();
+
+  // 5 - the triangulation of each intersected triangle, which are independent
+  std::vector<Triangle_refinement> refinements(involved_triangles.size());
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, involved_triangles.size()), [&](const std::size_t i) -> bool
+  {
+    internal::autorefinement::triangulate_triangle<EK>(exact_corners(involved_triangles[i]), planes[i],
+                                                       constraints[i], refinements[i]);
+    constraints[i] = Triangle_constraints(); // frees the memory early
+    return true;
+  });
+  constraints.clear();
+
+  // 6 - ids of the new points: points equal to an input point take its id (the smallest one if
+  //     there are duplicates), and the other ones are numbered in lexicographic order,
+  //     which does not depend on the scheduling of the tasks
+  std::vector<std::size_t> new_point_offsets(refinements.size() + 1, 0);
+  for(std::size_t i=0; i<refinements.size(); ++i)
+    new_point_offsets[i+1] = new_point_offsets[i] + refinements[i].new_points.size();
+
+  // (point, input id or `npos`, position in the new points of the refinements)
+  typedef std::tuple<const EK_point_3*, std::size_t, std::size_t> Keyed_point;
+  std::vector<Keyed_point> keyed_points;
+  keyed_points.reserve(involved_points.size() + new_point_offsets.back());
+  for(std::size_t i=0; i<involved_points.size(); ++i)
+    keyed_points.emplace_back(&exact_points[i], involved_points[i], npos);
+  for(std::size_t i=0; i<refinements.size(); ++i)
+    for(std::size_t j=0; j<refinements[i].new_points.size(); ++j)
+      keyed_points.emplace_back(&refinements[i].new_points[j], npos, new_point_offsets[i] + j);
+
+  auto less_keyed = [](const Keyed_point& a, const Keyed_point& b)
+  {
+    const Comparison_result res = compare_xyz(*std::get<0>(a), *std::get<0>(b));
+    if(res != EQUAL)
+      return res == SMALLER;
+    return std::make_pair(std::get<1>(a), std::get<2>(a)) < std::make_pair(std::get<1>(b), std::get<2>(b));
+  };
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    tbb::parallel_sort(keyed_points.begin(), keyed_points.end(), less_keyed);
+  else
+#endif
+    std::sort(keyed_points.begin(), keyed_points.end(), less_keyed);
+
+  const std::size_t nb_input_points = soup_points.size();
+  std::vector<std::size_t> new_point_ids(new_point_offsets.back());
+  std::vector<const EK_point_3*> points_to_round;
+  for(std::size_t i=0; i<keyed_points.size(); )
+  {
+    std::size_t id = std::get<1>(keyed_points[i]);
+    if(id == npos)
+    {
+      id = nb_input_points + points_to_round.size();
+      points_to_round.push_back(std::get<0>(keyed_points[i]));
+    }
+
+    std::size_t j = i;
+    for(; j<keyed_points.size() && compare_xyz(*std::get<0>(keyed_points[j]), *std::get<0>(keyed_points[i])) == EQUAL; ++j)
+      if(std::get<2>(keyed_points[j]) != npos)
+        new_point_ids[std::get<2>(keyed_points[j])] = id;
+    i = j;
+  }
+
+  // 7 - rounding of the new points
+  const Cartesian_converter<EK, GT> from_exact;
+  CGAL::internal::resize(soup_points, nb_input_points + points_to_round.size());
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, points_to_round.size()), [&](const std::size_t i) -> bool
+  {
+    const EK_point_3& p = *(points_to_round[i]);
+    // the exact coordinates give the closest approximation
+    exact(p);
+    soup_points[nb_input_points + i] = from_exact(p);
+    return true;
+  });
+
+  // 8 - the intersected triangles are replaced by their refinement
+  TriIdsRange new_triangles;
+  for(std::size_t t=0; t<soup_triangles.size(); ++t)
+  {
+    if(tri_id[t] == npos)
+    {
+      new_triangles.push_back(soup_triangles[t]);
+      continue;
+    }
+
+    const std::size_t i = tri_id[t];
+    const Triangle_ids& input_tri = soup_triangles[t];
+    for(const std::array<std::size_t, 3>& local_tri : refinements[i].triangles)
+    {
+      Triangle_ids tri;
+      CGAL::internal::resize(tri, 3);
+      for(int k=0; k<3; ++k)
+        tri[k] = (local_tri[k] < 3) ? input_tri[local_tri[k]]
+                                    : new_point_ids[new_point_offsets[i] + local_tri[k] - 3];
+      new_triangles.push_back(tri);
+    }
+  }
+
+  soup_triangles.swap(new_triangles);
+}
+
+} // namespace Polygon_mesh_processing
+} // namespace CGAL
+
+#endif // CGAL_POLYGON_MESH_PROCESSING_AUTOREFINEMENT_H
@@ -22,12 +22,18 @@
 #include <CGAL/boost/graph/helpers.h>
 #include <CGAL/boost/graph/properties.h>
 #include <CGAL/Dynamic_property_map.h>
+#include <CGAL/for_each.h>
 #include <CGAL/Origin.h>
+#include <CGAL/tags.h>
 
 #include <boost/graph/graph_traits.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/range/irange.hpp>
 
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <unordered_map>
@@ -200,10 +206,13 @@ compute_face_normal(typename boost::graph_traits<PolygonMesh>::face_descriptor f
 *
 * computes the outward unit vector normal for all faces of the polygon mesh.
 *
+* @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+*                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 * @tparam PolygonMesh a model of `FaceGraph`
 * @tparam Face_normal_map a model of `WritablePropertyMap` with
     `boost::graph_traits<PolygonMesh>::%face_descriptor` as key type and
-    `Kernel::Vector_3` as value type.
+    `Kernel::Vector_3` as value type. In parallel, it must support concurrent writes
+    for distinct keys, as for example the property maps of `Surface_mesh`.
 *
 * @param pmesh the polygon mesh
 * @param face_normals the property map in which the normals are written
@@ -233,13 +242,32 @@ compute_face_normal(typename boost::graph_traits<PolygonMesh>::face_descriptor f
 *
 * @see `compute_face_normal()`
 */
-template <typename PolygonMesh, typename Face_normal_map, typename NamedParameters = parameters::Default_named_parameters>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PolygonMesh, typename Face_normal_map, typename NamedParameters = parameters::Default_named_parameters>
 void compute_face_normals(const PolygonMesh& pmesh,
                           Face_normal_map face_normals,
                           const NamedParameters& np = parameters::default_values())
 {
+  typedef typename boost::graph_traits<PolygonMesh>::face_descriptor face_descriptor;
   typedef typename GetGeomTraits<PolygonMesh,NamedParameters>::type Kernel;
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    const std::vector<face_descriptor> face_vector(std::begin(faces(pmesh)), std::end(faces(pmesh)));
+    CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, face_vector.size()),
+                                   [&](const std::size_t i) -> bool
+    {
+      put(face_normals, face_vector[i], compute_face_normal(face_vector[i], pmesh, np));
+      return true;
+    });
+    return;
+  }
+
   for(typename boost::graph_traits<PolygonMesh>::face_descriptor f : faces(pmesh))
   {
     typename Kernel::Vector_3 vec = compute_face_normal(f, pmesh, np);
@@ -745,15 +773,39 @@ compute_vertex_normal(typename boost::graph_traits<PolygonMesh>::vertex_descript
 }
 
 
+namespace internal {
+
+// computes the vertex normals concurrently, the face normals being provided in `np`
+template <typename ConcurrencyTag, typename PolygonMesh, typename VertexNormalMap, typename NamedParameters>
+void compute_vertex_normals_with_face_normals(const PolygonMesh& pmesh,
+                                              VertexNormalMap vertex_normals,
+                                              const NamedParameters& np)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor           vertex_descriptor;
+
+  const std::vector<vertex_descriptor> vertex_vector(std::begin(vertices(pmesh)), std::end(vertices(pmesh)));
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, vertex_vector.size()),
+                                 [&](const std::size_t i) -> bool
+  {
+    put(vertex_normals, vertex_vector[i], compute_vertex_normal(vertex_vector[i], pmesh, np));
+    return true;
+  });
+}
+
+} // namespace internal
+
 /**
 * \ingroup PMP_normal_grp
 *
 * computes the outward unit vector normal for all vertices of the polygon mesh.
 *
+* @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+*                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 * @tparam PolygonMesh a model of `FaceListGraph`
 * @tparam VertexNormalMap a model of `WritablePropertyMap` with
 *                         `boost::graph_traits<PolygonMesh>::%vertex_descriptor` as key type and
 *                         the return type of `compute_vertex_normal()` as value type.
+*                         In parallel, it must support concurrent writes for distinct keys.
 *
 * @param pmesh the polygon mesh
 * @param vertex_normals the property map in which the normals are written
@@ -783,7 +835,8 @@ compute_vertex_normal(typename boost::graph_traits<PolygonMesh>::vertex_descript
 *
 * @see `compute_vertex_normal()`
 */
-template <typename PolygonMesh, typename VertexNormalMap, typename NamedParameters = parameters::Default_named_parameters>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PolygonMesh, typename VertexNormalMap, typename NamedParameters = parameters::Default_named_parameters>
 void compute_vertex_normals(const PolygonMesh& pmesh,
                             VertexNormalMap vertex_normals,
                             const NamedParameters& np = parameters::default_values())
@@ -797,6 +850,31 @@ void compute_vertex_normals(const PolygonMesh& pmesh,
   typedef typename GetGeomTraits<PolygonMesh,NamedParameters>::type              GT;
   typedef typename GT::Vector_3                                                  Vector_3;
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    // the face normals are stored in a vector, as a dynamic property map might not
+    // support concurrent writes
+    if(is_default_parameter<NamedParameters, internal_np::face_normal_t>::value)
+    {
+      std::vector<Vector_3> face_normal_vector(num_faces(pmesh));
+      auto face_normals = boost::make_iterator_property_map(face_normal_vector.begin(),
+                                                            CGAL::get_initialized_face_index_map(pmesh, np));
+      compute_face_normals<ConcurrencyTag>(pmesh, face_normals, np);
+      internal::compute_vertex_normals_with_face_normals<ConcurrencyTag>(pmesh, vertex_normals,
+                                                                         np.face_normal_map(face_normals));
+    }
+    else
+    {
+      internal::compute_vertex_normals_with_face_normals<ConcurrencyTag>(pmesh, vertex_normals, np);
+    }
+    return;
+  }
+
   typedef CGAL::dynamic_face_property_t<Vector_3>                                Face_normal_tag;
   typedef typename boost::property_map<PolygonMesh, Face_normal_tag>::const_type Face_normal_dmap;
 
@@ -843,6 +921,8 @@ void compute_vertex_normals(const PolygonMesh& pmesh,
 *
 * computes the outward unit vector normal for all vertices and faces of the polygon mesh.
 *
+* @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+*                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 * @tparam PolygonMesh a model of `FaceListGraph`
 * @tparam VertexNormalMap a model of `WritablePropertyMap` with
 *    `boost::graph_traits<PolygonMesh>::%vertex_descriptor` as key type and
@@ -851,6 +931,8 @@ void compute_vertex_normals(const PolygonMesh& pmesh,
 *    `boost::graph_traits<PolygonMesh>::%face_descriptor` as key type and
 *    `Kernel::Vector_3` as value type.
 *
+* In parallel, both property maps must support concurrent writes for distinct keys.
+*
 * @param pmesh the polygon mesh
 * @param vertex_normals the property map in which the vertex normals are written
 * @param face_normals the property map in which the face normals are written
@@ -881,7 +963,8 @@ void compute_vertex_normals(const PolygonMesh& pmesh,
 * @see `compute_vertex_normals()`
 * @see `compute_face_normals()`
 */
-template <typename PolygonMesh,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PolygonMesh,
           typename VertexNormalMap, typename FaceNormalMap,
           typename NamedParameters = parameters::Default_named_parameters>
 void compute_normals(const PolygonMesh& pmesh,
@@ -889,8 +972,8 @@ void compute_normals(const PolygonMesh& pmesh,
                      FaceNormalMap face_normals,
                      const NamedParameters& np = parameters::default_values())
 {
-  compute_face_normals(pmesh, face_normals, np);
-  compute_vertex_normals(pmesh, vertex_normals, np.face_normal_map(face_normals));
+  compute_face_normals<ConcurrencyTag>(pmesh, face_normals, np);
+  compute_vertex_normals<ConcurrencyTag>(pmesh, vertex_normals, np.face_normal_map(face_normals));
 }
 
 
@@ -41,6 +41,15 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+#include <CGAL/Polygon_mesh_processing/internal/Concurrent_union_find.h>
+
+#include <boost/range/irange.hpp>
+
+#include <iterator>
+#include <type_traits>
+
 namespace CGAL {
 namespace Polygon_mesh_processing{
 namespace internal {
@@ -83,6 +92,41 @@ namespace internal {
       EdgeConstraintMap ecm;
     };
 
+// Labels the elements `0, ..., n-1` with the connected components of the graph in which `i` is
+// adjacent to each `j` such that `for_each_neighbor(i, f)` calls `f(j)`, and returns the number of components.
+// The components are numbered in the order of their smallest element, like a sequential traversal would do.
+// With `Parallel_tag`, the adjacencies are processed concurrently with a lock-free union-find.
+template <typename ConcurrencyTag, typename NeighborFunctor>
+std::size_t label_connected_components(const std::size_t n,
+                                       const NeighborFunctor& for_each_neighbor,
+                                       std::vector<std::size_t>& labels)
+{
+  Concurrent_union_find union_find(n);
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, n),
+                                 [&](const std::size_t i) -> bool
+  {
+    for_each_neighbor(i, [&](const std::size_t j) { union_find.unite(i, j); });
+    return true;
+  });
+
+  // the representative of a component is its smallest element
+  labels.resize(n);
+  std::size_t nb_components = 0;
+  for(std::size_t i=0; i<n; ++i)
+    if(union_find.is_root(i))
+      labels[i] = nb_components++;
+
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, n),
+                                 [&](const std::size_t i) -> bool
+  {
+    if(!union_find.is_root(i))
+      labels[i] = labels[union_find.find(i)];
+    return true;
+  });
+
+  return nb_components;
+}
+
 } // namespace internal
 
 /*!
@@ -163,6 +207,13 @@ connected_component(typename boost::graph_traits<PolygonMesh>::face_descriptor s
  *
  * computes for each face the index of the corresponding connected component.
  *
+ * The connected components are numbered in the order of the first of their faces in `faces(pmesh)`.
+ * With `Parallel_tag`, the faces are labeled with a concurrent union-find, giving the same
+ * numbering as the sequential traversal, and the property maps passed as named parameters
+ * are read concurrently.
+ *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
  * \tparam PolygonMesh a model of `FaceListGraph`
  * \tparam FaceComponentMap a model of `WritablePropertyMap` with
  *       `boost::graph_traits<PolygonMesh>::%face_descriptor` as key type and
@@ -193,7 +244,8 @@ connected_component(typename boost::graph_traits<PolygonMesh>::face_descriptor s
  *
  * \see `connected_component()`
  */
-template <typename PolygonMesh
+template <typename ConcurrencyTag = Sequential_tag
+        , typename PolygonMesh
         , typename FaceComponentMap
         , typename NamedParameters = parameters::Default_named_parameters
 >
@@ -221,7 +273,45 @@ connected_components(const PolygonMesh& pmesh,
   typedef typename GetInitializedFaceIndexMap<PolygonMesh, NamedParameters>::const_type FaceIndexMap;
   FaceIndexMap fimap = get_initialized_face_index_map(pmesh, np);
 
-  typename boost::property_traits<FaceComponentMap>::value_type i=0;
+  typedef typename boost::property_traits<FaceComponentMap>::value_type Component_id;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    // faces are identified by their position in `faces(pmesh)`
+    const std::vector<face_descriptor> face_vector(std::begin(faces(pmesh)), std::end(faces(pmesh)));
+    std::vector<std::size_t> position(face_vector.size());
+    for(std::size_t i=0; i<face_vector.size(); ++i)
+      position[get(fimap, face_vector[i])] = i;
+
+    std::vector<std::size_t> labels;
+    const std::size_t nb_components = internal::label_connected_components<ConcurrencyTag>(
+      face_vector.size(),
+      [&](const std::size_t i, const auto& unite_with)
+      {
+        for(halfedge_descriptor h : halfedges_around_face(halfedge(face_vector[i], pmesh), pmesh))
+        {
+          if(get(ecmap, edge(h, pmesh))) continue;
+          face_descriptor fo = face(opposite(h, pmesh), pmesh);
+          if(fo == GT::null_face()) continue;
+          const std::size_t j = position[get(fimap, fo)];
+          if(j < i) // each pair of adjacent faces is seen twice
+            unite_with(j);
+        }
+      },
+      labels);
+
+    for(std::size_t i=0; i<face_vector.size(); ++i)
+      put(fcm, face_vector[i], Component_id(labels[i]));
+
+    return Component_id(nb_components);
+  }
+
+  Component_id i=0;
   std::vector<bool> handled(num_faces(pmesh), false);
   for (face_descriptor f : faces(pmesh))
   {
@@ -253,6 +343,116 @@ connected_components(const PolygonMesh& pmesh,
   return i;
 }
 
+/*!
+ * \ingroup PMP_keep_connected_components_grp
+ *
+ * computes for each vertex the index of the corresponding connected component,
+ * two vertices being connected if they are the endpoints of an edge that is not constrained.
+ * In particular, an isolated vertex forms a connected component on its own.
+ *
+ * The connected components are numbered in the order of the first of their vertices in `vertices(pmesh)`.
+ * With `Parallel_tag`, the vertices are labeled with a concurrent union-find, and the property maps
+ * passed as named parameters are read concurrently.
+ *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ * \tparam PolygonMesh a model of `HalfedgeListGraph`
+ * \tparam VertexComponentMap a model of `WritablePropertyMap` with
+ *       `boost::graph_traits<PolygonMesh>::%vertex_descriptor` as key type and
+ *       `boost::graph_traits<PolygonMesh>::%vertices_size_type` as value type.
+ * \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+ *
+ * \param pmesh the polygon mesh
+ * \param vcm the property map with indices of components associated to vertices in `pmesh`
+ * \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+ *
+ * \cgalNamedParamsBegin
+ *   \cgalParamNBegin{edge_is_constrained_map}
+ *     \cgalParamDescription{a property map containing the constrained-or-not status of each edge of `pmesh`}
+ *     \cgalParamType{a class model of `ReadablePropertyMap` with `boost::graph_traits<PolygonMesh>::%edge_descriptor`
+ *                    as key type and `bool` as value type}
+ *     \cgalParamDefault{a constant property map returning `false` for any edge}
+ *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{vertex_index_map}
+ *     \cgalParamDescription{a property map associating to each vertex of `pmesh` a unique index between `0` and `num_vertices(pmesh) - 1`}
+ *     \cgalParamType{a class model of `ReadablePropertyMap` with `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+ *                    as key type and `std::size_t` as value type}
+ *     \cgalParamDefault{an automatically indexed internal map}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * \returns the number of connected components.
+ *
+ * \see `connected_components()`
+ */
+template <typename ConcurrencyTag = Sequential_tag
+        , typename PolygonMesh
+        , typename VertexComponentMap
+        , typename NamedParameters = parameters::Default_named_parameters
+>
+typename boost::property_traits<VertexComponentMap>::value_type
+vertex_connected_components(const PolygonMesh& pmesh,
+                            VertexComponentMap vcm,
+                            const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef boost::graph_traits<PolygonMesh> GT;
+  typedef typename GT::halfedge_descriptor halfedge_descriptor;
+  typedef typename GT::vertex_descriptor vertex_descriptor;
+
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::edge_is_constrained_t,
+    NamedParameters,
+    internal::No_constraint<PolygonMesh>//default
+  > ::type                                               EdgeConstraintMap;
+
+  EdgeConstraintMap ecmap
+    = choose_parameter<EdgeConstraintMap>(get_parameter(np, internal_np::edge_is_constrained));
+
+  typedef typename GetInitializedVertexIndexMap<PolygonMesh, NamedParameters>::const_type VertexIndexMap;
+  VertexIndexMap vimap = get_initialized_vertex_index_map(pmesh, np);
+
+  typedef typename boost::property_traits<VertexComponentMap>::value_type Component_id;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  // vertices are identified by their position in `vertices(pmesh)`
+  const std::vector<vertex_descriptor> vertex_vector(std::begin(vertices(pmesh)), std::end(vertices(pmesh)));
+  std::vector<std::size_t> position(vertex_vector.size());
+  for(std::size_t i=0; i<vertex_vector.size(); ++i)
+    position[get(vimap, vertex_vector[i])] = i;
+
+  std::vector<std::size_t> labels;
+  const std::size_t nb_components = internal::label_connected_components<ConcurrencyTag>(
+    vertex_vector.size(),
+    [&](const std::size_t i, const auto& unite_with)
+    {
+      const vertex_descriptor v = vertex_vector[i];
+      if(halfedge(v, pmesh) == GT::null_halfedge())
+        return;
+
+      for(halfedge_descriptor h : halfedges_around_target(v, pmesh))
+      {
+        if(get(ecmap, edge(h, pmesh))) continue;
+        const std::size_t j = position[get(vimap, source(h, pmesh))];
+        if(j < i) // each edge is seen from both of its endpoints
+          unite_with(j);
+      }
+    },
+    labels);
+
+  for(std::size_t i=0; i<vertex_vector.size(); ++i)
+    put(vcm, vertex_vector[i], Component_id(labels[i]));
+
+  return Component_id(nb_components);
+}
+
 
 template <typename PolygonMesh
         , typename ComponentRange
@@ -325,6 +525,9 @@ std::size_t number_of_connected_components(const PolygonMesh& pmesh,
  * By default, the size of a face is `1` (and thus the size of a connected component is the number
  * of faces it contains), but it is also possible to pass custom sizes, such as the area of the face.
  *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ *                        It is used to compute the connected components, see `connected_components()`.
  * \tparam PolygonMesh a model of `FaceListGraph` and `MutableFaceGraph`
  * \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
  *
@@ -381,7 +584,8 @@ std::size_t number_of_connected_components(const PolygonMesh& pmesh,
  *
  * \see `keep_large_connected_components()`
  */
-template <typename PolygonMesh,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PolygonMesh,
           typename NamedParameters = parameters::Default_named_parameters>
 std::size_t keep_largest_connected_components(PolygonMesh& pmesh,
                                               std::size_t nb_components_to_keep,
@@ -419,7 +623,7 @@ std::size_t keep_largest_connected_components(PolygonMesh& pmesh,
   // Even if we do not want to keep anything we need to first
   // calculate the number of existing connected_components to get the
   // correct return value.
-  const std::size_t num = connected_components(pmesh, face_cc, np);
+  const std::size_t num = connected_components<ConcurrencyTag>(pmesh, face_cc, np);
 
   if(nb_components_to_keep == 0)
   {
@@ -473,6 +677,9 @@ std::size_t keep_largest_connected_components(PolygonMesh& pmesh,
  * By default, the size of a face is `1` (and thus the size of a connected component is the number
  * of faces it contains), but it is also possible to pass custom sizes, such as the area of the face.
  *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ *                        It is used to compute the connected components, see `connected_components()`.
  * \tparam PolygonMesh a model of `FaceListGraph` and `MutableFaceGraph`
  * \tparam ThresholdValueType the type of the threshold value. If a face size property map is passed
  *         by the user, `ThresholdValueType` must be the same type as the value type of the property map.
@@ -531,7 +738,8 @@ std::size_t keep_largest_connected_components(PolygonMesh& pmesh,
  *
  * \see `keep_largest_connected_components()`
  */
-template <typename PolygonMesh,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PolygonMesh,
           typename ThresholdValueType,
           typename NamedParameters = parameters::Default_named_parameters>
 std::size_t keep_large_connected_components(PolygonMesh& pmesh,
@@ -566,7 +774,7 @@ std::size_t keep_large_connected_components(PolygonMesh& pmesh,
 
   // vector_property_map
   boost::vector_property_map<std::size_t, FaceIndexMap> face_cc(static_cast<unsigned>(num_faces(pmesh)), fim);
-  std::size_t num = connected_components(pmesh, face_cc, np);
+  std::size_t num = connected_components<ConcurrencyTag>(pmesh, face_cc, np);
   std::vector<Face_size> component_size(num, 0);
 
   for(face_descriptor f : faces(pmesh))
@@ -985,7 +1193,8 @@ void keep_connected_components(PolygonMesh& pmesh
 
 namespace internal {
 
-template < class PolygonMesh, class PolygonMeshRange,
+template < class ConcurrencyTag,
+           class PolygonMesh, class PolygonMeshRange,
            class FIMap, class VIMap,
            class HIMap, class Ecm, class NamedParameters >
 void split_connected_components_impl(FIMap fim,
@@ -1014,7 +1223,7 @@ void split_connected_components_impl(FIMap fim,
   faces_size_type nb_patches = 0;
   if(is_default_parameter<NamedParameters, internal_np::face_patch_t>::value)
   {
-    nb_patches = CGAL::Polygon_mesh_processing::connected_components(
+    nb_patches = CGAL::Polygon_mesh_processing::connected_components<ConcurrencyTag>(
           tm, pidmap, CGAL::parameters::face_index_map(fim)
           .edge_is_constrained_map(ecm));
   }
@@ -1029,6 +1238,37 @@ void split_connected_components_impl(FIMap fim,
     nb_patches+=1;
   }
   CGAL::internal::reserve(range, nb_patches);
+
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    // the faces of each patch are gathered in a single pass, and the patches are copied concurrently
+    typedef typename boost::graph_traits<PolygonMesh>::face_descriptor face_descriptor;
+    std::vector<std::vector<face_descriptor> > patch_faces(nb_patches);
+    for(face_descriptor f : faces(tm))
+      patch_faces[get(pidmap, f)].push_back(f);
+
+    std::vector<PolygonMesh*> new_graphs;
+    new_graphs.reserve(nb_patches);
+    for(faces_size_type i=0; i<nb_patches; ++i)
+    {
+      range.push_back(PolygonMesh());
+      new_graphs.push_back(&range.back());
+    }
+
+    CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, nb_patches),
+                                   [&](const std::size_t i) -> bool
+    {
+      CGAL::Face_filtered_graph<PolygonMesh, FIMap, VIMap, HIMap>
+          filter_graph(tm, CGAL::parameters::face_index_map(fim)
+                                            .halfedge_index_map(him)
+                                            .vertex_index_map(vim));
+      filter_graph.set_selected_faces(patch_faces[i]);
+      CGAL::copy_face_graph(filter_graph, *new_graphs[i]);
+      return true;
+    });
+    return;
+  }
+
   for(faces_size_type i=0; i<nb_patches; ++i)
   {
     CGAL::Face_filtered_graph<PolygonMesh, FIMap, VIMap, HIMap>
@@ -1049,6 +1289,10 @@ void split_connected_components_impl(FIMap fim,
  * identifies the connected components of `pmesh` and pushes back a new `PolygonMesh`
  * for each connected component in `cc_meshes`.
  *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ *                        In parallel, the connected components are computed as in `connected_components()`,
+ *                        and then copied concurrently.
  * \tparam PolygonMesh a model of `FaceListGraph` and `MutableFaceGraph`
  * \tparam PolygonMeshRange a model of `SequenceContainer` with `PolygonMesh` as value type
  *
@@ -1100,7 +1344,8 @@ void split_connected_components_impl(FIMap fim,
  * \cgalNamedParamsEnd
  *
  */
-template <class PolygonMesh, class PolygonMeshRange, class NamedParameters = parameters::Default_named_parameters>
+template <class ConcurrencyTag = Sequential_tag,
+          class PolygonMesh, class PolygonMeshRange, class NamedParameters = parameters::Default_named_parameters>
 void split_connected_components(const PolygonMesh& pmesh,
                                 PolygonMeshRange& cc_meshes,
                                 const NamedParameters& np = parameters::default_values())
@@ -1119,10 +1364,15 @@ void split_connected_components(const PolygonMesh& pmesh,
   Ecm ecm = choose_parameter(get_parameter(np, internal_np::edge_is_constrained),
                              Default_ecm());
 
-  internal::split_connected_components_impl(CGAL::get_initialized_face_index_map(pmesh, np),
-                                            CGAL::get_initialized_halfedge_index_map(pmesh, np),
-                                            CGAL::get_initialized_vertex_index_map(pmesh, np),
-                                            ecm, cc_meshes, pmesh, np);
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  internal::split_connected_components_impl<ConcurrencyTag>(CGAL::get_initialized_face_index_map(pmesh, np),
+                                                            CGAL::get_initialized_halfedge_index_map(pmesh, np),
+                                                            CGAL::get_initialized_vertex_index_map(pmesh, np),
+                                                            ecm, cc_meshes, pmesh, np);
 }
 
 } // namespace Polygon_mesh_processing
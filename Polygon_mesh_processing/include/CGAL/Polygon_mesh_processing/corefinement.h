@@ -89,6 +89,13 @@ enum Boolean_operation_type {UNION = 0, INTERSECTION=1,
   * \pre \link CGAL::Polygon_mesh_processing::does_bound_a_volume() `CGAL::Polygon_mesh_processing::does_bound_a_volume(tm1)` \endlink
   * \pre \link CGAL::Polygon_mesh_processing::does_bound_a_volume() `CGAL::Polygon_mesh_processing::does_bound_a_volume(tm2)` \endlink
   *
+  * With `Parallel_tag`, the intersecting pairs of boxes are filtered, the intersection points
+  * are computed, and the triangulations of the intersected faces are built concurrently.
+  * Intersection points and mesh modifications are created sequentially in a deterministic order,
+  * so that the output does not depend on the number of threads.
+  *
+  * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  *                        Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
   * @tparam TriangleMesh a model of `HalfedgeListGraph`, `FaceListGraph`, and `MutableFaceGraph`
   * @tparam NamedParameters1 a sequence of \ref bgl_namedparameters "Named Parameters"
   * @tparam NamedParameters2 a sequence of \ref bgl_namedparameters "Named Parameters"
@@ -175,7 +182,8 @@ enum Boolean_operation_type {UNION = 0, INTERSECTION=1,
   *         an input mesh but the output operation was generating a non-manifold mesh, the surface mesh
   *         will only be corefined.
   */
-template <class TriangleMesh,
+template <class ConcurrencyTag = Sequential_tag,
+          class TriangleMesh,
           class NamedParameters1 = parameters::Default_named_parameters,
           class NamedParameters2 = parameters::Default_named_parameters,
           class NamedParametersOut0 = parameters::Default_named_parameters,
@@ -385,7 +393,8 @@ corefine_and_compute_boolean_operations(
                                                   User_visitor> Ob;
 
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor> Algo_visitor;
+            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor,
+            false, false, ConcurrencyTag> Algo_visitor;
 
   Ecm_in ecm_in(tm1,tm2,ecm1,ecm2);
   Edge_mark_map_tuple ecms_out(ecm_out_0, ecm_out_1, ecm_out_2, ecm_out_3);
@@ -403,7 +412,7 @@ corefine_and_compute_boolean_operations(
     ob.setup_for_clipping_a_surface(use_compact_clipper);
   }
 
-  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor >
+  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor, ConcurrencyTag>
     functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm_in));
   functor(CGAL::Emptyset_iterator(), throw_on_self_intersection, true);
 
@@ -431,6 +440,13 @@ corefine_and_compute_boolean_operations(
   * \pre \link CGAL::Polygon_mesh_processing::does_bound_a_volume() `CGAL::Polygon_mesh_processing::does_bound_a_volume(tm1)` \endlink
   * \pre \link CGAL::Polygon_mesh_processing::does_bound_a_volume() `CGAL::Polygon_mesh_processing::does_bound_a_volume(tm2)` \endlink
   *
+  * With `Parallel_tag`, the intersecting pairs of boxes are filtered, the intersection points
+  * are computed, and the triangulations of the intersected faces are built concurrently.
+  * Intersection points and mesh modifications are created sequentially in a deterministic order,
+  * so that the output does not depend on the number of threads.
+  *
+  * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  *                        Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
   * @tparam TriangleMesh a model of `HalfedgeListGraph`, `FaceListGraph`, and `MutableFaceGraph`
   * @tparam NamedParameters1 a sequence of \ref bgl_namedparameters "Named Parameters"
   * @tparam NamedParameters2 a sequence of \ref bgl_namedparameters "Named Parameters"
@@ -510,7 +526,8 @@ corefine_and_compute_boolean_operations(
   * @return `true` if the output surface mesh is manifold and is put into `tm_out`.
   *         If `false` is returned and if `tm_out` is one of the input surface meshes,
   *         then `tm_out` is only corefined.  */
-template <class TriangleMesh,
+template <class ConcurrencyTag = Sequential_tag,
+          class TriangleMesh,
           class NamedParameters1 = parameters::Default_named_parameters,
           class NamedParameters2 = parameters::Default_named_parameters,
           class NamedParametersOut = parameters::Default_named_parameters>
@@ -527,7 +544,7 @@ corefine_and_compute_union(      TriangleMesh& tm1,
   output[Corefinement::UNION]=&tm_out;
 
   return
-   corefine_and_compute_boolean_operations(tm1, tm2, output, np1, np2,
+   corefine_and_compute_boolean_operations<ConcurrencyTag>(tm1, tm2, output, np1, np2,
                                            std::make_tuple(np_out,
                                                              parameters::default_values(),
                                                              parameters::default_values(),
@@ -542,7 +559,8 @@ corefine_and_compute_union(      TriangleMesh& tm1,
   * the intersection of the volumes bounded by `tm1` and `tm2`.
   * \copydetails CGAL::Polygon_mesh_processing::corefine_and_compute_union()
   */
-template <class TriangleMesh,
+template <class ConcurrencyTag = Sequential_tag,
+          class TriangleMesh,
           class NamedParameters1 = parameters::Default_named_parameters,
           class NamedParameters2 = parameters::Default_named_parameters,
           class NamedParametersOut = parameters::Default_named_parameters>
@@ -559,7 +577,7 @@ corefine_and_compute_intersection(      TriangleMesh& tm1,
   output[Corefinement::INTERSECTION]=&tm_out;
 
   return
-    corefine_and_compute_boolean_operations(tm1, tm2, output, np1, np2,
+    corefine_and_compute_boolean_operations<ConcurrencyTag>(tm1, tm2, output, np1, np2,
                                             std::make_tuple(parameters::default_values(),
                                                               np_out,
                                                               parameters::default_values(),
@@ -574,7 +592,8 @@ corefine_and_compute_intersection(      TriangleMesh& tm1,
   * the volume bounded by `tm1` minus the volume bounded by `tm2`.
   * \copydetails CGAL::Polygon_mesh_processing::corefine_and_compute_union()
   */
-template <class TriangleMesh,
+template <class ConcurrencyTag = Sequential_tag,
+          class TriangleMesh,
           class NamedParameters1 = parameters::Default_named_parameters,
           class NamedParameters2 = parameters::Default_named_parameters,
           class NamedParametersOut = parameters::Default_named_parameters>
@@ -592,7 +611,7 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
   output[TM1_MINUS_TM2]=&tm_out;
 
   return
-    corefine_and_compute_boolean_operations(tm1, tm2, output, np1, np2,
+    corefine_and_compute_boolean_operations<ConcurrencyTag>(tm1, tm2, output, np1, np2,
                                             std::make_tuple(parameters::default_values(),
                                                               parameters::default_values(),
                                                               np_out,
@@ -610,6 +629,12 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
  * \pre \link CGAL::Polygon_mesh_processing::does_self_intersect() `!CGAL::Polygon_mesh_processing::does_self_intersect(tm1)` \endlink
  * \pre \link CGAL::Polygon_mesh_processing::does_self_intersect() `!CGAL::Polygon_mesh_processing::does_self_intersect(tm2)` \endlink
  *
+ * With `Parallel_tag`, the intersecting pairs of boxes are filtered, the intersection points
+ * are computed, and the triangulations of the intersected faces are built concurrently,
+ * the output being the same as with `Sequential_tag`.
+ *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
  * @tparam TriangleMesh a model of `HalfedgeListGraph`, `FaceListGraph`, and `MutableFaceGraph`
  * @tparam NamedParameters1 a sequence of \ref bgl_namedparameters "Named Parameters"
  * @tparam NamedParameters2 a sequence of \ref bgl_namedparameters "Named Parameters"
@@ -662,7 +687,8 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
  * \cgalNamedParamsEnd
  *
  */
-template <class TriangleMesh,
+template <class ConcurrencyTag = Sequential_tag,
+          class TriangleMesh,
           class NamedParameters1 = parameters::Default_named_parameters,
           class NamedParameters2 = parameters::Default_named_parameters>
 void
@@ -743,11 +769,11 @@ corefine(      TriangleMesh& tm1,
 // surface intersection algorithm call
   typedef Corefinement::No_extra_output_from_corefinement<TriangleMesh> Ob;
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features> Algo_visitor;
+  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features, ConcurrencyTag> Algo_visitor;
 
   Ob ob;
   Ecm ecm(tm1,tm2,ecm1,ecm2);
-  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor>
+  Corefinement::Intersection_of_triangle_meshes<TriangleMesh, VPM1, VPM2, Algo_visitor, ConcurrencyTag>
     functor(tm1, tm2, vpm1, vpm2, Algo_visitor(uv,ob,ecm,const_mesh_ptr), const_mesh_ptr);
 
   // Fill non-manifold feature maps if provided
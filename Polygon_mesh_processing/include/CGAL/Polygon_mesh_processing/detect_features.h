@@ -21,8 +21,15 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/boost/graph/properties.h>
 #include <CGAL/Polygon_mesh_processing/connected_components.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
+#include <boost/range/irange.hpp>
+
+#include <iterator>
 #include <set>
+#include <type_traits>
+#include <vector>
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -165,7 +172,62 @@ detect_surface_patches(const PolygonMesh& p,
                                          .face_index_map(CGAL::get_initialized_face_index_map(p, np)));
 }
 
-template <typename FT, typename PolygonMesh, typename VPM, typename GT, typename EIFMap, typename VNFEMap>
+// calls `sharp_edge_functor(h)` for a halfedge `h` of each sharp edge, in the order of `edges(pmesh)`.
+// With `Parallel_tag`, the sharpness of the edges is evaluated concurrently, but the functor
+// is called sequentially.
+template <typename ConcurrencyTag, typename FT, typename PolygonMesh, typename VPM, typename GT, typename SharpEdgeFunctor>
+void for_each_sharp_edge(const FT angle_in_deg,
+                         const PolygonMesh& pmesh,
+                         const VPM vpm,
+                         const GT gt,
+                         const SharpEdgeFunctor& sharp_edge_functor)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::edge_descriptor     edge_descriptor;
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  const FT cos_angle = std::cos(CGAL::to_double(angle_in_deg) * CGAL_PI / 180.);
+  const FT sq_cos_angle = square(cos_angle);
+
+  auto is_sharp_edge = [&](const halfedge_descriptor he)
+  {
+    return is_border_edge(he, pmesh) ||
+           angle_in_deg == FT() ||
+           (angle_in_deg != FT(180) && internal::is_sharp(he, pmesh, vpm, gt, CGAL::sign(cos_angle), sq_cos_angle));
+  };
+
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    const std::vector<edge_descriptor> edge_vector(std::begin(edges(pmesh)), std::end(edges(pmesh)));
+    std::vector<char> is_sharp_edge_vector(edge_vector.size(), false);
+    CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, edge_vector.size()),
+                                   [&](const std::size_t i) -> bool
+    {
+      is_sharp_edge_vector[i] = is_sharp_edge(halfedge(edge_vector[i], pmesh));
+      return true;
+    });
+
+    for(std::size_t i=0; i<edge_vector.size(); ++i)
+      if(is_sharp_edge_vector[i])
+        sharp_edge_functor(halfedge(edge_vector[i], pmesh));
+
+    return;
+  }
+
+  // Detect sharp edges
+  for(edge_descriptor ed : edges(pmesh))
+  {
+    halfedge_descriptor he = halfedge(ed, pmesh);
+    if(is_sharp_edge(he))
+      sharp_edge_functor(he);
+  }
+}
+
+template <typename ConcurrencyTag, typename FT, typename PolygonMesh, typename VPM, typename GT, typename EIFMap, typename VNFEMap>
 void sharp_call(const FT angle_in_deg,
                 const PolygonMesh& pmesh,
                 const VPM vpm,
@@ -177,25 +239,16 @@ void sharp_call(const FT angle_in_deg,
   for(typename boost::graph_traits<PolygonMesh>::vertex_descriptor vd : vertices(pmesh))
     put(vnfe, vd, 0);
 
-  const FT cos_angle = std::cos(CGAL::to_double(angle_in_deg) * CGAL_PI / 180.);
-  const FT sq_cos_angle = square(cos_angle);
-
-  // Detect sharp edges
-  for(typename boost::graph_traits<PolygonMesh>::edge_descriptor ed : edges(pmesh))
+  for_each_sharp_edge<ConcurrencyTag>(angle_in_deg, pmesh, vpm, gt,
+                                      [&](const typename boost::graph_traits<PolygonMesh>::halfedge_descriptor he)
   {
-    typename boost::graph_traits<PolygonMesh>::halfedge_descriptor he = halfedge(ed, pmesh);
-    if(is_border_edge(he, pmesh) ||
-       angle_in_deg == FT() ||
-       (angle_in_deg != FT(180) && internal::is_sharp(he, pmesh, vpm, gt, CGAL::sign(cos_angle), sq_cos_angle)))
-    {
-      put(edge_is_feature_map, edge(he, pmesh), true);
-      put(vnfe, target(he, pmesh), get(vnfe, target(he, pmesh))+1);
-      put(vnfe, source(he, pmesh), get(vnfe, source(he, pmesh))+1);
-    }
-  }
+    put(edge_is_feature_map, edge(he, pmesh), true);
+    put(vnfe, target(he, pmesh), get(vnfe, target(he, pmesh))+1);
+    put(vnfe, source(he, pmesh), get(vnfe, source(he, pmesh))+1);
+  });
 }
 
-template <typename FT, typename PolygonMesh, typename VPM, typename GT, typename EIFMap>
+template <typename ConcurrencyTag, typename FT, typename PolygonMesh, typename VPM, typename GT, typename EIFMap>
 void sharp_call(const FT angle_in_deg,
                 const PolygonMesh& pmesh,
                 const VPM vpm,
@@ -203,23 +256,11 @@ void sharp_call(const FT angle_in_deg,
                 EIFMap edge_is_feature_map,
                 const internal_np::Param_not_found&)
 {
-  typedef typename boost::graph_traits<PolygonMesh>::edge_descriptor     edge_descriptor;
-  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
-
-  const FT cos_angle = std::cos(CGAL::to_double(angle_in_deg) * CGAL_PI / 180.);
-  const FT sq_cos_angle = square(cos_angle);
-
-  // Detect sharp edges
-  for(edge_descriptor ed : edges(pmesh))
+  for_each_sharp_edge<ConcurrencyTag>(angle_in_deg, pmesh, vpm, gt,
+                                      [&](const typename boost::graph_traits<PolygonMesh>::halfedge_descriptor he)
   {
-    halfedge_descriptor he = halfedge(ed, pmesh);
-    if(is_border_edge(he, pmesh) ||
-       angle_in_deg == FT() ||
-       (angle_in_deg != FT(180) && internal::is_sharp(he, pmesh, vpm, gt, CGAL::sign(cos_angle), sq_cos_angle)))
-    {
-      put(edge_is_feature_map, edge(he, pmesh), true);
-    }
-  }
+    put(edge_is_feature_map, edge(he, pmesh), true);
+  });
 }
 
 } // namespace internal
@@ -235,6 +276,10 @@ void sharp_call(const FT angle_in_deg,
  *
  * Also computes the number of sharp edges incident to each vertex, if `vertex_feature_degree_map` is provided.
  *
+ * In parallel, the dihedral angles are evaluated concurrently, while the property maps are filled sequentially.
+ *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
  * \tparam PolygonMesh a model of `HalfedgeListGraph`
  * \tparam FT a number type. It is
  * either deduced from the `geom_traits` \ref bgl_namedparameters "Named Parameters" if provided,
@@ -267,10 +312,12 @@ void sharp_call(const FT angle_in_deg,
  * \see `sharp_edges_segmentation()`
  */
 #ifdef DOXYGEN_RUNNING
-template <typename PolygonMesh, typename FT,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PolygonMesh, typename FT,
           typename EdgeIsFeatureMap, typename NamedParameters>
 #else
-template <typename PolygonMesh, typename EdgeIsFeatureMap, typename NamedParameters = parameters::Default_named_parameters>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename PolygonMesh, typename EdgeIsFeatureMap, typename NamedParameters = parameters::Default_named_parameters>
 #endif
 void detect_sharp_edges(const PolygonMesh& pmesh,
 #ifdef DOXYGEN_RUNNING
@@ -292,8 +339,8 @@ void detect_sharp_edges(const PolygonMesh& pmesh,
   VPM vpm = choose_parameter(get_parameter(np, internal_np::vertex_point),
                              get_const_property_map(boost::vertex_point, pmesh));
 
-  internal::sharp_call(angle_in_deg, pmesh, vpm, gt, edge_is_feature_map,
-                       get_parameter(np, internal_np::vertex_feature_degree));
+  internal::sharp_call<ConcurrencyTag>(angle_in_deg, pmesh, vpm, gt, edge_is_feature_map,
+                                       get_parameter(np, internal_np::vertex_feature_degree));
 }
 
 /*!
@@ -39,17 +39,21 @@
 #endif // CGAL_METIS_ENABLED
 
 #ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 #include <tbb/blocked_range.h>
+#include <tbb/spin_mutex.h>
 #endif // CGAL_LINKED_WITH_TBB
 
 #include <any>
+#include <atomic>
 
 #include <unordered_set>
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <limits>
+#include <queue>
 
 #ifdef CGAL_HAUSDORFF_DEBUG_PP
  #ifndef CGAL_HAUSDORFF_DEBUG
@@ -1424,7 +1428,219 @@ preprocess_bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm
   return std::make_pair(infinity_value, rebuild);
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+
+// Global bounds shared by the threads of the parallel subdivision.
+// The lower bound only increases. It is updated under a lock, and also published as a double
+// that is never larger than it, so that threads can cull candidates without locking.
+template <class Kernel,
+          class Face_handle_1,
+          class Face_handle_2>
+class Concurrent_global_bounds
+{
+  using FT = typename Kernel::FT;
+  using Bounds = Global_bounds<Kernel, Face_handle_1, Face_handle_2>;
+
+public:
+  Concurrent_global_bounds(const Bounds& bounds, const FT sq_distance_bound)
+    : m_bounds(bounds),
+      m_sq_distance_bound(sq_distance_bound),
+      m_approximate_lower(to_interval(bounds.lower).first),
+      m_stop(false)
+  {
+    // The upper bound is recomputed from the candidates that are not subdivided further
+    m_bounds.upper = m_bounds.lower;
+    m_bounds.upair = m_bounds.lpair;
+  }
+
+  // Must not be called while threads are still updating the bounds.
+  const Bounds& bounds() const { return m_bounds; }
+
+  double approximate_lower() const { return m_approximate_lower.load(std::memory_order_acquire); }
+
+  FT lower() const
+  {
+    tbb::spin_mutex::scoped_lock lock(m_mutex);
+    return m_bounds.lower;
+  }
+
+  void update_lower(const FT& lower, const Face_handle_1 tm1_face, const Face_handle_2 tm2_face)
+  {
+    // cheap rejection of the values that cannot improve the bound
+    if(to_interval(lower).second <= approximate_lower())
+      return;
+
+    tbb::spin_mutex::scoped_lock lock(m_mutex);
+    if(lower <= m_bounds.lower)
+      return;
+
+    m_bounds.lower = lower;
+    m_bounds.lpair = std::make_pair(tm1_face, tm2_face);
+
+    const double approximate_lower = to_interval(lower).first;
+    if(approximate_lower > m_approximate_lower.load(std::memory_order_relaxed))
+      m_approximate_lower.store(approximate_lower, std::memory_order_release);
+
+    // the user-defined max distance is exceeded, no need to go further
+    if(is_positive(m_sq_distance_bound) && m_sq_distance_bound <= lower)
+      m_stop.store(true, std::memory_order_release);
+  }
+
+  void update_upper(const FT& upper, const Face_handle_1 tm1_face, const Face_handle_2 tm2_face)
+  {
+    tbb::spin_mutex::scoped_lock lock(m_mutex);
+    if(upper <= m_bounds.upper)
+      return;
+
+    m_bounds.upper = upper;
+    m_bounds.upair = std::make_pair(tm1_face, tm2_face);
+  }
+
+  bool is_stopped() const { return m_stop.load(std::memory_order_acquire); }
+
+private:
+  Bounds m_bounds;
+  const FT m_sq_distance_bound;
+  std::atomic<double> m_approximate_lower;
+  std::atomic<bool> m_stop;
+  mutable tbb::spin_mutex m_mutex;
+};
+
+// Parallel version of the subdivision of the candidate triangles, see Section 5.1 in the paper.
+// The candidates are distributed over the threads by work stealing, and each thread subdivides
+// its candidates with its own priority queue. The global lower bound is shared, so that a bound
+// found by any thread culls the candidates of all the others.
+// A candidate is not subdivided further once its upper bound is within `error_bound` of the global
+// lower bound; the global upper bound is the largest upper bound of such candidates.
 template <class Kernel,
+          class TriangleMesh1,
+          class TriangleMesh2,
+          class VPM2,
+          class TM2Tree,
+          class CandidateQueue,
+          class GlobalBounds>
+void parallel_bounded_error_Hausdorff_subdivision(const TriangleMesh2& tm2,
+                                                  const VPM2 vpm2,
+                                                  const TM2Tree& tm2_tree,
+                                                  const typename Kernel::FT error_bound,
+                                                  const typename Kernel::FT sq_distance_bound,
+                                                  const typename Kernel::FT infinity_value,
+                                                  CandidateQueue& candidate_triangles,
+                                                  GlobalBounds& global_bounds)
+{
+  using FT = typename Kernel::FT;
+  using Point_3 = typename Kernel::Point_3;
+  using Triangle_3 = typename Kernel::Triangle_3;
+
+  using TM2_hd_traits = Hausdorff_primitive_traits_tm2<Triangle_3, Kernel, TriangleMesh1, TriangleMesh2, VPM2>;
+
+  using Face_handle_1 = typename boost::graph_traits<TriangleMesh1>::face_descriptor;
+  using Face_handle_2 = typename boost::graph_traits<TriangleMesh2>::face_descriptor;
+
+  using Candidate = Candidate_triangle<Kernel, Face_handle_1, Face_handle_2>;
+
+  // Sorted by decreasing upper bound, so that the most promising candidates are processed first
+  std::vector<Candidate> candidates;
+  candidates.reserve(candidate_triangles.size());
+  while(!candidate_triangles.empty())
+  {
+    candidates.push_back(candidate_triangles.top());
+    candidate_triangles.pop();
+  }
+
+  Concurrent_global_bounds<Kernel, Face_handle_1, Face_handle_2> shared_bounds(global_bounds, sq_distance_bound);
+
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, candidates.size()),
+                    [&](const tbb::blocked_range<std::size_t>& range)
+  {
+    std::priority_queue<Candidate> local_candidates;
+    for(std::size_t ci=range.begin(); ci!=range.end(); ++ci)
+    {
+      local_candidates.push(candidates[ci]);
+
+      while(!local_candidates.empty())
+      {
+        if(shared_bounds.is_stopped())
+          return;
+
+        const Candidate triangle_and_bounds = local_candidates.top();
+        local_candidates.pop();
+
+        const auto& triangle_bounds = triangle_and_bounds.bounds;
+        CGAL_assertion(triangle_bounds.lower >= FT(0));
+        CGAL_assertion(triangle_bounds.upper >= triangle_bounds.lower);
+
+        // Culled by a lower bound found by any of the threads
+        const double approximate_lower = shared_bounds.approximate_lower();
+        if(to_interval(triangle_bounds.upper).second < approximate_lower)
+          continue;
+
+        // The global lower bound can only increase, so the candidate will stay within the error bound
+        if(std::sqrt(to_double(triangle_bounds.upper)) - std::sqrt(approximate_lower) <= error_bound)
+        {
+          shared_bounds.update_upper(triangle_bounds.upper, triangle_and_bounds.tm1_face, triangle_bounds.tm2_uface);
+          continue;
+        }
+
+        const Triangle_3& triangle_for_subdivision = triangle_and_bounds.triangle;
+        const Point_3& v0 = triangle_for_subdivision.vertex(0);
+        const Point_3& v1 = triangle_for_subdivision.vertex(1);
+        const Point_3& v2 = triangle_for_subdivision.vertex(2);
+
+        // Stopping condition: All three vertices of the triangle are projected onto the same triangle in TM2.
+        const auto closest_triangle_v0 = tm2_tree.closest_point_and_primitive(v0);
+        const auto closest_triangle_v1 = tm2_tree.closest_point_and_primitive(v1);
+        const auto closest_triangle_v2 = tm2_tree.closest_point_and_primitive(v2);
+
+        if((closest_triangle_v0.second == closest_triangle_v1.second) &&
+           (closest_triangle_v1.second == closest_triangle_v2.second))
+        {
+          // The upper bound of this triangle is the actual Hausdorff distance of the triangle to the second mesh
+          shared_bounds.update_lower(triangle_bounds.upper, triangle_and_bounds.tm1_face, triangle_bounds.tm2_uface);
+          shared_bounds.update_upper(triangle_bounds.upper, triangle_and_bounds.tm1_face, triangle_bounds.tm2_uface);
+          continue;
+        }
+
+        // Subdivide the triangle into four smaller triangles.
+        const Point_3 v01 = CGAL::midpoint(v0, v1);
+        const Point_3 v02 = CGAL::midpoint(v0, v2);
+        const Point_3 v12 = CGAL::midpoint(v1, v2);
+        const std::array<Triangle_3, 4> sub_triangles = { Triangle_3(v0, v01, v02), Triangle_3(v1 , v01, v12),
+                                                          Triangle_3(v2, v02, v12), Triangle_3(v01, v02, v12) };
+
+        // The TM2 traversal culls with a snapshot of the global lower bound, which is only conservative
+        GlobalBounds current_bounds(infinity_value);
+        current_bounds.lower = shared_bounds.lower();
+
+        for(std::size_t i=0; i<4; ++i)
+        {
+          const Bbox_3 sub_t1_bbox = sub_triangles[i].bbox();
+
+          // Ensure 'uface' is initialized in case the upper bound is not changed by the subdivision
+          Local_bounds<Kernel, Face_handle_1, Face_handle_2> bounds(triangle_bounds.upper);
+          bounds.tm2_uface = triangle_bounds.tm2_uface;
+
+          TM2_hd_traits traversal_traits_tm2(sub_t1_bbox, tm2, vpm2, bounds, current_bounds, infinity_value);
+          tm2_tree.traversal_with_priority(sub_triangles[i], traversal_traits_tm2);
+
+          const auto& sub_triangle_bounds = traversal_traits_tm2.get_local_bounds();
+          CGAL_assertion(sub_triangle_bounds.lower >= FT(0));
+          CGAL_assertion(sub_triangle_bounds.upper >= sub_triangle_bounds.lower);
+
+          shared_bounds.update_lower(sub_triangle_bounds.lower, triangle_and_bounds.tm1_face, sub_triangle_bounds.tm2_lface);
+          local_candidates.emplace(sub_triangles[i], sub_triangle_bounds, triangle_and_bounds.tm1_face);
+        }
+      }
+    }
+  });
+
+  global_bounds = shared_bounds.bounds();
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+template <class Concurrency_tag,
+          class Kernel,
           class TriangleMesh1,
           class TriangleMesh2,
           class VPM1,
@@ -1528,6 +1744,15 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
   std::size_t explored_candidates_count = 0;
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+  // The parallel subdivision consumes all the candidates, so the sequential loop below is skipped.
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    parallel_bounded_error_Hausdorff_subdivision<Kernel, TriangleMesh1>(
+      tm2, vpm2, tm2_tree, error_bound, sq_distance_bound, infinity_value, candidate_triangles, global_bounds);
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
   // See Section 5.1 in the paper.
   while(!candidate_triangles.empty())
   {
@@ -1772,7 +1997,8 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
 
   CGAL_assertion(global_bounds.lower >= FT(0));
   CGAL_assertion(global_bounds.upper >= global_bounds.lower);
-  CGAL_assertion(CGAL::approximate_sqrt(global_bounds.upper) - CGAL::approximate_sqrt(global_bounds.lower) <= error_bound);
+  CGAL_assertion((is_positive(sq_distance_bound) && sq_distance_bound <= global_bounds.lower) ||
+                 CGAL::approximate_sqrt(global_bounds.upper) - CGAL::approximate_sqrt(global_bounds.lower) <= error_bound);
 
   // Get realizing triangles.
   CGAL_assertion(global_bounds.lpair.first != boost::graph_traits<TriangleMesh1>::null_face());
@@ -1948,7 +2174,7 @@ struct Bounded_error_squared_distance_computation
 
       // TODO: add distance_bound (now it is FT(-1)) in case we use parallel
       // for checking if two meshes are close.
-      const FT sqd = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+      const FT sqd = bounded_error_squared_Hausdorff_distance_impl<Sequential_tag, Kernel>(
                        tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
                        error_bound, sq_initial_bound, FT(-1) /*sq_distance_bound*/, infinity_value,
                        stub);
@@ -1994,9 +2220,9 @@ bounded_error_squared_one_sided_Hausdorff_distance_impl(const TriangleMesh1& tm1
                                                         const NamedParameters2& np2,
                                                         OutputIterator& out)
 {
-#if !defined(CGAL_LINKED_WITH_TBB) || !defined(CGAL_METIS_ENABLED)
+#ifndef CGAL_LINKED_WITH_TBB
   static_assert(!std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value,
-                                      "Parallel_tag is enabled but at least TBB or METIS is unavailable.");
+                "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
   using FT = typename Kernel::FT;
@@ -2229,7 +2455,7 @@ bounded_error_squared_one_sided_Hausdorff_distance_impl(const TriangleMesh1& tm1
 #ifdef CGAL_HAUSDORFF_DEBUG
     std::cout << "* executing sequential version" << std::endl;
 #endif
-    sq_hdist = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_hdist = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
                  error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out);
   }
@@ -2269,9 +2495,9 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
                                                         OutputIterator1& out1,
                                                         OutputIterator2& out2)
 {
-#if !defined(CGAL_LINKED_WITH_TBB) || !defined(CGAL_METIS_ENABLED)
+#ifndef CGAL_LINKED_WITH_TBB
   static_assert(!std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value,
-                "Parallel_tag is enabled but at least TBB or METIS is unavailable.");
+                "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
   // Optimized version.
@@ -2330,7 +2556,7 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
 
   if(!compare_meshes || (compare_meshes && tm1_only.size() > 0))
   {
-    sq_dista = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_dista = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
                  error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out1);
   }
@@ -2354,7 +2580,7 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
 
   if(!compare_meshes || (compare_meshes && tm2_only.size() > 0))
   {
-    sq_distb = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_distb = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm2, tm1, vpm2, vpm1, tm2_tree, tm1_tree,
                  error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out2);
   }
@@ -2459,9 +2685,11 @@ bounded_error_squared_Hausdorff_distance_naive_impl(const TriangleMesh1& tm1,
  * is at most `error_bound` away from the actual Hausdorff distance from `tm1` to `tm2`.
  *
  * @tparam Concurrency_tag enables sequential versus parallel algorithm.
- *                         Possible values are `Sequential_tag` and `Parallel_tag`.
- *                         Currently, the parallel version is not implemented and the
- *                         sequential version is always used whatever tag is chosen!
+ *                         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ *                         With `Parallel_tag`, the subdivision of the candidate triangles of `tm1`
+ *                         is distributed over the threads, which share the current lower bound
+ *                         on the distance. The result may differ from the sequential one,
+ *                         but it is also within `error_bound` of the actual Hausdorff distance.
  *
  * @tparam TriangleMesh1 a model of the concept `FaceListGraph`
  * @tparam TriangleMesh2 a model of the concept `FaceListGraph`
@@ -2605,6 +2833,9 @@ double bounded_error_symmetric_Hausdorff_distance(const TriangleMesh1& tm1,
  * Instead of computing the full distance and checking it against the user-provided
  * value, this function returns early if certain criteria show that the meshes
  * do not satisfy the provided `distance_bound`.
+ * In particular, the computation stops as soon as a lower bound on the distance
+ * larger than `distance_bound` is found, which with `Parallel_tag`
+ * can be found by any of the threads.
  *
  * See the function `CGAL::Polygon_mesh_processing::bounded_error_Hausdorff_distance()`
  * for a complete description of the parameters and requirements. The following extra named parameter
@@ -0,0 +1,91 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+
+#ifndef CGAL_POLYGON_MESH_PROCESSING_INTERNAL_CONCURRENT_UNION_FIND_H
+#define CGAL_POLYGON_MESH_PROCESSING_INTERNAL_CONCURRENT_UNION_FIND_H
+
+#include <CGAL/license/Polygon_mesh_processing/connected_components.h>
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Polygon_mesh_processing {
+namespace internal {
+
+// A lock-free union-find over the indices `0, ..., n-1`.
+// The parent of an index is never larger than the index itself: `unite()` links the larger
+// of the two roots below the smaller one, and `find()` compresses the paths by halving.
+// Hence the representative of a set is its smallest index, whatever the order of the calls,
+// and both functions can be called concurrently.
+class Concurrent_union_find
+{
+public:
+  explicit Concurrent_union_find(const std::size_t n)
+    : m_parent(n)
+  {
+    for(std::size_t i=0; i<n; ++i)
+      m_parent[i].store(i, std::memory_order_relaxed);
+  }
+
+  std::size_t size() const { return m_parent.size(); }
+
+  std::size_t find(std::size_t i)
+  {
+    for(;;)
+    {
+      std::size_t p = m_parent[i].load(std::memory_order_acquire);
+      if(p == i)
+        return i;
+
+      const std::size_t gp = m_parent[p].load(std::memory_order_acquire);
+      if(p != gp) // path halving, which can fail harmlessly if another thread got there first
+        m_parent[i].compare_exchange_weak(p, gp, std::memory_order_release, std::memory_order_relaxed);
+
+      i = gp;
+    }
+  }
+
+  bool is_root(const std::size_t i) const
+  {
+    return m_parent[i].load(std::memory_order_acquire) == i;
+  }
+
+  void unite(std::size_t i, std::size_t j)
+  {
+    for(;;)
+    {
+      i = find(i);
+      j = find(j);
+      if(i == j)
+        return;
+
+      if(i < j)
+        std::swap(i, j);
+
+      // `i` might have been linked to another root in the meantime
+      std::size_t expected = i;
+      if(m_parent[i].compare_exchange_strong(expected, j, std::memory_order_acq_rel, std::memory_order_relaxed))
+        return;
+    }
+  }
+
+private:
+  std::vector<std::atomic<std::size_t> > m_parent;
+};
+
+} // namespace internal
+} // namespace Polygon_mesh_processing
+} // namespace CGAL
+
+#endif // CGAL_POLYGON_MESH_PROCESSING_INTERNAL_CONCURRENT_UNION_FIND_H
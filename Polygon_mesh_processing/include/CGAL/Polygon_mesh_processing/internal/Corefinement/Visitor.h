@@ -25,9 +25,14 @@
 #include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/Projection_traits_3.h>
 #include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/small_vector.hpp>
+#include <boost/range/irange.hpp>
+
+#include <memory>
 
 namespace CGAL{
 namespace Polygon_mesh_processing {
@@ -440,7 +445,8 @@ template< class TriangleMesh,
           class EdgeMarkMapBind_ = Default,
           class UserVisitor_ = Default,
           bool doing_autorefinement = false,
-          bool handle_non_manifold_features = false >
+          bool handle_non_manifold_features = false,
+          class ConcurrencyTag = Sequential_tag >
 class Surface_intersection_visitor_for_corefinement{
 //default template parameters
   typedef typename Default::Get<EdgeMarkMapBind_,
@@ -1034,7 +1040,7 @@ public:
 
   //insert intersection edges as constrained edges in a CDT triangulation
   void insert_constrained_edges(
-    Node_ids& node_ids,
+    const Node_ids& node_ids,
     CDT& cdt,
     std::map<Node_id, CDT_Vertex_handle>& id_to_CDT_vh,
     std::vector<std::pair<Node_id,Node_id> >& constrained_edges,
@@ -1188,6 +1194,311 @@ public:
     }
   }
 
+  // The constrained triangulation of a face to be retriangulated, together
+  // with the correspondence between its elements and the ones of the mesh
+  struct Face_triangulation
+  {
+    // the face boundary if it was refined, nullptr otherwise
+    Face_boundary* f_boundary = nullptr;
+    // the vertices of f
+    std::array<vertex_descriptor,3> f_vertices;
+    // the node_id of an input vertex or a fake id (>=nb_nodes)
+    std::array<Node_id,3> f_indices;
+    std::map<Node_id,CDT_Vertex_handle> id_to_CDT_vh;
+    //associate an edge of the triangulation to a halfedge in a given polyhedron
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
+    std::array<CDT_Vertex_handle,3> triangle_vertices;
+    std::vector<std::pair<Node_id,Node_id> > constrained_edges;
+    std::unique_ptr<CDT> cdt;
+  };
+
+  // collects the vertices of `f` (and its halfedges if its boundary was not refined)
+  void init_face_triangulation(face_descriptor f,
+                               Face_triangulation& ft,
+                               Face_boundaries& face_boundaries,
+                               Vertex_to_node_id& vertex_to_node_id,
+                               const TriangleMesh& tm,
+                               Node_id nb_nodes)
+  {
+    typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
+    ft.f_boundary = it_fb!=face_boundaries.end() ? &it_fb->second : nullptr;
+    ft.f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
+    if (ft.f_boundary!=nullptr){ //the boundary of the triangle face was refined
+      ft.f_vertices[0]=ft.f_boundary->vertices[0];
+      ft.f_vertices[1]=ft.f_boundary->vertices[1];
+      ft.f_vertices[2]=ft.f_boundary->vertices[2];
+      update_face_indices(ft.f_vertices,ft.f_indices,vertex_to_node_id);
+    }
+    else{
+      CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
+      halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
+      ft.f_vertices[0]=target(h0,tm); //nb_nodes
+      ft.f_vertices[1]=target(h1,tm); //nb_nodes+1
+      ft.f_vertices[2]=target(h2,tm); //nb_nodes+2
+
+      update_face_indices(ft.f_vertices,ft.f_indices,vertex_to_node_id);
+      ft.edge_to_hedge[std::make_pair( ft.f_indices[2],ft.f_indices[0] )] = h0;
+      ft.edge_to_hedge[std::make_pair( ft.f_indices[0],ft.f_indices[1] )] = h1;
+      ft.edge_to_hedge[std::make_pair( ft.f_indices[1],ft.f_indices[2] )] = h2;
+    }
+  }
+
+  template <class VPM>
+  bool is_degenerate_face(const Face_triangulation& ft, const VPM& vpm) const
+  {
+    return const_mesh_ptr &&
+           collinear( get(vpm,ft.f_vertices[0]), get(vpm,ft.f_vertices[1]), get(vpm,ft.f_vertices[2]) );
+  }
+
+  // returns `true` if the triangulation of a non-degenerate face does not depend
+  // on the faces triangulated before it, that is if none of its nodes is an
+  // intersection point of coplanar faces (see XSL_TAG_CPL_VERT)
+  bool is_independent_face(const Node_ids& node_ids,
+                           const Face_triangulation& ft,
+                           Node_id nb_nodes) const
+  {
+    if (number_coplanar_vertices==0) return true;
+
+    for (int i=0;i<3;++i)
+      if (ft.f_indices[i] < nb_nodes && ft.f_indices[i] < number_coplanar_vertices)
+        return false;
+    for(Node_id id : node_ids)
+      if (id < number_coplanar_vertices) return false;
+    if (ft.f_boundary!=nullptr)
+      for (int i=0;i<3;++i)
+        for(Node_id id : ft.f_boundary->node_ids_array[i])
+          if (id < number_coplanar_vertices) return false;
+    return true;
+  }
+
+  // builds the constrained triangulation of a face without modifying the mesh
+  // nor the visitor
+  template <class VPM>
+  void build_face_triangulation(const Node_ids& node_ids,
+                                Face_triangulation& ft,
+                                const TriangleMesh& tm,
+                                const VPM& vpm,
+                                const INodes& nodes,
+                                Node_id nb_nodes)
+  {
+    std::map<Node_id,CDT_Vertex_handle>& id_to_CDT_vh = ft.id_to_CDT_vh;
+    std::array<CDT_Vertex_handle,3>& triangle_vertices = ft.triangle_vertices;
+
+    typename EK::Point_3 p = nodes.to_exact(get(vpm,ft.f_vertices[0])),
+                         q = nodes.to_exact(get(vpm,ft.f_vertices[1])),
+                         r = nodes.to_exact(get(vpm,ft.f_vertices[2]));
+///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
+    CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
+    ft.cdt = std::make_unique<CDT>(traits);
+    CDT& cdt = *ft.cdt;
+
+    // insert triangle points
+    //we can do this to_exact because these are supposed to be input points.
+    triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
+    triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
+    triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
+    triangle_vertices[2]->set_point(r);
+
+    triangle_vertices[0]->info()=ft.f_indices[0];
+    triangle_vertices[1]->info()=ft.f_indices[1];
+    triangle_vertices[2]->info()=ft.f_indices[2];
+
+    //if one of the triangle input vertex is also a node
+    for (int ik=0;ik<3;++ik){
+      if ( ft.f_indices[ik]<nb_nodes )
+        id_to_CDT_vh.insert(
+            std::make_pair(ft.f_indices[ik],triangle_vertices[ik]));
+    }
+    //insert points on edges
+    if (ft.f_boundary!=nullptr) //if f not a triangle?
+    {
+      // collect infinite faces incident to the initial triangle
+      typename CDT::Face_handle infinite_faces[3];
+      for (int i=0;i<3;++i)
+      {
+        int oi=-1;
+        CGAL_assertion_code(bool is_edge = )
+        cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
+        CGAL_assertion(is_edge);
+        CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
+      }
+
+      // In this loop, for each original edge of the triangle, we insert
+      // the constrained edges and we recover the halfedge_descriptor
+      // corresponding to these constrained (they are already in tm)
+      const Face_boundary& f_boundary=*ft.f_boundary;
+      for (int i=0;i<3;++i){
+        //handle case of halfedge starting at triangle_vertices[i]
+        // and ending at triangle_vertices[(i+1)%3]
+
+        const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
+        CDT_Vertex_handle previous=triangle_vertices[i];
+        Node_id prev_index=ft.f_indices[i];// node-id of the mesh vertex
+        halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
+        CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
+        if (!ids_on_edge.empty()){ //is there at least one node on this edge?
+          // fh must be an infinite face
+          // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
+          for(Node_id id : ids_on_edge)
+          {
+            CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
+            vh->info()=id;
+            id_to_CDT_vh.insert(std::make_pair(id,vh));
+            ft.edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
+            previous=vh;
+            hedge=next(hedge,tm);
+            prev_index=id;
+          }
+        }
+        else{
+        CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
+          CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
+          CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
+        }
+        CGAL_assertion(hedge==f_boundary.halfedges[i]);
+        ft.edge_to_hedge[std::make_pair(prev_index,ft.f_indices[(i+1)%3])] =
+          f_boundary.halfedges[i];
+      }
+    }
+
+    //insert point inside face
+    for(Node_id node_id : node_ids)
+    {
+      CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
+      vh->info()=node_id;
+      id_to_CDT_vh.insert(std::make_pair(node_id,vh));
+    }
+
+    // insert constraints that are interior to the triangle (in the case
+    // no edges are collinear in the meshes)
+    insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,ft.constrained_edges);
+
+    // insert constraints between points that are on the boundary
+    // (not a constrained on the triangle boundary)
+    if (ft.f_boundary!=nullptr) //is f not a triangle ?
+    {
+      for (int i=0;i<3;++i)
+      {
+        const Node_ids& ids=ft.f_boundary->node_ids_array[i];
+        insert_constrained_edges(ids,cdt,id_to_CDT_vh,ft.constrained_edges,1);
+      }
+    }
+
+    //insert coplanar edges for endpoints of triangles
+    for (int i=0;i<3;++i){
+      Node_id nindex=triangle_vertices[i]->info();
+      if ( nindex < nb_nodes )
+        insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
+    }
+  }
+
+  // imports the triangulation of the face `f` in `tm`
+  template <class VPM>
+  void import_face_triangulation(face_descriptor f,
+                                 const Node_ids& node_ids,
+                                 Face_triangulation& ft,
+                                 TriangleMesh& tm,
+                                 const VPM& vpm,
+                                 INodes& nodes,
+                                 Node_id_to_vertex& node_id_to_vertex,
+                                 Node_id nb_nodes)
+  {
+    CDT& cdt = *ft.cdt;
+
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, ft.f_vertices[0]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, ft.f_vertices[1]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, ft.f_vertices[2]);
+
+    if (doing_autorefinement || handle_non_manifold_features)
+      for (int ik=0;ik<3;++ik)
+        if ( ft.f_indices[ik]<nb_nodes )
+          // update the current vertex in node_id_to_vertex
+          // to match the one of the face
+          node_id_to_vertex.set_temporary_vertex_for_retriangulation(ft.f_indices[ik], ft.f_vertices[ik]);
+          // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
+          // it is OK not to store all vertices corresponding to this id as the approximate version
+          // is already tight and the call in Intersection_nodes::finalize() will not fix anything
+
+    //XSL_TAG_CPL_VERT
+    //collect edges incident to a point that is the intersection of two
+    // coplanar faces. This ensure that triangulations are compatible.
+    if (ft.f_boundary!=nullptr) //is f not a triangle ?
+    {
+      for (typename CDT::Finite_vertices_iterator
+            vit=cdt.finite_vertices_begin(),
+            vit_end=cdt.finite_vertices_end();vit_end!=vit;++vit)
+      {
+        //skip original vertices (that are not nodes) and non-coplanar face
+        // issued vertices (this is working because intersection points
+        // between coplanar facets are the first inserted)
+        if (vit->info() >= nb_nodes ||
+            vit->info() >= number_coplanar_vertices) continue;
+        // \todo no need to insert constrained edges (they also are constrained
+        // in the other mesh)!!
+        typename std::map< Node_id,std::set<Node_id> >::iterator res =
+            coplanar_constraints.insert(
+                std::make_pair(vit->info(),std::set<Node_id>())).first;
+        //turn around the vertex and get incident edge
+        typename CDT::Edge_circulator  start=cdt.incident_edges(vit);
+        typename CDT::Edge_circulator  curr=start;
+        do{
+          if (cdt.is_infinite(*curr) ) continue;
+          typename CDT::Edge mirror=cdt.mirror_edge(*curr);
+          if ( cdt.is_infinite( curr->first->vertex(curr->second) ) ||
+               cdt.is_infinite( mirror.first->vertex(mirror.second) ) )
+            continue; // skip edges that are on the boundary of the triangle
+                      // (these are already constrained)
+          //insert edges in the set of constraints
+          CDT_Vertex_handle vh=vit;
+          int nindex = curr->first->vertex((curr->second+1)%3)==vh
+                         ? (curr->second+2)%3
+                         : (curr->second+1)%3;
+          CDT_Vertex_handle vn=curr->first->vertex(nindex);
+          if ( vit->info() > vn->info() || vn->info()>=nb_nodes)
+            continue; //take only one out of the two edges + skip input
+          CGAL_assertion(vn->info()<nb_nodes);
+          res->second.insert( vn->info() );
+        }while(start!=++curr);
+      }
+    }
+
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = ft.edge_to_hedge;
+
+    // import the triangle in `cdt` in the face `f` of `tm`
+    triangulate_a_face(f, tm, nodes, node_ids, node_id_to_vertex,
+      edge_to_hedge, cdt, vpm, output_builder, user_visitor);
+
+    // TODO Here we do the update only for internal edges.
+    // Update for border halfedges could be done during the split
+
+    //3) mark halfedges that are common to two polyhedral surfaces
+    //recover halfedges inserted that are on the intersection
+    typedef std::pair<Node_id,Node_id> Node_id_pair;
+    for(const Node_id_pair& node_id_pair : ft.constrained_edges)
+    {
+      typename std::map<Node_id_pair,halfedge_descriptor>
+        ::iterator it_poly_hedge=edge_to_hedge.find(node_id_pair);
+      //we cannot have an assertion here in case an edge or part of an edge is a constraints.
+      //Indeed, the graph_of_constraints report an edge 0,1 and 1,0 for example while only one of the two
+      //is defined as one of them defines an adjacent face
+      //CGAL_assertion(it_poly_hedge!=edge_to_hedge.end());
+      if( it_poly_hedge!=edge_to_hedge.end() ){
+        call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
+        output_builder.set_edge_per_polyline(tm,node_id_pair,it_poly_hedge->second);
+      }
+      else{
+        //WARNING: in few case this is needed if the marked edge is on the border
+        //to optimize it might be better to only use sorted pair. TAG_SLXX1
+        Node_id_pair opposite_pair(node_id_pair.second,node_id_pair.first);
+        it_poly_hedge=edge_to_hedge.find(opposite_pair);
+        CGAL_assertion( it_poly_hedge!=edge_to_hedge.end() );
+
+        call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
+        output_builder.set_edge_per_polyline(tm,opposite_pair,it_poly_hedge->second);
+      }
+    }
+  }
+
   template <class OnFaceMapIterator, class VPM>
   void triangulate_intersected_faces(OnFaceMapIterator it,
                                      const VPM& vpm,
@@ -1204,58 +1515,61 @@ public:
 
     const Node_id nb_nodes = nodes.size();
 
+    // Faces are processed by blocks: the triangulations of the independent
+    // faces of a block are first built (concurrently with `Parallel_tag`)
+    // and then imported one by one in `tm`, in the same order as in the
+    // sequential version. Other triangulations are built when imported.
+    const std::size_t block_size =
+      std::is_convertible<ConcurrencyTag, Parallel_tag>::value ? 1024 : 1;
+
+    std::vector<typename On_face_map::iterator> face_iterators;
+    face_iterators.reserve(on_face_map.size());
     for (typename On_face_map::iterator it=on_face_map.begin();
           it!=on_face_map.end();++it)
+      face_iterators.push_back(it);
+
+    std::vector<Face_triangulation> triangulations;
+    for (std::size_t fi=0; fi<face_iterators.size(); ++fi)
     {
-      user_visitor.triangulating_faces_step();
-      face_descriptor f = it->first; //the face to be triangulated
-      Node_ids& node_ids  = it->second; // ids of nodes in the interior of f
-      typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
-
-      std::map<Node_id,typename CDT::Vertex_handle> id_to_CDT_vh;
-
-      //associate an edge of the triangulation to a halfedge in a given polyhedron
-      std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
-
-      // the vertices of f
-      std::array<vertex_descriptor,3> f_vertices;
-      // the node_id of an input vertex or a fake id (>=nb_nodes)
-      std::array<Node_id,3> f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
-      if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
-        f_vertices[0]=it_fb->second.vertices[0];
-        f_vertices[1]=it_fb->second.vertices[1];
-        f_vertices[2]=it_fb->second.vertices[2];
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        if (doing_autorefinement || handle_non_manifold_features)
-          it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
-      }
-      else{
-        CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
-        halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
-        f_vertices[0]=target(h0,tm); //nb_nodes
-        f_vertices[1]=target(h1,tm); //nb_nodes+1
-        f_vertices[2]=target(h2,tm); //nb_nodes+2
-
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
-        edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
-        edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
+      if (fi % block_size == 0)
+      {
+        triangulations.clear();
+        triangulations.resize((std::min)(block_size, face_iterators.size()-fi));
+        CGAL::for_each<ConcurrencyTag>(
+          boost::irange<std::size_t>(0, triangulations.size()),
+          [&](std::size_t i) -> bool
+          {
+            typename On_face_map::iterator it = face_iterators[fi+i];
+            Face_triangulation& ft = triangulations[i];
+            init_face_triangulation(it->first, ft, face_boundaries, vertex_to_node_id, tm, nb_nodes);
+            if (!is_degenerate_face(ft, vpm) && is_independent_face(it->second, ft, nb_nodes))
+              build_face_triangulation(it->second, ft, tm, vpm, nodes, nb_nodes);
+            return true;
+          });
       }
 
+      user_visitor.triangulating_faces_step();
+      face_descriptor f = face_iterators[fi]->first; //the face to be triangulated
+      Node_ids& node_ids  = face_iterators[fi]->second; // ids of nodes in the interior of f
+      Face_triangulation& ft = triangulations[fi % block_size];
+
+      if (ft.f_boundary!=nullptr && (doing_autorefinement || handle_non_manifold_features))
+        ft.f_boundary->update_node_id_to_vertex_map(node_id_to_vertex, tm);
+
       // handle possible presence of degenerate faces
-      if (const_mesh_ptr && collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) ) )
+      if (is_degenerate_face(ft, vpm))
       {
         Node_ids face_vertex_nids;
 
         //check if one of the triangle input vertex is also a node
         for (int ik=0;ik<3;++ik)
-          if ( f_indices[ik]<nb_nodes )
-            face_vertex_nids.push_back(f_indices[ik]);
+          if ( ft.f_indices[ik]<nb_nodes )
+            face_vertex_nids.push_back(ft.f_indices[ik]);
 
         // collect nodes on edges (if any)
-        if (it_fb != face_boundaries.end())
+        if (ft.f_boundary != nullptr)
         {
-          Face_boundary& f_boundary=it_fb->second;
+          Face_boundary& f_boundary=*ft.f_boundary;
           for (int i=0;i<3;++i)
             std::copy(f_boundary.node_ids_array[i].begin(),
                       f_boundary.node_ids_array[i].end(),
@@ -1306,7 +1620,7 @@ public:
           #endif
         }
 
-        CGAL_assertion(constraints.empty() || it_fb != face_boundaries.end());
+        CGAL_assertion(constraints.empty() || ft.f_boundary != nullptr);
         std::vector<face_descriptor> new_faces;
         for (const std::array<std::pair<halfedge_descriptor, Node_id>, 2>& a : constraints)
         {
@@ -1333,204 +1647,12 @@ public:
         continue;
       }
 
-      typename EK::Point_3 p = nodes.to_exact(get(vpm,f_vertices[0])),
-                           q = nodes.to_exact(get(vpm,f_vertices[1])),
-                           r = nodes.to_exact(get(vpm,f_vertices[2]));
-///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
-      CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
-      CDT cdt(traits);
-
-      // insert triangle points
-      std::array<CDT_Vertex_handle,3> triangle_vertices;
-      //we can do this to_exact because these are supposed to be input points.
-      triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
-      triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
-      triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
-      triangle_vertices[2]->set_point(r);
-
-      triangle_vertices[0]->info()=f_indices[0];
-      triangle_vertices[1]->info()=f_indices[1];
-      triangle_vertices[2]->info()=f_indices[2];
-
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, f_vertices[0]);
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, f_vertices[1]);
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, f_vertices[2]);
-
-      //if one of the triangle input vertex is also a node
-      for (int ik=0;ik<3;++ik){
-        if ( f_indices[ik]<nb_nodes )
-        {
-          id_to_CDT_vh.insert(
-              std::make_pair(f_indices[ik],triangle_vertices[ik]));
-          if (doing_autorefinement || handle_non_manifold_features)
-            // update the current vertex in node_id_to_vertex
-            // to match the one of the face
-            node_id_to_vertex.set_temporary_vertex_for_retriangulation(f_indices[ik], f_vertices[ik]);
-            // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
-            // it is OK not to store all vertices corresponding to this id as the approximate version
-            // is already tight and the call in Intersection_nodes::finalize() will not fix anything
-        }
-      }
-      //insert points on edges
-      if (it_fb!=face_boundaries.end()) //if f not a triangle?
-      {
-        // collect infinite faces incident to the initial triangle
-        typename CDT::Face_handle infinite_faces[3];
-        for (int i=0;i<3;++i)
-        {
-          int oi=-1;
-          CGAL_assertion_code(bool is_edge = )
-          cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
-          CGAL_assertion(is_edge);
-          CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
-        }
-
-        // In this loop, for each original edge of the triangle, we insert
-        // the constrained edges and we recover the halfedge_descriptor
-        // corresponding to these constrained (they are already in tm)
-        Face_boundary& f_boundary=it_fb->second;
-        for (int i=0;i<3;++i){
-          //handle case of halfedge starting at triangle_vertices[i]
-          // and ending at triangle_vertices[(i+1)%3]
-
-          const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
-          CDT_Vertex_handle previous=triangle_vertices[i];
-          Node_id prev_index=f_indices[i];// node-id of the mesh vertex
-          halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
-          CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
-          if (!ids_on_edge.empty()){ //is there at least one node on this edge?
-            // fh must be an infinite face
-            // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
-            for(Node_id id : ids_on_edge)
-            {
-              CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
-              vh->info()=id;
-              id_to_CDT_vh.insert(std::make_pair(id,vh));
-              edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
-              previous=vh;
-              hedge=next(hedge,tm);
-              prev_index=id;
-            }
-          }
-          else{
-          CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
-            CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
-            CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
-          }
-          CGAL_assertion(hedge==f_boundary.halfedges[i]);
-          edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
-            it_fb->second.halfedges[i];
-        }
-      }
+      if (!ft.cdt)
+        build_face_triangulation(node_ids, ft, tm, vpm, nodes, nb_nodes);
 
-      //insert point inside face
-      for(Node_id node_id : node_ids)
-      {
-        CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
-        vh->info()=node_id;
-        id_to_CDT_vh.insert(std::make_pair(node_id,vh));
-      }
-
-      std::vector<std::pair<Node_id,Node_id> > constrained_edges;
-
-      // insert constraints that are interior to the triangle (in the case
-      // no edges are collinear in the meshes)
-      insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
-
-      // insert constraints between points that are on the boundary
-      // (not a constrained on the triangle boundary)
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
-      {
-        for (int i=0;i<3;++i)
-        {
-          Node_ids& ids=it_fb->second.node_ids_array[i];
-          insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
-        }
-      }
-
-      //insert coplanar edges for endpoints of triangles
-      for (int i=0;i<3;++i){
-        Node_id nindex=triangle_vertices[i]->info();
-        if ( nindex < nb_nodes )
-          insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
-      }
-
-      //XSL_TAG_CPL_VERT
-      //collect edges incident to a point that is the intersection of two
-      // coplanar faces. This ensure that triangulations are compatible.
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
-      {
-        for (typename CDT::Finite_vertices_iterator
-              vit=cdt.finite_vertices_begin(),
-              vit_end=cdt.finite_vertices_end();vit_end!=vit;++vit)
-        {
-          //skip original vertices (that are not nodes) and non-coplanar face
-          // issued vertices (this is working because intersection points
-          // between coplanar facets are the first inserted)
-          if (vit->info() >= nb_nodes ||
-              vit->info() >= number_coplanar_vertices) continue;
-          // \todo no need to insert constrained edges (they also are constrained
-          // in the other mesh)!!
-          typename std::map< Node_id,std::set<Node_id> >::iterator res =
-              coplanar_constraints.insert(
-                  std::make_pair(vit->info(),std::set<Node_id>())).first;
-          //turn around the vertex and get incident edge
-          typename CDT::Edge_circulator  start=cdt.incident_edges(vit);
-          typename CDT::Edge_circulator  curr=start;
-          do{
-            if (cdt.is_infinite(*curr) ) continue;
-            typename CDT::Edge mirror=cdt.mirror_edge(*curr);
-            if ( cdt.is_infinite( curr->first->vertex(curr->second) ) ||
-                 cdt.is_infinite( mirror.first->vertex(mirror.second) ) )
-              continue; // skip edges that are on the boundary of the triangle
-                        // (these are already constrained)
-            //insert edges in the set of constraints
-            CDT_Vertex_handle vh=vit;
-            int nindex = curr->first->vertex((curr->second+1)%3)==vh
-                           ? (curr->second+2)%3
-                           : (curr->second+1)%3;
-            CDT_Vertex_handle vn=curr->first->vertex(nindex);
-            if ( vit->info() > vn->info() || vn->info()>=nb_nodes)
-              continue; //take only one out of the two edges + skip input
-            CGAL_assertion(vn->info()<nb_nodes);
-            res->second.insert( vn->info() );
-          }while(start!=++curr);
-        }
-      }
-
-      // import the triangle in `cdt` in the face `f` of `tm`
-      triangulate_a_face(f, tm, nodes, node_ids, node_id_to_vertex,
-        edge_to_hedge, cdt, vpm, output_builder, user_visitor);
-
-      // TODO Here we do the update only for internal edges.
-      // Update for border halfedges could be done during the split
-
-      //3) mark halfedges that are common to two polyhedral surfaces
-      //recover halfedges inserted that are on the intersection
-      typedef std::pair<Node_id,Node_id> Node_id_pair;
-      for(const Node_id_pair& node_id_pair : constrained_edges)
-      {
-        typename std::map<Node_id_pair,halfedge_descriptor>
-          ::iterator it_poly_hedge=edge_to_hedge.find(node_id_pair);
-        //we cannot have an assertion here in case an edge or part of an edge is a constraints.
-        //Indeed, the graph_of_constraints report an edge 0,1 and 1,0 for example while only one of the two
-        //is defined as one of them defines an adjacent face
-        //CGAL_assertion(it_poly_hedge!=edge_to_hedge.end());
-        if( it_poly_hedge!=edge_to_hedge.end() ){
-          call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
-          output_builder.set_edge_per_polyline(tm,node_id_pair,it_poly_hedge->second);
-        }
-        else{
-          //WARNING: in few case this is needed if the marked edge is on the border
-          //to optimize it might be better to only use sorted pair. TAG_SLXX1
-          Node_id_pair opposite_pair(node_id_pair.second,node_id_pair.first);
-          it_poly_hedge=edge_to_hedge.find(opposite_pair);
-          CGAL_assertion( it_poly_hedge!=edge_to_hedge.end() );
-
-          call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
-          output_builder.set_edge_per_polyline(tm,opposite_pair,it_poly_hedge->second);
-        }
-      }
+      import_face_triangulation(f, node_ids, ft, tm, vpm, nodes, node_id_to_vertex, nb_nodes);
+      // release the triangulation as soon as it has been imported
+      ft = Face_triangulation();
     }
   }
 
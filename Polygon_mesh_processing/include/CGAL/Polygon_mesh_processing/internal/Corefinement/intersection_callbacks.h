@@ -116,9 +116,21 @@ public:
   , visitor(visitor)
   {}
 
-  void operator()( const Box& face_box, const Box& edge_box) const {
+  // What is reported for a pair of boxes, see `classify()`
+  enum Report_flag {
+    NOTHING = 0,
+    EDGE_FACE = 1, // the edge and the face intersect
+    COPLANAR_FACE = 2, // the face of `eh` and the face are coplanar
+    COPLANAR_OPPOSITE_FACE = 4 // the face of `opposite(eh)` and the face are coplanar
+  };
+
+  // Classifies a pair of boxes without modifying the output containers,
+  // `eh` being set to the halfedge of the edge used in the report.
+  // This function can be called concurrently.
+  int classify(const Box& face_box, const Box& edge_box, halfedge_descriptor& eh) const
+  {
     halfedge_descriptor fh = face_box.info();
-    halfedge_descriptor eh = edge_box.info();
+    eh = edge_box.info();
     if(is_border(eh,tm_edges)) eh = opposite(eh, tm_edges);
 
     //check if the segment intersects the plane of the facet or if it is included in the plane
@@ -131,32 +143,46 @@ public:
     const Orientation abcq = orientation(a,b,c, get(vpmap_tme, source(eh, tm_edges)));
     if (abcp==abcq){
       if (abcp!=COPLANAR){
-        return; //no intersection
+        return NOTHING; //no intersection
       }
 
+      int flags = NOTHING;
       if (orientation(a,b,c,get(vpmap_tme, target( next(eh, tm_edges), tm_edges)))==COPLANAR)
-      {
-        coplanar_faces.insert(
-            &tm_edges < &tm_faces // TODO can we avoid by reporting them in only of the two calls to the filter function?
-            ? std::make_pair(face(eh, tm_edges), face(fh, tm_faces))
-            : std::make_pair(face(fh, tm_faces), face(eh, tm_edges))
-          );
-      }
+        flags |= COPLANAR_FACE;
       halfedge_descriptor eh_opp=opposite(eh, tm_edges);
       if (!is_border(eh_opp, tm_edges) &&
           orientation(a,b,c,get(vpmap_tme, target(next(eh_opp, tm_edges),tm_edges)))==COPLANAR)
-      {
-        coplanar_faces.insert(
-            &tm_edges < &tm_faces // TODO can we avoid by reporting them in only of the two calls to the filter function?
-            ? std::make_pair(face(opposite(eh, tm_edges), tm_edges), face(fh, tm_faces))
-            : std::make_pair(face(fh, tm_faces), face(opposite(eh, tm_edges), tm_edges))
-          );
-      }
+        flags |= COPLANAR_OPPOSITE_FACE;
       //in case only the edge is coplanar, the intersection points will be detected using an incident facet
-      return;
+      return flags;
     }
     // non-coplanar case
-    edge_to_faces[edge(eh,tm_edges)].insert(face(fh, tm_faces));
+    return EDGE_FACE;
+  }
+
+  // Fills the output containers with the result of `classify()`
+  void report(halfedge_descriptor fh, halfedge_descriptor eh, int flags) const
+  {
+    if (flags & COPLANAR_FACE)
+      coplanar_faces.insert(
+          &tm_edges < &tm_faces // TODO can we avoid by reporting them in only of the two calls to the filter function?
+          ? std::make_pair(face(eh, tm_edges), face(fh, tm_faces))
+          : std::make_pair(face(fh, tm_faces), face(eh, tm_edges))
+        );
+    if (flags & COPLANAR_OPPOSITE_FACE)
+      coplanar_faces.insert(
+          &tm_edges < &tm_faces // TODO can we avoid by reporting them in only of the two calls to the filter function?
+          ? std::make_pair(face(opposite(eh, tm_edges), tm_edges), face(fh, tm_faces))
+          : std::make_pair(face(fh, tm_faces), face(opposite(eh, tm_edges), tm_edges))
+        );
+    if (flags & EDGE_FACE)
+      edge_to_faces[edge(eh,tm_edges)].insert(face(fh, tm_faces));
+  }
+
+  void operator()( const Box& face_box, const Box& edge_box) const {
+    halfedge_descriptor eh;
+    const int flags = classify(face_box, edge_box, eh);
+    report(face_box.info(), eh, flags);
   }
 
   bool is_face_degenerated(halfedge_descriptor fh) const
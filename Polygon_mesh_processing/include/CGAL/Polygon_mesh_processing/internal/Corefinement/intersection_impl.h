@@ -24,11 +24,19 @@
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/intersection_nodes.h>
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/intersect_triangle_and_segment_3.h>
 #include <CGAL/Polygon_mesh_processing/Non_manifold_feature_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 #include <CGAL/utility.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/functional/hash.hpp>
+#include <boost/range/irange.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/concurrent_vector.h>
+#include <tbb/parallel_sort.h>
+#endif
 
 #include <stdexcept>
 #include <unordered_map>
@@ -193,7 +201,8 @@ struct Node_id_set {
 
 template< class TriangleMesh,
           class VertexPointMap1, class VertexPointMap2,
-          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>
+          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>,
+          class ConcurrencyTag=Sequential_tag
          >
 class Intersection_of_triangle_meshes
 {
@@ -225,6 +234,15 @@ class Intersection_of_triangle_meshes
                              VertexPointMap1, VertexPointMap2,
                              Predicates_on_constructions_needed>    Node_vector;
 
+  // the intersection of an edge with a face, computed before the creation of nodes
+  struct Edge_face_intersection
+  {
+    face_descriptor f;
+    std::tuple<Intersection_type, halfedge_descriptor, bool, bool> type;
+    // set only if the intersection point is not an input point
+    typename Node_vector::Intersection_point point;
+  };
+
 // data members
   Edge_to_faces stm_edge_to_ltm_faces; // map edges from the triangle mesh with the smaller address to faces of the triangle mesh with the larger address
   Edge_to_faces ltm_edge_to_stm_faces; // map edges from the triangle mesh with the larger address to faces of the triangle mesh with the smaller address
@@ -241,6 +259,58 @@ class Intersection_of_triangle_meshes
   CGAL_assertion_code(bool doing_autorefinement;)
 
 // member functions
+#ifndef DO_NOT_HANDLE_COPLANAR_FACES
+  // Reports to `callback` the intersecting pairs of boxes: the candidate pairs
+  // are collected concurrently and sorted so that they are reported in a
+  // deterministic order, their classification being also done concurrently.
+  template <class Callback>
+  void filter_intersections_in_parallel(const std::vector<Box>& face_boxes,
+                                        const std::vector<Box>& edge_boxes,
+                                        std::vector<Box*>& face_boxes_ptr,
+                                        std::vector<Box*>& edge_boxes_ptr,
+                                        const Callback& callback,
+                                        std::ptrdiff_t cutoff)
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    typedef std::pair<std::size_t, std::size_t> Box_pair;
+
+    tbb::concurrent_vector<Box_pair> candidates;
+    CGAL::box_intersection_d<Parallel_tag>(face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                                           edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                                           [&](const Box* fb, const Box* eb)
+                                           {
+                                             candidates.push_back(Box_pair(fb - face_boxes.data(),
+                                                                           eb - edge_boxes.data()));
+                                           },
+                                           cutoff);
+
+    std::vector<Box_pair> box_pairs(candidates.begin(), candidates.end());
+    tbb::parallel_sort(box_pairs.begin(), box_pairs.end());
+
+    std::vector<halfedge_descriptor> edge_halfedges(box_pairs.size());
+    std::vector<int> flags(box_pairs.size());
+    CGAL::for_each<Parallel_tag>(boost::irange<std::size_t>(0, box_pairs.size()),
+                                 [&](std::size_t i) -> bool
+                                 {
+                                   flags[i] = callback.classify(face_boxes[box_pairs[i].first],
+                                                                edge_boxes[box_pairs[i].second],
+                                                                edge_halfedges[i]);
+                                   return true;
+                                 });
+
+    for (std::size_t i=0; i<box_pairs.size(); ++i)
+      if (flags[i] != Callback::NOTHING)
+        callback.report(face_boxes[box_pairs[i].first].info(), edge_halfedges[i], flags[i]);
+#else
+    CGAL_USE(face_boxes);
+    CGAL_USE(edge_boxes);
+    CGAL::box_intersection_d(face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                             edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                             callback, cutoff);
+#endif
+  }
+#endif
+
   template <class VPMF, class VPME>
   void filter_intersections(const TriangleMesh& tm_f,
                             const TriangleMesh& tm_e,
@@ -382,9 +452,18 @@ class Intersection_of_triangle_meshes
                                     filtered_callback, cutoff );
         }
         else
-          CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
-                                    edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
-                                    callback, cutoff );
+        {
+          #ifndef DO_NOT_HANDLE_COPLANAR_FACES
+          if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+            filter_intersections_in_parallel(face_boxes, edge_boxes,
+                                             face_boxes_ptr, edge_boxes_ptr,
+                                             callback, cutoff);
+          else
+          #endif
+            CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                                      edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                                      callback, cutoff );
+        }
       }
     }
   }
@@ -909,7 +988,8 @@ class Intersection_of_triangle_meshes
                     const VPM2& vpm2,
                     std::tuple<Intersection_type,
                                  halfedge_descriptor,
-                                 bool,bool> inter_res)
+                                 bool,bool> inter_res,
+                    const Edge_face_intersection* precomputed)
   {
     if ( std::get<3>(inter_res) ) // is edge target in triangle plane
       nodes.add_new_node(get(vpm1, target(h_1,tm1)));
@@ -917,8 +997,52 @@ class Intersection_of_triangle_meshes
       if (std::get<2>(inter_res)) // is edge source in triangle plane
         nodes.add_new_node(get(vpm1, source(h_1,tm1)));
       else
-        nodes.add_new_node(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        if (precomputed != nullptr)
+          nodes.add_new_node(precomputed->point);
+        else
+          nodes.add_new_node(h_1,f_2,tm1,tm2,vpm1,vpm2);
+    }
+  }
+
+  // Computes concurrently the intersection of all the pairs of
+  // `tm1_edge_to_tm2_faces`, including the intersection points that are not
+  // input points. The intersections of the edge of the `i`-th entry of the map
+  // are in the range [`offsets[i]`, `offsets[i+1]`) of `intersections`.
+  template <typename VPM1, typename VPM2>
+  void precompute_intersections(const Edge_to_faces& tm1_edge_to_tm2_faces,
+                                const TriangleMesh& tm1,
+                                const TriangleMesh& tm2,
+                                const VPM1& vpm1,
+                                const VPM2& vpm2,
+                                std::vector<Edge_face_intersection>& intersections,
+                                std::vector<std::size_t>& offsets)
+  {
+    std::vector<halfedge_descriptor> hedges;
+    offsets.reserve(tm1_edge_to_tm2_faces.size()+1);
+    offsets.push_back(0);
+    for(const typename Edge_to_faces::value_type& e_and_faces : tm1_edge_to_tm2_faces)
+    {
+      halfedge_descriptor h_1=halfedge(e_and_faces.first,tm1);
+      for(face_descriptor f_2 : e_and_faces.second)
+      {
+        hedges.push_back(h_1);
+        intersections.emplace_back();
+        intersections.back().f=f_2;
+      }
+      offsets.push_back(intersections.size());
     }
+
+    CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, intersections.size()),
+                                   [&](std::size_t i) -> bool
+                                   {
+                                     Edge_face_intersection& inter = intersections[i];
+                                     inter.type = intersection_type(hedges[i],inter.f,tm1,tm2,vpm1,vpm2);
+                                     Intersection_type type=std::get<0>(inter.type);
+                                     if ( (type==ON_FACE || type==ON_EDGE) &&
+                                          !std::get<2>(inter.type) && !std::get<3>(inter.type) )
+                                       inter.point = Node_vector::intersection_point(hedges[i],inter.f,tm1,tm2,vpm1,vpm2);
+                                     return true;
+                                   });
   }
 
   template <typename VPM1, typename VPM2>
@@ -935,8 +1059,18 @@ class Intersection_of_triangle_meshes
 
     visitor.start_handling_edge_face_intersections(tm1_edge_to_tm2_faces.size());
 
+    // With `Parallel_tag`, the intersections are computed beforehand. Nodes
+    // are still created sequentially, in the same order.
+    const bool use_precomputed_intersections =
+      std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+    std::vector<Edge_face_intersection> intersections;
+    std::vector<std::size_t> offsets;
+    if (use_precomputed_intersections)
+      precompute_intersections(tm1_edge_to_tm2_faces, tm1, tm2, vpm1, vpm2, intersections, offsets);
+
+    std::size_t entry_index=0;
     for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
-                                         it!=tm1_edge_to_tm2_faces.end();++it)
+                                         it!=tm1_edge_to_tm2_faces.end();++it, ++entry_index)
     {
       visitor.edge_face_intersections_step();
       edge_descriptor e_1=it->first;
@@ -946,7 +1080,21 @@ class Intersection_of_triangle_meshes
       while (!fset.empty()){
         face_descriptor f_2=*fset.begin();
 
-        Inter_type res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        const Edge_face_intersection* precomputed = nullptr;
+        if (use_precomputed_intersections)
+        {
+          precomputed = &*std::find_if(intersections.begin()+offsets[entry_index],
+                                       intersections.begin()+offsets[entry_index+1],
+                                       [f_2](const Edge_face_intersection& inter)
+                                       {
+                                         return inter.f==f_2;
+                                       });
+          CGAL_assertion(precomputed->f==f_2);
+        }
+
+        Inter_type res = precomputed==nullptr
+                       ? intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2)
+                       : precomputed->type;
         Intersection_type type=std::get<0>(res);
 
     //handle degenerate case: one extremity of edge belong to f_2
@@ -1065,7 +1213,7 @@ class Intersection_of_triangle_meshes
             CGAL_assertion(f_2==face(std::get<1>(res),tm2));
 
             Node_id node_id=++current_node;
-            add_new_node(h_1,f_2,tm1,tm2,vpm1,vpm2,res);
+            add_new_node(h_1,f_2,tm1,tm2,vpm1,vpm2,res,precomputed);
             visitor.new_node_added(node_id,ON_FACE,h_1,halfedge(f_2,tm2),tm1,tm2,std::get<3>(res),std::get<2>(res));
             for (;it_edge!=all_edges.end();++it_edge){
               add_intersection_point_to_face_and_all_edge_incident_faces(f_2,*it_edge,tm2,tm1,node_id);
@@ -1087,7 +1235,7 @@ class Intersection_of_triangle_meshes
           case ON_EDGE:
           {
             Node_id node_id=++current_node;
-            add_new_node(h_1,f_2,tm1,tm2,vpm1,vpm2,res);
+            add_new_node(h_1,f_2,tm1,tm2,vpm1,vpm2,res,precomputed);
             halfedge_descriptor h_2=std::get<1>(res);
 
             std::size_t eid2 = nm_features_map_2.non_manifold_edges.empty()
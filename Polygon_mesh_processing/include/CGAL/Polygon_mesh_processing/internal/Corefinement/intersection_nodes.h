@@ -45,6 +45,7 @@ class Intersection_nodes<TriangleMesh, VertexPointMap1, VertexPointMap2, false,
 //typedefs
 public:
   typedef CGAL::Exact_predicates_exact_constructions_kernel        Exact_kernel;
+  typedef typename Exact_kernel::Point_3                     Intersection_point;
 private:
 //typedefs
   typedef typename boost::property_traits<VertexPointMap1>::value_type  Point_3;
@@ -101,6 +102,27 @@ public:
     nodes.push_back(  exact_to_double(p) );
   }
 
+  //the intersection of the triangle with the segment.
+  //this function can be called concurrently
+  template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
+  static Intersection_point
+  intersection_point(halfedge_descriptor h_a,
+                     face_descriptor f_b,
+                     const TriangleMesh& tm_a,
+                     const TriangleMesh& tm_b,
+                     const VPM_A& vpm_a,
+                     const VPM_B& vpm_b)
+  {
+    halfedge_descriptor h_b = halfedge(f_b, tm_b);
+    return
+      typename Exact_kernel::Construct_plane_line_intersection_point_3()(
+        to_exact( get(vpm_b, source(h_b,tm_b)) ),
+        to_exact( get(vpm_b, target(h_b,tm_b)) ),
+        to_exact( get(vpm_b, target(next(h_b,tm_b),tm_b)) ),
+        to_exact( get(vpm_a, source(h_a,tm_a)) ),
+        to_exact( get(vpm_a, target(h_a,tm_a)) ) );
+  }
+
   //add a new node in the final graph.
   //it is the intersection of the triangle with the segment
   template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
@@ -111,14 +133,7 @@ public:
                     const VPM_A& vpm_a,
                     const VPM_B& vpm_b)
   {
-    halfedge_descriptor h_b = halfedge(f_b, tm_b);
-    add_new_node(
-      typename Exact_kernel::Construct_plane_line_intersection_point_3()(
-        to_exact( get(vpm_b, source(h_b,tm_b)) ),
-        to_exact( get(vpm_b, target(h_b,tm_b)) ),
-        to_exact( get(vpm_b, target(next(h_b,tm_b),tm_b)) ),
-        to_exact( get(vpm_a, source(h_a,tm_a)) ),
-        to_exact( get(vpm_a, target(h_a,tm_a)) ) ) );
+    add_new_node(intersection_point(h_a, f_b, tm_a, tm_b, vpm_a, vpm_b));
   }
 
   template <class VPM> // VertexPointMap1 or VertexPointMap2
@@ -147,6 +162,7 @@ class Intersection_nodes<TriangleMesh, VertexPointMap1, VertexPointMap2, true, f
 //typedefs
 public:
   typedef CGAL::Exact_predicates_exact_constructions_kernel        Exact_kernel;
+  typedef Exact_kernel::Point_3                              Intersection_point;
 
 private:
   typedef typename boost::property_traits<VertexPointMap1>::value_type  Point_3;
@@ -210,7 +226,8 @@ public:
 
   size_t size() const {return enodes.size();}
 
-  void add_new_node(const Exact_kernel::Point_3& p)
+  //make sure the approximation of p is precise enough to be converted to double
+  static void make_precise(const Exact_kernel::Point_3& p)
   {
     const Exact_kernel::Approximate_kernel::Point_3& p_approx=p.approx();
     const double precision =
@@ -221,9 +238,37 @@ public:
     {
       p.exact();
     }
+  }
+
+  void add_new_node(const Exact_kernel::Point_3& p)
+  {
+    make_precise(p);
     enodes.push_back(p);
   }
 
+  //the intersection of the triangle with the segment.
+  //this function can be called concurrently
+  template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
+  static Intersection_point
+  intersection_point(halfedge_descriptor h_a,
+                     face_descriptor f_b,
+                     const TriangleMesh& tm_a,
+                     const TriangleMesh& tm_b,
+                     const VPM_A& vpm_a,
+                     const VPM_B& vpm_b)
+  {
+    halfedge_descriptor h_b = halfedge(f_b, tm_b);
+    Intersection_point p =
+      Exact_kernel::Construct_plane_line_intersection_point_3()(
+        to_exact( get(vpm_b, source(h_b,tm_b)) ),
+        to_exact( get(vpm_b, target(h_b,tm_b)) ),
+        to_exact( get(vpm_b, target(next(h_b,tm_b),tm_b)) ),
+        to_exact( get(vpm_a, source(h_a,tm_a)) ),
+        to_exact( get(vpm_a, target(h_a,tm_a)) ) );
+    make_precise(p);
+    return p;
+  }
+
   //add a new node in the final graph.
   //it is the intersection of the triangle with the segment
   template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
@@ -234,14 +279,7 @@ public:
                     const VPM_A vpm_a,
                     const VPM_B vpm_b)
   {
-    halfedge_descriptor h_b = halfedge(f_b, tm_b);
-    add_new_node(
-      Exact_kernel::Construct_plane_line_intersection_point_3()(
-        to_exact( get(vpm_b, source(h_b,tm_b)) ),
-        to_exact( get(vpm_b, target(h_b,tm_b)) ),
-        to_exact( get(vpm_b, target(next(h_b,tm_b),tm_b)) ),
-        to_exact( get(vpm_a, source(h_a,tm_a)) ),
-        to_exact( get(vpm_a, target(h_a,tm_a)) ) ) );
+    enodes.push_back(intersection_point(h_a, f_b, tm_a, tm_b, vpm_a, vpm_b));
   }
 
   // use to resolve intersection of 3 faces in autorefinement only
@@ -343,6 +381,7 @@ class Intersection_nodes<TriangleMesh, VertexPointMap1, VertexPointMap2,
   typename Input_kernel::Intersect_3 intersection;
 public:
   typedef Input_kernel                                             Exact_kernel;
+  typedef Point_3                                            Intersection_point;
 
   const TriangleMesh &tm1, &tm2;
   const VertexPointMap1& vpm1;
@@ -402,16 +441,30 @@ public:
                     const TriangleMesh& tm_b,
                     const VPM_A& vpm_a,
                     const VPM_B& vpm_b)
+  {
+    add_new_node(intersection_point(h_a, f_b, tm_a, tm_b, vpm_a, vpm_b));
+  }
+
+  //the intersection of the triangle with the segment.
+  //this function can be called concurrently
+  template <class VPM_A, class VPM_B> // VertexPointMap1 or VertexPointMap2
+  static Intersection_point
+  intersection_point(halfedge_descriptor h_a,
+                     face_descriptor f_b,
+                     const TriangleMesh& tm_a,
+                     const TriangleMesh& tm_b,
+                     const VPM_A& vpm_a,
+                     const VPM_B& vpm_b)
   {
     halfedge_descriptor h_b=halfedge(f_b,tm_b);
 
-    add_new_node(
+    return
       typename Exact_kernel::Construct_plane_line_intersection_point_3()(
         get(vpm_b, source(h_b,tm_b)),
         get(vpm_b, target(h_b,tm_b)),
         get(vpm_b, target(next(h_b,tm_b),tm_b)),
         get(vpm_a, source(h_a,tm_a)),
-        get(vpm_a, target(h_a,tm_a)) ) );
+        get(vpm_a, target(h_a,tm_a)) );
   }
 
   void add_new_node(const Point_3& p)
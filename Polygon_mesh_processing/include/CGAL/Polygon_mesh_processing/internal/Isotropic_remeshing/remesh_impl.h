@@ -31,6 +31,7 @@
 #include <CGAL/property_map.h>
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/iterator.h>
+#include <CGAL/for_each.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/properties.h>
 #include <boost/graph/graph_traits.hpp>
@@ -41,6 +42,7 @@
 #include <boost/bimap/set_of.hpp>
 #include <boost/range.hpp>
 #include <boost/range/join.hpp>
+#include <boost/range/irange.hpp>
 #include <memory>
 #include <boost/container/flat_set.hpp>
 #include <optional>
@@ -261,6 +263,7 @@ namespace internal {
          , typename VertexIsConstrainedMap
          , typename FacePatchMap
          , typename FaceIndexMap
+         , typename ConcurrencyTag = Sequential_tag
   >
   class Incremental_remesher
   {
@@ -281,6 +284,7 @@ namespace internal {
                                , VertexIsConstrainedMap
                                , FacePatchMap
                                , FaceIndexMap
+                               , ConcurrencyTag
                                > Self;
 
   private:
@@ -493,14 +497,15 @@ namespace internal {
         { return p1.second > p2.second; }
       );
 
-      for(edge_descriptor e : edges(mesh_))
-      {
-        if (!is_split_allowed(e))
-          continue;
-        double sqlen = sqlength(e);
-        if(sqlen > sq_high)
-          long_edges.emplace(halfedge(e, mesh_), sqlen);
-      }
+      for(const H_and_sql& h_and_sql : candidate_edges(
+            [&](const edge_descriptor& e, double& sqlen)
+            {
+              if (!is_split_allowed(e))
+                return false;
+              sqlen = sqlength(e);
+              return sqlen > sq_high;
+            }))
+        long_edges.insert(h_and_sql);
 
       //split long edges
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -641,12 +646,13 @@ namespace internal {
       double sq_high = high*high;
 
       Boost_bimap short_edges;
-      for(edge_descriptor e : edges(mesh_))
-      {
-        double sqlen = sqlength(e);
-        if ((sqlen < sq_low) && is_collapse_allowed(e, collapse_constraints))
-          short_edges.insert(short_edge(halfedge(e, mesh_), sqlen));
-      }
+      for(const std::pair<halfedge_descriptor, double>& h_and_sql : candidate_edges(
+            [&](const edge_descriptor& e, double& sqlen)
+            {
+              sqlen = sqlength(e);
+              return (sqlen < sq_low) && is_collapse_allowed(e, collapse_constraints);
+            }))
+        short_edges.insert(short_edge(h_and_sql.first, h_and_sql.second));
 #ifdef CGAL_PMP_REMESHING_VERBOSE_PROGRESS
       std::cout << "done." << std::endl;
 #endif
@@ -1038,7 +1044,7 @@ namespace internal {
       auto constrained_vertices_pmap
         = boost::make_function_property_map<vertex_descriptor>(vertex_constraint);
 
-      tangential_relaxation(
+      tangential_relaxation<ConcurrencyTag>(
         vertices(mesh_),
         mesh_,
         CGAL::parameters::number_of_iterations(nb_iterations)
@@ -1072,15 +1078,18 @@ namespace internal {
       std::cout.flush();
 #endif
 
-      for(vertex_descriptor v : vertices(mesh_))
+      // the trees are built on the input triangles, so that the vertices
+      // can be projected independently
+      CGAL::for_each<ConcurrencyTag>(vertices(mesh_), [&](vertex_descriptor v) -> bool
       {
         if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
+          return true;
         //note if v is constrained, it has not moved
 
-        Point proj = trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]->closest_point(get(vpmap_, v));
+        Point proj = trees[tree_index(get_patch_id(face(halfedge(v, mesh_), mesh_)))]->closest_point(get(vpmap_, v));
         put(vpmap_, v, proj);
-      }
+        return true;
+      });
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1102,12 +1111,34 @@ namespace internal {
       std::cout << "Project to surface...";
       std::cout.flush();
 #endif
-      for(vertex_descriptor v : vertices(mesh_))
+      if (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
       {
-        if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
-          continue;
-        //note if v is constrained, it has not moved
-        put(vpmap_, v,  proj(v));
+        for(vertex_descriptor v : vertices(mesh_))
+        {
+          if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
+            continue;
+          //note if v is constrained, it has not moved
+          put(vpmap_, v,  proj(v));
+        }
+      }
+      else
+      {
+        // `proj` may look at the mesh: compute all the projections before moving any vertex
+        const std::vector<vertex_descriptor> vs(std::begin(vertices(mesh_)), std::end(vertices(mesh_)));
+        std::vector<Point> projections(vs.size());
+        std::vector<char> is_projected(vs.size(), false);
+        CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, vs.size()), [&](std::size_t i) -> bool
+        {
+          vertex_descriptor v = vs[i];
+          if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
+            return true;
+          projections[i] = proj(v);
+          is_projected[i] = true;
+          return true;
+        });
+        for (std::size_t i = 0; i < vs.size(); ++i)
+          if (is_projected[i])
+            put(vpmap_, vs[i], projections[i]);
       }
       CGAL_assertion(is_valid(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
@@ -1123,6 +1154,37 @@ namespace internal {
     }
 
 private:
+  // index of the AABB tree of the patch `pid`, without inserting
+  // unknown patch ids in the map so that it can be called concurrently
+  std::size_t tree_index(const Patch_id& pid) const
+  {
+    typename Patch_id_to_index_map::const_iterator it = patch_id_to_index_map.find(pid);
+    return (it == patch_id_to_index_map.end()) ? 0 : it->second;
+  }
+
+  // collects the edges `e` of the mesh for which `is_candidate(e, sqlen)` returns `true`,
+  // as pairs of `halfedge(e, mesh_)` and of the squared length `sqlen` set by `is_candidate`,
+  // in the order of `edges(mesh_)`. The edges are tested concurrently with `Parallel_tag`.
+  template <typename IsCandidate>
+  std::vector<std::pair<halfedge_descriptor, double> >
+  candidate_edges(const IsCandidate& is_candidate) const
+  {
+    const std::vector<edge_descriptor> es(std::begin(edges(mesh_)), std::end(edges(mesh_)));
+    std::vector<double> sqlengths(es.size());
+    std::vector<char> is_selected(es.size(), false);
+    CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, es.size()), [&](std::size_t i) -> bool
+    {
+      is_selected[i] = is_candidate(es[i], sqlengths[i]);
+      return true;
+    });
+
+    std::vector<std::pair<halfedge_descriptor, double> > candidates;
+    for (std::size_t i = 0; i < es.size(); ++i)
+      if (is_selected[i])
+        candidates.emplace_back(halfedge(es[i], mesh_), sqlengths[i]);
+    return candidates;
+  }
+
   Patch_id get_patch_id(const face_descriptor& f) const
   {
     if (f == boost::graph_traits<PM>::null_face())
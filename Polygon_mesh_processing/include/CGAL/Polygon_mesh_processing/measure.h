@@ -27,14 +27,20 @@
 #include <CGAL/Polygon_mesh_processing/border.h>
 
 #include <CGAL/Lazy.h> // needed for CGAL::exact(FT)/CGAL::exact(Lazy_exact_nt<T>)
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #include <boost/container/small_vector.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/dynamic_bitset.hpp>
+#include <boost/range/irange.hpp>
 
+#include <array>
+#include <cmath>
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <type_traits>
 #include <unordered_set>
 
 namespace CGAL {
@@ -56,6 +62,89 @@ inline void rearrange_face_ids(boost::container::small_vector<std::size_t, 4>& i
   auto min_elem = std::min_element(ids.begin(), ids.end());
   std::rotate(ids.begin(), min_elem, ids.end());
 }
+
+// Sum of floating-point numbers, with Neumaier's compensation of the rounding errors
+template <typename FT, bool is_floating_point = std::is_floating_point<FT>::value>
+class Compensated_sum
+{
+public:
+  void add(const FT x)
+  {
+    const FT t = m_sum + x;
+    if(std::abs(m_sum) >= std::abs(x))
+      m_compensation += (m_sum - t) + x;
+    else
+      m_compensation += (x - t) + m_sum;
+    m_sum = t;
+  }
+
+  void add(const Compensated_sum& other)
+  {
+    add(other.m_sum);
+    add(other.m_compensation);
+  }
+
+  FT value() const { return m_sum + m_compensation; }
+
+private:
+  FT m_sum = FT(0);
+  FT m_compensation = FT(0);
+};
+
+// Other number types are summed as is
+template <typename FT>
+class Compensated_sum<FT, false>
+{
+public:
+  void add(const FT& x)
+  {
+    m_sum += x;
+    exact(m_sum);
+  }
+
+  void add(const Compensated_sum& other) { add(other.m_sum); }
+
+  FT value() const { return m_sum; }
+
+private:
+  FT m_sum = FT(0);
+};
+
+// Sums the `N` components of `value(i)` for `i` in `[0, n)`. The range is cut into blocks of fixed size
+// which are summed independently (concurrently with `Parallel_tag`) and then combined in order,
+// so that the result does not depend on the number of threads.
+template <typename ConcurrencyTag, typename FT, std::size_t N, typename ValueFunctor>
+std::array<FT, N> deterministic_sum(const std::size_t n, const ValueFunctor& value)
+{
+  const std::size_t block_size = 4096;
+  const std::size_t nb_blocks = (n + block_size - 1) / block_size;
+
+  std::vector<std::array<Compensated_sum<FT>, N> > block_sums(nb_blocks);
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, nb_blocks),
+                                 [&](const std::size_t b) -> bool
+  {
+    const std::size_t end = (std::min)(n, (b + 1) * block_size);
+    for(std::size_t i=b*block_size; i<end; ++i)
+    {
+      const std::array<FT, N> v = value(i);
+      for(std::size_t k=0; k<N; ++k)
+        block_sums[b][k].add(v[k]);
+    }
+    return true;
+  });
+
+  std::array<Compensated_sum<FT>, N> sum;
+  for(const std::array<Compensated_sum<FT>, N>& block_sum : block_sums)
+    for(std::size_t k=0; k<N; ++k)
+      sum[k].add(block_sum[k]);
+
+  std::array<FT, N> result;
+  for(std::size_t k=0; k<N; ++k)
+    result[k] = sum[k].value();
+
+  return result;
+}
+
 }//namespace internal
 
 /**
@@ -506,6 +595,8 @@ squared_face_area(typename boost::graph_traits<TriangleMesh>::face_descriptor f,
   *
   * computes the area of a range of faces of a given triangulated surface mesh.
   *
+  * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
   * @tparam FaceRange range of `boost::graph_traits<PolygonMesh>::%face_descriptor`,
           model of `Range`.
           Its iterator type is `InputIterator`.
@@ -536,6 +627,9 @@ squared_face_area(typename boost::graph_traits<TriangleMesh>::face_descriptor f,
   * The return type `FT` is a number type either deduced from the `geom_traits`
   * \ref bgl_namedparameters "Named Parameters" if provided,
   * or the geometric traits class deduced from the point property map of `tmesh`.
+  * In parallel, the face areas are summed by blocks of fixed size, with a compensated summation
+  * if `FT` is a floating-point type: the result does not depend on the number of threads,
+  * but might differ from the sequential one by rounding errors.
   *
   * \warning This function involves a square root computation.
   * If `Kernel::FT` does not support the `sqrt()` operation, the square root computation
@@ -543,7 +637,8 @@ squared_face_area(typename boost::graph_traits<TriangleMesh>::face_descriptor f,
   *
   * @sa `face_area()`
   */
-template<typename FaceRange,
+template<typename ConcurrencyTag = Sequential_tag,
+         typename FaceRange,
          typename TriangleMesh,
          typename CGAL_NP_TEMPLATE_PARAMETERS>
 #ifdef DOXYGEN_RUNNING
@@ -556,8 +651,22 @@ area(FaceRange face_range,
      const CGAL_NP_CLASS& np = parameters::default_values())
 {
   typedef typename boost::graph_traits<TriangleMesh>::face_descriptor face_descriptor;
+  typedef typename GetGeomTraits<TriangleMesh, CGAL_NP_CLASS>::type::FT FT;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
 
-  typename GetGeomTraits<TriangleMesh, CGAL_NP_CLASS>::type::FT result = 0;
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    const std::vector<face_descriptor> face_vector(std::begin(face_range), std::end(face_range));
+    return internal::deterministic_sum<ConcurrencyTag, FT, 1>(
+             face_vector.size(),
+             [&](const std::size_t i) { return std::array<FT, 1>{{ face_area(face_vector[i], tmesh, np) }}; })[0];
+  }
+
+  FT result = 0;
   for(face_descriptor f : face_range)
   {
     result += face_area(f, tmesh, np);
@@ -571,6 +680,8 @@ area(FaceRange face_range,
   * \ingroup PMP_measure_grp
   * computes the surface area of a triangulated surface mesh.
   *
+  * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
   * @tparam TriangleMesh a model of `FaceGraph`
   * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
   *
@@ -597,6 +708,8 @@ area(FaceRange face_range,
   * The return type `FT` is a number type either deduced from the `geom_traits`
   * \ref bgl_namedparameters "Named Parameters" if provided,
   * or the geometric traits class deduced from the point property map of `tmesh`.
+  * In parallel, the result does not depend on the number of threads, but might differ
+  * from the sequential one by rounding errors.
   *
   * \warning This function involves a square root computation.
   * If `Kernel::FT` does not support the `sqrt()` operation, the square root computation
@@ -604,7 +717,8 @@ area(FaceRange face_range,
   *
   * @sa `face_area()`
   */
-template<typename TriangleMesh,
+template<typename ConcurrencyTag = Sequential_tag,
+         typename TriangleMesh,
          typename CGAL_NP_TEMPLATE_PARAMETERS>
 #ifdef DOXYGEN_RUNNING
 FT
@@ -614,7 +728,7 @@ typename GetGeomTraits<TriangleMesh, CGAL_NP_CLASS>::type::FT
 area(const TriangleMesh& tmesh,
      const CGAL_NP_CLASS& np = parameters::default_values())
 {
-  return area(faces(tmesh), tmesh, np);
+  return area<ConcurrencyTag>(faces(tmesh), tmesh, np);
 }
 
 /**
@@ -622,6 +736,8 @@ area(const TriangleMesh& tmesh,
   *
   * computes the volume of the domain bounded by a closed triangulated surface mesh.
   *
+  * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
   * @tparam TriangleMesh a model of `HalfedgeGraph`
   * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
   *
@@ -650,8 +766,11 @@ area(const TriangleMesh& tmesh,
   * The return type `FT` is a number type either deduced from the `geom_traits`
   * \ref bgl_namedparameters "Named Parameters" if provided,
   * or the geometric traits class deduced from the point property map of `tmesh`.
+  * In parallel, the result does not depend on the number of threads, but might differ
+  * from the sequential one by rounding errors.
   */
-template<typename TriangleMesh,
+template<typename ConcurrencyTag = Sequential_tag,
+         typename TriangleMesh,
          typename CGAL_NP_TEMPLATE_PARAMETERS>
 #ifdef DOXYGEN_RUNNING
 FT
@@ -673,11 +792,32 @@ volume(const TriangleMesh& tmesh,
   typename GetGeomTraits<TriangleMesh, CGAL_NP_CLASS>::type::Point_3 origin(0, 0, 0);
 
   typedef typename boost::graph_traits<TriangleMesh>::face_descriptor face_descriptor;
+  typedef typename GetGeomTraits<TriangleMesh, CGAL_NP_CLASS>::type::FT FT;
 
-  typename GetGeomTraits<TriangleMesh, CGAL_NP_CLASS>::type::FT volume = 0;
   typename CGAL::Kernel_traits<typename property_map_value<TriangleMesh,
       CGAL::vertex_point_t>::type>::Kernel::Compute_volume_3 cv3;
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    const std::vector<face_descriptor> face_vector(std::begin(faces(tmesh)), std::end(faces(tmesh)));
+    return internal::deterministic_sum<ConcurrencyTag, FT, 1>(
+             face_vector.size(),
+             [&](const std::size_t i)
+             {
+               const face_descriptor f = face_vector[i];
+               return std::array<FT, 1>{{ cv3(origin,
+                                              get(vpm, target(halfedge(f, tmesh), tmesh)),
+                                              get(vpm, target(next(halfedge(f, tmesh), tmesh), tmesh)),
+                                              get(vpm, target(prev(halfedge(f, tmesh), tmesh), tmesh))) }};
+             })[0];
+  }
+
+  FT volume = 0;
   for(face_descriptor f : faces(tmesh))
   {
     volume += cv3(origin,
@@ -810,6 +950,8 @@ face_aspect_ratio(typename boost::graph_traits<TriangleMesh>::face_descriptor f,
   *
   * computes the centroid of a volume bounded by a closed triangulated surface mesh.
   *
+  * @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
   * @tparam TriangleMesh a model of `FaceListGraph`
   * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
   *
@@ -835,8 +977,11 @@ face_aspect_ratio(typename boost::graph_traits<TriangleMesh>::face_descriptor f,
   * \cgalNamedParamsEnd
   *
   * @return the centroid of the domain bounded by `tmesh`.
+  * In parallel, the result does not depend on the number of threads, but might differ
+  * from the sequential one by rounding errors.
   */
-template<typename TriangleMesh, typename CGAL_NP_TEMPLATE_PARAMETERS>
+template<typename ConcurrencyTag = Sequential_tag,
+         typename TriangleMesh, typename CGAL_NP_TEMPLATE_PARAMETERS>
 #ifdef DOXYGEN_RUNNING
 Point_3
 #else
@@ -884,7 +1029,8 @@ centroid(const TriangleMesh& tmesh,
   Scale scale = k.construct_scaled_vector_3_object();
   Sum sum = k.construct_sum_of_vectors_3_object();
 
-  for(face_descriptor fd : faces(tmesh))
+  // contributions of a face to the volume and to the centroid
+  auto face_contribution = [&](const face_descriptor fd, FT& face_volume, Vector_3& face_centroid)
   {
     const Point_3_ref p = get(vpm, target(halfedge(fd, tmesh), tmesh));
     const Point_3_ref q = get(vpm, target(next(halfedge(fd, tmesh), tmesh), tmesh));
@@ -893,7 +1039,7 @@ centroid(const TriangleMesh& tmesh,
              vq = vector(ORIGIN, q),
              vr = vector(ORIGIN, r);
     Vector_3 n = normal(p, q, r);
-    volume += (scalar_product(n,vp))/FT(6);
+    face_volume = (scalar_product(n,vp))/FT(6);
     n = scale(n, FT(1)/FT(24));
 
     Vector_3 v2 = sum(vp, vq);
@@ -903,7 +1049,40 @@ centroid(const TriangleMesh& tmesh,
     v2 = sum(vp, vr);
     v3 = sum(v3, Vector_3(square(v2.x()), square(v2.y()), square(v2.z())));
 
-    centroid = sum(centroid, Vector_3(n.x() * v3.x(), n.y() * v3.y(), n.z() * v3.z()));
+    face_centroid = Vector_3(n.x() * v3.x(), n.y() * v3.y(), n.z() * v3.z());
+  };
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    const std::vector<face_descriptor> face_vector(std::begin(faces(tmesh)), std::end(faces(tmesh)));
+    const std::array<FT, 4> sums = internal::deterministic_sum<ConcurrencyTag, FT, 4>(
+                                     face_vector.size(),
+                                     [&](const std::size_t i)
+                                     {
+                                       FT face_volume;
+                                       Vector_3 face_centroid;
+                                       face_contribution(face_vector[i], face_volume, face_centroid);
+                                       return std::array<FT, 4>{{ face_volume, face_centroid.x(),
+                                                                  face_centroid.y(), face_centroid.z() }};
+                                     });
+    volume = sums[0];
+    centroid = Vector_3(sums[1], sums[2], sums[3]);
+  }
+  else
+  {
+    for(face_descriptor fd : faces(tmesh))
+    {
+      FT face_volume;
+      Vector_3 face_centroid;
+      face_contribution(fd, face_volume, face_centroid);
+      volume += face_volume;
+      centroid = sum(centroid, face_centroid);
+    }
   }
 
   centroid = scale(centroid, FT(1)/(FT(2)*volume));
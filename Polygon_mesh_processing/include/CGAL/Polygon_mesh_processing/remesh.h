@@ -38,6 +38,17 @@ namespace Polygon_mesh_processing {
 * edge flips, tangential relaxation and projection to the initial surface
 * to generate a smooth mesh with a prescribed edge length.
 *
+* With `Parallel_tag`, the tangential relaxation and the projection steps process
+* the vertices concurrently, and the lengths and the validity of the candidate edges
+* of the split and collapse steps are evaluated concurrently. Edge flips and the
+* modifications of the connectivity are performed sequentially, so that the output
+* mesh is the same as with `Sequential_tag`, provided that `projection_functor`
+* does not depend on the positions of the other vertices.
+*
+* @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+*                        Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
+*                        With `Parallel_tag`, the vertex point map must support concurrent writes on distinct vertices,
+*                        and the functor passed as `projection_functor` must support concurrent calls.
 * @tparam PolygonMesh model of `MutableFaceGraph`.
 *         The descriptor types `boost::graph_traits<PolygonMesh>::%face_descriptor`
 *         and `boost::graph_traits<PolygonMesh>::%halfedge_descriptor` must be
@@ -191,7 +202,8 @@ namespace Polygon_mesh_processing {
 *      get a point which is exactly on the surface.
 *
 */
-template<typename PolygonMesh
+template<typename ConcurrencyTag = Sequential_tag
+       , typename PolygonMesh
        , typename FaceRange
        , typename NamedParameters = parameters::Default_named_parameters>
 void isotropic_remeshing(const FaceRange& faces
@@ -284,7 +296,7 @@ void isotropic_remeshing(const FaceRange& faces
   t.reset(); t.start();
 #endif
 
-  typename internal::Incremental_remesher<PM, VPMap, GT, ECMap, VCMap, FPMap, FIMap>
+  typename internal::Incremental_remesher<PM, VPMap, GT, ECMap, VCMap, FPMap, FIMap, ConcurrencyTag>
     remesher(pmesh, vpmap, gt, protect, ecmap, vcmap, fpmap, fimap, need_aabb_tree);
   remesher.init_remeshing(faces);
 
@@ -41,12 +41,17 @@
 #ifdef CGAL_PMP_REPAIR_SI_USE_OBB_IN_COMPACTIFICATION
 #include <CGAL/Optimal_bounding_box/oriented_bounding_box.h>
 #endif
+#include <CGAL/for_each.h>
 #include <CGAL/utility.h>
+
+#include <boost/range/irange.hpp>
+
 #include <array>
 #include <fstream>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <set>
 #include <tuple>
 #include <type_traits>
@@ -1930,23 +1935,18 @@ bool handle_CC_with_complex_topology(std::vector<typename boost::graph_traits<Tr
   return true;
 }
 
-// the parameter `step` controls how many extra layers of faces we take around the range `faces_to_treat`
-template <typename Projector, typename TriangleMesh, typename VertexPointMap, typename GeomTraits, typename Visitor>
-std::pair<bool, bool>
-remove_self_intersections_one_step(std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& faces_to_treat,
-                                   std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& working_face_range,
-                                   TriangleMesh& tmesh,
-                                   const int step,
-                                   const bool preserve_genus,
-                                   const bool treat_all_CCs,
-                                   const double strong_dihedral_angle,
-                                   const double weak_dihedral_angle,
-                                   const bool use_smoothing,
-                                   const double containment_epsilon,
-                                   const Projector& projector,
-                                   VertexPointMap vpm,
-                                   const GeomTraits& gt,
-                                   Visitor& visitor)
+// Collects in `cc_faces` the connected component of `faces_to_treat` that contains `seed`,
+// and grows it into the region that is going to be remeshed:
+// the parameter `step` controls how many extra layers of faces we take around the component
+template <typename TriangleMesh, typename VertexPointMap, typename GeomTraits>
+void collect_self_intersecting_cc(const typename boost::graph_traits<TriangleMesh>::face_descriptor seed,
+                                  const std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& faces_to_treat,
+                                  std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& cc_faces,
+                                  const TriangleMesh& tmesh,
+                                  const int step,
+                                  const int cc_id,
+                                  VertexPointMap vpm,
+                                  const GeomTraits& gt)
 {
   typedef boost::graph_traits<TriangleMesh>                                    graph_traits;
   typedef typename graph_traits::halfedge_descriptor                           halfedge_descriptor;
@@ -1957,353 +1957,593 @@ remove_self_intersections_one_step(std::set<typename boost::graph_traits<Triangl
   typedef typename boost::property_traits<VertexPointMap>::value_type          Point;
 #endif
 
-  std::set<face_descriptor> faces_to_treat_copy = faces_to_treat;
-
-  bool something_was_done = false; // indicates if a region was successfully remeshed
-  bool all_fixed = true; // indicates if all removal went well
-  // indicates if a removal was not possible because the region handle has
-  // some boundary cycle of halfedges
-  bool topology_issue = false;
-
-#ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-  std::cout << "  DEBUG: is_valid in one_step(tmesh)? " << is_valid_polygon_mesh(tmesh) << std::endl;
+  CGAL_USE(cc_id);
+  CGAL_USE(gt);
 
-  unsolved_self_intersections = 0;
-#endif
-
-  CGAL_precondition(is_valid_polygon_mesh(tmesh));
-
-#if defined(CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG) || defined(CGAL_PMP_REMOVE_SELF_INTERSECTION_OUTPUT)
-  int cc_id = -1;
-#endif
-
-  while(!faces_to_treat.empty())
+  // Collect all the faces from the connected component
+  std::vector<face_descriptor> queue(1, seed); // temporary queue
+  cc_faces.insert(queue.back());
+  while(!queue.empty())
   {
-    if(visitor.stop())
-      return std::make_pair(false, false);
-
-    visitor.start_component_handling();
-    visitor.status_update(faces_to_treat);
-
-#if defined(CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG) || defined(CGAL_PMP_REMOVE_SELF_INTERSECTION_OUTPUT)
-    ++cc_id;
-#endif
-
-#ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-    std::cout << "  DEBUG: Remaining faces to remove: " << faces_to_treat.size() << "\n";
-    std::cout << "  DEBUG: --------------- Considering CC #" << cc_id << " ---------------\n";
-    std::cout << "  DEBUG: Initial face " << *faces_to_treat.begin() << "\n";
-    std::cout << "  DEBUG: first face: " << get(vpm, target(halfedge(*(faces_to_treat.begin()), tmesh), tmesh)) << " "
-                                         << get(vpm, target(next(halfedge(*(faces_to_treat.begin()), tmesh), tmesh), tmesh)) << " "
-                                         << get(vpm, source(halfedge(*(faces_to_treat.begin()), tmesh), tmesh)) << "\n";
-#endif
-
-    // Collect all the faces from the connected component
-    std::set<face_descriptor> cc_faces;
-    std::vector<face_descriptor> queue(1, *faces_to_treat.begin()); // temporary queue
-    cc_faces.insert(queue.back());
-    while(!queue.empty())
+    face_descriptor top = queue.back();
+    queue.pop_back();
+    halfedge_descriptor h = halfedge(top, tmesh);
+    for(int i=0; i<3; ++i)
     {
-      face_descriptor top = queue.back();
-      queue.pop_back();
-      halfedge_descriptor h = halfedge(top, tmesh);
-      for(int i=0; i<3; ++i)
+      face_descriptor adjacent_face = face(opposite(h, tmesh), tmesh);
+      if(adjacent_face != boost::graph_traits<TriangleMesh>::null_face())
       {
-        face_descriptor adjacent_face = face(opposite(h, tmesh), tmesh);
-        if(adjacent_face != boost::graph_traits<TriangleMesh>::null_face())
-        {
-          if(faces_to_treat.count(adjacent_face) != 0 && cc_faces.insert(adjacent_face).second)
-            queue.push_back(adjacent_face);
-        }
-
-        h = next(h, tmesh);
+        if(faces_to_treat.count(adjacent_face) != 0 && cc_faces.insert(adjacent_face).second)
+          queue.push_back(adjacent_face);
       }
+
+      h = next(h, tmesh);
     }
+  }
 
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-    std::cout << "  DEBUG: " << cc_faces.size() << " faces in base CC\n";
+  std::cout << "  DEBUG: " << cc_faces.size() << " faces in base CC\n";
 #endif
 
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_OUTPUT
-    std::string fname = "results/initial_step_"+std::to_string(step)+"_CC_" + std::to_string(cc_id)+".off";
-    dump_cc(fname, cc_faces, tmesh, vpm);
+  std::string fname = "results/initial_step_"+std::to_string(step)+"_CC_" + std::to_string(cc_id)+".off";
+  dump_cc(fname, cc_faces, tmesh, vpm);
 #endif
 
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_OUTPUT_INTERMEDIATE_FULL_MESH
-    fname = "results/mesh_at_step_"+std::to_string(step)+"_CC_"+std::to_string(cc_id)+".off";
-    CGAL::IO::write_polygon_mesh(fname, tmesh, CGAL::parameters::stream_precision);
+  fname = "results/mesh_at_step_"+std::to_string(step)+"_CC_"+std::to_string(cc_id)+".off";
+  CGAL::IO::write_polygon_mesh(fname, tmesh, CGAL::parameters::stream_precision);
 #endif
 
-    // expand the region to be filled
-    if(step > 0)
-    {
-      expand_face_selection(cc_faces, tmesh, step,
-                            make_boolean_property_map(cc_faces),
-                            Emptyset_iterator());
-    }
+  // expand the region to be filled
+  if(step > 0)
+  {
+    expand_face_selection(cc_faces, tmesh, step,
+                          make_boolean_property_map(cc_faces),
+                          Emptyset_iterator());
+  }
 
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_OUTPUT
-    std::cout << "  DEBUG: " << cc_faces.size() << " faces in expanded CC\n";
+  std::cout << "  DEBUG: " << cc_faces.size() << " faces in expanded CC\n";
 
-    fname = "results/expanded_step_"+std::to_string(step)+"_CC_"+std::to_string(cc_id)+".off";
-    dump_cc(fname, cc_faces, tmesh, vpm);
+  fname = "results/expanded_step_"+std::to_string(step)+"_CC_"+std::to_string(cc_id)+".off";
+  dump_cc(fname, cc_faces, tmesh, vpm);
 #endif
 
-    // @todo keep this?
-    // try to compactify the selection region by also selecting all the faces included
-    // in the bounding box of the initial selection
-    std::vector<halfedge_descriptor> stack_for_expension;
+  // @todo keep this?
+  // try to compactify the selection region by also selecting all the faces included
+  // in the bounding box of the initial selection
+  std::vector<halfedge_descriptor> stack_for_expension;
 
 #ifdef CGAL_PMP_REPAIR_SI_USE_OBB_IN_COMPACTIFICATION
-    std::set<Point> cc_points;
-    for(face_descriptor f : cc_faces)
-      for(vertex_descriptor v : vertices_around_face(halfedge(f, tmesh), tmesh))
-          cc_points.insert(get(vpm, v));
+  std::set<Point> cc_points;
+  for(face_descriptor f : cc_faces)
+    for(vertex_descriptor v : vertices_around_face(halfedge(f, tmesh), tmesh))
+        cc_points.insert(get(vpm, v));
 
-    typedef typename GeomTraits::Aff_transformation_3 Aff_transformation;
-    Aff_transformation tr{CGAL::Identity_transformation()};
+  typedef typename GeomTraits::Aff_transformation_3 Aff_transformation;
+  Aff_transformation tr{CGAL::Identity_transformation()};
 
-    if(cc_points.size() > 3)
-      CGAL::oriented_bounding_box(cc_points, tr, CGAL::parameters::random_seed(0));
+  if(cc_points.size() > 3)
+    CGAL::oriented_bounding_box(cc_points, tr, CGAL::parameters::random_seed(0));
 
-    // Construct the rotated OBB
-    Bbox_3 bb;
-    for(const Point& p : cc_points)
-      bb += (tr.transform(p)).bbox();
+  // Construct the rotated OBB
+  Bbox_3 bb;
+  for(const Point& p : cc_points)
+    bb += (tr.transform(p)).bbox();
 
 #else
-    Bbox_3 bb;
+  Bbox_3 bb;
 #endif
 
-    for(face_descriptor fd : cc_faces)
+  for(face_descriptor fd : cc_faces)
+  {
+    for(halfedge_descriptor h : halfedges_around_face(halfedge(fd, tmesh), tmesh))
     {
-      for(halfedge_descriptor h : halfedges_around_face(halfedge(fd, tmesh), tmesh))
-      {
 #ifndef CGAL_PMP_REPAIR_SI_USE_OBB_IN_COMPACTIFICATION
-        bb += get(vpm, target(h, tmesh)).bbox();
+      bb += get(vpm, target(h, tmesh)).bbox();
 #endif
-        face_descriptor nf = face(opposite(h, tmesh), tmesh);
-        if(nf != boost::graph_traits<TriangleMesh>::null_face() && cc_faces.count(nf) == 0)
-          stack_for_expension.push_back(opposite(h, tmesh));
-      }
+      face_descriptor nf = face(opposite(h, tmesh), tmesh);
+      if(nf != boost::graph_traits<TriangleMesh>::null_face() && cc_faces.count(nf) == 0)
+        stack_for_expension.push_back(opposite(h, tmesh));
     }
+  }
 
-    while(!stack_for_expension.empty())
-    {
-      halfedge_descriptor h = stack_for_expension.back();
-      stack_for_expension.pop_back();
-      if(cc_faces.count(face(h, tmesh)) == 1)
-        continue;
+  while(!stack_for_expension.empty())
+  {
+    halfedge_descriptor h = stack_for_expension.back();
+    stack_for_expension.pop_back();
+    if(cc_faces.count(face(h, tmesh)) == 1)
+      continue;
 
 #ifdef CGAL_PMP_REPAIR_SI_USE_OBB_IN_COMPACTIFICATION
-      if(do_overlap(bb, tr.transform(get(vpm, target(next(h, tmesh), tmesh))).bbox()))
+    if(do_overlap(bb, tr.transform(get(vpm, target(next(h, tmesh), tmesh))).bbox()))
 #else
-      if(do_overlap(bb, get(vpm, target(next(h, tmesh), tmesh)).bbox()))
+    if(do_overlap(bb, get(vpm, target(next(h, tmesh), tmesh)).bbox()))
 #endif
-      {
-        cc_faces.insert(face(h, tmesh));
-        halfedge_descriptor candidate = opposite(next(h, tmesh), tmesh);
-        if(face(candidate, tmesh) != boost::graph_traits<TriangleMesh>::null_face())
-          stack_for_expension.push_back(candidate);
-
-        candidate = opposite(prev(h, tmesh), tmesh);
-        if(face(candidate, tmesh) != boost::graph_traits<TriangleMesh>::null_face())
-          stack_for_expension.push_back(candidate);
-      }
+    {
+      cc_faces.insert(face(h, tmesh));
+      halfedge_descriptor candidate = opposite(next(h, tmesh), tmesh);
+      if(face(candidate, tmesh) != boost::graph_traits<TriangleMesh>::null_face())
+        stack_for_expension.push_back(candidate);
+
+      candidate = opposite(prev(h, tmesh), tmesh);
+      if(face(candidate, tmesh) != boost::graph_traits<TriangleMesh>::null_face())
+        stack_for_expension.push_back(candidate);
     }
+  }
 
-    Boolean_property_map<std::set<face_descriptor> > is_selected(cc_faces);
-    expand_face_selection_for_removal(cc_faces, tmesh, is_selected);
+  Boolean_property_map<std::set<face_descriptor> > is_selected(cc_faces);
+  expand_face_selection_for_removal(cc_faces, tmesh, is_selected);
 
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-    std::cout << "  DEBUG: " << cc_faces.size() << " faces in expanded and compactified CC\n";
+  std::cout << "  DEBUG: " << cc_faces.size() << " faces in expanded and compactified CC\n";
 #endif
 
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_OUTPUT
-    fname = "results/expanded_compactified_step_"+std::to_string(step)+"_CC_"+std::to_string(cc_id)+".off";
-    dump_cc(fname, cc_faces, tmesh, vpm);
+  fname = "results/expanded_compactified_step_"+std::to_string(step)+"_CC_"+std::to_string(cc_id)+".off";
+  dump_cc(fname, cc_faces, tmesh, vpm);
 #endif
+}
 
-    // Now, we have a proper selection to work on.
+// outcome of the treatment of a connected component of self-intersecting faces
+enum CC_repair_status
+{
+  CC_SKIPPED = 0, // nothing was attempted
+  CC_FIXED, // the region was remeshed
+  CC_NOT_FIXED,
+  CC_TOPOLOGY_ISSUE // the region could not be remeshed because of its boundary cycles
+};
 
-    for(const face_descriptor f : cc_faces)
-      faces_to_treat.erase(f);
+// tries to remesh the region `cc_faces`, obtained with `collect_self_intersecting_cc()`
+template <typename Projector, typename TriangleMesh, typename VertexPointMap, typename GeomTraits>
+CC_repair_status
+remove_self_intersections_in_cc(std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& cc_faces,
+                                std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& working_face_range,
+                                TriangleMesh& tmesh,
+                                const bool preserve_genus,
+                                const bool treat_all_CCs,
+                                const double strong_dihedral_angle,
+                                const double weak_dihedral_angle,
+                                const bool use_smoothing,
+                                const double containment_epsilon,
+                                const Projector& projector,
+                                VertexPointMap vpm,
+                                const GeomTraits& gt)
+{
+  typedef boost::graph_traits<TriangleMesh>                                    graph_traits;
+  typedef typename graph_traits::halfedge_descriptor                           halfedge_descriptor;
+  typedef typename graph_traits::face_descriptor                               face_descriptor;
 
-    if(cc_faces.size() == 1)
-    {
+  if(cc_faces.size() == 1)
+  {
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-      std::cout << "  DEBUG: Compactified CC of size 1, moving on\n";
+    std::cout << "  DEBUG: Compactified CC of size 1, moving on\n";
 #endif
-      visitor.end_component_handling();
-      continue;
-    }
+    return CC_SKIPPED;
+  }
 
-    bool self_intersects = does_self_intersect(cc_faces, tmesh, parameters::vertex_point_map(vpm).geom_traits(gt));
+  bool self_intersects = does_self_intersect(cc_faces, tmesh, parameters::vertex_point_map(vpm).geom_traits(gt));
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-    if(!self_intersects)
-      std::cout << "  DEBUG: No self-intersection within the CC\n";
+  if(!self_intersects)
+    std::cout << "  DEBUG: No self-intersection within the CC\n";
 #endif
 
-    if(!treat_all_CCs && !self_intersects)
-    {
+  if(!treat_all_CCs && !self_intersects)
+  {
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-      ++unsolved_self_intersections;
+    ++unsolved_self_intersections;
 #endif
 
-      all_fixed = false;
-      visitor.end_component_handling();
-      continue;
-    }
+    return CC_NOT_FIXED;
+  }
 
 #ifndef CGAL_PMP_REMOVE_SELF_INTERSECTION_NO_POLYHEDRAL_ENVELOPE_CHECK
-    Polyhedral_envelope<GeomTraits> cc_envelope;
-    if(containment_epsilon != 0)
-      cc_envelope = Polyhedral_envelope<GeomTraits>(cc_faces, tmesh, containment_epsilon);
+  Polyhedral_envelope<GeomTraits> cc_envelope;
+  if(containment_epsilon != 0)
+    cc_envelope = Polyhedral_envelope<GeomTraits>(cc_faces, tmesh, containment_epsilon);
 #else
-    struct Return_true
-    {
-      constexpr bool is_empty() const { return true; }
-      bool operator()(const std::vector<std::vector<typename GeomTraits::Point_3> >&) const { return true; }
-      bool operator()(const TriangleMesh&) const { return true; }
-    };
+  struct Return_true
+  {
+    constexpr bool is_empty() const { return true; }
+    bool operator()(const std::vector<std::vector<typename GeomTraits::Point_3> >&) const { return true; }
+    bool operator()(const TriangleMesh&) const { return true; }
+  };
 
-    Return_true cc_envelope;
-    CGAL_USE(containment_epsilon);
+  Return_true cc_envelope;
+  CGAL_USE(containment_epsilon);
 #endif
 
 #ifndef CGAL_PMP_REMOVE_SELF_INTERSECTIONS_NO_SMOOTHING
-    // First, try to smooth if we only care about local self-intersections
-    // Two different approaches:
-    // - First, try to constrain edges that are in the zone to smooth and whose dihedral angle is large,
-    //   but not too large (we don't want to constrain edges that are foldings);
-    // - If that fails, try to smooth without any constraints, but make sure that the deviation from
-    //   the first zone is small.
-    //
-    // If smoothing fails, the face patch is restored to its pre-smoothing state.
-    //
-    // There is no need to update the working range because smoothing doesn`t change
-    // the number of faces (and old faces are re-used).
-    //
-    // Do not smooth if there are no self-intersections within the patch: this means the intersection
-    // is with another CC and smoothing is unlikely to move the surface sufficiently
-    if(use_smoothing && self_intersects)
+  // First, try to smooth if we only care about local self-intersections
+  // Two different approaches:
+  // - First, try to constrain edges that are in the zone to smooth and whose dihedral angle is large,
+  //   but not too large (we don't want to constrain edges that are foldings);
+  // - If that fails, try to smooth without any constraints, but make sure that the deviation from
+  //   the first zone is small.
+  //
+  // If smoothing fails, the face patch is restored to its pre-smoothing state.
+  //
+  // There is no need to update the working range because smoothing doesn`t change
+  // the number of faces (and old faces are re-used).
+  //
+  // Do not smooth if there are no self-intersections within the patch: this means the intersection
+  // is with another CC and smoothing is unlikely to move the surface sufficiently
+  if(use_smoothing && self_intersects)
+  {
+    bool fixed_by_smoothing = false;
+
+    fixed_by_smoothing = remove_self_intersections_with_smoothing(cc_faces, tmesh, true /*constrain_sharp_edges*/,
+                                                                  strong_dihedral_angle, weak_dihedral_angle,
+                                                                  cc_envelope, vpm, gt);
+
+    if(!fixed_by_smoothing)
     {
-      bool fixed_by_smoothing = false;
-
-      fixed_by_smoothing = remove_self_intersections_with_smoothing(cc_faces, tmesh, true /*constrain_sharp_edges*/,
-                                                                    strong_dihedral_angle, weak_dihedral_angle,
-                                                                    cc_envelope, vpm, gt);
-
-      if(!fixed_by_smoothing)
-      {
  #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-        std::cout << "  DEBUG: Could not be solved via smoothing with constraints\n";
+      std::cout << "  DEBUG: Could not be solved via smoothing with constraints\n";
  #endif
 
-        // try again, but without constraining sharp edges
-        fixed_by_smoothing = remove_self_intersections_with_smoothing(cc_faces, tmesh, false /*constrain_sharp_edges*/,
-                                                                      strong_dihedral_angle, weak_dihedral_angle,
-                                                                      cc_envelope, vpm, gt);
-      }
+      // try again, but without constraining sharp edges
+      fixed_by_smoothing = remove_self_intersections_with_smoothing(cc_faces, tmesh, false /*constrain_sharp_edges*/,
+                                                                    strong_dihedral_angle, weak_dihedral_angle,
+                                                                    cc_envelope, vpm, gt);
+    }
 
-      if(fixed_by_smoothing)
-      {
+    if(fixed_by_smoothing)
+    {
  #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-        std::cout << "  DEBUG: Solved with smoothing!\n";
+      std::cout << "  DEBUG: Solved with smoothing!\n";
  #endif
 
-        something_was_done = true;
-        visitor.end_component_handling();
-        continue;
-      }
+      return CC_FIXED;
+    }
  #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-      else
-      {
-        std::cout << "  DEBUG: Could not be solved via smoothing\n";
-      }
- #endif
+    else
+    {
+      std::cout << "  DEBUG: Could not be solved via smoothing\n";
     }
+ #endif
+  }
 
 #endif // ndef CGAL_PMP_REMOVE_SELF_INTERSECTIONS_NO_SMOOTHING
 
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-    std::cout << "  DEBUG: Trying hole-filling based approach...\n";
+  std::cout << "  DEBUG: Trying hole-filling based approach...\n";
 #endif
 
-    // Collect halfedges on the boundary of the region to be selected
-    // (incident to faces that are part of the CC)
-    std::vector<halfedge_descriptor> cc_border_hedges;
-    for(face_descriptor fd : cc_faces)
+  // Collect halfedges on the boundary of the region to be selected
+  // (incident to faces that are part of the CC)
+  std::vector<halfedge_descriptor> cc_border_hedges;
+  for(face_descriptor fd : cc_faces)
+  {
+    for(halfedge_descriptor h : halfedges_around_face(halfedge(fd, tmesh), tmesh))
     {
-      for(halfedge_descriptor h : halfedges_around_face(halfedge(fd, tmesh), tmesh))
-      {
-        if(is_border(opposite(h, tmesh), tmesh) || cc_faces.count(face(opposite(h, tmesh), tmesh)) == 0)
-          cc_border_hedges.push_back(h);
-      }
+      if(is_border(opposite(h, tmesh), tmesh) || cc_faces.count(face(opposite(h, tmesh), tmesh)) == 0)
+        cc_border_hedges.push_back(h);
     }
+  }
+
+  // Whichever step we are at, no border means no expansion will change this selection
+  // This CC was not fixed by smoothing, and there is nothing hole filling can do
+  // @todo just remove the CC?
+  if(cc_border_hedges.empty())
+  {
+#ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
+    std::cout << "  DEBUG: CC is closed!\n"; // @todo wrap?
+    ++unsolved_self_intersections;
+#endif
+
+    return CC_NOT_FIXED;
+  }
 
-    // Whichever step we are at, no border means no expansion will change this selection
-    // This CC was not fixed by smoothing, and there is nothing hole filling can do
-    // @todo just remove the CC?
-    if(cc_border_hedges.empty())
+  int selection_chi = euler_characteristic_of_selection(cc_faces, tmesh);
+  if(selection_chi != 1) // not a topological disk
+  {
+    if(!handle_CC_with_complex_topology(cc_border_hedges, cc_faces, working_face_range,
+                                        tmesh, strong_dihedral_angle, weak_dihedral_angle,
+                                        preserve_genus, cc_envelope, projector, vpm, gt))
     {
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-      std::cout << "  DEBUG: CC is closed!\n"; // @todo wrap?
+      std::cout << "  DEBUG: Failed to handle complex CC\n";
       ++unsolved_self_intersections;
 #endif
-
-      all_fixed = false;
-      visitor.end_component_handling();
-      continue;
+      return CC_TOPOLOGY_ISSUE;
     }
 
-    int selection_chi = euler_characteristic_of_selection(cc_faces, tmesh);
-    if(selection_chi != 1) // not a topological disk
-    {
-      if(!handle_CC_with_complex_topology(cc_border_hedges, cc_faces, working_face_range,
-                                          tmesh, strong_dihedral_angle, weak_dihedral_angle,
-                                          preserve_genus, cc_envelope, projector, vpm, gt))
-      {
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-        std::cout << "  DEBUG: Failed to handle complex CC\n";
-        ++unsolved_self_intersections;
+    ++self_intersections_solved_by_unconstrained_hole_filling;
 #endif
-        topology_issue = true;
-        all_fixed = false;
-      }
-      else
-      {
+
+    return CC_FIXED;
+  }
+
+  // From here on, the CC is a topological disk
+
+  if(!remove_self_intersections_with_hole_filling(cc_border_hedges, cc_faces, working_face_range,
+                                                  tmesh, strong_dihedral_angle, weak_dihedral_angle,
+                                                  cc_envelope, projector, vpm, gt))
+  {
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-        ++self_intersections_solved_by_unconstrained_hole_filling;
+    std::cout << "  DEBUG: Failed to fill hole\n";
+    ++unsolved_self_intersections;
 #endif
 
-        something_was_done = true;
+    return CC_NOT_FIXED;
+  }
+
+  return CC_FIXED;
+}
+
+inline void update_repair_status(const CC_repair_status status,
+                                 bool& something_was_done,
+                                 bool& all_fixed,
+                                 bool& topology_issue)
+{
+  if(status == CC_FIXED)
+  {
+    something_was_done = true;
+  }
+  else if(status == CC_NOT_FIXED)
+  {
+    all_fixed = false;
+  }
+  else if(status == CC_TOPOLOGY_ISSUE)
+  {
+    topology_issue = true;
+    all_fixed = false;
+  }
+}
+
+#ifdef CGAL_LINKED_WITH_TBB
+// Remeshes concurrently the connected components of `faces_to_treat` whose regions are far enough
+// apart not to interact: the faces incident to the vertices of one region must not share a vertex
+// with the faces incident to the vertices of another region. Each region is remeshed in a local
+// copy of its neighborhood, and the results are then plugged in `tmesh` sequentially.
+// The faces of the other components are left in `faces_to_treat`.
+template <typename Projector, typename TriangleMesh, typename VertexPointMap, typename GeomTraits, typename Visitor>
+void remove_self_intersections_in_independent_ccs(std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& faces_to_treat,
+                                                  std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& working_face_range,
+                                                  TriangleMesh& tmesh,
+                                                  const int step,
+                                                  const bool preserve_genus,
+                                                  const bool treat_all_CCs,
+                                                  const double strong_dihedral_angle,
+                                                  const double weak_dihedral_angle,
+                                                  const bool use_smoothing,
+                                                  const double containment_epsilon,
+                                                  const Projector& projector,
+                                                  VertexPointMap vpm,
+                                                  const GeomTraits& gt,
+                                                  Visitor& visitor,
+                                                  bool& something_was_done,
+                                                  bool& all_fixed,
+                                                  bool& topology_issue)
+{
+  typedef boost::graph_traits<TriangleMesh>                                    graph_traits;
+  typedef typename graph_traits::vertex_descriptor                             vertex_descriptor;
+  typedef typename graph_traits::halfedge_descriptor                           halfedge_descriptor;
+  typedef typename graph_traits::face_descriptor                               face_descriptor;
+
+  typedef typename boost::property_traits<VertexPointMap>::value_type          Point;
+  typedef typename boost::property_map<TriangleMesh, vertex_point_t>::type     Local_vertex_point_map;
+
+  struct Local_cc
+  {
+    std::set<face_descriptor> cc_faces; // faces of `tmesh`
+    TriangleMesh mesh; // copy of the faces incident to the vertices of `cc_faces`
+    std::set<face_descriptor> local_cc_faces; // faces of `mesh` that are copies of `cc_faces`
+    std::set<face_descriptor> context_faces; // faces of `mesh` that are not copies of `cc_faces`
+    CC_repair_status status = CC_SKIPPED;
+  };
+
+  std::vector<std::unique_ptr<Local_cc> > local_ccs;
+
+  // Select the independent connected components, and copy their neighborhoods
+  std::set<face_descriptor> remaining_faces = faces_to_treat;
+  std::set<vertex_descriptor> used_vertices;
+  int cc_id = -1;
+  while(!remaining_faces.empty())
+  {
+    std::unique_ptr<Local_cc> lcc = std::make_unique<Local_cc>();
+    collect_self_intersecting_cc(*remaining_faces.begin(), remaining_faces, lcc->cc_faces, tmesh, step, ++cc_id, vpm, gt);
+    for(const face_descriptor f : lcc->cc_faces)
+      remaining_faces.erase(f);
+
+    std::set<vertex_descriptor> cc_vertices;
+    for(const face_descriptor f : lcc->cc_faces)
+      for(const vertex_descriptor v : vertices_around_face(halfedge(f, tmesh), tmesh))
+        cc_vertices.insert(v);
+
+    std::set<face_descriptor> neighborhood = lcc->cc_faces;
+    for(const vertex_descriptor v : cc_vertices)
+      for(const face_descriptor f : faces_around_target(halfedge(v, tmesh), tmesh))
+        if(f != graph_traits::null_face())
+          neighborhood.insert(f);
+
+    std::set<vertex_descriptor> neighborhood_vertices;
+    bool is_independent = true;
+    for(const face_descriptor f : neighborhood)
+    {
+      for(const vertex_descriptor v : vertices_around_face(halfedge(f, tmesh), tmesh))
+      {
+        if(used_vertices.count(v) != 0)
+          is_independent = false;
+        neighborhood_vertices.insert(v);
       }
+    }
 
-      visitor.end_component_handling();
+    if(!is_independent)
       continue;
-    }
 
-    // From here on, the CC is a topological disk
+    const CGAL::Face_filtered_graph<TriangleMesh> ffg(tmesh, neighborhood);
+    if(!ffg.is_selection_valid())
+      continue;
 
-    if(!remove_self_intersections_with_hole_filling(cc_border_hedges, cc_faces, working_face_range,
-                                                    tmesh, strong_dihedral_angle, weak_dihedral_angle,
-                                                    cc_envelope, projector, vpm, gt))
+    used_vertices.insert(neighborhood_vertices.begin(), neighborhood_vertices.end());
+
+    std::map<face_descriptor, face_descriptor> f2f;
+    CGAL::copy_face_graph(ffg, lcc->mesh, parameters::vertex_point_map(vpm)
+                                                     .face_to_face_map(boost::make_assoc_property_map(f2f)));
+    for(const face_descriptor f : neighborhood)
     {
+      if(lcc->cc_faces.count(f) != 0)
+        lcc->local_cc_faces.insert(f2f[f]);
+      else
+        lcc->context_faces.insert(f2f[f]);
+    }
+
+    for(const face_descriptor f : lcc->cc_faces)
+      faces_to_treat.erase(f);
+
+    local_ccs.push_back(std::move(lcc));
+  }
+
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
-      std::cout << "  DEBUG: Failed to fill hole\n";
-      ++unsolved_self_intersections;
+  std::cout << "  DEBUG: " << local_ccs.size() << " independent CCs are treated in parallel" << std::endl;
 #endif
 
-      all_fixed = false;
-    }
-    else
+  // The local meshes are independent, and the projector is only queried
+  CGAL::for_each<Parallel_tag>(boost::irange<std::size_t>(0, local_ccs.size()), [&](const std::size_t i) -> bool
+  {
+    Local_cc& lcc = *(local_ccs[i]);
+    std::set<face_descriptor> local_working_face_range(faces(lcc.mesh).begin(), faces(lcc.mesh).end());
+    lcc.status = remove_self_intersections_in_cc(lcc.local_cc_faces, local_working_face_range, lcc.mesh,
+                                                 preserve_genus, treat_all_CCs,
+                                                 strong_dihedral_angle, weak_dihedral_angle,
+                                                 use_smoothing, containment_epsilon, projector,
+                                                 get_property_map(vertex_point, lcc.mesh), gt);
+    return true;
+  });
+
+  // Plug the remeshed regions in the mesh, in the same order as the components were found
+  for(const std::unique_ptr<Local_cc>& lcc : local_ccs)
+  {
+    visitor.start_component_handling();
+    visitor.status_update(faces_to_treat);
+
+    update_repair_status(lcc->status, something_was_done, all_fixed, topology_issue);
+
+    if(lcc->status == CC_FIXED)
     {
-      something_was_done = true;
+      // the faces of the local mesh that are not in the context replace `cc_faces`
+      const Local_vertex_point_map local_vpm = get_property_map(vertex_point, lcc->mesh);
+      std::vector<std::vector<Point> > patch;
+      for(const face_descriptor f : faces(lcc->mesh))
+      {
+        if(lcc->context_faces.count(f) != 0)
+          continue;
+
+        const halfedge_descriptor h = halfedge(f, lcc->mesh);
+        patch.emplace_back(std::initializer_list<Point>{get(local_vpm, target(h, lcc->mesh)),
+                                                        get(local_vpm, target(next(h, lcc->mesh), lcc->mesh)),
+                                                        get(local_vpm, target(prev(h, lcc->mesh), lcc->mesh))});
+      }
+
+      std::vector<vertex_descriptor> cc_vertices;
+      for(const face_descriptor f : lcc->cc_faces)
+      {
+        working_face_range.erase(f);
+        for(const vertex_descriptor v : vertices_around_face(halfedge(f, tmesh), tmesh))
+          cc_vertices.push_back(v);
+      }
+
+      replace_faces_with_patch_without_reuse(cc_vertices, lcc->cc_faces, patch, tmesh, vpm,
+                                             std::inserter(working_face_range, working_face_range.end()));
     }
 
     visitor.end_component_handling();
   }
+}
+#endif // CGAL_LINKED_WITH_TBB
+
+template <typename ConcurrencyTag, typename Projector, typename TriangleMesh, typename VertexPointMap, typename GeomTraits, typename Visitor>
+std::pair<bool, bool>
+remove_self_intersections_one_step(std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& faces_to_treat,
+                                   std::set<typename boost::graph_traits<TriangleMesh>::face_descriptor>& working_face_range,
+                                   TriangleMesh& tmesh,
+                                   const int step,
+                                   const bool preserve_genus,
+                                   const bool treat_all_CCs,
+                                   const double strong_dihedral_angle,
+                                   const double weak_dihedral_angle,
+                                   const bool use_smoothing,
+                                   const double containment_epsilon,
+                                   const Projector& projector,
+                                   VertexPointMap vpm,
+                                   const GeomTraits& gt,
+                                   Visitor& visitor)
+{
+  typedef boost::graph_traits<TriangleMesh>                                    graph_traits;
+  typedef typename graph_traits::face_descriptor                               face_descriptor;
+
+  std::set<face_descriptor> faces_to_treat_copy = faces_to_treat;
+
+  bool something_was_done = false; // indicates if a region was successfully remeshed
+  bool all_fixed = true; // indicates if all removal went well
+  // indicates if a removal was not possible because the region handle has
+  // some boundary cycle of halfedges
+  bool topology_issue = false;
+
+#ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
+  std::cout << "  DEBUG: is_valid in one_step(tmesh)? " << is_valid_polygon_mesh(tmesh) << std::endl;
+
+  unsolved_self_intersections = 0;
+#endif
+
+  CGAL_precondition(is_valid_polygon_mesh(tmesh));
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    if(visitor.stop())
+      return std::make_pair(false, false);
+
+    remove_self_intersections_in_independent_ccs(faces_to_treat, working_face_range, tmesh, step,
+                                                 preserve_genus, treat_all_CCs,
+                                                 strong_dihedral_angle, weak_dihedral_angle,
+                                                 use_smoothing, containment_epsilon, projector, vpm, gt,
+                                                 visitor, something_was_done, all_fixed, topology_issue);
+  }
+#endif
+
+  // the components that could not be treated in parallel are treated one after the other
+  int cc_id = -1;
+  while(!faces_to_treat.empty())
+  {
+    if(visitor.stop())
+      return std::make_pair(false, false);
+
+    visitor.start_component_handling();
+    visitor.status_update(faces_to_treat);
+
+    ++cc_id;
+
+#ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
+    std::cout << "  DEBUG: Remaining faces to remove: " << faces_to_treat.size() << "\n";
+    std::cout << "  DEBUG: --------------- Considering CC #" << cc_id << " ---------------\n";
+    std::cout << "  DEBUG: Initial face " << *faces_to_treat.begin() << "\n";
+    std::cout << "  DEBUG: first face: " << get(vpm, target(halfedge(*(faces_to_treat.begin()), tmesh), tmesh)) << " "
+                                         << get(vpm, target(next(halfedge(*(faces_to_treat.begin()), tmesh), tmesh), tmesh)) << " "
+                                         << get(vpm, source(halfedge(*(faces_to_treat.begin()), tmesh), tmesh)) << "\n";
+#endif
+
+    std::set<face_descriptor> cc_faces;
+    collect_self_intersecting_cc(*faces_to_treat.begin(), faces_to_treat, cc_faces, tmesh, step, cc_id, vpm, gt);
+
+    // Now, we have a proper selection to work on.
+
+    for(const face_descriptor f : cc_faces)
+      faces_to_treat.erase(f);
+
+    const CC_repair_status status = remove_self_intersections_in_cc(cc_faces, working_face_range, tmesh,
+                                                                    preserve_genus, treat_all_CCs,
+                                                                    strong_dihedral_angle, weak_dihedral_angle,
+                                                                    use_smoothing, containment_epsilon,
+                                                                    projector, vpm, gt);
+    update_repair_status(status, something_was_done, all_fixed, topology_issue);
+
+    visitor.end_component_handling();
+  }
 
   if(!something_was_done)
   {
@@ -2350,11 +2590,19 @@ struct Remove_self_intersection_default_visitor
                         double /* containment_epsilon */ ) {}
 };
 
-template <typename FaceRange, typename TriangleMesh, typename NamedParameters = parameters::Default_named_parameters>
+// With `Parallel_tag`, the connected components of self-intersecting faces whose neighborhoods
+// are disjoint are remeshed concurrently, each in a local copy of its neighborhood.
+template <typename ConcurrencyTag = Sequential_tag,
+          typename FaceRange, typename TriangleMesh, typename NamedParameters = parameters::Default_named_parameters>
 bool remove_self_intersections(const FaceRange& face_range,
                                TriangleMesh& tmesh,
                                const NamedParameters& np = parameters::default_values())
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   using parameters::choose_parameter;
   using parameters::get_parameter;
 
@@ -2464,7 +2712,7 @@ bool remove_self_intersections(const FaceRange& face_range,
 
       // TODO : possible optimization to reduce the range to check with the bbox
       // of the previous patches or something.
-      self_intersections(working_face_range, tmesh,
+      self_intersections<ConcurrencyTag>(working_face_range, tmesh,
                          filter_output_iterator(std::back_inserter(self_inter), out_it_predicates),
                          parameters::vertex_point_map(vpm).geom_traits(gt));
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
@@ -2488,7 +2736,7 @@ bool remove_self_intersections(const FaceRange& face_range,
     visitor.status_update(faces_to_treat);
 
     std::tie(all_fixed, topology_issue) =
-      internal::remove_self_intersections_one_step(
+      internal::remove_self_intersections_one_step<ConcurrencyTag>(
           faces_to_treat, working_face_range, tmesh, step,
           preserve_genus, treat_all_CCs, strong_dihedral_angle, weak_dihedral_angle,
           use_smoothing, containment_epsilon, projector, vpm, gt, visitor);
@@ -2514,7 +2762,8 @@ bool remove_self_intersections(const FaceRange& face_range,
   std::ofstream("results/final.off") << std::setprecision(17) << tmesh;
 #endif
 
-  bool self_intersects = does_self_intersect(working_face_range, tmesh, parameters::vertex_point_map(vpm).geom_traits(gt));
+  bool self_intersects = does_self_intersect<ConcurrencyTag>(working_face_range, tmesh,
+                                                             parameters::vertex_point_map(vpm).geom_traits(gt));
 
 #ifdef CGAL_PMP_REMOVE_SELF_INTERSECTION_DEBUG
   if(self_intersects)
@@ -2524,10 +2773,10 @@ bool remove_self_intersections(const FaceRange& face_range,
   return !self_intersects;
 }
 
-template <typename TriangleMesh, typename CGAL_NP_TEMPLATE_PARAMETERS>
+template <typename ConcurrencyTag = Sequential_tag, typename TriangleMesh, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool remove_self_intersections(TriangleMesh& tmesh, const CGAL_NP_CLASS& np = parameters::default_values())
 {
-  return remove_self_intersections(faces(tmesh), tmesh, np);
+  return remove_self_intersections<ConcurrencyTag>(faces(tmesh), tmesh, np);
 }
 
 } // namespace experimental
@@ -18,13 +18,18 @@
 
 #include <CGAL/Polygon_mesh_processing/compute_normal.h>
 #include <CGAL/property_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <boost/range/irange.hpp>
+
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -47,6 +52,14 @@ struct Allow_all_moves{
 * is projected back to the tangent plane to the surface at `v`, iteratively.
 * The connectivity remains unchanged.
 *
+* With `Parallel_tag`, the relocations of all the vertices are computed concurrently.
+* They are then applied by batches of non-adjacent vertices, so that the result
+* is the same as the one of the sequential version.
+*
+* @tparam ConcurrencyTag enables sequential versus parallel algorithm.
+*                        Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
+*                        With `Parallel_tag`, the vertex point map must support concurrent writes on distinct vertices,
+*                        and the functor passed as `allow_move_functor` must support concurrent calls.
 * @tparam TriangleMesh model of `FaceGraph` and `VertexListGraph`.
 *         The descriptor types `boost::graph_traits<TriangleMesh>::%face_descriptor`
 *         and `boost::graph_traits<TriangleMesh>::%halfedge_descriptor` must be
@@ -119,7 +132,8 @@ struct Allow_all_moves{
 *
 * \todo check if it should really be a triangle mesh or if a polygon mesh is fine
 */
-template <typename VertexRange, class TriangleMesh, class NamedParameters = parameters::Default_named_parameters>
+template <typename ConcurrencyTag = Sequential_tag,
+          typename VertexRange, class TriangleMesh, class NamedParameters = parameters::Default_named_parameters>
 void tangential_relaxation(const VertexRange& vertices,
                            TriangleMesh& tm,
                            const NamedParameters& np = parameters::default_values())
@@ -207,6 +221,14 @@ void tangential_relaxation(const VertexRange& vertices,
   Shall_move shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                            internal::Allow_all_moves());
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  constexpr bool parallel = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+
+  const std::vector<vertex_descriptor> relaxed_vertices(std::begin(vertices), std::end(vertices));
+
   for (unsigned int nit = 0; nit < nb_iterations; ++nit)
   {
 #ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
@@ -216,19 +238,24 @@ void tangential_relaxation(const VertexRange& vertices,
 #endif
 
     typedef std::tuple<vertex_descriptor, Vector_3, Point_3> VNP;
-    std::vector< VNP > barycenters;
     auto gt_barycenter = gt.construct_barycenter_3_object();
     auto gt_project = gt.construct_projected_point_3_object();
 
     // at each vertex, compute vertex normal
+    // (in parallel, each vertex computes its own normal to avoid sharing the map)
     std::unordered_map<vertex_descriptor, Vector_3> vnormals;
-    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+    if (!parallel)
+      compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
 
     // at each vertex, compute barycenter of neighbors
-    for(vertex_descriptor v : vertices)
+    std::vector< VNP > barycenters(relaxed_vertices.size());
+    std::vector<char> has_barycenter(relaxed_vertices.size(), false);
+    CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, relaxed_vertices.size()),
+                                   [&](std::size_t i) -> bool
     {
+      vertex_descriptor v = relaxed_vertices[i];
       if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
-        continue;
+        return true;
 
       // collect hedges to detect if we have to handle boundary cases
       std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
@@ -242,7 +269,7 @@ void tangential_relaxation(const VertexRange& vertices,
 
       if (border_halfedges.empty())
       {
-        const Vector_3& vn = vnormals.at(v);
+        const Vector_3 vn = parallel ? compute_vertex_normal(v, tm, np) : vnormals.at(v);
         Vector_3 move = CGAL::NULL_VECTOR;
         unsigned int star_size = 0;
         for(halfedge_descriptor h :interior_hedges)
@@ -253,11 +280,12 @@ void tangential_relaxation(const VertexRange& vertices,
         CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
         move = (1. / static_cast<double>(star_size)) * move;
 
-        barycenters.emplace_back(v, vn, get(vpm, v) + move);
+        barycenters[i] = VNP(v, vn, get(vpm, v) + move);
+        has_barycenter[i] = true;
       }
       else
       {
-        if (!relax_constraints) continue;
+        if (!relax_constraints) return true;
         Vector_3 vn(NULL_VECTOR);
 
         if (border_halfedges.size() == 2)// corners are constrained
@@ -279,30 +307,39 @@ void tangential_relaxation(const VertexRange& vertices,
             typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
 
             bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
-            barycenters.emplace_back(v, vn, bary);
+            barycenters[i] = VNP(v, vn, bary);
+            has_barycenter[i] = true;
           }
-
-
         }
       }
-    }
+      return true;
+    });
+
+    // keep the relocated vertices, in the order of the input range
+    std::size_t nb_barycenters = 0;
+    for (std::size_t i = 0; i < barycenters.size(); ++i)
+      if (has_barycenter[i])
+        barycenters[nb_barycenters++] = barycenters[i];
+    barycenters.resize(nb_barycenters);
 
     // compute moves
     typedef std::pair<vertex_descriptor, Point_3> VP_pair;
-    std::vector< std::pair<vertex_descriptor, Point_3> > new_locations;
-    new_locations.reserve(barycenters.size());
-    for(const VNP& vnp : barycenters)
+    std::vector< std::pair<vertex_descriptor, Point_3> > new_locations(barycenters.size());
+    CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, barycenters.size()),
+                                   [&](std::size_t i) -> bool
     {
+      const VNP& vnp = barycenters[i];
       vertex_descriptor v = std::get<0>(vnp);
       const Point_3& pv = get(vpm, v);
       const Vector_3& nv = std::get<1>(vnp);
       const Point_3& qv = std::get<2>(vnp); //barycenter at v
 
-      new_locations.emplace_back(v, qv + (nv * Vector_3(qv, pv)) * nv);
-    }
+      new_locations[i] = VP_pair(v, qv + (nv * Vector_3(qv, pv)) * nv);
+      return true;
+    });
 
     // perform moves
-    for(const VP_pair& vp : new_locations)
+    auto perform_move = [&](const VP_pair& vp)
     {
       const Point_3 initial_pos = get(vpm, vp.first); // make a copy on purpose
       const Vector_3 move(initial_pos, vp.second);
@@ -320,6 +357,58 @@ void tangential_relaxation(const VertexRange& vertices,
       }
       if (frac <= 0.02)
         put(vpm, vp.first, initial_pos);//cancel move
+    };
+
+    if (!parallel)
+    {
+      for(const VP_pair& vp : new_locations)
+        perform_move(vp);
+    }
+    else
+    {
+      // The validity of a move depends on the positions of the neighbors of the vertex.
+      // Each move gets a level strictly greater than the ones of the moves of the same
+      // vertex and of its neighbors that come before it, so that the moves of a level
+      // are independent and see the same neighborhoods as in the sequential order.
+      std::unordered_map<vertex_descriptor, std::size_t> last_level;
+      std::vector<std::size_t> levels(new_locations.size());
+      std::size_t nb_levels = 0;
+      for (std::size_t i = 0; i < new_locations.size(); ++i)
+      {
+        vertex_descriptor v = new_locations[i].first;
+        std::size_t level = 0;
+        auto lit = last_level.find(v);
+        if (lit != last_level.end())
+          level = lit->second + 1;
+        for(halfedge_descriptor h : halfedges_around_target(v, tm))
+        {
+          lit = last_level.find(source(h, tm));
+          if (lit != last_level.end())
+            level = (std::max)(level, lit->second + 1);
+        }
+        last_level[v] = level;
+        levels[i] = level;
+        nb_levels = (std::max)(nb_levels, level + 1);
+      }
+
+      // sort the moves by level, keeping the order of the moves within a level
+      std::vector<std::size_t> level_begin(nb_levels + 1, 0);
+      for (std::size_t level : levels)
+        ++level_begin[level + 1];
+      for (std::size_t l = 0; l < nb_levels; ++l)
+        level_begin[l + 1] += level_begin[l];
+      std::vector<std::size_t> sorted_moves(new_locations.size());
+      std::vector<std::size_t> position(level_begin.begin(), level_begin.end() - 1);
+      for (std::size_t i = 0; i < new_locations.size(); ++i)
+        sorted_moves[position[levels[i]]++] = i;
+
+      for (std::size_t l = 0; l < nb_levels; ++l)
+        CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(level_begin[l], level_begin[l + 1]),
+                                       [&](std::size_t j) -> bool
+        {
+          perform_move(new_locations[sorted_moves[j]]);
+          return true;
+        });
     }
   }//end for loop (nit == nb_iterations)
 
@@ -333,11 +422,12 @@ void tangential_relaxation(const VertexRange& vertices,
 * \ingroup PMP_meshing_grp
 * applies `tangential_relaxation()` to all the vertices of `tm`.
 */
-template <class TriangleMesh,
+template <typename ConcurrencyTag = Sequential_tag,
+          class TriangleMesh,
           typename CGAL_NP_TEMPLATE_PARAMETERS>
 void tangential_relaxation(TriangleMesh& tm, const CGAL_NP_CLASS& np = parameters::default_values())
 {
-  tangential_relaxation(vertices(tm), tm, np);
+  tangential_relaxation<ConcurrencyTag>(vertices(tm), tm, np);
 }
 
 } } // CGAL::Polygon_mesh_processing
@@ -217,6 +217,82 @@ void test_CC_with_area_size_map(Mesh sm,
   }
 }
 
+// The parallel labeling gives the same components, with the same numbering, as the sequential one
+void test_parallel_CC(const Mesh& input,
+                      const Kernel& k)
+{
+  std::cout << " -- test parallel labeling -- " << std::endl;
+
+  typedef boost::graph_traits<Mesh>::vertex_descriptor                    vertex_descriptor;
+  typedef boost::graph_traits<Mesh>::edge_descriptor                      edge_descriptor;
+  typedef boost::graph_traits<Mesh>::face_descriptor                      face_descriptor;
+
+  // many small components, an isolated vertex, and some garbage
+  Mesh sm = input;
+  for(int i=0; i<1000; ++i)
+  {
+    Point p(i,0,0), q(i+1,0,0), r(i,1,0), s(i,0,1);
+    CGAL::make_tetrahedron(p,q,r,s,sm);
+  }
+  sm.add_vertex(Point(-1,-1,-1));
+  CGAL::Euler::remove_face(halfedge(*faces(sm).begin(), sm), sm);
+
+  Mesh::Property_map<face_descriptor, std::size_t> seq_fcc, par_fcc;
+  seq_fcc = sm.add_property_map<face_descriptor, std::size_t>("f:seq_CC").first;
+  par_fcc = sm.add_property_map<face_descriptor, std::size_t>("f:par_CC").first;
+
+  std::size_t seq_num = PMP::connected_components(sm, seq_fcc);
+  std::size_t par_num = PMP::connected_components<CGAL::Parallel_if_available_tag>(sm, par_fcc);
+  std::cout << par_num << " connected components" << std::endl;
+  assert(seq_num == par_num);
+  for(face_descriptor f : faces(sm))
+    assert(seq_fcc[f] == par_fcc[f]);
+
+  // patch-constrained labeling
+  const Kernel::FT bound = std::cos(0.7 * CGAL_PI);
+  seq_num = PMP::connected_components(sm, seq_fcc,
+              CGAL::parameters::edge_is_constrained_map(Constraint<Mesh, Kernel>(sm, k, bound)));
+  par_num = PMP::connected_components<CGAL::Parallel_if_available_tag>(sm, par_fcc,
+              CGAL::parameters::edge_is_constrained_map(Constraint<Mesh, Kernel>(sm, k, bound)));
+  std::cout << par_num << " patches" << std::endl;
+  assert(seq_num == par_num);
+  for(face_descriptor f : faces(sm))
+    assert(seq_fcc[f] == par_fcc[f]);
+
+  // vertex connectivity
+  Mesh::Property_map<vertex_descriptor, std::size_t> seq_vcc, par_vcc;
+  seq_vcc = sm.add_property_map<vertex_descriptor, std::size_t>("v:seq_CC").first;
+  par_vcc = sm.add_property_map<vertex_descriptor, std::size_t>("v:par_CC").first;
+
+  seq_num = PMP::vertex_connected_components(sm, seq_vcc);
+  par_num = PMP::vertex_connected_components<CGAL::Parallel_if_available_tag>(sm, par_vcc);
+  std::cout << par_num << " vertex connected components" << std::endl;
+  assert(seq_num == par_num);
+  assert(par_num == PMP::connected_components(sm, seq_fcc) + 1); // the isolated vertex
+  for(vertex_descriptor v : vertices(sm))
+    assert(seq_vcc[v] == par_vcc[v]);
+  for(edge_descriptor e : edges(sm))
+    assert(par_vcc[source(e, sm)] == par_vcc[target(e, sm)]);
+
+  // keeping and splitting
+  Mesh seq_sm = sm, par_sm = sm;
+  PMP::keep_largest_connected_components(seq_sm, 10);
+  PMP::keep_largest_connected_components<CGAL::Parallel_if_available_tag>(par_sm, 10);
+  assert(num_faces(seq_sm) == num_faces(par_sm));
+  assert(num_vertices(seq_sm) == num_vertices(par_sm));
+
+  std::vector<Mesh> seq_ccs, par_ccs;
+  PMP::split_connected_components(sm, seq_ccs);
+  PMP::split_connected_components<CGAL::Parallel_if_available_tag>(sm, par_ccs);
+  assert(seq_ccs.size() == par_ccs.size());
+  for(std::size_t i=0; i<seq_ccs.size(); ++i)
+  {
+    assert(CGAL::is_valid_polygon_mesh(par_ccs[i]));
+    assert(num_faces(seq_ccs[i]) == num_faces(par_ccs[i]));
+    assert(num_vertices(seq_ccs[i]) == num_vertices(par_ccs[i]));
+  }
+}
+
 int main(int /*argc*/, char** /*argv*/)
 {
   const std::string filename = CGAL::data_file_path("meshes/blobby_3cc.off");
@@ -231,6 +307,7 @@ int main(int /*argc*/, char** /*argv*/)
 
   test_CC_with_default_size_map(sm, k);
   test_CC_with_area_size_map(sm, k);
+  test_parallel_CC(sm, k);
 
   return EXIT_SUCCESS;
 }
@@ -9,6 +9,11 @@
 
 #include <CGAL/Bbox_3.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <cmath>
 #include <iostream>
 #include <fstream>
 #include <iterator>
@@ -20,6 +25,12 @@ namespace PMP = CGAL::Polygon_mesh_processing;
 typedef CGAL::Exact_predicates_inexact_constructions_kernel Epic;
 typedef CGAL::Exact_predicates_exact_constructions_kernel Epec;
 
+template <typename FT>
+bool is_close(const FT& a, const FT& b)
+{
+  return CGAL::abs(CGAL::to_double(a) - CGAL::to_double(b)) <= 1e-12 * CGAL::abs(CGAL::to_double(a));
+}
+
 
 template<typename Mesh, typename K>
 void test_pmesh(const Mesh& pmesh)
@@ -103,6 +114,12 @@ void test_pmesh(const Mesh& pmesh)
   std::cout << "mesh area (NP) = " << mesh_area_np << std::endl;
   assert(mesh_area_np > 0);
 
+  FT patch_area_par = PMP::area<CGAL::Parallel_if_available_tag>(patch, pmesh);
+  FT mesh_area_par = PMP::area<CGAL::Parallel_if_available_tag>(pmesh);
+  std::cout << "mesh area (parallel) = " << mesh_area_par << std::endl;
+  assert(is_close(patch_area, patch_area_par));
+  assert(is_close(mesh_area, mesh_area_par));
+
   std::pair<halfedge_descriptor, FT> res = PMP::longest_border(pmesh);
   if(res.first == boost::graph_traits<Mesh>::null_halfedge()){
     std::cout << "mesh has no border" << std::endl;
@@ -175,6 +192,10 @@ void test_closed_surface_mesh(const std::string filename)
   std::cout << "volume = " << vol << std::endl;
   assert(vol > 0);
 
+  typename K::FT vol_par = PMP::volume<CGAL::Parallel_if_available_tag>(sm);
+  std::cout << "volume (parallel) = " << vol_par << std::endl;
+  assert(is_close(vol, vol_par));
+
 }
 
 
@@ -207,7 +228,40 @@ void test_centroid(const std::string filename)
   assert (p.y() > -0.14 && p.y() < -0.13);
   assert (p.z() > 0.01 && p.z() < 0.02);
 
+  typename K::Point_3 p_par = PMP::centroid<CGAL::Parallel_if_available_tag>(sm);
+  p_par = p_par - v;
+  assert(CGAL::squared_distance(p, p_par) < 1e-20);
+}
+
+// The parallel sums do not depend on the number of threads
+template <typename Surface_mesh>
+void test_parallel_sums(const std::string filename)
+{
+  std::cout << "Test parallel sums on " << filename << std::endl;
+  Surface_mesh sm;
+  std::ifstream input(filename);
+  input >> sm;
 
+  const auto area = PMP::area<CGAL::Parallel_if_available_tag>(sm);
+  const auto volume = PMP::volume<CGAL::Parallel_if_available_tag>(sm);
+  const auto centroid = PMP::centroid<CGAL::Parallel_if_available_tag>(sm);
+
+  for(int nb_threads : { 1, 2, 7 })
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    tbb::task_arena arena(nb_threads);
+    arena.execute([&]
+    {
+#else
+    CGAL_USE(nb_threads);
+#endif
+      assert(PMP::area<CGAL::Parallel_if_available_tag>(sm) == area);
+      assert(PMP::volume<CGAL::Parallel_if_available_tag>(sm) == volume);
+      assert(PMP::centroid<CGAL::Parallel_if_available_tag>(sm) == centroid);
+#ifdef CGAL_LINKED_WITH_TBB
+    });
+#endif
+  }
 }
 
 template <typename PolygonMesh1, typename PolygonMesh2 >
@@ -369,6 +423,7 @@ int main(int argc, char* argv[])
   // It won't work with Epec for large meshes as it builds up a deep DAG
   // leading to a stackoverflow when the destructor is called.
   test_centroid<CGAL::Surface_mesh<Epic::Point_3>,Epic>(filename_surface_mesh);
+  test_parallel_sums<CGAL::Surface_mesh<Epic::Point_3> >(CGAL::data_file_path("meshes/armadillo.off"));
   test_compare<CGAL::Polyhedron_3<Epic>, CGAL::Surface_mesh<Epic::Point_3> >();
   test_compare<CGAL::Polyhedron_3<Epec>, CGAL::Surface_mesh<Epec::Point_3> >();
   test_compare<CGAL::Surface_mesh<Epic::Point_3>, CGAL::Polyhedron_3<Epic> >();
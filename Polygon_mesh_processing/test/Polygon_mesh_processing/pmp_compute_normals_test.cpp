@@ -150,6 +150,24 @@ void test_SM(const std::string file_name)
   fnormals = mesh.template add_property_map<face_descriptor, Vector>("f:normals", CGAL::NULL_VECTOR).first;
 
   test<K>(mesh, vnormals, fnormals);
+
+  // The parallel computations give the same normals as the sequential ones
+  typename SM::template Property_map<vertex_descriptor, Vector> vnormals_par;
+  vnormals_par = mesh.template add_property_map<vertex_descriptor, Vector>("v:normals_par", CGAL::NULL_VECTOR).first;
+  typename SM::template Property_map<face_descriptor, Vector> fnormals_par;
+  fnormals_par = mesh.template add_property_map<face_descriptor, Vector>("f:normals_par", CGAL::NULL_VECTOR).first;
+
+  PMP::compute_face_normals<CGAL::Parallel_if_available_tag>(mesh, fnormals_par);
+  PMP::compute_vertex_normals<CGAL::Parallel_if_available_tag>(mesh, vnormals_par);
+  for(face_descriptor f : faces(mesh))
+    assert(get(fnormals_par, f) == get(fnormals, f));
+  for(vertex_descriptor v : vertices(mesh))
+    assert(get(vnormals_par, v) == get(vnormals, v));
+
+  PMP::compute_normals<CGAL::Parallel_if_available_tag>(mesh, vnormals_par, fnormals_par,
+                                                        CGAL::parameters::geom_traits(K()));
+  for(vertex_descriptor v : vertices(mesh))
+    assert(get(vnormals_par, v) == get(vnormals, v));
 }
 
 template<typename K>
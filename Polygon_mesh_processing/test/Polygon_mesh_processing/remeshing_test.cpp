@@ -16,6 +16,7 @@
 #include <CGAL/Polygon_mesh_processing/connected_components.h>
 #include <CGAL/Polygon_mesh_processing/self_intersections.h>
 #include <CGAL/Polygon_mesh_processing/detect_features.h>
+#include <CGAL/Polygon_mesh_processing/tangential_relaxation.h>
 
 #include <CGAL/Timer.h>
 #include <fstream>
@@ -309,6 +310,57 @@ Main(int argc, const char* argv[])
 }
 };
 
+// The parallel remeshing and relaxation must give the same mesh as the sequential ones
+void test_parallel(const char* filename)
+{
+  typedef CGAL::Surface_mesh<Epic::Point_3> Mesh;
+
+  Mesh m;
+  std::ifstream input(filename);
+  if (!input || !(input >> m)){
+    std::cerr << "Error: can not read file.\n";
+    assert(false);
+    return;
+  }
+
+  auto same_mesh = [](const Mesh& m1, const Mesh& m2)
+  {
+    if (m1.number_of_vertices() != m2.number_of_vertices()
+     || m1.number_of_faces() != m2.number_of_faces())
+      return false;
+    for (Mesh::Vertex_index v : vertices(m1))
+      if (m1.point(v) != m2.point(v))
+        return false;
+    for (Mesh::Face_index f : faces(m1))
+      if (m1.halfedge(f) != m2.halfedge(f) || m1.target(m1.halfedge(f)) != m2.target(m2.halfedge(f)))
+        return false;
+    return true;
+  };
+
+  std::cout << "Test parallel remeshing...";
+  Mesh seq = m, par = m;
+  const double target_edge_length = 0.05;
+  PMP::isotropic_remeshing(faces(seq), target_edge_length, seq,
+    CGAL::parameters::number_of_iterations(3).number_of_relaxation_steps(3));
+  PMP::isotropic_remeshing<CGAL::Parallel_if_available_tag>(faces(par), target_edge_length, par,
+    CGAL::parameters::number_of_iterations(3).number_of_relaxation_steps(3));
+  assert(same_mesh(seq, par));
+
+  Mesh seq_constrained = m, par_constrained = m;
+  PMP::isotropic_remeshing(faces(seq_constrained), 2. * target_edge_length, seq_constrained,
+    CGAL::parameters::protect_constraints(true).relax_constraints(true).number_of_relaxation_steps(3));
+  PMP::isotropic_remeshing<CGAL::Parallel_if_available_tag>(faces(par_constrained), 2. * target_edge_length, par_constrained,
+    CGAL::parameters::protect_constraints(true).relax_constraints(true).number_of_relaxation_steps(3));
+  assert(same_mesh(seq_constrained, par_constrained));
+  std::cout << "done." << std::endl;
+
+  std::cout << "Test parallel tangential relaxation...";
+  PMP::tangential_relaxation(seq, CGAL::parameters::number_of_iterations(5));
+  PMP::tangential_relaxation<CGAL::Parallel_if_available_tag>(par, CGAL::parameters::number_of_iterations(5));
+  assert(same_mesh(seq, par));
+  std::cout << "done." << std::endl;
+}
+
 int main(int argc, const char* argv[])
 {
   Main<Epic> m(argc,argv);
@@ -326,5 +378,7 @@ int main(int argc, const char* argv[])
                                param[2], param[3], param[4], param[5] };
   Main<Epic> sharp2(6, param_bis);
 
+  test_parallel("data/joint_refined.off");
+
   return 0;
 }
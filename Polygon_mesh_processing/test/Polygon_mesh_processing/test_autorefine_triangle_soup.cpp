@@ -0,0 +1,124 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+
+#include <CGAL/Polygon_mesh_processing/autorefinement.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+#include <CGAL/IO/polygon_soup_io.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   Epick;
+typedef CGAL::Exact_predicates_exact_constructions_kernel     Epeck;
+
+typedef std::array<std::size_t, 3>                            Triangle;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+template <class K>
+void test(const std::vector<typename K::Point_3>& input_points, const std::vector<Triangle>& input_triangles)
+{
+  typedef typename K::Point_3                                 Point_3;
+
+  std::vector<Point_3> points = input_points;
+  std::vector<Triangle> triangles = input_triangles;
+  PMP::autorefine_triangle_soup(points, triangles);
+
+  std::cout << "    " << input_triangles.size() << " triangles, " << triangles.size() << " after refinement, "
+            << points.size() - input_points.size() << " new points" << std::endl;
+
+  // input points are not moved, and the new points are not duplicated
+  assert(std::equal(input_points.begin(), input_points.end(), points.begin()));
+  for(std::size_t i=input_points.size(); i<points.size(); ++i)
+    assert(std::find(points.begin(), points.begin() + i, points[i]) == points.begin() + i);
+
+  if(std::is_same<K, Epeck>::value)
+  {
+    assert(!PMP::does_triangle_soup_self_intersect(points, triangles));
+  }
+
+  // The output does not depend on the concurrency tag
+  std::vector<Point_3> par_points = input_points;
+  std::vector<Triangle> par_triangles = input_triangles;
+  PMP::autorefine_triangle_soup<CGAL::Parallel_if_available_tag>(par_points, par_triangles);
+  assert(par_points == points);
+  assert(par_triangles == triangles);
+}
+
+template <class K>
+void test_crossing_triangles()
+{
+  typedef typename K::Point_3                                 Point_3;
+
+  std::cout << "  crossing triangles" << std::endl;
+
+  // two triangles crossing each other, and a third one sharing an edge with the first one
+  // and crossed at the middle of that edge
+  std::vector<Point_3> points = { Point_3(0,0,0), Point_3(4,0,0), Point_3(0,4,0),
+                                  Point_3(1,1,-1), Point_3(1,1,1), Point_3(5,5,0),
+                                  Point_3(4,4,0) };
+  std::vector<Triangle> triangles = { {0,1,2}, {3,5,4}, {1,6,2} };
+  test<K>(points, triangles);
+
+  // two coplanar triangles overlapping
+  points = { Point_3(0,0,0), Point_3(4,0,0), Point_3(0,4,0),
+             Point_3(1,-1,0), Point_3(3,-1,0), Point_3(2,5,0) };
+  triangles = { {0,1,2}, {3,4,5} };
+  test<K>(points, triangles);
+}
+
+template <class K>
+void test_file(const std::string& filename)
+{
+  typedef typename K::Point_3                                 Point_3;
+
+  std::cout << "  " << filename << std::endl;
+
+  std::vector<Point_3> points;
+  std::vector<Triangle> triangles;
+  if(!CGAL::IO::read_polygon_soup(filename, points, triangles))
+  {
+    std::cerr << "Invalid input: " << filename << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // duplicated points are intersections that the refinement does not remove
+  PMP::merge_duplicate_points_in_polygon_soup(points, triangles);
+
+  test<K>(points, triangles);
+}
+
+int main(int argc, char** argv)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  // Several threads, even on a single core
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+#endif
+
+  std::vector<std::string> filenames = { "data-autoref/test_01.off", "data-autoref/test_03.off",
+                                         "data-autoref/cpln_01.off", "data-autoref/four_cubes.off" };
+  if(argc > 1)
+    filenames.assign(argv + 1, argv + argc);
+
+  std::cout << "Epick" << std::endl;
+  test_crossing_triangles<Epick>();
+  for(const std::string& f : filenames)
+    test_file<Epick>(f);
+
+  std::cout << "Epeck" << std::endl;
+  test_crossing_triangles<Epeck>();
+  for(const std::string& f : filenames)
+    test_file<Epeck>(f);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
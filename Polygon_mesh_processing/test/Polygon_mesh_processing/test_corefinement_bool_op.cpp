@@ -6,6 +6,7 @@
 #include <CGAL/Surface_mesh.h>
 #include <CGAL/Polygon_mesh_processing/corefinement.h>
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <fstream>
@@ -274,6 +275,60 @@ void run(char* P_fname, char* Q_fname, int k,
     }
 }
 
+// sorted points of a mesh, to compare meshes whose vertices are not in the same order
+std::vector<Point_3> sorted_points(const Surface_mesh& tm)
+{
+  std::vector<Point_3> points;
+  for (Surface_mesh::Vertex_index v : vertices(tm))
+    points.push_back(tm.point(v));
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+// checks that the parallel Boolean operations give the same results as the sequential ones
+void test_parallel(const char* P_fname, const char* Q_fname)
+{
+  typedef std::optional<Surface_mesh*> OSM;
+
+  std::array<Surface_mesh, 4> seq_out, par_out;
+  std::array<OSM, 4> seq_output, par_output;
+  for (int i=0; i<4; ++i)
+  {
+    seq_output[i] = OSM(&seq_out[i]);
+    par_output[i] = OSM(&par_out[i]);
+  }
+
+  Surface_mesh P, Q;
+  std::ifstream P_file(P_fname), Q_file(Q_fname);
+  P_file >> P;
+  Q_file >> Q;
+  const Surface_mesh P_input(P), Q_input(Q);
+  Surface_mesh P2(P), Q2(Q);
+
+  std::array<bool,4> seq_res = PMP::corefine_and_compute_boolean_operations(P, Q, seq_output);
+  std::array<bool,4> par_res =
+    PMP::corefine_and_compute_boolean_operations<CGAL::Parallel_if_available_tag>(P2, Q2, par_output);
+
+  assert(seq_res == par_res);
+  for (int i=0; i<4; ++i)
+  {
+    if (!seq_res[i]) continue;
+    assert(par_out[i].is_valid());
+    assert(seq_out[i].number_of_faces() == par_out[i].number_of_faces());
+    assert(sorted_points(seq_out[i]) == sorted_points(par_out[i]));
+  }
+
+  // corefinement only
+  P = P_input; Q = Q_input;
+  P2 = P_input; Q2 = Q_input;
+  PMP::corefine(P, Q);
+  PMP::corefine<CGAL::Parallel_if_available_tag>(P2, Q2);
+  assert(P.number_of_faces() == P2.number_of_faces());
+  assert(Q.number_of_faces() == Q2.number_of_faces());
+  assert(sorted_points(P) == sorted_points(P2));
+  assert(sorted_points(Q) == sorted_points(Q2));
+}
+
 int main(int argc,char** argv)
 {
   if (argc<3){
@@ -297,6 +352,7 @@ int main(int argc,char** argv)
       if (std::string(argv[i+3])!=std::string("ALL"))
         scenario = atoi(argv[i+3]);
       run<Surface_mesh>(argv[i+1], argv[i+2], scenario, rc);
+      test_parallel(argv[i+1], argv[i+2]);
     }
   }
   else
@@ -317,6 +373,7 @@ int main(int argc,char** argv)
       scenario = atoi(argv[3]);
 
     run<Surface_mesh>(argv[1], argv[2], scenario, rc);
+    test_parallel(argv[1], argv[2]);
   }
 
   return 0;
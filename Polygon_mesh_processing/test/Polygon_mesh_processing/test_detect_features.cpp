@@ -120,6 +120,30 @@ void test_blobby()
 
   std::cout << "Found " << nb_sharp_edges << " sharp edges" << std::endl;
   assert(nb_sharp_edges == 2565);
+
+  // same edges and vertex degrees in parallel
+  typedef CGAL::dynamic_vertex_property_t<int> VFD_tag;
+  typedef boost::property_map<Mesh, VFD_tag>::type VFD;
+
+  EIF eif_par = get(EIF_tag(), mesh);
+  VFD vfd = get(VFD_tag(), mesh);
+  VFD vfd_par = get(VFD_tag(), mesh);
+
+  PMP::detect_sharp_edges(mesh, 5, eif, CGAL::parameters::vertex_feature_degree_map(vfd));
+
+  timer.reset();
+  timer.start();
+
+  PMP::detect_sharp_edges<CGAL::Parallel_if_available_tag>(mesh, 5, eif_par,
+                                                           CGAL::parameters::vertex_feature_degree_map(vfd_par));
+
+  timer.stop();
+  std::cout << "Elapsed (parallel): " << timer.time() << std::endl;
+
+  for(auto e : edges(mesh))
+    assert(get(eif_par, e) == get(eif, e));
+  for(auto v : vertices(mesh))
+    assert(get(vfd_par, v) == get(vfd, v));
 }
 
 int main(int, char**)
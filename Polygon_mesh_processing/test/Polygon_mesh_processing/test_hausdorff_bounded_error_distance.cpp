@@ -20,6 +20,10 @@
 #include <CGAL/Polygon_mesh_processing/transform.h>
 #include <CGAL/Real_timer.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
 using SCK   = CGAL::Simple_cartesian<double>;
 using EPICK = CGAL::Exact_predicates_inexact_constructions_kernel;
 using EPECK = CGAL::Exact_predicates_exact_constructions_kernel;
@@ -1071,6 +1075,48 @@ void test_parallel_version(const std::string& filepath,
 }
 #endif // defined(CGAL_LINKED_WITH_TBB) && defined(CGAL_METIS_ENABLED)
 
+#ifdef CGAL_LINKED_WITH_TBB
+void test_parallel_subdivision(const std::string& filepath,
+                               const double error_bound)
+{
+  std::cout << std::endl << "-- test parallel subdivision:" << std::endl << std::endl;
+
+  Surface_mesh mesh1, mesh2;
+  get_meshes(filepath, filepath, mesh1, mesh2);
+
+  PMP::transform(Affine_transformation_3(CGAL::Translation(),
+                                         Vector_3(FT(0), FT(0), FT(0.5))), mesh2);
+
+  // Both results are within the error bound of the actual distance, but not necessarily equal.
+  const double dista = PMP::bounded_error_Hausdorff_distance<CGAL::Sequential_tag>(mesh1, mesh2, error_bound);
+  const double distb = PMP::bounded_error_Hausdorff_distance<CGAL::Parallel_tag>(mesh1, mesh2, error_bound);
+  std::cout << "* one-sided seq = " << dista << ", par = " << distb << std::endl;
+  assert(CGAL::abs(dista - distb) <= error_bound);
+
+  const double sym_dista = PMP::bounded_error_symmetric_Hausdorff_distance<CGAL::Sequential_tag>(mesh1, mesh2, error_bound);
+  const double sym_distb = PMP::bounded_error_symmetric_Hausdorff_distance<CGAL::Parallel_tag>(mesh1, mesh2, error_bound);
+  std::cout << "* symmetric seq = " << sym_dista << ", par = " << sym_distb << std::endl;
+  assert(CGAL::abs(sym_dista - sym_distb) <= error_bound);
+
+  // The realizing triangles are valid faces.
+  std::vector<std::pair<Face_handle, Face_handle> > realizing_triangles;
+  PMP::bounded_error_Hausdorff_distance<CGAL::Parallel_tag>(mesh1, mesh2, error_bound,
+    CGAL::parameters::output_iterator(std::back_inserter(realizing_triangles)));
+  assert(realizing_triangles.size() == 2);
+  for(const auto& fp : realizing_triangles)
+  {
+    assert(fp.first != boost::graph_traits<Surface_mesh>::null_face() && mesh1.is_valid(fp.first));
+    assert(fp.second != boost::graph_traits<Surface_mesh>::null_face() && mesh2.is_valid(fp.second));
+  }
+
+  // Early quit, as soon as any thread finds a lower bound larger than the threshold.
+  assert(!PMP::is_Hausdorff_distance_larger<CGAL::Parallel_tag>(mesh1, mesh2, dista + 2 * error_bound, error_bound));
+  assert(PMP::is_Hausdorff_distance_larger<CGAL::Parallel_tag>(mesh1, mesh2, 0.4, error_bound));
+  assert(PMP::is_Hausdorff_distance_larger<CGAL::Parallel_tag>(mesh1, mesh2, 0.4, error_bound,
+                                                               CGAL::parameters::use_one_sided_hausdorff(false)));
+}
+#endif // CGAL_LINKED_WITH_TBB
+
 void test_early_quit(const std::string& filepath,
                      const bool save = true)
 {
@@ -1127,6 +1173,11 @@ void run_examples(const double error_bound,
 
 int main(int argc, char** argv)
 {
+#ifdef CGAL_LINKED_WITH_TBB
+  // Several threads, even on a single core
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+#endif
+
   std::cout.precision(17);
   std::cerr.precision(17);
 
@@ -1173,6 +1224,10 @@ int main(int argc, char** argv)
   test_parallel_version(filepath, error_bound);
 #endif // defined(CGAL_LINKED_WITH_TBB) && defined(CGAL_METIS_ENABLED)
 
+#ifdef CGAL_LINKED_WITH_TBB
+  test_parallel_subdivision(filepath, error_bound);
+#endif // CGAL_LINKED_WITH_TBB
+
   // --- Test early quit.
   test_early_quit(filepath);
 
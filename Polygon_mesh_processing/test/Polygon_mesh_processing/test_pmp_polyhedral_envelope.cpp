@@ -109,6 +109,15 @@ void test_remove_si()
   // try with a larger bound --> accept fix
   PMP::experimental::remove_self_intersections(tm, CGAL::parameters::polyhedral_envelope_epsilon(0.001));
   assert(!PMP::does_self_intersect(tm));
+
+  // the independent self-intersecting areas are fixed concurrently
+  CGAL::Surface_mesh<EPIC::Point_3> ptm;
+  std::ifstream pin(CGAL::data_file_path("meshes/pig.off"));
+  pin >> ptm;
+  PMP::experimental::remove_self_intersections<CGAL::Parallel_if_available_tag>(
+    ptm, CGAL::parameters::polyhedral_envelope_epsilon(0.001));
+  assert(!PMP::does_self_intersect(ptm));
+  assert(CGAL::is_valid_polygon_mesh(ptm));
 }
 
 void cube_test()
@@ -0,0 +1,450 @@
+// Copyright (c) 2012  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Clement Jamin
+
+#ifndef CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_D_H
+#define CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_D_H
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+#include <CGAL/assertions.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/Spatial_lock_grid_3.h> // lock tags
+
+#include <atomic>
+#include <thread>
+#include <tbb/enumerable_thread_specific.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace CGAL {
+
+//*****************************************************************************
+// class Spatial_lock_grid_base_d
+// (Uses Curiously recurring template pattern)
+// dD counterpart of Spatial_lock_grid_base_3, whose dimension is given at
+// run time: the bounding box is divided into a regular grid of cells, and
+// locking a point, given by the range of its coordinates, locks its grid cell.
+// The grid has `num_grid_cells_per_axis` to the power of the dimension cells,
+// which should thus stay small in high dimensions.
+//*****************************************************************************
+
+template <typename Derived>
+class Spatial_lock_grid_base_d
+{
+private:
+  static bool *init_TLS_grid(int num_cells)
+  {
+    bool *local_grid = new bool[num_cells];
+    for (int i = 0 ; i < num_cells ; ++i)
+      local_grid[i] = false;
+    return local_grid;
+  }
+
+public:
+  bool *get_thread_local_grid()
+  {
+    return m_tls_grids.local();
+  }
+
+  int dimension() const
+  {
+    return static_cast<int>(m_min.size());
+  }
+
+  int number_of_cells() const
+  {
+    return m_num_cells;
+  }
+
+  // InputIterator must have `double` as value type
+  template <typename InputIterator>
+  void set_bbox(InputIterator min_first, InputIterator min_last,
+                InputIterator max_first)
+  {
+    // Compute resolutions
+    m_min.assign(min_first, min_last);
+    m_resolution.resize(m_min.size());
+    double n = static_cast<double>(m_num_grid_cells_per_axis);
+    for (std::size_t i = 0 ; i < m_min.size() ; ++i, ++max_first)
+      m_resolution[i] = n / (*max_first - m_min[i]);
+  }
+
+  bool is_locked_by_this_thread(int cell_index)
+  {
+    return get_thread_local_grid()[cell_index];
+  }
+
+  template <typename InputIterator>
+  bool is_locked(InputIterator first, InputIterator last)
+  {
+    return is_cell_locked(get_grid_index(first, last));
+  }
+
+  template <typename InputIterator>
+  bool is_locked_by_this_thread(InputIterator first, InputIterator last)
+  {
+    return get_thread_local_grid()[get_grid_index(first, last)];
+  }
+
+  bool try_lock(int cell_index)
+  {
+    return try_lock<false>(cell_index);
+  }
+
+  template <bool no_spin>
+  bool try_lock(int cell_index)
+  {
+    return get_thread_local_grid()[cell_index]
+        || try_lock_cell<no_spin>(cell_index);
+  }
+
+  // [first, last) is the range of the coordinates of the point
+  template <typename InputIterator>
+  bool try_lock(InputIterator first, InputIterator last)
+  {
+    return try_lock<false>(get_grid_index(first, last));
+  }
+
+  template <bool no_spin, typename InputIterator>
+  bool try_lock(InputIterator first, InputIterator last)
+  {
+    return try_lock<no_spin>(get_grid_index(first, last));
+  }
+
+  void unlock(int cell_index)
+  {
+    // Unlock lock and shared grid
+    unlock_cell(cell_index);
+    get_thread_local_grid()[cell_index] = false;
+  }
+
+  void unlock_all_points_locked_by_this_thread()
+  {
+    std::vector<int> &tls_locked_cells = m_tls_locked_cells.local();
+    for (int cell_index : tls_locked_cells)
+    {
+      // If we still own the lock
+      if (get_thread_local_grid()[cell_index] == true)
+        unlock(cell_index);
+    }
+    tls_locked_cells.clear();
+  }
+
+  void unlock_all_tls_locked_cells_but_one(int cell_index_to_keep_locked)
+  {
+    std::vector<int> &tls_locked_cells = m_tls_locked_cells.local();
+    bool cell_to_keep_found = false;
+    for (int cell_index : tls_locked_cells)
+    {
+      // If we still own the lock
+      if (get_thread_local_grid()[cell_index] == true)
+      {
+        if (cell_index == cell_index_to_keep_locked)
+          cell_to_keep_found = true;
+        else
+          unlock(cell_index);
+      }
+    }
+    tls_locked_cells.clear();
+    if (cell_to_keep_found)
+      tls_locked_cells.push_back(cell_index_to_keep_locked);
+  }
+
+  template <typename InputIterator>
+  void unlock_all_tls_locked_locations_but_one_point(InputIterator first, InputIterator last)
+  {
+    unlock_all_tls_locked_cells_but_one(get_grid_index(first, last));
+  }
+
+  bool check_if_all_cells_are_unlocked()
+  {
+    bool unlocked = true;
+    for (int i = 0 ; unlocked && i < m_num_cells ; ++i)
+      unlocked = !is_cell_locked(i);
+    return unlocked;
+  }
+
+  bool check_if_all_tls_cells_are_unlocked()
+  {
+    bool unlocked = true;
+    for (int i = 0 ; unlocked && i < m_num_cells ; ++i)
+      unlocked = (get_thread_local_grid()[i] == false);
+    return unlocked;
+  }
+
+protected:
+
+  static int compute_number_of_cells(int dimension, int num_grid_cells_per_axis)
+  {
+    long long num_cells = 1;
+    for (int i = 0 ; i < dimension ; ++i)
+    {
+      num_cells *= num_grid_cells_per_axis;
+      CGAL_precondition_msg(num_cells <= (std::numeric_limits<int>::max)(),
+                            "too many cells in the lock grid");
+    }
+    return static_cast<int>(num_cells);
+  }
+
+  // Constructor
+  template <typename InputIterator>
+  Spatial_lock_grid_base_d(InputIterator min_first, InputIterator min_last,
+                           InputIterator max_first, int num_grid_cells_per_axis)
+    : m_num_grid_cells_per_axis(num_grid_cells_per_axis),
+      m_num_cells(compute_number_of_cells(static_cast<int>(std::distance(min_first, min_last)),
+                                          num_grid_cells_per_axis)),
+      m_tls_grids([this](){ return init_TLS_grid(m_num_cells); })
+  {
+    set_bbox(min_first, min_last, max_first);
+  }
+
+  /// Destructor
+  ~Spatial_lock_grid_base_d()
+  {
+    for( typename TLS_grid::iterator it_grid = m_tls_grids.begin() ;
+         it_grid != m_tls_grids.end() ;
+         ++it_grid )
+    {
+      delete [] *it_grid;
+    }
+  }
+
+  template <typename InputIterator>
+  int get_grid_index(InputIterator first, InputIterator last) const
+  {
+    int index = 0;
+    // row-major order, the first coordinate varying fastest
+    int stride = 1;
+    for (std::size_t i = 0 ; first != last && i < m_min.size() ; ++i, ++first)
+    {
+      int axis_index = static_cast<int>((CGAL::to_double(*first) - m_min[i]) * m_resolution[i]);
+      axis_index = (std::max)(0, (std::min)(axis_index, m_num_grid_cells_per_axis - 1));
+      index += axis_index * stride;
+      stride *= m_num_grid_cells_per_axis;
+    }
+    return index;
+  }
+
+  bool is_cell_locked(int cell_index)
+  {
+    return static_cast<Derived*>(this)->is_cell_locked_impl(cell_index);
+  }
+
+  bool try_lock_cell(int cell_index)
+  {
+    return try_lock_cell<false>(cell_index);
+  }
+
+  template <bool no_spin>
+  bool try_lock_cell(int cell_index)
+  {
+    return static_cast<Derived*>(this)
+      ->template try_lock_cell_impl<no_spin>(cell_index);
+  }
+
+  void unlock_cell(int cell_index)
+  {
+    static_cast<Derived*>(this)->unlock_cell_impl(cell_index);
+  }
+
+  int                                             m_num_grid_cells_per_axis;
+  int                                             m_num_cells;
+  std::vector<double>                             m_min;
+  std::vector<double>                             m_resolution;
+
+  // TLS
+  typedef tbb::enumerable_thread_specific<
+    bool*,
+    tbb::cache_aligned_allocator<bool*>,
+    tbb::ets_key_per_instance>                               TLS_grid;
+  typedef tbb::enumerable_thread_specific<std::vector<int> > TLS_locked_cells;
+
+  TLS_grid                                        m_tls_grids;
+  TLS_locked_cells                                m_tls_locked_cells;
+};
+
+
+//*****************************************************************************
+// class Spatial_lock_grid_d
+//*****************************************************************************
+template <typename Grid_lock_tag = Tag_priority_blocking>
+class Spatial_lock_grid_d;
+
+
+//*****************************************************************************
+// class Spatial_lock_grid_d<Tag_non_blocking>
+//*****************************************************************************
+template <>
+class Spatial_lock_grid_d<Tag_non_blocking>
+  : public Spatial_lock_grid_base_d<Spatial_lock_grid_d<Tag_non_blocking> >
+{
+  typedef Spatial_lock_grid_base_d<
+    Spatial_lock_grid_d<Tag_non_blocking> > Base;
+
+public:
+  // Constructors
+  // [min_first, min_last) and max_first are the ranges of the minimal and
+  // maximal coordinates of the bounding box of the grid
+  template <typename InputIterator>
+  Spatial_lock_grid_d(InputIterator min_first, InputIterator min_last,
+                      InputIterator max_first, int num_grid_cells_per_axis)
+  : Base(min_first, min_last, max_first, num_grid_cells_per_axis),
+    m_grid(m_num_cells)
+  {
+    for (std::atomic<bool>& cell : m_grid)
+      cell = false;
+  }
+
+  bool is_cell_locked_impl(int cell_index)
+  {
+    return (m_grid[cell_index] == true);
+  }
+
+  template <bool no_spin>
+  bool try_lock_cell_impl(int cell_index)
+  {
+    bool v1 = true, v2 = false;
+    if(m_grid[cell_index].compare_exchange_strong(v2,v1))
+    {
+      get_thread_local_grid()[cell_index] = true;
+      m_tls_locked_cells.local().push_back(cell_index);
+      return true;
+    }
+    return false;
+  }
+
+  void unlock_cell_impl(int cell_index)
+  {
+    m_grid[cell_index] = false;
+  }
+
+protected:
+
+  std::vector<std::atomic<bool> > m_grid;
+};
+
+
+//*****************************************************************************
+// class Spatial_lock_grid_d<Tag_priority_blocking>
+//*****************************************************************************
+
+template <>
+class Spatial_lock_grid_d<Tag_priority_blocking>
+  : public Spatial_lock_grid_base_d<Spatial_lock_grid_d<Tag_priority_blocking> >
+{
+  typedef Spatial_lock_grid_base_d<
+    Spatial_lock_grid_d<Tag_priority_blocking> > Base;
+
+public:
+  // Constructors
+  // [min_first, min_last) and max_first are the ranges of the minimal and
+  // maximal coordinates of the bounding box of the grid
+  template <typename InputIterator>
+  Spatial_lock_grid_d(InputIterator min_first, InputIterator min_last,
+                      InputIterator max_first, int num_grid_cells_per_axis)
+  : Base(min_first, min_last, max_first, num_grid_cells_per_axis),
+    m_grid(m_num_cells),
+    m_tls_thread_priorities(init_TLS_thread_priorities)
+  {
+    // Explicitly initialize the atomics
+    for (std::atomic<unsigned int>& cell : m_grid)
+      cell = 0;
+  }
+
+  bool is_cell_locked_impl(int cell_index)
+  {
+    return (m_grid[cell_index] != 0);
+  }
+
+  template <bool no_spin>
+  bool try_lock_cell_impl(int cell_index)
+  {
+    unsigned int this_thread_priority = m_tls_thread_priorities.local();
+
+    // NO SPIN
+    if (no_spin)
+    {
+      unsigned int old_value = 0;
+      if(m_grid[cell_index].compare_exchange_strong(old_value, this_thread_priority))
+      {
+        get_thread_local_grid()[cell_index] = true;
+        m_tls_locked_cells.local().push_back(cell_index);
+        return true;
+      }
+    }
+    // SPIN
+    else
+    {
+      for(;;)
+      {
+        unsigned int old_value = 0;
+        if(m_grid[cell_index].compare_exchange_weak(old_value, this_thread_priority))
+        {
+          get_thread_local_grid()[cell_index] = true;
+          m_tls_locked_cells.local().push_back(cell_index);
+          return true;
+        }
+        else if (old_value > this_thread_priority)
+        {
+          // Another "more priority" thread owns the lock, we back off
+          return false;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    return false;
+  }
+
+  void unlock_cell_impl(int cell_index)
+  {
+    m_grid[cell_index] = 0;
+  }
+
+private:
+  static unsigned int init_TLS_thread_priorities()
+  {
+    static std::atomic<unsigned int> last_id;
+    unsigned int id = ++last_id;
+    // Ensure it is > 0
+    return (1 + id%((std::numeric_limits<unsigned int>::max)()));
+  }
+
+protected:
+
+  std::vector<std::atomic<unsigned int> >               m_grid;
+
+  typedef tbb::enumerable_thread_specific<unsigned int> TLS_thread_uint_ids;
+  TLS_thread_uint_ids                                   m_tls_thread_priorities;
+};
+
+} //namespace CGAL
+
+#else // !CGAL_LINKED_WITH_TBB
+
+namespace CGAL {
+
+template <typename Grid_lock_tag = void>
+class Spatial_lock_grid_d
+{
+};
+
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+#endif // CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_D_H
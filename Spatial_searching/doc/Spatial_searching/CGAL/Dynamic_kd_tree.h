@@ -0,0 +1,168 @@
+namespace CGAL {
+
+/*!
+\ingroup SearchClasses
+
+The class `Dynamic_kd_tree` defines a `k-d` tree supporting insertions
+and removals of points in amortized logarithmic time, without rebuilding
+the whole tree.
+
+It implements the logarithmic method of Bentley and Saxe: the points
+are stored in a small insertion buffer and in a sequence of static
+`Kd_tree`s whose capacities double from one to the next. When the buffer
+is full, its points are merged with the ones of the smallest trees into a
+new tree. A removed point is dropped from its tree, which is rebuilt
+once it has lost half of its points. Queries are answered by all the
+trees; as their sizes grow geometrically, the query time is close to the
+one of a single `Kd_tree`, and `rebuild()` gathers all the points in a
+single tree.
+
+\tparam Traits must be a model of the concept `SearchTraits`.
+\tparam Splitter must be a model for the concept `Splitter`.
+It defaults to `Sliding_midpoint<Traits>`.
+\tparam UseExtendedNode must be `Tag_true`, if the trees shall be built
+with extended nodes, and `Tag_false` otherwise.
+
+\sa `CGAL::Kd_tree<Traits, Splitter, UseExtendedNode, EnablePointsCache>`
+*/
+template< typename Traits, typename Splitter, typename UseExtendedNode >
+class Dynamic_kd_tree {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+Point class.
+*/
+typedef Traits::Point_d Point_d;
+
+/*!
+Number type.
+*/
+typedef Traits::FT FT;
+
+/*!
+Type of the static trees.
+*/
+typedef Kd_tree<Traits, Splitter, UseExtendedNode, Tag_false> Tree;
+
+/*!
+Pair of a point and of its transformed distance to a query item.
+*/
+typedef std::pair<Point_d, FT> Point_with_transformed_distance;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+Constructs an empty tree. When `buffer_capacity` points have been
+inserted since the last merge, they are merged in a static tree.
+*/
+Dynamic_kd_tree(Splitter s = Splitter(), Traits t = Traits(),
+                std::size_t buffer_capacity = 64);
+
+/*!
+Constructs a tree on the elements from the sequence `[first, beyond)`.
+The value type of the `InputIterator` must be `Point_d`.
+*/
+template <class InputIterator>
+Dynamic_kd_tree(InputIterator first, InputIterator beyond,
+                Splitter s = Splitter(), Traits t = Traits(),
+                std::size_t buffer_capacity = 64);
+
+/// @}
+
+/// \name Operations
+/// @{
+
+/*!
+Inserts the point `p`.
+*/
+void insert(Point_d p);
+
+/*!
+Inserts the elements from the sequence `[first, beyond)`.
+*/
+template <class InputIterator> void insert(InputIterator first, InputIterator beyond);
+
+/*!
+Removes a point identified by `identify_point`, a unary functor that takes
+a `Point_d` and returns a `bool`, as in `Kd_tree::remove()`.
+Returns `true` if a point was removed.
+*/
+template<class IdentifyPoint>
+bool remove(Point_d p, IdentifyPoint identify_point);
+
+/*!
+Removes a point with the same coordinates as `p`.
+Returns `true` if a point was removed.
+*/
+bool remove(Point_d p);
+
+/*!
+Gathers all the points in a single static tree.
+*/
+void rebuild();
+
+/*!
+Removes all the points.
+*/
+void clear();
+
+/*!
+Writes all the points to `it`, in no particular order.
+*/
+template <class OutputIterator>
+OutputIterator points(OutputIterator it) const;
+
+/*!
+Reports the points that are approximately contained by `q`.
+The types `FuzzyQueryItem::Point_d` and `Point_d` must be equivalent.
+*/
+template <class OutputIterator, class FuzzyQueryItem>
+OutputIterator search(OutputIterator it, FuzzyQueryItem q) const;
+
+/*!
+Reports any point that is approximately contained by `q`.
+*/
+template <class FuzzyQueryItem>
+std::optional<Point_d> search_any_point(FuzzyQueryItem q) const;
+
+/*!
+Writes the `k` nearest neighbors of `q`, with their transformed distance
+to `q`, sorted by increasing distance, as `Point_with_transformed_distance`
+objects. Each static tree is searched with
+`Orthogonal_k_neighbor_search<Traits, Distance, Splitter, Tree>`.
+`Distance` must be a model of the concept `OrthogonalDistance`.
+*/
+template <class Distance, class OutputIterator>
+OutputIterator k_neighbors(Distance::Query_item q, unsigned int k,
+                           OutputIterator it, Distance d = Distance()) const;
+
+/*!
+Returns the number of points.
+*/
+std::size_t size() const;
+
+/*!
+Returns `true` if there is no point.
+*/
+bool empty() const;
+
+/*!
+Returns the number of static trees storing points.
+*/
+std::size_t number_of_trees() const;
+
+/*!
+Returns a const reference to the traits class object.
+*/
+const Traits& traits() const;
+
+/// @}
+
+}; /* end Dynamic_kd_tree */
+} /* end namespace CGAL */
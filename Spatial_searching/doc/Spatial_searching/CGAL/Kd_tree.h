@@ -172,6 +172,19 @@ that simply compares coordinates.
 */
 void remove(Point_d p);
 
+/*!
+Same as `remove(p, identify_point)`, except that `p` may not be in the
+`k-d` tree. Returns `true` if a point was removed.
+*/
+template<class IdentifyPoint>
+bool try_remove(Point_d p, IdentifyPoint identify_point);
+
+/*!
+Same as `remove(p)`, except that `p` may not be in the `k-d` tree.
+Returns `true` if a point was removed.
+*/
+bool try_remove(Point_d p);
+
 /*
 Pre-allocates memory in order to store at least 'size' points.
 */
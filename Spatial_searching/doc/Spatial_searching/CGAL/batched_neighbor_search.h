@@ -0,0 +1,65 @@
+namespace CGAL {
+
+/*!
+\ingroup BatchedSearchFunctions
+
+The function `batched_k_neighbor_search()` computes the `k` nearest
+neighbors in `tree` of each point of the range `[first, beyond)`, as
+`Orthogonal_k_neighbor_search` would for each of them.
+
+The neighbors are written into a compressed sparse row graph: the
+neighbors of the `i`-th query point, sorted by increasing distance,
+are `neighbors[offsets[i]]`, ..., `neighbors[offsets[i+1]-1]`.
+`offsets` has one more element than the number of query points.
+With parallelism enabled, the neighbors are first gathered in
+per-thread buffers, then copied in the flat `neighbors` array.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam Tree must be a `Kd_tree`.
+\tparam QueryIterator must be a model of `InputIterator`, and of
+`RandomAccessIterator` if parallelism is enabled, with a value type
+that is the query item type of `Orthogonal_k_neighbor_search`.
+\tparam Distance must be a model of the concept `OrthogonalDistance`.
+It defaults to the default distance of `Tree::Traits`.
+
+\param eps the approximation factor, as in `Orthogonal_k_neighbor_search`.
+*/
+template <class ConcurrencyTag = Sequential_tag, class Tree, class QueryIterator, class Distance>
+void batched_k_neighbor_search(const Tree& tree,
+                               QueryIterator first, QueryIterator beyond,
+                               unsigned int k,
+                               std::vector<std::size_t>& offsets,
+                               std::vector<Tree::Point_d>& neighbors,
+                               const Distance& distance = Distance(),
+                               Tree::FT eps = 0);
+
+/*!
+\ingroup BatchedSearchFunctions
+
+The function `batched_radius_search()` computes the points of `tree`
+in the sphere of radius `radius` centered at each point of the range
+`[first, beyond)`, as `Kd_tree::search()` would with a `Fuzzy_sphere`.
+
+The neighbors are written into a compressed sparse row graph, as in
+`batched_k_neighbor_search()`, except that the neighbors of a query point
+are not sorted.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam Tree must be a `Kd_tree`.
+\tparam QueryIterator must be a model of `InputIterator`, and of
+`RandomAccessIterator` if parallelism is enabled, with a value type
+that is the center type of `Fuzzy_sphere<Tree::Traits>`.
+
+\param eps the approximation factor, as in `Fuzzy_sphere`.
+*/
+template <class ConcurrencyTag = Sequential_tag, class Tree, class QueryIterator>
+void batched_radius_search(const Tree& tree,
+                           QueryIterator first, QueryIterator beyond,
+                           Tree::FT radius,
+                           std::vector<std::size_t>& offsets,
+                           std::vector<Tree::Point_d>& neighbors,
+                           Tree::FT eps = 0);
+
+} // namespace CGAL
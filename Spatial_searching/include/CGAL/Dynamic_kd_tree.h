@@ -0,0 +1,338 @@
+// Copyright (c) 2023 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Clement Jamin (clement.jamin.pro@gmail.com)
+
+#ifndef CGAL_DYNAMIC_KD_TREE_H
+#define CGAL_DYNAMIC_KD_TREE_H
+
+#include <CGAL/license/Spatial_searching.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/Kd_tree.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Splitters.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+/*
+  A kd-tree supporting insertions and removals in amortized logarithmic
+  time, with the logarithmic method of Bentley and Saxe.
+
+  The points are stored in a small insertion buffer and in a sequence of
+  static `Kd_tree`s, the i-th one holding at most
+  `buffer_capacity * 2^i` points. When the buffer is full, its points
+  and the ones of the trees before the first empty slot large enough
+  are gathered in a new tree put in that slot, like a binary counter.
+  Removing a point drops it from its tree, which is rebuilt once it has
+  lost half of its points.
+
+  Queries are answered by all the trees and the buffer; as the sizes of
+  the trees grow geometrically, the largest one dominates the query time.
+  `rebuild()` gathers all the points in a single tree.
+*/
+template <
+  class SearchTraits,
+  class Splitter_=Sliding_midpoint<SearchTraits>,
+  class UseExtendedNode = Tag_true>
+class Dynamic_kd_tree {
+
+public:
+  typedef SearchTraits Traits;
+  typedef Splitter_ Splitter;
+  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, Tag_false> Tree;
+  typedef typename SearchTraits::Point_d Point_d;
+  typedef typename SearchTraits::FT FT;
+  typedef std::size_t size_type;
+  typedef std::pair<Point_d, FT> Point_with_transformed_distance;
+
+private:
+  SearchTraits traits_;
+  Splitter split;
+  size_type buffer_capacity_;
+
+  // Points inserted since the last gathering, searched linearly
+  std::vector<Point_d> buffer;
+
+  // trees[i] is either null or holds at most `buffer_capacity_ * 2^i` points.
+  // built_sizes[i] is its number of points when it was built.
+  std::vector<std::unique_ptr<Tree> > trees;
+  std::vector<size_type> built_sizes;
+
+  size_type size_;
+
+  // no copy, as Kd_tree
+  Dynamic_kd_tree(const Dynamic_kd_tree&);
+
+  struct Equal_by_coordinates {
+    SearchTraits const* traits;
+    Point_d const* pp;
+    bool operator()(Point_d const&q) const {
+      typename SearchTraits::Construct_cartesian_const_iterator_d ccci=traits->construct_cartesian_const_iterator_d_object();
+      return std::equal(ccci(*pp), ccci(*pp,0), ccci(q));
+    }
+  };
+
+  // Appends the points of the i-th tree to `points` and removes the tree
+  void gather_tree(size_type i, std::vector<Point_d>& points)
+  {
+    if(trees[i]->size() != 0)
+      trees[i]->root()->tree_items(std::back_inserter(points));
+    trees[i].reset();
+    built_sizes[i] = 0;
+  }
+
+  void make_tree(size_type i, const std::vector<Point_d>& points)
+  {
+    CGAL_assertion(!trees[i]);
+    if(points.empty())
+      return;
+    trees[i].reset(new Tree(points.begin(), points.end(), split, traits_));
+    trees[i]->build();
+    built_sizes[i] = points.size();
+  }
+
+  // Moves the points of the buffer to the first empty slot that is large
+  // enough for them and the points of the trees before it.
+  void flush_buffer()
+  {
+    size_type count = buffer.size();
+    size_type i = 0;
+    for(;; ++i){
+      if(i == trees.size()){
+        trees.emplace_back();
+        built_sizes.push_back(0);
+      }
+      if(!trees[i] && count <= (buffer_capacity_ << i))
+        break;
+      if(trees[i])
+        count += trees[i]->size();
+    }
+
+    std::vector<Point_d> points;
+    points.swap(buffer);
+    points.reserve(count);
+    for(size_type j = 0; j < i; ++j)
+      if(trees[j])
+        gather_tree(j, points);
+    make_tree(i, points);
+  }
+
+public:
+
+  Dynamic_kd_tree(Splitter s = Splitter(), const SearchTraits traits = SearchTraits(),
+                  size_type buffer_capacity = 64)
+    : traits_(traits), split(s), buffer_capacity_((std::max)(buffer_capacity, size_type(1))),
+      size_(0)
+  {}
+
+  template <class InputIterator>
+  Dynamic_kd_tree(InputIterator first, InputIterator beyond,
+                  Splitter s = Splitter(), const SearchTraits traits = SearchTraits(),
+                  size_type buffer_capacity = 64)
+    : traits_(traits), split(s), buffer_capacity_((std::max)(buffer_capacity, size_type(1))),
+      size_(0)
+  {
+    insert(first, beyond);
+  }
+
+  const SearchTraits&
+  traits() const
+  {
+    return traits_;
+  }
+
+  size_type
+  size() const
+  {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  // Number of static trees currently storing points
+  size_type
+  number_of_trees() const
+  {
+    return static_cast<size_type>(
+      std::count_if(trees.begin(), trees.end(),
+                    [](const std::unique_ptr<Tree>& t) { return bool(t); }));
+  }
+
+  void clear()
+  {
+    buffer.clear();
+    trees.clear();
+    built_sizes.clear();
+    size_ = 0;
+  }
+
+  void
+  insert(const Point_d& p)
+  {
+    buffer.push_back(p);
+    ++size_;
+    if(buffer.size() >= buffer_capacity_)
+      flush_buffer();
+  }
+
+  template <class InputIterator>
+  void
+  insert(InputIterator first, InputIterator beyond)
+  {
+    size_type n = buffer.size();
+    buffer.insert(buffer.end(), first, beyond);
+    size_ += buffer.size() - n;
+    if(buffer.size() >= buffer_capacity_)
+      flush_buffer();
+  }
+
+  // Removes a point equal to `p`, if any. Returns whether a point was removed.
+  bool
+  remove(const Point_d& p)
+  {
+    Equal_by_coordinates equal_to_p = { &traits_, &p };
+    return remove(p, equal_to_p);
+  }
+
+  template<class Equal>
+  bool
+  remove(const Point_d& p, Equal const& equal_to_p)
+  {
+    typename std::vector<Point_d>::iterator pi =
+      std::find_if(buffer.begin(), buffer.end(), equal_to_p);
+    if(pi != buffer.end()){
+      std::iter_swap(pi, buffer.end() - 1);
+      buffer.pop_back();
+      --size_;
+      return true;
+    }
+
+    for(size_type i = 0; i < trees.size(); ++i){
+      if(!trees[i] || !trees[i]->try_remove(p, equal_to_p))
+        continue;
+      --size_;
+      // Rebuild the tree once it has lost half of its points, so that the
+      // removed points do not slow the queries down.
+      if(2 * trees[i]->size() <= built_sizes[i]){
+        std::vector<Point_d> points;
+        gather_tree(i, points);
+        make_tree(i, points);
+      }
+      return true;
+    }
+    return false;
+  }
+
+  // Gathers all the points in a single tree, as a freshly built Kd_tree
+  void rebuild()
+  {
+    std::vector<Point_d> points;
+    points.swap(buffer);
+    points.reserve(size_);
+    for(size_type i = 0; i < trees.size(); ++i)
+      if(trees[i])
+        gather_tree(i, points);
+    trees.clear();
+    built_sizes.clear();
+
+    size_type i = 0;
+    while((buffer_capacity_ << i) < points.size())
+      ++i;
+    trees.resize(i + 1);
+    built_sizes.resize(i + 1, 0);
+    make_tree(i, points);
+  }
+
+  template <class OutputIterator>
+  OutputIterator
+  points(OutputIterator it) const
+  {
+    it = std::copy(buffer.begin(), buffer.end(), it);
+    for(const std::unique_ptr<Tree>& t : trees)
+      if(t && t->size() != 0)
+        it = t->root()->tree_items(it);
+    return it;
+  }
+
+  template <class OutputIterator, class FuzzyQueryItem>
+  OutputIterator
+  search(OutputIterator it, const FuzzyQueryItem& q) const
+  {
+    for(const Point_d& p : buffer)
+      if(q.contains(p))
+        *it++ = p;
+    for(const std::unique_ptr<Tree>& t : trees)
+      if(t && t->size() != 0)
+        it = t->search(it, q);
+    return it;
+  }
+
+  template <class FuzzyQueryItem>
+  std::optional<Point_d>
+  search_any_point(const FuzzyQueryItem& q) const
+  {
+    for(const Point_d& p : buffer)
+      if(q.contains(p))
+        return p;
+    for(const std::unique_ptr<Tree>& t : trees){
+      if(t && t->size() != 0){
+        std::optional<Point_d> result = t->search_any_point(q);
+        if(result)
+          return result;
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Writes the `k` nearest neighbors of `q`, with their transformed
+  // distance to `q`, sorted by increasing distance. Each tree is searched
+  // with Orthogonal_k_neighbor_search.
+  template <class Distance = typename internal::Spatial_searching_default_distance<SearchTraits>::type,
+            class OutputIterator>
+  OutputIterator
+  k_neighbors(const typename Distance::Query_item& q, unsigned int k,
+              OutputIterator it, const Distance& distance = Distance()) const
+  {
+    typedef Orthogonal_k_neighbor_search<SearchTraits, Distance, Splitter, Tree> Neighbor_search;
+
+    std::vector<Point_with_transformed_distance> candidates;
+    for(const Point_d& p : buffer)
+      candidates.push_back(std::make_pair(p, distance.transformed_distance(q, p)));
+    for(const std::unique_ptr<Tree>& t : trees){
+      if(t && t->size() != 0){
+        Neighbor_search search(*t, q, k, FT(0), true, distance);
+        candidates.insert(candidates.end(), search.begin(), search.end());
+      }
+    }
+
+    typename std::vector<Point_with_transformed_distance>::iterator last =
+      candidates.begin() + (std::min)(candidates.size(), std::size_t(k));
+    std::partial_sort(candidates.begin(), last, candidates.end(),
+                      [](const Point_with_transformed_distance& a,
+                         const Point_with_transformed_distance& b)
+                      { return a.second < b.second; });
+    return std::copy(candidates.begin(), last, it);
+  }
+};
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_DYNAMIC_KD_TREE_H
@@ -20,6 +20,7 @@
 
 #include <CGAL/basic.h>
 #include <CGAL/assertions.h>
+#include <CGAL/use.h>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -508,12 +509,31 @@ public:
       return;
     }
 #endif
-    bool success = remove_(p, 0, false, 0, false, root(), equal_to_p);
+    bool success = try_remove(p, equal_to_p);
     CGAL_assertion(success);
+    CGAL_USE(success);
+  }
+
+  // Same as remove(), but `p` may not be in the tree.
+  // Returns whether a point was removed.
+  bool
+  try_remove(const Point_d& p)
+  {
+    return try_remove(p, equal_by_coordinates(p));
+  }
+
+  template<class Equal>
+  bool
+  try_remove(const Point_d& p, Equal const& equal_to_p)
+  {
+    if(size() == 0)
+      return false;
+    bool success = remove_(p, 0, false, 0, false, root(), equal_to_p);
 
     // Do not set the flag is the tree has been cleared.
     if(is_built() && success)
       ++removed_;
+    return success;
   }
 private:
   template<class Equal>
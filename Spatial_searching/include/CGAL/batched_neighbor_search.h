@@ -0,0 +1,208 @@
+// Copyright (c) 2023 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : Clement Jamin (clement.jamin.pro@gmail.com)
+
+#ifndef CGAL_BATCHED_NEIGHBOR_SEARCH_H
+#define CGAL_BATCHED_NEIGHBOR_SEARCH_H
+
+#include <CGAL/license/Spatial_searching.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Fuzzy_sphere.h>
+#include <CGAL/tags.h>
+
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/enumerable_thread_specific.h>
+#  include <tbb/parallel_for.h>
+#endif
+
+namespace CGAL {
+namespace internal {
+
+// Calls `search_one(q, out)` for each query point `q` of [first, beyond),
+// where `out` is an output iterator to which the neighbors of `q` are written,
+// and stores the result as a compressed sparse row graph: the neighbors of
+// the i-th query point are
+// `neighbors[offsets[i]] ... neighbors[offsets[i+1]-1]`.
+template <typename ConcurrencyTag,
+          typename QueryIterator, typename SearchOne, typename Point_d>
+void batched_neighbor_search(QueryIterator first, QueryIterator beyond,
+                             const SearchOne& search_one,
+                             std::vector<std::size_t>& offsets,
+                             std::vector<Point_d>& neighbors)
+{
+  const std::size_t n = static_cast<std::size_t>(std::distance(first, beyond));
+  offsets.assign(n + 1, 0);
+  neighbors.clear();
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    // First pass: each thread appends the neighbors of its query points to
+    // its own scratch buffer, which is reused from one query to the next.
+    typedef std::vector<Point_d> Buffer;
+    tbb::enumerable_thread_specific<Buffer> buffers;
+    std::vector<std::pair<const Buffer*, std::size_t> > location(n);
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      Buffer& buffer = buffers.local();
+      for (std::size_t i = r.begin(); i != r.end(); ++i)
+      {
+        const std::size_t start = buffer.size();
+        search_one(first[i], std::back_inserter(buffer));
+        location[i] = std::make_pair(&buffer, start);
+        offsets[i+1] = buffer.size() - start;
+      }
+    });
+
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    neighbors.resize(offsets[n]);
+
+    // Second pass: gather the buffers into the flat neighbor array
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for (std::size_t i = r.begin(); i != r.end(); ++i)
+        std::copy_n(location[i].first->begin() + location[i].second,
+                    offsets[i+1] - offsets[i],
+                    neighbors.begin() + offsets[i]);
+    });
+    return;
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
+  std::size_t i = 0;
+  for (; first != beyond; ++first)
+  {
+    search_one(*first, std::back_inserter(neighbors));
+    offsets[++i] = neighbors.size();
+  }
+}
+
+} // namespace internal
+
+/*
+  Computes the `k` nearest neighbors in `tree` of each point of the
+  range [`first`, `beyond`), with `Orthogonal_k_neighbor_search`.
+
+  The result is stored as a compressed sparse row graph: the neighbors
+  of the i-th query point, sorted by increasing distance, are
+  `neighbors[offsets[i]] ... neighbors[offsets[i+1]-1]`, and
+  `offsets` has one more element than the number of query points.
+
+  \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  Possible values are `Sequential_tag`, `Parallel_tag`, and
+  `Parallel_if_available_tag`. With parallelism enabled, `QueryIterator`
+  must be a random access iterator.
+*/
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Tree, typename QueryIterator, typename Distance>
+void batched_k_neighbor_search(const Tree& tree,
+                               QueryIterator first, QueryIterator beyond,
+                               unsigned int k,
+                               std::vector<std::size_t>& offsets,
+                               std::vector<typename Tree::Point_d>& neighbors,
+                               const Distance& distance,
+                               typename Tree::FT eps = typename Tree::FT(0))
+{
+  typedef typename Tree::Traits                                 Traits;
+  typedef Orthogonal_k_neighbor_search<Traits, Distance,
+                                       typename Tree::Splitter, Tree> Neighbor_search;
+  typedef typename std::iterator_traits<QueryIterator>::value_type Query_item;
+
+  // build the tree once, before the queries are spread among threads
+  if (!tree.empty())
+    tree.root();
+
+  internal::batched_neighbor_search<ConcurrencyTag>(
+    first, beyond,
+    [&](const Query_item& q, auto out)
+    {
+      Neighbor_search search(tree, q, k, eps, true, distance);
+      for (const typename Neighbor_search::Point_with_transformed_distance& pd : search)
+        *out++ = pd.first;
+    },
+    offsets, neighbors);
+}
+
+/*
+  Same as above, with the default distance of the traits of `tree`.
+*/
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Tree, typename QueryIterator>
+void batched_k_neighbor_search(const Tree& tree,
+                               QueryIterator first, QueryIterator beyond,
+                               unsigned int k,
+                               std::vector<std::size_t>& offsets,
+                               std::vector<typename Tree::Point_d>& neighbors)
+{
+  typedef typename internal::Spatial_searching_default_distance<
+    typename Tree::Traits>::type Distance;
+  batched_k_neighbor_search<ConcurrencyTag>(tree, first, beyond, k,
+                                            offsets, neighbors, Distance());
+}
+
+/*
+  Computes the points of `tree` in the sphere of radius `radius`
+  centered at each point of the range [`first`, `beyond`), with
+  `Fuzzy_sphere`.
+
+  The result is stored as a compressed sparse row graph, as in
+  `batched_k_neighbor_search()`. The neighbors of a query point are
+  not sorted.
+
+  \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  Possible values are `Sequential_tag`, `Parallel_tag`, and
+  `Parallel_if_available_tag`. With parallelism enabled, `QueryIterator`
+  must be a random access iterator.
+*/
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Tree, typename QueryIterator>
+void batched_radius_search(const Tree& tree,
+                           QueryIterator first, QueryIterator beyond,
+                           typename Tree::FT radius,
+                           std::vector<std::size_t>& offsets,
+                           std::vector<typename Tree::Point_d>& neighbors,
+                           typename Tree::FT eps = typename Tree::FT(0))
+{
+  typedef Fuzzy_sphere<typename Tree::Traits>                      Sphere;
+  typedef typename std::iterator_traits<QueryIterator>::value_type Query_item;
+
+  if (!tree.empty())
+    tree.root();
+
+  internal::batched_neighbor_search<ConcurrencyTag>(
+    first, beyond,
+    [&](const Query_item& q, auto out)
+    {
+      tree.search(out, Sphere(q, radius, eps, tree.traits()));
+    },
+    offsets, neighbors);
+}
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_BATCHED_NEIGHBOR_SEARCH_H
@@ -0,0 +1,80 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Kd_tree.h>
+#include <CGAL/Fuzzy_sphere.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/batched_neighbor_search.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                        K;
+typedef K::Point_3                                            Point;
+typedef CGAL::Search_traits_3<K>                              Traits;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits>            Neighbor_search;
+typedef Neighbor_search::Tree                                 Tree;
+typedef CGAL::Fuzzy_sphere<Traits>                            Sphere;
+
+template <typename ConcurrencyTag>
+void test(const Tree& tree, const std::vector<Point>& queries)
+{
+  const unsigned int k = 8;
+  const double radius = 0.1;
+  std::vector<std::size_t> offsets;
+  std::vector<Point> neighbors;
+
+  CGAL::batched_k_neighbor_search<ConcurrencyTag>(tree, queries.begin(), queries.end(),
+                                                  k, offsets, neighbors);
+  assert(offsets.size() == queries.size() + 1);
+  assert(offsets.back() == neighbors.size());
+  for (std::size_t i = 0; i < queries.size(); ++i)
+  {
+    Neighbor_search search(tree, queries[i], k);
+    assert(offsets[i+1] - offsets[i] == k);
+    std::size_t j = offsets[i];
+    for (const Neighbor_search::Point_with_transformed_distance& pd : search)
+      assert(neighbors[j++] == pd.first);
+  }
+
+  CGAL::batched_radius_search<ConcurrencyTag>(tree, queries.begin(), queries.end(),
+                                              radius, offsets, neighbors);
+  assert(offsets.size() == queries.size() + 1);
+  assert(offsets.back() == neighbors.size());
+  for (std::size_t i = 0; i < queries.size(); ++i)
+  {
+    std::vector<Point> result;
+    tree.search(std::back_inserter(result), Sphere(queries[i], radius));
+    std::vector<Point> batched(neighbors.begin() + offsets[i],
+                               neighbors.begin() + offsets[i+1]);
+    std::sort(result.begin(), result.end());
+    std::sort(batched.begin(), batched.end());
+    assert(result == batched);
+  }
+
+  // Empty range of query points
+  CGAL::batched_k_neighbor_search<ConcurrencyTag>(tree, queries.end(), queries.end(),
+                                                  k, offsets, neighbors);
+  assert(offsets.size() == 1 && offsets[0] == 0 && neighbors.empty());
+}
+
+int main()
+{
+  CGAL::Random random(42);
+  CGAL::Random_points_in_cube_3<Point> gen(1.0, random);
+  std::vector<Point> points, queries;
+  std::copy_n(gen, 10000, std::back_inserter(points));
+  std::copy_n(gen, 1000, std::back_inserter(queries));
+
+  Tree tree(points.begin(), points.end());
+
+  test<CGAL::Sequential_tag>(tree, queries);
+#ifdef CGAL_LINKED_WITH_TBB
+  test<CGAL::Parallel_tag>(tree, queries);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Fuzzy_sphere.h>
+#include <CGAL/Dynamic_kd_tree.h>
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                        K;
+typedef K::Point_3                                            Point;
+typedef CGAL::Search_traits_3<K>                              Traits;
+typedef CGAL::Dynamic_kd_tree<Traits>                         Tree;
+typedef CGAL::Fuzzy_sphere<Traits>                            Sphere;
+
+// Compares the queries on the tree with a linear scan of `window`
+void check(const Tree& tree, const std::deque<Point>& window, const Point& q)
+{
+  assert(tree.size() == window.size());
+
+  std::vector<Point> result, expected;
+  tree.search(std::back_inserter(result), Sphere(q, 0.2));
+  for(const Point& p : window)
+    if(CGAL::squared_distance(p, q) <= 0.04)
+      expected.push_back(p);
+  std::sort(result.begin(), result.end());
+  std::sort(expected.begin(), expected.end());
+  assert(result == expected);
+  assert(bool(tree.search_any_point(Sphere(q, 0.2))) == !expected.empty());
+
+  const unsigned int k = 5;
+  std::vector<Tree::Point_with_transformed_distance> neighbors;
+  tree.k_neighbors(q, k, std::back_inserter(neighbors));
+  std::vector<double> distances;
+  for(const Point& p : window)
+    distances.push_back(CGAL::squared_distance(p, q));
+  std::sort(distances.begin(), distances.end());
+  assert(neighbors.size() == (std::min)(std::size_t(k), window.size()));
+  for(std::size_t i = 0; i < neighbors.size(); ++i)
+    assert(neighbors[i].second == distances[i]);
+}
+
+int main()
+{
+  CGAL::Random random(42);
+  CGAL::Random_points_in_cube_3<Point> gen(1.0, random);
+
+  // Moving window of a point stream: 1% of the points replaced at each step
+  const std::size_t N = 5000;
+  std::deque<Point> window;
+  std::copy_n(gen, N, std::back_inserter(window));
+  Tree tree(window.begin(), window.end());
+  check(tree, window, *gen++);
+
+  for(int step = 0; step < 50; ++step)
+  {
+    for(std::size_t i = 0; i < N / 100; ++i)
+    {
+      bool removed = tree.remove(window.front());
+      assert(removed);
+      window.pop_front();
+      window.push_back(*gen++);
+      tree.insert(window.back());
+    }
+    check(tree, window, *gen++);
+  }
+
+  // Removing a point which is not in the tree
+  assert(!tree.remove(Point(2, 2, 2)));
+
+  std::vector<Point> points;
+  tree.points(std::back_inserter(points));
+  assert(points.size() == window.size());
+
+  tree.rebuild();
+  assert(tree.number_of_trees() == 1);
+  check(tree, window, *gen++);
+
+  // Remove all the points
+  while(!window.empty())
+  {
+    bool removed = tree.remove(window.back());
+    assert(removed);
+    window.pop_back();
+  }
+  assert(tree.empty());
+  check(tree, window, *gen++);
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
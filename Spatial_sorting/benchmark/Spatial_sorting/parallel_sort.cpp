@@ -0,0 +1,71 @@
+// Times Hilbert, spatial and Morton sorting of random points in 3D,
+// sequentially and in parallel.
+// Usage: parallel_sort [number of points]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/morton_sort.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+template <class Sort>
+void bench(const char* name, const std::vector<Point_3>& points, const Sort& sort)
+{
+  std::vector<Point_3> v(points);
+  CGAL::Real_timer timer;
+  timer.start();
+  sort(v);
+  timer.stop();
+  std::cout << name << ": " << timer.time() << " sec" << std::endl;
+}
+
+template <class ConcurrencyTag>
+void run(const std::vector<Point_3>& points)
+{
+  bench("  hilbert_sort (median)", points, [](std::vector<Point_3>& v)
+  {
+    CGAL::hilbert_sort<ConcurrencyTag>(v.begin(), v.end(), CGAL::Hilbert_sort_median_policy());
+  });
+  bench("  hilbert_sort (middle)", points, [](std::vector<Point_3>& v)
+  {
+    CGAL::hilbert_sort<ConcurrencyTag>(v.begin(), v.end(), CGAL::Hilbert_sort_middle_policy());
+  });
+  bench("  spatial_sort         ", points, [](std::vector<Point_3>& v)
+  {
+    CGAL::spatial_sort<ConcurrencyTag>(v.begin(), v.end());
+  });
+  bench("  morton_sort          ", points, [](std::vector<Point_3>& v)
+  {
+    CGAL::morton_sort<ConcurrencyTag>(v.begin(), v.end());
+  });
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atol(argv[1]) : 10000000;
+
+  CGAL::Random random(42);
+  CGAL::Random_points_in_cube_3<Point_3> generator(1., random);
+  std::vector<Point_3> points;
+  points.reserve(n);
+  std::copy_n(generator, n, std::back_inserter(points));
+
+  std::cout << n << " points" << std::endl;
+  std::cout << "Sequential:" << std::endl;
+  run<CGAL::Sequential_tag>(points);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel:" << std::endl;
+  run<CGAL::Parallel_tag>(points);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -16,8 +16,9 @@ Possible values are \link CGAL::Hilbert_sort_median_policy `Hilbert_sort_median_
 
 \tparam ConcurrencyTag enables sequential versus parallel algorithm.
 Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
-With parallelism enabled, sorting will be performed using up to eight threads.
-Parallel sorting is available only when the median strategy policy (the default policy) is used.
+With parallelism enabled, the subranges created by the recursive subdivision are sorted
+concurrently, for both strategy policies.
+The result does not depend on the concurrency tag.
 */
 template< typename Traits, typename PolicyTag, typename ConcurrencyTag = Sequential_tag  >
 class Hilbert_sort_3 {
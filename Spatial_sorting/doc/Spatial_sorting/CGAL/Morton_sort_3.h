@@ -0,0 +1,47 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgSpatialSortingFunctionObjects
+
+The function object `Morton_sort_3` sorts iterator ranges of
+`Traits::Point_3` along a Z-order (Morton) curve. The points are snapped to
+a grid of \f$2^{21}\f$ cells per side covering their bounding box,
+and sorted by the interleaved bits of the coordinates of their cells
+with a radix sort. Points in the same cell keep their relative order.
+
+\tparam Traits must be a model of the concept `SpatialSortingTraits_3`,
+with coordinates convertible to `double` by `to_double()`.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The result does not depend on the concurrency tag.
+*/
+template< typename Traits, typename ConcurrencyTag = Sequential_tag >
+class Morton_sort_3 {
+public:
+
+/// \name Creation
+/// @{
+
+/*!
+constructs an instance with `traits` as traits class instance.
+`limit` is ignored, so that the class can replace `Hilbert_sort_3`.
+*/
+Morton_sort_3(const Traits &traits = Traits(), std::ptrdiff_t limit = 1);
+
+/// @}
+
+/// \name Operations
+/// @{
+
+/*!
+It sorts the range `[begin, end)`.
+\tparam InputPointIterator must be a model of `RandomAccessIterator` with value type `Traits::Point_3`.
+*/
+template <class InputPointIterator>
+void operator() (InputPointIterator begin, InputPointIterator end) const;
+
+/// @}
+
+}; /* end Morton_sort_3 */
+} /* end namespace CGAL */
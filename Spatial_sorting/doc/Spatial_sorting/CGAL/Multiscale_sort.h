@@ -11,8 +11,13 @@ Given a range of `n` points:
 stopping when there are fewer than `threshold` points.
 </OL>
 
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+With parallelism enabled, `Sort` is applied on the last points of a level
+while the algorithm recurses on the first ones.
+`Sort` must then be safe to call concurrently on disjoint ranges.
 */
-template< typename Sort >
+template< typename Sort, typename ConcurrencyTag = Sequential_tag >
 class Multiscale_sort {
 public:
 
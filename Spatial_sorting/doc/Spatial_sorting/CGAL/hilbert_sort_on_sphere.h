@@ -9,6 +9,10 @@ If input points are not close to the input sphere, this function still works, bu
 
 It sorts the range `[begin, end)` in place.
 
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+With parallelism enabled, the faces of the cube are sorted concurrently.
+
 \tparam InputPointIterator must be a model of `RandomAccessIterator` and
 `std::iterator_traits<InputPointIterator>::%value_type` must be convertible to `Traits::Point_3`.
 
@@ -32,7 +36,7 @@ Creates an instance of `Hilbert_sort_on_sphere<Traits, PolicyTag>`,
 and calls its `operator()`.
 
 */
-template <class InputPointIterator, class Traits, class PolicyTag>
+template <class ConcurrencyTag = Sequential_tag, class InputPointIterator, class Traits, class PolicyTag>
 void
 hilbert_sort_on_sphere( InputPointIterator begin,
                         InputPointIterator end,
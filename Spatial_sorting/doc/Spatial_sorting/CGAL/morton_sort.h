@@ -0,0 +1,42 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgSpatialSortingFunctions
+
+The function `morton_sort()` sorts an iterator range of points
+along a Z-order (Morton) curve.
+
+It sorts the range `[begin, end)` in place.
+The points are snapped to a regular grid covering their bounding box,
+and the interleaved bits of the coordinates of their cells are sorted with a radix sort.
+This is faster than `hilbert_sort()` on very large inputs, at the price of
+a curve with larger jumps between consecutive points.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The result does not depend on the concurrency tag.
+
+\tparam InputPointIterator must be a model of `RandomAccessIterator` and
+`std::iterator_traits<InputPointIterator>::%value_type` must be convertible to
+`Traits::Point_2` or `Traits::Point_3`.
+
+\tparam Traits must be a model for concept `SpatialSortingTraits_2` or `SpatialSortingTraits_3`,
+with coordinates convertible to `double` by `to_double()`.
+The default traits class `Default_traits` is the kernel in which the type
+`std::iterator_traits<InputPointIterator>::%value_type` is defined.
+
+\cgalHeading{Implementation}
+
+Creates an instance of
+`Morton_sort_2<Traits, ConcurrencyTag>` or
+`Morton_sort_3<Traits, ConcurrencyTag>`
+and calls its `operator()`.
+
+*/
+template <class ConcurrencyTag = Sequential_tag, class InputPointIterator, class Traits>
+void
+morton_sort( InputPointIterator begin,
+             InputPointIterator end,
+             const Traits& traits = Default_traits);
+
+} /* namespace CGAL */
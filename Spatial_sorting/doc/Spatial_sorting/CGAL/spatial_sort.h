@@ -12,9 +12,9 @@ It sorts the range `[begin, end)` in place.
 
 \tparam ConcurrencyTag enables sequential versus parallel algorithm.
 Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
-With parallelism enabled, sorting will be performed using up to four threads in 2D,
-and up to eight threads in 3D.
-Parallel sorting is available only when the median strategy policy (the default policy) is used.
+With parallelism enabled, the subranges created by the recursive subdivision are sorted
+concurrently, for both strategy policies and in any dimension.
+The result does not depend on the concurrency tag.
 
 \tparam InputPointIterator must be a model of `RandomAccessIterator` and
 `std::iterator_traits<InputPointIterator>::%value_type` must be convertible to
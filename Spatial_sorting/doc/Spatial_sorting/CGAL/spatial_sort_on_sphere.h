@@ -16,6 +16,10 @@ The input sphere is given by a squared radius and a center, parameter `sqr_radiu
 The default squared radius of the sphere is 1.0.
 The default center of the sphere is the origin (0,0,0).
 
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+With parallelism enabled, the faces of the cube are sorted concurrently.
+
 \tparam InputPointIterator must be a model of `RandomAccessIterator` and
 `std::iterator_traits<InputPointIterator>::%value_type` must be convertible to
 `Traits::Point_3`.
@@ -47,7 +51,7 @@ times the original size of the set, `Hilbert_sort_on_sphere_3` functor is applie
 second subset.
 
 */
-template <class InputPointIterator, class Traits, class PolicyTag>
+template <class ConcurrencyTag = Sequential_tag, class InputPointIterator, class Traits, class PolicyTag>
 void
 spatial_sort_on_sphere( InputPointIterator begin,
                         InputPointIterator end,
@@ -33,11 +33,11 @@ public:
 
 template <class K, class ConcurrencyTag>
 class Hilbert_sort_2<K, Hilbert_sort_middle_policy, ConcurrencyTag >
-  : public Hilbert_sort_middle_2<K>
+  : public Hilbert_sort_middle_2<K, ConcurrencyTag>
 {
 public:
   Hilbert_sort_2 (const K &k=K(), std::ptrdiff_t limit=1 )
-    : Hilbert_sort_middle_2<K> (k,limit)
+    : Hilbert_sort_middle_2<K, ConcurrencyTag> (k,limit)
   {}
 };
 
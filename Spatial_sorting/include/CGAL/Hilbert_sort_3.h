@@ -33,11 +33,11 @@ public:
 
 template <class K, class ConcurrencyTag >
 class Hilbert_sort_3<K, Hilbert_sort_middle_policy, ConcurrencyTag >
-  : public Hilbert_sort_middle_3<K>
+  : public Hilbert_sort_middle_3<K, ConcurrencyTag>
 {
 public:
   Hilbert_sort_3 (const K &k=K(), std::ptrdiff_t limit=1 )
-    : Hilbert_sort_middle_3<K> (k,limit)
+    : Hilbert_sort_middle_3<K, ConcurrencyTag> (k,limit)
   {}
 };
 
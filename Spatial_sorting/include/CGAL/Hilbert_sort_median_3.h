@@ -149,7 +149,7 @@ public:
 
     void operator()() const
     {
-      hs.recursive_sort<x,upx,upy,upz>(begin,end);
+      hs.template sort<x,upx,upy,upz>(begin,end,Parallel_tag());
     }
   };
 
@@ -206,7 +206,7 @@ public:
                            Recursive_sort<y, !upy,  upz, !upx, RandomAccessIterator>(*this, m6, m7),
                            Recursive_sort<z, !upz, !upx,  upy, RandomAccessIterator>(*this, m7, m8));
     } else {
-      recursive_sort<0, false, false, false>(begin, end);
+      recursive_sort<x, upx, upy, upz>(begin, end);
     }
 #endif
   }
@@ -13,11 +13,15 @@
 #define CGAL_HILBERT_SORT_MEDIAN_d_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
 #include <functional>
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <CGAL/Hilbert_sort_base.h>
+#include <CGAL/Spatial_sorting/internal/parallel_for_each.h>
 
 namespace CGAL {
 
@@ -43,7 +47,7 @@ struct Hilbert_cmp_d
 
 } // namespace internal
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_median_d
 {
 public:
@@ -92,24 +96,26 @@ public:
     places[0]=begin;
     places[nb_splits]=end;
 
+    // Large ranges are split and sorted concurrently
+    const bool parallel = std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+                          && (end - begin) > 2048; // 2^11, as in 3D
+
     int last_dir = (direction + nb_directions) % _dimension;
     int current_dir = direction;
     int current_level_step =nb_splits;
     do{
       int half_step = current_level_step/2;
-      int left=0;
-      int middle = half_step;
-      int right=current_level_step;
       bool orient = start[current_dir];
-      do{
+      internal::spatial_sort_for_each<ConcurrencyTag>
+        (nb_splits / current_level_step, parallel, [&](int i)
+      {
+        int left = i * current_level_step;
+        int middle = left + half_step;
+        int right = left + current_level_step;
         dir[middle]    = current_dir;
         places[middle] = internal::hilbert_split
-                         (places[left], places[right], Cmp (current_dir,orient,_k));
-        left =right;
-        right+=current_level_step;
-        middle+=current_level_step;
-        orient = ! orient;
-      }while( left< nb_splits);
+                         (places[left], places[right], Cmp (current_dir, (i % 2 == 0) ? orient : !orient, _k));
+      });
       current_level_step = half_step;
       current_dir = (current_dir +1) % _dimension;
     }while (current_dir != last_dir);
@@ -117,19 +123,48 @@ public:
     if ( end-begin < two_to_dim) return; // fewer than 2^dim points
 
     /////////////start recursive calls
-    last_dir = (direction + _dimension -1) % _dimension;
+    if (!parallel) {
+      for_each_subrange(dir, start, direction,
+                        [&](int i, const Starting_position& s, int d)
+                        {
+                          sort(places[i], places[i+1], s, d);
+                        });
+      return;
+    }
+
+    // Gather the arguments of the recursive calls, and make them concurrently
+    std::vector<std::pair<Starting_position, int> > calls(two_to_dim);
+    for_each_subrange(dir, start, direction,
+                      [&](int i, const Starting_position& s, int d)
+                      {
+                        calls[i] = std::make_pair(s, d);
+                      });
+    internal::spatial_sort_for_each<ConcurrencyTag>(two_to_dim, true, [&](int i)
+    {
+      sort(places[i], places[i+1], calls[i].first, calls[i].second);
+    });
+  }
+
+  // Calls `call(i, start, direction)` with the arguments of the recursive
+  // call on the `i`-th subrange, for each subrange in order
+  template <class Call>
+  void for_each_subrange (const std::vector<int>& dir,
+                          Starting_position start, int direction,
+                          const Call& call) const
+  {
+    int last_dir = (direction + _dimension -1) % _dimension;
     // first step is special
-    sort( places[0], places[1], start, last_dir);
+    call(0, start, last_dir);
 
     for(int i=1; i<two_to_dim-1; i +=2){
-      sort( places[i  ], places[i+1], start, dir[i+1]);
-      sort( places[i+1], places[i+2], start, dir[i+1]);
+      call(i  , start, dir[i+1]);
+      call(i+1, start, dir[i+1]);
       start[dir[i+1]] = !  start[dir[i+1]];
       start[last_dir] = !  start[last_dir];
     }
 
     //last step is special
-    sort( places[two_to_dim-1], places[two_to_dim], start, last_dir);
+    call(two_to_dim-1, start, last_dir);
   }
 
   template <class RandomAccessIterator>
@@ -13,11 +13,17 @@
 #define CGAL_HILBERT_SORT_MIDDLE_2_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
 #include <functional>
 #include <cstddef>
+#include <type_traits>
 #include <CGAL/Hilbert_sort_middle_base.h>
 #include <CGAL/number_utils.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
 namespace CGAL {
 
 namespace internal {
@@ -70,7 +76,7 @@ struct Fixed_hilbert_cmp_2<K,1,false>
 
 } // namespace internal
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_middle_2
 {
 public:
@@ -106,6 +112,27 @@ public:
     RandomAccessIterator m0 = begin, m4 = end;
 
     RandomAccessIterator m2 = internal::fixed_hilbert_split (m0, m4, Cmp< x,  upx> (xmed,_k));
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+        && (end - begin) > 8192) // 2^13, as for the median policy
+    {
+      RandomAccessIterator m1, m3;
+      tbb::parallel_invoke([&]{ m1 = internal::fixed_hilbert_split (m0, m2, Cmp< y,  upy> (ymed,_k)); },
+                           [&]{ m3 = internal::fixed_hilbert_split (m2, m4, Cmp< y, !upy> (ymed,_k)); });
+
+      tbb::parallel_invoke([&]{ if (m1!=m4)
+                                  sort<y, upy, upx> (m0, m1, ymin, xmin, ymed, xmed); },
+                           [&]{ if (m1!=m0 || m2!=m4)
+                                  sort<x, upx, upy> (m1, m2, xmin, ymed, xmed, ymax); },
+                           [&]{ if (m2!=m0 || m3!=m4)
+                                  sort<x, upx, upy> (m2, m3, xmed, ymed, xmax, ymax); },
+                           [&]{ if (m3!=m0)
+                                  sort<y,!upy,!upx> (m3, m4, ymed, xmax, ymin, xmed); });
+      return;
+    }
+#endif
+
     RandomAccessIterator m1 = internal::fixed_hilbert_split (m0, m2, Cmp< y,  upy> (ymed,_k));
     RandomAccessIterator m3 = internal::fixed_hilbert_split (m2, m4, Cmp< y, !upy> (ymed,_k));
 
@@ -122,6 +149,11 @@ public:
   template <class RandomAccessIterator>
   void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
   {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     //Bbox_2 box=bbox_2(begin, end); BUG: WE NEED TO FIX THIS
     double xmin=to_double(_k.compute_x_2_object()(*begin)),
            ymin=to_double(_k.compute_y_2_object()(*begin)),
@@ -13,10 +13,16 @@
 #define CGAL_HILBERT_SORT_MIDDLE_3_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
 #include <functional>
 #include <cstddef>
+#include <type_traits>
 #include <CGAL/Hilbert_sort_middle_base.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
 namespace CGAL {
 
 namespace internal {
@@ -83,7 +89,7 @@ namespace internal {
     };
 }
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_middle_3
 {
 public:
@@ -119,6 +125,43 @@ public:
 
         RandomAccessIterator m4 =
           internal::fixed_hilbert_split (m0, m8, Cmp< x,  upx> (xmed,_k));
+
+#ifdef CGAL_LINKED_WITH_TBB
+        if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+            && (end - begin) > 2048) // 2^11, as for the median policy
+        {
+          RandomAccessIterator m1, m2, m3, m5, m6, m7;
+          tbb::parallel_invoke(
+            [&]{ m2 = internal::fixed_hilbert_split (m0, m4, Cmp< y,  upy> (ymed,_k)); },
+            [&]{ m6 = internal::fixed_hilbert_split (m4, m8, Cmp< y, !upy> (ymed,_k)); });
+
+          tbb::parallel_invoke(
+            [&]{ m1 = internal::fixed_hilbert_split (m0, m2, Cmp< z,  upz> (zmed,_k)); },
+            [&]{ m3 = internal::fixed_hilbert_split (m2, m4, Cmp< z, !upz> (zmed,_k)); },
+            [&]{ m5 = internal::fixed_hilbert_split (m4, m6, Cmp< z,  upz> (zmed,_k)); },
+            [&]{ m7 = internal::fixed_hilbert_split (m6, m8, Cmp< z, !upz> (zmed,_k)); });
+
+          tbb::parallel_invoke(
+            [&]{ if (m1!=m8)
+                   sort<z, upz, upx, upy> (m0, m1, zmin, xmin, ymin, zmed, xmed, ymed); },
+            [&]{ if (m1!=m0 || m2!=m8)
+                   sort<y, upy, upz, upx> (m1, m2, ymin, zmed, xmin, ymed, zmax, xmed); },
+            [&]{ if (m2!=m0 || m3!=m8)
+                   sort<y, upy, upz, upx> (m2, m3, ymed, zmed, xmin, ymax, zmax, xmed); },
+            [&]{ if (m3!=m0 || m4!=m8)
+                   sort<x, upx,!upy,!upz> (m3, m4, xmin, ymax, zmed, xmed, ymed, zmin); },
+            [&]{ if (m4!=m0 || m5!=m8)
+                   sort<x, upx,!upy,!upz> (m4, m5, xmed, ymax, zmed, xmax, ymed, zmin); },
+            [&]{ if (m5!=m0 || m6!=m8)
+                   sort<y,!upy, upz,!upx> (m5, m6, ymax, zmed, xmax, ymed, zmax, xmed); },
+            [&]{ if (m6!=m0 || m7!=m8)
+                   sort<y,!upy, upz,!upx> (m6, m7, ymed, zmed, xmax, ymin, zmax, xmed); },
+            [&]{ if (m7!=m0)
+                   sort<z,!upz,!upx, upy> (m7, m8, zmed, xmax, ymin, zmin, xmed, ymed); });
+          return;
+        }
+#endif
+
         RandomAccessIterator m2 =
           internal::fixed_hilbert_split (m0, m4, Cmp< y,  upy> (ymed,_k));
         RandomAccessIterator m6 =
@@ -154,6 +197,11 @@ public:
     template <class RandomAccessIterator>
     void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
     {
+#ifndef CGAL_LINKED_WITH_TBB
+      static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                     "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
       double xmin=to_double(_k.compute_x_3_object()(*begin)),
              ymin=to_double(_k.compute_y_3_object()(*begin)),
              zmin=to_double(_k.compute_z_3_object()(*begin)),
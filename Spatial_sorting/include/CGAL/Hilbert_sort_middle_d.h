@@ -13,10 +13,13 @@
 #define CGAL_HILBERT_SORT_MIDDLE_d_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
 #include <functional>
 #include <cstddef>
+#include <type_traits>
 #include <vector>
 #include <CGAL/Hilbert_sort_middle_base.h>
+#include <CGAL/Spatial_sorting/internal/parallel_for_each.h>
 
 namespace CGAL {
 
@@ -44,7 +47,7 @@ namespace internal {
 
 }
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_middle_d
 {
 public:
@@ -63,6 +66,15 @@ private:
     { Cmp (int a, bool dir, double v, const Kernel &k)
         : internal::Fixed_hilbert_cmp_d<Kernel> (a,dir,v,k) {} };
 
+    // The arguments of a recursive call on the `index`-th subrange
+    struct Recursive_call
+    {
+      int index;
+      Starting_position start;
+      int direction;
+      Corner mini, maxi;
+    };
+
 public:
     Hilbert_sort_middle_d (const Kernel &k, std::ptrdiff_t limit = 1)
         : _k(k), _limit (limit)
@@ -77,55 +89,94 @@ public:
 
      Corner med(_dimension);
      for( int i=0; i<_dimension; ++i) med[i]=(mini[i]+maxi[i])/2;
-     Corner cmin=mini,cmax=med;
 
      std::vector<RandomAccessIterator> places(two_to_dim +1);
      std::vector<int>                  dir   (two_to_dim +1);
      places[0]=begin;
      places[two_to_dim]=end;
 
+     // Large ranges are split and sorted concurrently
+     const bool parallel = std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+                           && (end - begin) > 2048; // 2^11, as in 3D
+
      int last_dir = (direction + _dimension) % _dimension;
      int current_dir = direction;
      int current_level_step =two_to_dim;
      do{
        int half_step = current_level_step/2;
-       int left=0;
-       int middle = half_step;
-       int right=current_level_step;
        bool orient = start[current_dir];
-       do{
+       internal::spatial_sort_for_each<ConcurrencyTag>
+         (two_to_dim / current_level_step, parallel, [&](int i)
+       {
+         int left = i * current_level_step;
+         int middle = left + half_step;
+         int right = left + current_level_step;
          dir[middle]    = current_dir;
          places[middle] = internal::fixed_hilbert_split
                              (places[left], places[right],
-                              Cmp (current_dir,orient,med[current_dir],_k));
-         left =right;
-         right+=current_level_step;
-         middle+=current_level_step;
-         orient = ! orient;
-       }while( left< two_to_dim);
+                              Cmp (current_dir, (i % 2 == 0) ? orient : !orient,
+                                   med[current_dir], _k));
+       });
        current_level_step = half_step;
        current_dir = (current_dir +1) % _dimension;
      }while (current_dir != last_dir);
 
      /////////////start recursive calls
-     last_dir = (direction + _dimension -1) % _dimension;
+     if (!parallel) {
+       for_each_subrange(places, dir, start, direction, mini, maxi, med,
+                         [&](int i, const Starting_position& s, int d,
+                             const Corner& cmin, const Corner& cmax)
+                         {
+                           sort(places[i], places[i+1], s, d, cmin, cmax);
+                         });
+       return;
+     }
+
+     // Gather the arguments of the recursive calls, and make them concurrently
+     std::vector<Recursive_call> calls;
+     calls.reserve(two_to_dim);
+     for_each_subrange(places, dir, start, direction, mini, maxi, med,
+                       [&](int i, const Starting_position& s, int d,
+                           const Corner& cmin, const Corner& cmax)
+                       {
+                         calls.push_back(Recursive_call{i, s, d, cmin, cmax});
+                       });
+     internal::spatial_sort_for_each<ConcurrencyTag>(int(calls.size()), true, [&](int c)
+     {
+       const Recursive_call& call = calls[c];
+       sort(places[call.index], places[call.index+1], call.start, call.direction, call.mini, call.maxi);
+     });
+    }
+
+    // Calls `call(i, start, direction, mini, maxi)` with the arguments of the
+    // recursive call on the `i`-th subrange, for each non-empty subrange in order
+    template <class RandomAccessIterator, class Call>
+    void for_each_subrange (const std::vector<RandomAccessIterator>& places,
+                            const std::vector<int>& dir,
+                            Starting_position start, int direction,
+                            const Corner& mini, const Corner& maxi, const Corner& med,
+                            const Call& call) const
+    {
+     const RandomAccessIterator begin = places[0], end = places[two_to_dim];
+     Corner cmin=mini,cmax=med;
+
+     int last_dir = (direction + _dimension -1) % _dimension;
      // first step is special
      if (places[1]!=end)
-       sort( places[0], places[1], start, last_dir,cmin,cmax);
+       call(0, start, last_dir,cmin,cmax);
      cmin[last_dir] = med[last_dir];
      cmax[last_dir] = maxi[last_dir];
 
 
      for(int i=1; i<two_to_dim-1; i +=2){
-       //std::cout<<i<<";"<<start[0]<<start[1]<<start[2]<<start[3]<<"/"<<dir[i+1]<<std::endl;
        if (places[i]!=begin || places[i+1]!=end)
-         sort( places[i  ], places[i+1], start, dir[i+1],cmin,cmax);
+         call(i  , start, dir[i+1],cmin,cmax);
        cmax[ dir[i+1] ] =  (cmin[ dir[i+1]]==mini[ dir[i+1]])
                             ? maxi[ dir[i+1] ] : mini[ dir[i+1] ];
        cmin[ dir[i+1] ] =  med[ dir[i+1] ];
 
        if (places[i+1]!=begin || places[i+2]!=end)
-         sort( places[i+1], places[i+2], start, dir[i+1],cmin,cmax);
+         call(i+1, start, dir[i+1],cmin,cmax);
        cmin[ dir[i+1] ] =  cmax[ dir[i+1] ];
        cmax[ dir[i+1] ] =  med[ dir[i+1] ];
        cmax[ last_dir ] = (cmax[last_dir]==maxi[last_dir])
@@ -136,7 +187,7 @@ public:
 
      //last step is special
      if (places[two_to_dim-1]!=begin)
-       sort( places[two_to_dim-1], places[two_to_dim], start, last_dir,cmin,cmax);
+       call(two_to_dim-1, start, last_dir,cmin,cmax);
     }
 
 
@@ -15,6 +15,7 @@
 
 #include <CGAL/Hilbert_sort_2.h>
 #include <CGAL/Spatial_sorting/internal/Transform_coordinates_traits_3.h>
+#include <CGAL/Spatial_sorting/internal/parallel_for_each.h>
 #include <CGAL/number_utils.h>
 #include <CGAL/double.h>
 #include <algorithm>
@@ -24,7 +25,8 @@ namespace CGAL {
 
 template <class K,
           class Hilbert_policy,
-          class P = typename K::Point_3>
+          class P = typename K::Point_3,
+          class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_on_sphere_3
 {
         typedef P Point_3;
@@ -46,12 +48,12 @@ class Hilbert_sort_on_sphere_3
 
 
 
-        Hilbert_sort_2<Face_1_traits_3, Hilbert_policy > _hs_1_object;
-        Hilbert_sort_2<Face_2_traits_3, Hilbert_policy > _hs_2_object;
-        Hilbert_sort_2<Face_3_traits_3, Hilbert_policy > _hs_3_object;
-        Hilbert_sort_2<Face_4_traits_3, Hilbert_policy > _hs_4_object;
-        Hilbert_sort_2<Face_5_traits_3, Hilbert_policy > _hs_5_object;
-        Hilbert_sort_2<Face_6_traits_3, Hilbert_policy > _hs_6_object;
+        Hilbert_sort_2<Face_1_traits_3, Hilbert_policy, ConcurrencyTag > _hs_1_object;
+        Hilbert_sort_2<Face_2_traits_3, Hilbert_policy, ConcurrencyTag > _hs_2_object;
+        Hilbert_sort_2<Face_3_traits_3, Hilbert_policy, ConcurrencyTag > _hs_3_object;
+        Hilbert_sort_2<Face_4_traits_3, Hilbert_policy, ConcurrencyTag > _hs_4_object;
+        Hilbert_sort_2<Face_5_traits_3, Hilbert_policy, ConcurrencyTag > _hs_5_object;
+        Hilbert_sort_2<Face_6_traits_3, Hilbert_policy, ConcurrencyTag > _hs_6_object;
 
         K _k;
         Point_3 _p;
@@ -98,12 +100,19 @@ public:
                         else if(y < lyi) vec[4].push_back(p);        // Face 5, y < -sqrt(1/3)
                         else vec[5].push_back(p);                    // Face 6, z < -sqrt(1/3)
                 }
-                if(vec[0].size()) _hs_1_object(vec[0].begin(), vec[0].end());
-                if(vec[1].size()) _hs_2_object(vec[1].begin(), vec[1].end());
-                if(vec[2].size()) _hs_3_object(vec[2].begin(), vec[2].end());
-                if(vec[3].size()) _hs_4_object(vec[3].begin(), vec[3].end());
-                if(vec[4].size()) _hs_5_object(vec[4].begin(), vec[4].end());
-                if(vec[5].size()) _hs_6_object(vec[5].begin(), vec[5].end());
+                // the faces are sorted independently, concurrently for large ranges
+                internal::spatial_sort_for_each<ConcurrencyTag>(6, (end - begin) > 8192, [&](int i)
+                {
+                        if(vec[i].empty()) return;
+                        switch(i) {
+                        case 0: _hs_1_object(vec[0].begin(), vec[0].end()); break;
+                        case 1: _hs_2_object(vec[1].begin(), vec[1].end()); break;
+                        case 2: _hs_3_object(vec[2].begin(), vec[2].end()); break;
+                        case 3: _hs_4_object(vec[3].begin(), vec[3].end()); break;
+                        case 4: _hs_5_object(vec[4].begin(), vec[4].end()); break;
+                        default: _hs_6_object(vec[5].begin(), vec[5].end());
+                        }
+                });
 
                 // this is the order that set of points in a face should appear
                 // after sorting points wrt each face
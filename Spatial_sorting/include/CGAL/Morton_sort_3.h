@@ -0,0 +1,89 @@
+// Copyright (c) 2024  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_MORTON_SORT_3_H
+#define CGAL_MORTON_SORT_3_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/Morton_sort_base.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace CGAL {
+
+// Sorts points along a Z-order (Morton) curve. The points are snapped
+// to a grid of 2^21 cells per side covering their bounding box, their
+// 63-bit keys interleave the bits of their cells, and the keys are
+// sorted with a radix sort. The last argument of the constructor is
+// ignored; it makes the class a drop-in replacement for `Hilbert_sort_3`.
+template <class K, class ConcurrencyTag = Sequential_tag>
+class Morton_sort_3
+{
+public:
+  typedef K Kernel;
+  typedef typename Kernel::Point_3 Point;
+
+private:
+  Kernel _k;
+
+public:
+  Morton_sort_3 (const Kernel &k = Kernel(), std::ptrdiff_t /* limit */ = 1)
+    : _k(k)
+  {}
+
+  template <class RandomAccessIterator>
+  void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
+  {
+    const std::size_t n = std::size_t(end - begin);
+    if (n < 2)
+      return;
+
+    auto coordinate = [this](const typename std::iterator_traits<RandomAccessIterator>::value_type& p, int i)
+    {
+      return i == 0 ? to_double(_k.compute_x_3_object()(p))
+                    : (i == 1 ? to_double(_k.compute_y_3_object()(p))
+                              : to_double(_k.compute_z_3_object()(p)));
+    };
+
+    const auto box = internal::morton_bounding_box<3, ConcurrencyTag>(begin, end, coordinate);
+    double size = 0;
+    for (int i = 0; i < 3; ++i)
+      size = (std::max)(size, box[3 + i] - box[i]);
+
+    const std::uint64_t max_cell = (std::uint64_t(1) << 21) - 1;
+    const double scale = (size > 0) ? double(max_cell) / size : 0.;
+
+    std::vector<internal::Morton_item> items(n);
+    internal::morton_for_each_block<ConcurrencyTag>(n, internal::morton_grain_size,
+                                                    [&](std::size_t first, std::size_t last)
+    {
+      for (std::size_t j = first; j != last; ++j) {
+        std::uint64_t key = 0;
+        for (int i = 0; i < 3; ++i)
+          key |= internal::morton_spread_3(
+                   internal::morton_cell(coordinate(begin[j], i), box[i], scale, max_cell)) << i;
+        items[j] = internal::Morton_item(key, j);
+      }
+    });
+
+    internal::morton_radix_sort<ConcurrencyTag>(items);
+    internal::morton_permute<ConcurrencyTag>(begin, items);
+  }
+};
+
+} // namespace CGAL
+
+#endif // CGAL_MORTON_SORT_3_H
@@ -0,0 +1,242 @@
+// Copyright (c) 2024  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_MORTON_SORT_BASE_H
+#define CGAL_MORTON_SORT_BASE_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
+namespace CGAL {
+
+namespace internal {
+
+// A Morton key and the position of its point in the input range
+typedef std::pair<std::uint64_t, std::size_t> Morton_item;
+
+// Inserts two zero bits between each of the lowest 21 bits of `v`
+inline std::uint64_t morton_spread_3 (std::uint64_t v)
+{
+  v &= 0x1fffff;
+  v = (v | (v << 32)) & 0x1f00000000ffffULL;
+  v = (v | (v << 16)) & 0x1f0000ff0000ffULL;
+  v = (v | (v <<  8)) & 0x100f00f00f00f00fULL;
+  v = (v | (v <<  4)) & 0x10c30c30c30c30c3ULL;
+  v = (v | (v <<  2)) & 0x1249249249249249ULL;
+  return v;
+}
+
+// Inserts a zero bit between each of the lowest 32 bits of `v`
+inline std::uint64_t morton_spread_2 (std::uint64_t v)
+{
+  v &= 0xffffffff;
+  v = (v | (v << 16)) & 0x0000ffff0000ffffULL;
+  v = (v | (v <<  8)) & 0x00ff00ff00ff00ffULL;
+  v = (v | (v <<  4)) & 0x0f0f0f0f0f0f0f0fULL;
+  v = (v | (v <<  2)) & 0x3333333333333333ULL;
+  v = (v | (v <<  1)) & 0x5555555555555555ULL;
+  return v;
+}
+
+// Maps `x` in [`min`, `min + 1/scale`] to an integer in [0, `max_cell`]
+inline std::uint64_t morton_cell (double x, double min, double scale, std::uint64_t max_cell)
+{
+  const double c = (x - min) * scale;
+  if (!(c > 0)) // also catches NaN
+    return 0;
+  if (c >= double(max_cell))
+    return max_cell;
+  return std::uint64_t(c);
+}
+
+// Ranges of the input with fewer elements than this are processed by a single task
+const std::size_t morton_grain_size = 16384;
+
+// Calls `f(first, last)` on consecutive blocks of [0, n) of about `grain_size`
+// elements, concurrently if `ConcurrencyTag` is `Parallel_tag`
+template <class ConcurrencyTag, class Function>
+void morton_for_each_block (std::size_t n, std::size_t grain_size, const Function& f)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  CGAL_USE(grain_size);
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n, grain_size),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        f(r.begin(), r.end());
+                      });
+    return;
+  }
+#endif
+
+  f(std::size_t(0), n);
+}
+
+// Computes the bounding box of the points, `coordinate(p, i)` being the
+// `i`-th coordinate of `p` as a `double`
+template <int dimension, class ConcurrencyTag, class RandomAccessIterator, class Coordinate>
+std::array<double, 2 * dimension>
+morton_bounding_box (RandomAccessIterator begin, RandomAccessIterator end,
+                     const Coordinate& coordinate)
+{
+  typedef std::array<double, 2 * dimension> Box;
+
+  Box init;
+  for (int i = 0; i < dimension; ++i) {
+    init[i] = coordinate(*begin, i);
+    init[dimension + i] = init[i];
+  }
+
+  auto extend = [&](std::size_t first, std::size_t last, Box box)
+  {
+    for (std::size_t j = first; j != last; ++j)
+      for (int i = 0; i < dimension; ++i) {
+        const double c = coordinate(begin[j], i);
+        box[i] = (std::min)(box[i], c);
+        box[dimension + i] = (std::max)(box[dimension + i], c);
+      }
+    return box;
+  };
+  auto join = [](const Box& a, const Box& b)
+  {
+    Box box;
+    for (int i = 0; i < dimension; ++i) {
+      box[i] = (std::min)(a[i], b[i]);
+      box[dimension + i] = (std::max)(a[dimension + i], b[dimension + i]);
+    }
+    return box;
+  };
+
+  const std::size_t n = std::size_t(end - begin);
+#ifdef CGAL_LINKED_WITH_TBB
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    return tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, n, morton_grain_size), init,
+                                [&](const tbb::blocked_range<std::size_t>& r, const Box& box)
+                                {
+                                  return extend(r.begin(), r.end(), box);
+                                },
+                                join);
+#else
+  CGAL_USE(join);
+#endif
+
+  return extend(0, n, init);
+}
+
+// Sorts the items by increasing key with a least significant digit radix
+// sort, preserving the order of the items with the same key. With
+// `Parallel_tag`, each pass counts and scatters blocks of items concurrently.
+template <class ConcurrencyTag>
+void morton_radix_sort (std::vector<Morton_item>& items)
+{
+  const int radix_bits = 8;
+  const std::size_t nb_buckets = std::size_t(1) << radix_bits;
+  typedef std::array<std::size_t, std::size_t(1) << radix_bits> Histogram;
+
+  const std::size_t n = items.size();
+  const std::size_t nb_blocks = (std::max)(std::size_t(1), n / morton_grain_size);
+  const std::size_t block_size = (n + nb_blocks - 1) / nb_blocks;
+
+  std::vector<Morton_item> buffer(n);
+  std::vector<Histogram> histograms(nb_blocks);
+
+  for (int shift = 0; shift < 64; shift += radix_bits)
+  {
+    auto digit = [shift](const Morton_item& item)
+    {
+      return std::size_t((item.first >> shift) & (nb_buckets - 1));
+    };
+
+    // Count the digits of each block
+    morton_for_each_block<ConcurrencyTag>(nb_blocks, 1, [&](std::size_t first, std::size_t last)
+    {
+      for (std::size_t b = first; b != last; ++b) {
+        Histogram& histogram = histograms[b];
+        histogram.fill(0);
+        const std::size_t block_end = (std::min)(n, (b + 1) * block_size);
+        for (std::size_t j = b * block_size; j < block_end; ++j)
+          ++histogram[digit(items[j])];
+      }
+    });
+
+    // Skip the digits that are the same for all items
+    std::size_t count = 0;
+    for (std::size_t b = 0; b < nb_blocks; ++b)
+      count += histograms[b][digit(items[0])];
+    if (count == n)
+      continue;
+
+    // Turn the counts into the position of the first item of each digit in each block
+    std::size_t position = 0;
+    for (std::size_t d = 0; d < nb_buckets; ++d)
+      for (std::size_t b = 0; b < nb_blocks; ++b) {
+        const std::size_t c = histograms[b][d];
+        histograms[b][d] = position;
+        position += c;
+      }
+
+    morton_for_each_block<ConcurrencyTag>(nb_blocks, 1, [&](std::size_t first, std::size_t last)
+    {
+      for (std::size_t b = first; b != last; ++b) {
+        Histogram& histogram = histograms[b];
+        const std::size_t block_end = (std::min)(n, (b + 1) * block_size);
+        for (std::size_t j = b * block_size; j < block_end; ++j)
+          buffer[histogram[digit(items[j])]++] = items[j];
+      }
+    });
+
+    items.swap(buffer);
+  }
+}
+
+// Reorders the range so that its `i`-th element is the one that was at
+// position `items[i].second`
+template <class ConcurrencyTag, class RandomAccessIterator>
+void morton_permute (RandomAccessIterator begin, const std::vector<Morton_item>& items)
+{
+  typedef typename std::iterator_traits<RandomAccessIterator>::value_type Value;
+
+  std::vector<Value> sorted(items.size());
+  morton_for_each_block<ConcurrencyTag>(items.size(), morton_grain_size, [&](std::size_t first, std::size_t last)
+  {
+    for (std::size_t i = first; i != last; ++i)
+      sorted[i] = std::move(begin[items[i].second]);
+  });
+  morton_for_each_block<ConcurrencyTag>(items.size(), morton_grain_size, [&](std::size_t first, std::size_t last)
+  {
+    std::move(sorted.begin() + first, sorted.begin() + last, begin + first);
+  });
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_MORTON_SORT_BASE_H
@@ -14,12 +14,18 @@
 
 #include <CGAL/config.h>
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
 #include <iterator>
 #include <cstddef>
+#include <type_traits>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
 
 namespace CGAL {
 
-template <class Sort>
+template <class Sort, class ConcurrencyTag = Sequential_tag>
 class Multiscale_sort
 {
   Sort _sort;
@@ -37,9 +43,25 @@ public:
   void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
   {
     typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     RandomAccessIterator middle = begin;
     if (end - begin >= _threshold) {
       middle = begin + difference_type (double(end - begin) * _ratio);
+
+#ifdef CGAL_LINKED_WITH_TBB
+      // the two ranges are disjoint, so the coarser levels can be sorted
+      // while the finest one is
+      if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value && (end - begin) > 8192) {
+        tbb::parallel_invoke([&]{ this->operator() (begin, middle); },
+                             [&]{ _sort (middle, end); });
+        return;
+      }
+#endif
+
       this->operator() (begin, middle);
     }
     _sort (middle, end);
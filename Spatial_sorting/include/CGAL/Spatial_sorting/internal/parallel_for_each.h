@@ -0,0 +1,53 @@
+// Copyright (c) 2024  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_SPATIAL_SORTING_INTERNAL_PARALLEL_FOR_EACH_H
+#define CGAL_SPATIAL_SORTING_INTERNAL_PARALLEL_FOR_EACH_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
+
+#include <type_traits>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+namespace CGAL {
+
+namespace internal {
+
+// Calls `f(i)` for each `i` in [0, n), concurrently if `ConcurrencyTag`
+// is `Parallel_tag` and `parallel` is `true`
+template <class ConcurrencyTag, class Function>
+void spatial_sort_for_each (int n, bool parallel, const Function& f)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  CGAL_USE(parallel);
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value && parallel)
+  {
+    tbb::parallel_for(0, n, f);
+    return;
+  }
+#endif
+
+  for (int i = 0; i < n; ++i)
+    f(i);
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_SPATIAL_SORTING_INTERNAL_PARALLEL_FOR_EACH_H
@@ -20,7 +20,7 @@ namespace CGAL {
 
 namespace internal {
 
-template <class RandomAccessIterator, class Kernel, class Policy>
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Kernel, class Policy>
 void hilbert_sort_on_sphere (RandomAccessIterator begin,
                              RandomAccessIterator end,
                              const Kernel &k,
@@ -34,12 +34,12 @@ void hilbert_sort_on_sphere (RandomAccessIterator begin,
   boost::rand48 random;
   boost::random_number_generator<boost::rand48, Diff_t> rng(random);
   CGAL::cpp98::random_shuffle(begin,end, rng);
-  (Hilbert_sort_on_sphere_3<Kernel, Policy> (k,sq_r,p))(begin, end);
+  (Hilbert_sort_on_sphere_3<Kernel, Policy, typename Kernel::Point_3, ConcurrencyTag> (k,sq_r,p))(begin, end);
 }
 
 } //end of namespace internal
 
-template <class RandomAccessIterator>
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
 void hilbert_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator end,
                              double sq_r = 1.0,
                              const typename CGAL::Kernel_traits<
@@ -53,10 +53,10 @@ void hilbert_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
   typedef CGAL::Kernel_traits<value_type>            KTraits;
   typedef typename KTraits::Kernel                   Kernel;
 
-  internal::hilbert_sort_on_sphere(begin, end, Kernel(), Hilbert_sort_median_policy(), static_cast<value_type *> (0), sq_r, p);
+  internal::hilbert_sort_on_sphere<ConcurrencyTag>(begin, end, Kernel(), Hilbert_sort_median_policy(), static_cast<value_type *> (0), sq_r, p);
 }
 
-template <class RandomAccessIterator>
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
 void hilbert_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator end, Hilbert_sort_median_policy policy,
                              double sq_r = 1.0,
                              const typename CGAL::Kernel_traits<
@@ -69,10 +69,10 @@ void hilbert_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
   typedef CGAL::Kernel_traits<value_type>            KTraits;
   typedef typename KTraits::Kernel                   Kernel;
 
-  internal::hilbert_sort_on_sphere(begin, end, Kernel(), policy, static_cast<value_type *> (0), sq_r, p);
+  internal::hilbert_sort_on_sphere<ConcurrencyTag>(begin, end, Kernel(), policy, static_cast<value_type *> (0), sq_r, p);
 }
 
-template <class RandomAccessIterator>
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
 void hilbert_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator end, Hilbert_sort_middle_policy policy,
                              double sq_r = 1.0,
                              const typename CGAL::Kernel_traits<
@@ -85,10 +85,10 @@ void hilbert_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
   typedef CGAL::Kernel_traits<value_type>            KTraits;
   typedef typename KTraits::Kernel                   Kernel;
 
-  internal::hilbert_sort_on_sphere(begin, end, Kernel(), policy, static_cast<value_type *> (0), sq_r, p);
+  internal::hilbert_sort_on_sphere<ConcurrencyTag>(begin, end, Kernel(), policy, static_cast<value_type *> (0), sq_r, p);
 }
 
-template <class RandomAccessIterator, class Kernel, class Policy>
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Kernel, class Policy>
 void hilbert_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator end,
                              const Kernel &k, Policy policy,
                              double sq_r = 1.0,
@@ -97,7 +97,7 @@ void hilbert_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
   typedef std::iterator_traits<RandomAccessIterator> ITraits;
   typedef typename ITraits::value_type               value_type;
 
-  internal::hilbert_sort_on_sphere(begin, end, k, policy, static_cast<value_type *> (0), sq_r, p);
+  internal::hilbert_sort_on_sphere<ConcurrencyTag>(begin, end, k, policy, static_cast<value_type *> (0), sq_r, p);
 }
 
 } // end of namespace CGAL
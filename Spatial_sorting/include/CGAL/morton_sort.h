@@ -0,0 +1,68 @@
+// Copyright (c) 2024  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_MORTON_SORT_H
+#define CGAL_MORTON_SORT_H
+
+#include <CGAL/config.h>
+
+#include <CGAL/Morton_sort_2.h>
+#include <CGAL/Morton_sort_3.h>
+#include <CGAL/Kernel_traits.h>
+
+#include <iterator>
+
+namespace CGAL {
+namespace internal {
+
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Kernel>
+void morton_sort (RandomAccessIterator begin,
+                  RandomAccessIterator end,
+                  const Kernel &k,
+                  typename Kernel::Point_2 *)
+{
+  (Morton_sort_2<Kernel, ConcurrencyTag> (k))(begin, end);
+}
+
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Kernel>
+void morton_sort (RandomAccessIterator begin,
+                  RandomAccessIterator end,
+                  const Kernel &k,
+                  typename Kernel::Point_3 *)
+{
+  (Morton_sort_3<Kernel, ConcurrencyTag> (k))(begin, end);
+}
+
+} // namespace internal
+
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
+void morton_sort (RandomAccessIterator begin, RandomAccessIterator end)
+{
+  typedef std::iterator_traits<RandomAccessIterator> ITraits;
+  typedef typename ITraits::value_type               value_type;
+  typedef CGAL::Kernel_traits<value_type>            KTraits;
+  typedef typename KTraits::Kernel                   Kernel;
+
+  internal::morton_sort<ConcurrencyTag>(begin, end, Kernel(), static_cast<value_type *> (0));
+}
+
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Kernel>
+void morton_sort (RandomAccessIterator begin, RandomAccessIterator end,
+                  const Kernel &k)
+{
+  typedef std::iterator_traits<RandomAccessIterator> ITraits;
+  typedef typename ITraits::value_type               value_type;
+
+  internal::morton_sort<ConcurrencyTag>(begin, end, k, static_cast<value_type *> (0));
+}
+
+} // namespace CGAL
+
+#endif // CGAL_MORTON_SORT_H
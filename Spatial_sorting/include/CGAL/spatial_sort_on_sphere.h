@@ -22,7 +22,8 @@ namespace CGAL {
 
 namespace internal {
 
-template <class RandomAccessIterator, class PolicyTag, class Kernel,
+template <class ConcurrencyTag = Sequential_tag,
+          class RandomAccessIterator, class PolicyTag, class Kernel,
           class FT = typename Kernel::FT,
           class Point = typename Kernel::Point_3>
 void spatial_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator end,
@@ -34,7 +35,7 @@ void spatial_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
                              std::ptrdiff_t threshold_multiscale,
                              double ratio)
 {
-  typedef Hilbert_sort_on_sphere_3<Kernel, Hilbert_policy<PolicyTag>, Point> Sort;
+  typedef Hilbert_sort_on_sphere_3<Kernel, Hilbert_policy<PolicyTag>, Point, ConcurrencyTag> Sort;
   typedef std::iterator_traits<RandomAccessIterator> ITraits;
   typedef typename ITraits::difference_type Diff_t;
 
@@ -46,13 +47,14 @@ void spatial_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
   if (threshold_multiscale==0) threshold_multiscale=16;
   if (ratio==0.0) ratio=0.25;
 
-  (Multiscale_sort<Sort> (Sort (k, sq_r, p, threshold_hilbert),
-                          threshold_multiscale, ratio)) (begin, end);
+  (Multiscale_sort<Sort, ConcurrencyTag> (Sort (k, sq_r, p, threshold_hilbert),
+                                          threshold_multiscale, ratio)) (begin, end);
 }
 
 } // end of namespace internal
 
-template <class RandomAccessIterator, class PolicyTag,
+template <class ConcurrencyTag = Sequential_tag,
+          class RandomAccessIterator, class PolicyTag,
           class Kernel = typename CGAL::Kernel_traits<typename std::iterator_traits<RandomAccessIterator>::value_type>::Kernel,
           class FT = typename Kernel::FT,
           class Point = typename Kernel::Point_3>
@@ -64,11 +66,12 @@ void spatial_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
                              std::ptrdiff_t threshold_multiscale = 0,
                              const double ratio = 0.)
 {
-  internal::spatial_sort_on_sphere (begin, end, Kernel(), policy, sq_r, p,
-                                    threshold_hilbert, threshold_multiscale, ratio);
+  internal::spatial_sort_on_sphere<ConcurrencyTag> (begin, end, Kernel(), policy, sq_r, p,
+                                                    threshold_hilbert, threshold_multiscale, ratio);
 }
 
-template <class RandomAccessIterator, class Kernel,
+template <class ConcurrencyTag = Sequential_tag,
+          class RandomAccessIterator, class Kernel,
           class FT = typename Kernel::FT,
           class Point = typename Kernel::Point_3>
 void spatial_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator end,
@@ -79,12 +82,13 @@ void spatial_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
                              std::ptrdiff_t threshold_multiscale = 0,
                              const double ratio = 0.)
 {
-  internal::spatial_sort_on_sphere (begin, end, k,
-                                    Hilbert_sort_median_policy(), sq_r, p,
-                                    threshold_hilbert, threshold_multiscale, ratio);
+  internal::spatial_sort_on_sphere<ConcurrencyTag> (begin, end, k,
+                                                    Hilbert_sort_median_policy(), sq_r, p,
+                                                    threshold_hilbert, threshold_multiscale, ratio);
 }
 
-template <class RandomAccessIterator,
+template <class ConcurrencyTag = Sequential_tag,
+          class RandomAccessIterator,
           class Kernel = typename CGAL::Kernel_traits<typename std::iterator_traits<RandomAccessIterator>::value_type>::Kernel,
           class FT = typename Kernel::FT,
           class Point = typename Kernel::Point_3>
@@ -95,9 +99,9 @@ void spatial_sort_on_sphere (RandomAccessIterator begin, RandomAccessIterator en
                              std::ptrdiff_t threshold_multiscale = 0,
                              const double ratio = 0.)
 {
-  internal::spatial_sort_on_sphere (begin, end, Kernel(),
-                                    Hilbert_sort_median_policy(), sq_r, p,
-                                    threshold_hilbert, threshold_multiscale, ratio);
+  internal::spatial_sort_on_sphere<ConcurrencyTag> (begin, end, Kernel(),
+                                                    Hilbert_sort_median_policy(), sq_r, p,
+                                                    threshold_hilbert, threshold_multiscale, ratio);
 }
 
 } // end of namespace CGAL
@@ -127,6 +127,16 @@ int main ()
 
     std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point_2> v3 (v2);
+    timer.reset();timer.start();
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), CGAL::Hilbert_sort_middle_policy());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(),  K().less_xy_2_object());
@@ -255,6 +265,16 @@ int main ()
 
     std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point_3> v3 (v2);
+    timer.reset();timer.start();
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), CGAL::Hilbert_sort_middle_policy());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(),  K().less_xyz_3_object());
@@ -386,6 +406,16 @@ int main ()
 
     std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point_3> v3 (v2);
+    timer.reset();timer.start();
+    CGAL::hilbert_sort_on_sphere<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), CGAL::Hilbert_sort_middle_policy());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(),  K().less_xyz_3_object());
@@ -451,6 +481,16 @@ int main ()
 
     std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point> v3 (v2);
+    timer.reset();timer.start();
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), CGAL::Hilbert_sort_median_policy());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(), Kd().less_lexicographically_d_object());
@@ -518,6 +558,16 @@ int main ()
 
     std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point> v3 (v2);
+    timer.reset();timer.start();
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), CGAL::Hilbert_sort_middle_policy());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(), Kd().less_lexicographically_d_object());
@@ -0,0 +1,193 @@
+#include <cassert>
+
+#include <CGAL/morton_sort.h>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/algorithm.h>
+#include <CGAL/Random.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <CGAL/Real_timer.h>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2                                          Point_2;
+typedef K::Point_3                                          Point_3;
+
+// Interleaves the bits of the coordinates of a grid cell, x being the lowest bit
+std::uint64_t interleave (const std::vector<int>& cell)
+{
+  std::uint64_t key = 0;
+  for (int bit = 0; bit < 8; ++bit)
+    for (std::size_t i = 0; i < cell.size(); ++i)
+      key |= std::uint64_t((cell[i] >> bit) & 1) << (bit * cell.size() + i);
+  return key;
+}
+
+int main ()
+{
+  int nb_points_2 = 100000, nb_points_3 = 100000;
+  CGAL::Random random (42);
+  CGAL::Real_timer timer;
+
+  std::cout << "Testing Morton sort." << std::endl;
+
+  {
+    std::cout << "Testing 2D: Generating "<<nb_points_2<<" random points... " << std::flush;
+
+    std::vector<Point_2> v;
+    v.reserve (nb_points_2);
+
+    CGAL::Random_points_in_square_2<Point_2> gen (1.0, random);
+
+    for (int i = 0; i < nb_points_2 - 1; ++i)
+      v.push_back (*gen++);
+    v.push_back(v[0]); //insert twice the same point
+
+    std::cout << "done." << std::endl;
+
+    std::vector<Point_2> v2 (v), v3 (v);
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::morton_sort (v.begin(), v.end());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::morton_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+    assert(v == v3);
+
+    std::sort (v.begin(),  v.end());
+    std::sort (v2.begin(), v2.end());
+    assert(v == v2);
+
+    std::cout << "no points lost." << std::endl;
+  }
+  {
+    int size=16;
+    std::cout << "Testing 2D: Generating "<<size*size<<" grid points... " << std::flush;
+
+    std::vector<Point_2> v;
+    for (int i = 0; i < size; ++i)
+      for (int j = 0; j < size; ++j)
+        v.push_back (Point_2 (i, j));
+    CGAL::cpp98::random_shuffle (v.begin(), v.end(), random);
+
+    std::cout << "done." << std::endl;
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    CGAL::morton_sort (v.begin(), v.end());
+
+    std::cout << "done." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    // The grid coordinates are the leading bits of the cells of the points,
+    // so that the points come in the order of their interleaved coordinates
+    for (int i = 0; i < size*size; ++i) {
+      std::vector<int> cell = { int(v[i].x()), int(v[i].y()) };
+      assert(interleave(cell) == std::uint64_t(i));
+    }
+
+    std::cout << "OK." << std::endl;
+  }
+  {
+    std::cout << "Testing 3D: Generating "<<nb_points_3<<" random points... " << std::flush;
+
+    std::vector<Point_3> v;
+    v.reserve (nb_points_3);
+
+    CGAL::Random_points_in_cube_3<Point_3> gen (1.0, random);
+
+    for (int i = 0; i < nb_points_3; ++i)
+      v.push_back (*gen++);
+
+    std::cout << "done." << std::endl;
+
+    std::vector<Point_3> v2 (v), v3 (v);
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::morton_sort (v.begin(), v.end(), K());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::morton_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), K());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+    assert(v == v3);
+
+    std::sort (v.begin(),  v.end());
+    std::sort (v2.begin(), v2.end());
+    assert(v == v2);
+
+    std::cout << "no points lost." << std::endl;
+  }
+  {
+    int size=8;
+    std::cout << "Testing 3D: Generating "<<size*size*size<<" grid points... " << std::flush;
+
+    std::vector<Point_3> v;
+    for (int i = 0; i < size; ++i)
+      for (int j = 0; j < size; ++j)
+        for (int k = 0; k < size; ++k)
+          v.push_back (Point_3 (i, j, k));
+    CGAL::cpp98::random_shuffle (v.begin(), v.end(), random);
+
+    std::cout << "done." << std::endl;
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    CGAL::morton_sort (v.begin(), v.end());
+
+    std::cout << "done." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    for (int i = 0; i < size*size*size; ++i) {
+      std::vector<int> cell = { int(v[i].x()), int(v[i].y()), int(v[i].z()) };
+      assert(interleave(cell) == std::uint64_t(i));
+    }
+
+    std::cout << "OK." << std::endl;
+  }
+  {
+    std::cout << "Testing degenerate inputs... " << std::flush;
+
+    std::vector<Point_3> v (1000, Point_3 (1, 2, 3));
+    CGAL::morton_sort (v.begin(), v.end());
+    assert(v == std::vector<Point_3> (1000, Point_3 (1, 2, 3)));
+
+    std::vector<Point_3> empty;
+    CGAL::morton_sort (empty.begin(), empty.end());
+
+    std::cout << "OK." << std::endl;
+  }
+
+  return 0;
+}
@@ -56,6 +56,14 @@ int main ()
 
     std::cout << "done." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point_2> v3 (v2);
+    CGAL::spatial_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end());
+
+    std::cout << "done." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(),  K().less_xy_2_object());
@@ -86,6 +94,14 @@ int main ()
 
     std::cout << "done." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point_3> v3 (v2);
+    CGAL::spatial_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end());
+
+    std::cout << "done." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(),  K().less_xyz_3_object());
@@ -116,6 +132,14 @@ int main ()
 
     std::cout << "done." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point_3> v3 (v2);
+    CGAL::spatial_sort_on_sphere<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end());
+
+    std::cout << "done." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(),  K().less_xyz_3_object());
@@ -177,6 +201,14 @@ int main ()
 
     std::cout << "done." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    std::vector<Point> v3 (v2);
+    CGAL::spatial_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end());
+
+    std::cout << "done." << std::endl;
+    assert(v == v3);
+
     std::cout << "            Checking...          " << std::flush;
 
     std::sort (v.begin(),  v.end(), Kd().less_lexicographically_d_object());
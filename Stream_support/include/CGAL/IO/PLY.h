@@ -95,16 +95,34 @@ bool read_PLY(std::istream& is,
         }
       }
 
-      for(std::size_t j=0; j<element.number_of_items(); ++j)
+      // Binary vertices of fixed size are decoded by blocks
+      if(reader.is_binary() && element.item_size() != 0)
       {
-        for(std::size_t k=0; k<element.number_of_properties(); ++k)
+        const internal::PLY_column<double> x(element, "x"), y(element, "y"), z(element, "z");
+        const internal::PLY_column<std::uint8_t> r(element, rtag), g(element, gtag), b(element, btag);
+        typename Kernel_traits<Point_3>::Kernel::Construct_point_3 construct_point;
+        const std::size_t block_size = reader.items_per_block(element);
+        for(std::size_t j=0; j<element.number_of_items(); j+=block_size)
         {
-          internal::PLY_read_number* property = element.property(k);
-          property->get(is);
-
-          if(is.fail())
+          const std::size_t nb_items = (std::min)(block_size, element.number_of_items() - j);
+          const char* data = reader.read_items(is, element, nb_items);
+          if(data == nullptr)
             return false;
+
+          for(std::size_t k=0; k<nb_items; ++k)
+          {
+            points.push_back(construct_point(x(data, k), y(data, k), z(data, k)));
+            if(has_colors)
+              *vc_out++ = Color_rgb(r(data, k), g(data, k), b(data, k));
+          }
         }
+        continue;
+      }
+
+      for(std::size_t j=0; j<element.number_of_items(); ++j)
+      {
+        if(!reader.read_item(is, element))
+          return false;
 
         std::tuple<Point_3, std::uint8_t, std::uint8_t, std::uint8_t> new_vertex;
         if(has_colors)
@@ -133,19 +151,19 @@ bool read_PLY(std::istream& is,
     {
       if(element.has_property<std::vector<std::int32_t> >("vertex_indices"))
       {
-        internal::read_PLY_faces<std::int32_t>(is, element, polygons, fc_out, "vertex_indices");
+        internal::read_PLY_faces<std::int32_t>(is, reader, element, polygons, fc_out, "vertex_indices");
       }
       else if(element.has_property<std::vector<std::uint32_t> >("vertex_indices"))
       {
-        internal::read_PLY_faces<std::uint32_t>(is, element, polygons, fc_out, "vertex_indices");
+        internal::read_PLY_faces<std::uint32_t>(is, reader, element, polygons, fc_out, "vertex_indices");
       }
       else if(element.has_property<std::vector<std::int32_t> >("vertex_index"))
       {
-        internal::read_PLY_faces<std::int32_t>(is, element, polygons, fc_out, "vertex_index");
+        internal::read_PLY_faces<std::int32_t>(is, reader, element, polygons, fc_out, "vertex_index");
       }
       else if(element.has_property<std::vector<std::uint32_t> >("vertex_index"))
       {
-        internal::read_PLY_faces<std::uint32_t>(is, element, polygons, fc_out, "vertex_index");
+        internal::read_PLY_faces<std::uint32_t>(is, reader, element, polygons, fc_out, "vertex_index");
       }
       else
       {
@@ -169,14 +187,8 @@ bool read_PLY(std::istream& is,
       std::tuple<unsigned int, unsigned int, float, float, float> new_hedge;
       for(std::size_t j=0; j<element.number_of_items(); ++j)
       {
-        for(std::size_t k=0; k<element.number_of_properties(); ++k)
-        {
-          internal::PLY_read_number* property = element.property(k);
-          property->get(is);
-
-          if(is.fail())
-            return false;
-        }
+        if(!reader.read_item(is, element))
+          return false;
 
         if(has_uv)
         {
@@ -206,17 +218,12 @@ bool read_PLY(std::istream& is,
     else // Read other elements and ignore
     {
       for(std::size_t j=0; j<element.number_of_items(); ++j)
-      {
-        for(std::size_t k=0; k<element.number_of_properties(); ++k)
-        {
-          internal::PLY_read_number* property = element.property(k);
-          property->get(is);
-          if(is.fail())
-            return false;
-        }
-      }
+        if(!reader.read_item(is, element))
+          return false;
     }
   }
+
+  reader.release(is);
   return !is.fail();
 }
 
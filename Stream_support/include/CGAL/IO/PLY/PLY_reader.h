@@ -17,9 +17,13 @@
 #include <CGAL/Kernel_traits.h>
 #include <CGAL/property_map.h>
 
+#include <CGAL/use.h>
+
 #include <boost/cstdint.hpp>
 #include <boost/range/value_type.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -27,6 +31,11 @@
 #include <utility>
 #include <vector>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #define TRY_TO_GENERATE_PROPERTY(STD_TYPE, T_TYPE, TYPE)                \
   if(type == STD_TYPE  || type == T_TYPE)                              \
     m_elements.back().add_property(new PLY_read_typed_number< TYPE >(name, format))
@@ -139,6 +148,67 @@ make_ply_normal_writer(VectorMap normal_map)
 
 namespace internal {
 
+// Reads a binary stream by large blocks, so that the items of the PLY
+// elements are decoded from memory instead of with one `read()` per value
+class PLY_binary_buffer
+{
+  std::vector<char> m_data;
+  std::size_t m_begin;
+  std::size_t m_end;
+
+public:
+  // Number of bytes read from the stream at once
+  static std::size_t block_size() { return std::size_t(1) << 22; }
+
+  PLY_binary_buffer() : m_begin(0), m_end(0) { }
+
+  // Returns a pointer to the next `size` bytes of `stream`, or `nullptr`
+  // if the stream ends before. The pointer is valid until the next call.
+  const char* require(std::istream& stream, std::size_t size)
+  {
+    if(m_end - m_begin < size)
+    {
+      const std::size_t remaining = m_end - m_begin;
+      if(m_begin != 0)
+      {
+        std::memmove(m_data.data(), m_data.data() + m_begin, remaining);
+        m_begin = 0;
+        m_end = remaining;
+      }
+      if(m_data.size() < (std::max)(size, block_size()))
+        m_data.resize((std::max)(size, block_size()));
+
+      while(m_end < size && stream.good())
+      {
+        stream.read(m_data.data() + m_end, std::streamsize(m_data.size() - m_end));
+        m_end += std::size_t(stream.gcount());
+      }
+      if(m_end < size)
+        return nullptr;
+
+      // Reaching the end of the stream while filling the buffer is not an error
+      stream.clear(stream.rdstate() & ~(std::ios::failbit | std::ios::eofbit));
+    }
+    return m_data.data() + m_begin;
+  }
+
+  void consume(std::size_t size) { m_begin += size; }
+
+  // Puts back the bytes that were read from `stream` but not consumed
+  void release(std::istream& stream)
+  {
+    if(m_begin == m_end)
+      return;
+
+    const std::ios::iostate state = stream.rdstate();
+    stream.clear();
+    stream.seekg(-std::streamoff(m_end - m_begin), std::ios::cur);
+    if(stream.fail())
+      stream.clear(state);
+    m_begin = m_end = 0;
+  }
+};
+
 class PLY_read_number
 {
 protected:
@@ -152,8 +222,14 @@ public:
 
   const std::string& name() const { return m_name; }
 
+  // Number of bytes of the property in binary format, 0 if it is a list
+  virtual std::size_t size() const { return 0; }
+
   virtual void get(std::istream& stream) const = 0;
 
+  // Reads the property from a binary stream through `buffer`
+  virtual bool get(std::istream& stream, PLY_binary_buffer& buffer) const = 0;
+
   // The two following functions prevent the stream to only extract
   // ONE character (= what the types char imply) by requiring
   // explicitly an integer object when reading the stream
@@ -224,28 +300,37 @@ public:
     }
     else // Binary (2 = little endian)
     {
-      union
-      {
-        char uChar[sizeof(Type)];
-        Type type;
-      } buffer;
+      char data[sizeof(Type)];
+      stream.read(data, sizeof(Type));
+      return read<Type>(data);
+    }
+    return Type();
+  }
 
-      std::size_t size = sizeof(Type);
+  // Decodes a binary value stored at `data`
+  template <typename Type>
+  Type read(const char* data) const
+  {
+    union
+    {
+      char uChar[sizeof(Type)];
+      Type type;
+    } buffer;
 
-      stream.read(buffer.uChar, size);
+    std::size_t size = sizeof(Type);
 
-      if(m_format == 2) // Big endian
+    std::memcpy(buffer.uChar, data, size);
+
+    if(m_format == 2) // Big endian
+    {
+      for(std::size_t i = 0; i < size / 2; ++ i)
       {
-        for(std::size_t i = 0; i < size / 2; ++ i)
-        {
-          unsigned char tmp = buffer.uChar[i];
-          buffer.uChar[i] = buffer.uChar[size - 1 - i];
-          buffer.uChar[size - 1 - i] = tmp;
-        }
+        char tmp = buffer.uChar[i];
+        buffer.uChar[i] = buffer.uChar[size - 1 - i];
+        buffer.uChar[size - 1 - i] = tmp;
       }
-      return buffer.type;
     }
-    return Type();
+    return buffer.type;
   }
 };
 
@@ -258,8 +343,20 @@ public:
     : PLY_read_number(name, format)
   { }
 
+  std::size_t size() const { return sizeof(Type); }
+
   void get(std::istream& stream) const { m_buffer =(this->read<Type>(stream)); }
 
+  bool get(std::istream& stream, PLY_binary_buffer& buffer) const
+  {
+    const char* data = buffer.require(stream, sizeof(Type));
+    if(data == nullptr)
+      return false;
+    m_buffer = this->template read<Type>(data);
+    buffer.consume(sizeof(Type));
+    return true;
+  }
+
   const Type& buffer() const { return m_buffer; }
 };
 
@@ -276,6 +373,7 @@ public:
   { }
 
   virtual void get(std::istream& stream) const = 0;
+  virtual bool get(std::istream& stream, PLY_binary_buffer& buffer) const = 0;
 
   const std::vector<Type>& buffer() const { return m_buffer; }
 };
@@ -296,6 +394,24 @@ public:
     for(std::size_t i = 0; i < size; ++ i)
       this->m_buffer[i] = this->template read<IndexType>(stream);
   }
+
+  bool get(std::istream& stream, PLY_binary_buffer& buffer) const
+  {
+    const char* data = buffer.require(stream, sizeof(SizeType));
+    if(data == nullptr)
+      return false;
+    std::size_t size = static_cast<std::size_t>(this->template read<SizeType>(data));
+    buffer.consume(sizeof(SizeType));
+
+    data = buffer.require(stream, size * sizeof(IndexType));
+    if(data == nullptr)
+      return false;
+    this->m_buffer.resize(size);
+    for(std::size_t i = 0; i < size; ++ i)
+      this->m_buffer[i] = this->template read<IndexType>(data + i * sizeof(IndexType));
+    buffer.consume(size * sizeof(IndexType));
+    return true;
+  }
 };
 
 class PLY_element
@@ -336,6 +452,20 @@ public:
 
   PLY_read_number* property(std::size_t idx) { return m_properties[idx]; }
 
+  // Returns the number of bytes of an item in binary format,
+  // or 0 if the size of the items varies because of lists
+  std::size_t item_size() const
+  {
+    std::size_t size = 0;
+    for(std::size_t i = 0; i < m_properties.size(); ++ i)
+    {
+      if(m_properties[i]->size() == 0)
+        return 0;
+      size += m_properties[i]->size();
+    }
+    return size;
+  }
+
   void add_property(PLY_read_number* read_number)
   {
     m_properties.push_back(read_number);
@@ -430,12 +560,16 @@ public:
 
 class PLY_reader
 {
+  enum Format { ASCII = 0, BINARY_LITTLE_ENDIAN = 1, BINARY_BIG_ENDIAN = 2};
+
   std::vector<PLY_element> m_elements;
   std::string m_comments;
   bool m_verbose;
+  Format m_format;
+  PLY_binary_buffer m_buffer;
 
 public:
-  PLY_reader(bool verbose) : m_verbose(verbose) { }
+  PLY_reader(bool verbose) : m_verbose(verbose), m_format(ASCII) { }
 
   std::size_t number_of_elements() const { return m_elements.size(); }
   PLY_element& element(std::size_t idx)
@@ -445,12 +579,65 @@ public:
 
   const std::string& comments() const { return m_comments; }
 
+  bool is_binary() const { return m_format != ASCII; }
+
+  // Reads the properties of the next item of `element`
+  bool read_item(std::istream& stream, PLY_element& element)
+  {
+    for(std::size_t k = 0; k < element.number_of_properties(); ++ k)
+    {
+      PLY_read_number* property = element.property(k);
+      if(m_format == ASCII)
+      {
+        property->get(stream);
+        if(stream.fail())
+          return false;
+      }
+      else if(!property->get(stream, m_buffer))
+      {
+        stream.setstate(std::ios::failbit);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Number of items of `element` that `read_items()` should read at once
+  std::size_t items_per_block(const PLY_element& element) const
+  {
+    CGAL_precondition(element.item_size() != 0);
+    return (std::max)(std::size_t(1), PLY_binary_buffer::block_size() / element.item_size());
+  }
+
+  // Returns a pointer to the binary data of the next `nb_items` items of
+  // `element`, whose items must have a fixed size, or `nullptr` if the
+  // stream ends before. The pointer is valid until the next read.
+  const char* read_items(std::istream& stream, const PLY_element& element, std::size_t nb_items)
+  {
+    CGAL_precondition(is_binary() && element.item_size() != 0);
+    const std::size_t size = nb_items * element.item_size();
+    const char* data = m_buffer.require(stream, size);
+    if(data == nullptr)
+    {
+      stream.setstate(std::ios::failbit);
+      return nullptr;
+    }
+    m_buffer.consume(size);
+    return data;
+  }
+
+  // Puts back in `stream` what was read ahead of the last item
+  void release(std::istream& stream)
+  {
+    m_buffer.release(stream);
+  }
+
   template <typename Stream>
   bool init(Stream& stream)
   {
     std::size_t lineNumber = 0; // current line number
-    enum Format { ASCII = 0, BINARY_LITTLE_ENDIAN = 1, BINARY_BIG_ENDIAN = 2};
-    Format format = ASCII;
+    Format& format = m_format;
+    format = ASCII;
 
     std::string line;
     std::istringstream iss;
@@ -588,6 +775,86 @@ public:
 
 };
 
+// Decodes a numerical property of a PLY element from the binary data of
+// a block of items, as returned by `PLY_reader::read_items()`, converting
+// the values to `Type`. If the element has no such property, the values
+// are default-constructed.
+template <typename Type>
+class PLY_column
+{
+  const PLY_read_number* m_property;
+  std::size_t m_offset;
+  std::size_t m_stride;
+  int m_type;
+
+public:
+  PLY_column(PLY_element& element, const std::string& tag)
+    : m_property(nullptr), m_offset(0), m_stride(element.item_size()), m_type(-1)
+  {
+    for(std::size_t i = 0; i < element.number_of_properties(); ++ i)
+    {
+      const PLY_read_number* property = element.property(i);
+      if(property->name() == tag)
+      {
+        if(dynamic_cast<const PLY_read_typed_number<std::int8_t>*>(property)) m_type = 0;
+        else if(dynamic_cast<const PLY_read_typed_number<std::uint8_t>*>(property)) m_type = 1;
+        else if(dynamic_cast<const PLY_read_typed_number<std::int16_t>*>(property)) m_type = 2;
+        else if(dynamic_cast<const PLY_read_typed_number<std::uint16_t>*>(property)) m_type = 3;
+        else if(dynamic_cast<const PLY_read_typed_number<std::int32_t>*>(property)) m_type = 4;
+        else if(dynamic_cast<const PLY_read_typed_number<std::uint32_t>*>(property)) m_type = 5;
+        else if(dynamic_cast<const PLY_read_typed_number<float>*>(property)) m_type = 6;
+        else if(dynamic_cast<const PLY_read_typed_number<double>*>(property)) m_type = 7;
+        if(m_type != -1)
+          m_property = property;
+        return;
+      }
+      m_offset += property->size();
+    }
+  }
+
+  bool is_valid() const { return m_property != nullptr; }
+
+  // Returns the value of the `i`-th item of the block starting at `data`
+  Type operator()(const char* data, std::size_t i) const
+  {
+    const char* value = data + i * m_stride + m_offset;
+    switch(m_type)
+    {
+    case 0: return static_cast<Type>(m_property->template read<std::int8_t>(value));
+    case 1: return static_cast<Type>(m_property->template read<std::uint8_t>(value));
+    case 2: return static_cast<Type>(m_property->template read<std::int16_t>(value));
+    case 3: return static_cast<Type>(m_property->template read<std::uint16_t>(value));
+    case 4: return static_cast<Type>(m_property->template read<std::int32_t>(value));
+    case 5: return static_cast<Type>(m_property->template read<std::uint32_t>(value));
+    case 6: return static_cast<Type>(m_property->template read<float>(value));
+    case 7: return static_cast<Type>(m_property->template read<double>(value));
+    default: return Type();
+    }
+  }
+};
+
+// Calls `f(first, last)` on ranges covering [0, nb_items), concurrently
+// if `parallel` is `true` and TBB is available
+template <typename Function>
+void for_each_PLY_range(std::size_t nb_items, bool parallel, const Function& f)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  if(parallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_items, 4096),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        f(r.begin(), r.end());
+                      });
+    return;
+  }
+#else
+  CGAL_USE(parallel);
+#endif
+
+  f(std::size_t(0), nb_items);
+}
+
 template <class Reader, class T>
 void get_value(Reader& r, T& v, PLY_property<T>& wrapper)
 {
@@ -700,6 +967,7 @@ void process_properties(PLY_element& element, OutputValueType& new_element,
 
 template <typename Integer, class PolygonRange, class ColorOutputIterator>
 bool read_PLY_faces(std::istream& in,
+                    PLY_reader& reader,
                     PLY_element& element,
                     PolygonRange& polygons,
                     ColorOutputIterator fc_out,
@@ -726,14 +994,8 @@ bool read_PLY_faces(std::istream& in,
 
   for(std::size_t j = 0; j < element.number_of_items(); ++ j)
   {
-    for(std::size_t k = 0; k < element.number_of_properties(); ++ k)
-    {
-      PLY_read_number* property = element.property(k);
-      property->get(in);
-
-      if(in.fail())
-        return false;
-    }
+    if(!reader.read_item(in, element))
+      return false;
 
     std::tuple<std::vector<Integer>, std::uint8_t, std::uint8_t, std::uint8_t> new_face;
 
@@ -769,6 +1031,7 @@ bool read_PLY_faces(std::istream& in,
 
 template <typename Integer, class PolygonRange, class ColorRange>
 bool read_PLY_faces(std::istream& in,
+                    PLY_reader& reader,
                     PLY_element& element,
                     PolygonRange& polygons,
                     ColorRange& fcolors,
@@ -777,7 +1040,7 @@ bool read_PLY_faces(std::istream& in,
                       boost::has_range_const_iterator<ColorRange>::value
                     >* = nullptr)
 {
-  return read_PLY_faces<Integer>(in, element, polygons, std::back_inserter(fcolors), vertex_indices_tag);
+  return read_PLY_faces<Integer>(in, reader, element, polygons, std::back_inserter(fcolors), vertex_indices_tag);
 }
 
 } // namespace PLY
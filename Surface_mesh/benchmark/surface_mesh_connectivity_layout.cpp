@@ -0,0 +1,173 @@
+// Compares the halfedge connectivity layouts of `Surface_mesh`.
+// The layout is chosen at compile time, so this file is compiled twice (see CMakeLists.txt):
+// - the default layout, with one struct per halfedge,
+// - `CGAL_SURFACE_MESH_SOA_CONNECTIVITY`, with one array per connectivity field.
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+// Counts the bytes currently allocated with `new`, to measure the footprint of a mesh
+std::size_t allocated_bytes = 0;
+
+void* operator new(std::size_t size)
+{
+  // the size is stored in front of the block, which keeps the alignment of `std::max_align_t`
+  void* p = std::malloc(size + sizeof(std::max_align_t));
+  if(p == nullptr)
+    throw std::bad_alloc();
+  *static_cast<std::size_t*>(p) = size;
+  allocated_bytes += size;
+  return static_cast<char*>(p) + sizeof(std::max_align_t);
+}
+
+void operator delete(void* p) noexcept
+{
+  if(p == nullptr)
+    return;
+  void* block = static_cast<char*>(p) - sizeof(std::max_align_t);
+  allocated_bytes -= *static_cast<std::size_t*>(block);
+  std::free(block);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  operator delete(p);
+}
+
+typedef CGAL::Simple_cartesian<double>                  K;
+typedef K::Point_3                                      Point_3;
+typedef CGAL::Surface_mesh<Point_3>                     Surface_mesh;
+
+typedef Surface_mesh::Vertex_index                      Vertex_index;
+typedef Surface_mesh::Halfedge_index                    Halfedge_index;
+typedef Surface_mesh::Face_index                        Face_index;
+
+const char* layout_name()
+{
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+  return "one array per field";
+#else
+  return "one struct per halfedge";
+#endif
+}
+
+// The traversals return a checksum so that they are not optimized away
+template <typename Traversal>
+std::size_t run(const std::string& name, const Surface_mesh& sm, const int repeat, const Traversal& traversal)
+{
+  CGAL::Real_timer timer;
+  timer.start();
+  std::size_t checksum = 0;
+  for(int i=0; i<repeat; ++i)
+    checksum += traversal(sm);
+  timer.stop();
+
+  const double nh = double(repeat) * double(sm.number_of_halfedges());
+  std::cout << "  " << name << ": " << timer.time() << " s ("
+            << nh / timer.time() * 1e-6 << " M halfedges/s)" << std::endl;
+  return checksum;
+}
+
+int main(int argc, char** argv)
+{
+  Surface_mesh sm;
+  if(argc > 1)
+  {
+    if(!CGAL::IO::read_polygon_mesh(argv[1], sm))
+    {
+      std::cerr << "Invalid input: " << argv[1] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  else
+  {
+    CGAL::make_grid(1000, 1000, sm, true /*triangulated*/);
+  }
+  const int repeat = (argc > 2) ? std::atoi(argv[2]) : 10;
+
+  std::cout << "Layout: " << layout_name() << std::endl;
+  std::cout << num_vertices(sm) << " vertices, " << num_halfedges(sm) << " halfedges, "
+            << num_faces(sm) << " faces" << std::endl;
+
+  // a deep copy allocates all the properties with their exact size
+  const std::size_t bytes_before = allocated_bytes;
+  const Surface_mesh copy(sm);
+  const std::size_t bytes_after = allocated_bytes;
+
+  std::cout << "Memory:" << std::endl;
+  std::cout << "  whole mesh: " << double(bytes_after - bytes_before) / double(num_halfedges(copy))
+            << " bytes per halfedge" << std::endl;
+
+  std::cout << "Traversals (" << repeat << " times):" << std::endl;
+  std::size_t checksum = 0;
+
+  // only needs `next()`
+  checksum += run("face degrees", sm, repeat, [](const Surface_mesh& sm)
+  {
+    std::size_t degree = 0;
+    for(Face_index f : sm.faces())
+    {
+      Halfedge_index h = sm.halfedge(f), done = h;
+      do { ++degree; h = sm.next(h); } while(h != done);
+    }
+    return degree;
+  });
+
+  // needs `next()` and `target()`
+  checksum += run("face vertices", sm, repeat, [](const Surface_mesh& sm)
+  {
+    std::size_t sum = 0;
+    for(Face_index f : sm.faces())
+    {
+      Halfedge_index h = sm.halfedge(f), done = h;
+      do { sum += std::size_t(sm.target(h)); h = sm.next(h); } while(h != done);
+    }
+    return sum;
+  });
+
+  // needs `next()` and `opposite()`
+  checksum += run("vertex valences", sm, repeat, [](const Surface_mesh& sm)
+  {
+    std::size_t valence = 0;
+    for(Vertex_index v : sm.vertices())
+    {
+      Halfedge_index h = sm.halfedge(v), done = h;
+      if(h == sm.null_halfedge())
+        continue;
+      do { ++valence; h = sm.opposite(sm.next(h)); } while(h != done);
+    }
+    return valence;
+  });
+
+  // needs `face()`
+  checksum += run("border halfedges", sm, repeat, [](const Surface_mesh& sm)
+  {
+    std::size_t nb = 0;
+    for(Halfedge_index h : sm.halfedges())
+      if(sm.is_border(h))
+        ++nb;
+    return nb;
+  });
+
+  // needs `prev()`
+  checksum += run("previous halfedges", sm, repeat, [](const Surface_mesh& sm)
+  {
+    std::size_t sum = 0;
+    for(Halfedge_index h : sm.halfedges())
+      sum += std::size_t(sm.prev(h));
+    return sum;
+  });
+
+  std::cout << "Checksum: " << checksum << std::endl;
+  return EXIT_SUCCESS;
+}
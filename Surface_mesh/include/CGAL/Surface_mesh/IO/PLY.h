@@ -22,6 +22,7 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 
 #include <CGAL/IO/PLY.h>
+#include <CGAL/tags.h>
 
 namespace CGAL {
 namespace IO {
@@ -45,6 +46,8 @@ private:
   {
     virtual ~Abstract_ply_property_to_surface_mesh_property() { }
     virtual void assign(PLY_element& element, size_type index) = 0;
+    virtual void assign(PLY_element& element, const char* data, std::size_t nb_items,
+                        const Vertex_index* vertices, bool parallel) = 0;
   };
 
   template <typename Simplex, typename Type>
@@ -69,6 +72,33 @@ private:
       put(m_map, Simplex(index), t);
     }
 
+    // Fills the property of `vertices` from a block of binary items
+    virtual void assign(PLY_element& element, const char* data, std::size_t nb_items,
+                        const Vertex_index* vertices, bool parallel)
+    {
+      assign_block(element, data, nb_items, vertices, parallel, static_cast<Type*>(nullptr));
+    }
+
+    template <typename T>
+    void assign_block(PLY_element& element, const char* data, std::size_t nb_items,
+                      const Vertex_index* vertices, bool parallel, T*)
+    {
+      const PLY_column<T> column(element, m_name);
+      for_each_PLY_range(nb_items, parallel, [&](std::size_t begin, std::size_t end)
+      {
+        for(std::size_t i = begin; i < end; ++ i)
+          put(m_map, Simplex(size_type(vertices[i])), column(data, i));
+      });
+    }
+
+    // Items with lists are never read by blocks
+    template <typename T>
+    void assign_block(PLY_element&, const char*, std::size_t,
+                      const Vertex_index*, bool, std::vector<T>*)
+    {
+      CGAL_assertion(false);
+    }
+
     std::string prefix(Vertex_index) const { return "v:"; }
     std::string prefix(Face_index) const { return "f:"; }
     std::string prefix(Edge_index) const { return "e:"; }
@@ -265,6 +295,49 @@ public:
       m_vertex_properties[i]->assign(element, vi);
   }
 
+  // Adds the vertices of a block of binary items, as returned by `PLY_reader::read_items()`
+  void process_vertex_block(PLY_element& element, const char* data, std::size_t nb_items, bool parallel)
+  {
+    const std::size_t first = m_map_v2v.size();
+    for(std::size_t i = 0; i < nb_items; ++i)
+      m_map_v2v.push_back(m_mesh.add_vertex());
+    const Vertex_index* vertices = m_map_v2v.data() + first;
+
+    const PLY_column<double> x(element, "x"), y(element, "y"), z(element, "z");
+    const PLY_column<double> nx(element, "nx"), ny(element, "ny"), nz(element, "nz");
+    const PLY_column<unsigned char> r(element, "red"), g(element, "green"), b(element, "blue");
+    const PLY_column<float> rf(element, "red"), gf(element, "green"), bf(element, "blue");
+    const bool uchar_colors = element.has_property("red", (unsigned char)(0));
+    const bool float_colors = !uchar_colors && element.has_property("red", float(0));
+
+    for_each_PLY_range(nb_items, parallel, [&](std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; ++i)
+      {
+        const Vertex_index vi = vertices[i];
+        m_mesh.point(vi) = Point(x(data, i), y(data, i), z(data, i));
+
+        if(m_normals == 3)
+          m_normal_map[vi] = Vector(nx(data, i), ny(data, i), nz(data, i));
+
+        if(m_vcolors == 3)
+        {
+          if(uchar_colors)
+            m_vcolor_map[vi] = CGAL::IO::Color(r(data, i), g(data, i), b(data, i));
+          else if(float_colors)
+            m_vcolor_map[vi] = CGAL::IO::Color(static_cast<unsigned char>(std::floor(rf(data, i)*255)),
+                                               static_cast<unsigned char>(std::floor(gf(data, i)*255)),
+                                               static_cast<unsigned char>(std::floor(bf(data, i)*255)));
+          else
+            m_vcolor_map[vi] = CGAL::IO::Color(0, 0, 0);
+        }
+      }
+    });
+
+    for(std::size_t i = 0; i < m_vertex_properties.size(); ++i)
+      m_vertex_properties[i]->assign(element, data, nb_items, vertices, parallel);
+  }
+
   template <typename FT>
   void process_line(PLY_element& element, Vertex_index& vi)
   {
@@ -556,7 +629,8 @@ bool fill_simplex_specific_header(std::ostream&,
                                   typename Surface_mesh<Point>::Halfedge_index>*>& ,
                                   const std::string& prop)
 {
-  if(prop == "h:connectivity")
+  // also covers the per-field arrays "h:connectivity:*" of the split layout
+  if(prop.compare(0, 14, "h:connectivity") == 0)
     return true;
 
   return false;
@@ -775,6 +849,11 @@ void fill_header(std::ostream& os, const Surface_mesh<Point>& sm,
 ///   added, where `[s]` is `v` for vertex and `f` for face, and
 ///   `[name]` is the name of the PLY property.
 ///
+/// In binary files, vertices with no list property are read and decoded
+/// by large blocks, which is much faster than reading them one by one.
+///
+/// \tparam ConcurrencyTag enables sequential versus parallel decoding of the blocks of binary vertices.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 /// \tparam Point The type of the \em point property of a vertex. There is no requirement on `P`,
 ///               besides being default constructible and assignable.
 ///               In typical use cases it will be a 2D or 3D point type.
@@ -791,7 +870,7 @@ void fill_header(std::ostream& os, const Surface_mesh<Point>& sm,
 ///
 /// \returns `true` if reading was successful, `false` otherwise.
 ///
-template <typename P>
+template <typename ConcurrencyTag = Sequential_tag, typename P>
 bool read_PLY(std::istream& is,
               Surface_mesh<P>& sm,
               std::string& comments,
@@ -799,6 +878,12 @@ bool read_PLY(std::istream& is,
 {
   typedef typename Surface_mesh<P>::size_type size_type;
 
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  const bool parallel = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+
   if(!is.good())
   {
     if(verbose)
@@ -853,15 +938,25 @@ bool read_PLY(std::istream& is,
     if(is_halfedge)
       filler.instantiate_halfedge_properties(element);
 
-    for(std::size_t j = 0; j < element.number_of_items(); ++ j)
+    // Binary vertices of fixed size are decoded by blocks
+    if(is_vertex && reader.is_binary() && element.item_size() != 0)
     {
-      for(std::size_t k = 0; k < element.number_of_properties(); ++ k)
+      const std::size_t block_size = reader.items_per_block(element);
+      for(std::size_t j = 0; j < element.number_of_items(); j += block_size)
       {
-        internal::PLY_read_number* property = element.property(k);
-        property->get(is);
-        if(is.fail())
+        const std::size_t nb_items = (std::min)(block_size, element.number_of_items() - j);
+        const char* data = reader.read_items(is, element, nb_items);
+        if(data == nullptr)
           return false;
+        filler.process_vertex_block(element, data, nb_items, parallel);
       }
+      continue;
+    }
+
+    for(std::size_t j = 0; j < element.number_of_items(); ++ j)
+    {
+      if(!reader.read_item(is, element))
+        return false;
 
       if(is_vertex)
         filler.process_vertex_line(element);
@@ -880,16 +975,17 @@ bool read_PLY(std::istream& is,
     }
   }
 
+  reader.release(is);
   return true;
 }
 
 /// \cond SKIP_IN_MANUAL
 
-template <typename P>
+template <typename ConcurrencyTag = Sequential_tag, typename P>
 bool read_PLY(std::istream& is, Surface_mesh<P>& sm)
 {
   std::string dummy;
-  return read_PLY(is, sm, dummy);
+  return read_PLY<ConcurrencyTag>(is, sm, dummy);
 }
 
 /// \endcond
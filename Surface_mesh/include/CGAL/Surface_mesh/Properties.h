@@ -17,11 +17,13 @@
 #ifndef DOXYGEN_RUNNING
 
 #include <CGAL/assertions.h>
+#include <CGAL/for_each.h>
 #include <CGAL/property_map.h>
 
 #include <algorithm>
 #include <string>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -64,6 +66,13 @@ public:
     /// Let two elements swap their storage place.
     virtual void swap(size_t i0, size_t i1) = 0;
 
+    /// Let each pair of elements swap their storage place.
+    virtual void swap(const std::vector<std::pair<size_t, size_t> >& pairs)
+    {
+        for (const std::pair<size_t, size_t>& p : pairs)
+            swap(p.first, p.second);
+    }
+
     /// Return a deep copy of self.
     virtual Base_property_array* clone () const = 0;
 
@@ -163,6 +172,16 @@ public: // virtual interface of Base_property_array
         data_[i1]=d;
     }
 
+    virtual void swap(const std::vector<std::pair<size_t, size_t> >& pairs)
+    {
+        for (const std::pair<size_t, size_t>& p : pairs)
+        {
+            T d(data_[p.first]);
+            data_[p.first]=data_[p.second];
+            data_[p.second]=d;
+        }
+    }
+
     virtual Base_property_array* clone() const
     {
         Property_array<T>* p = new Property_array<T>(this->name_, this->value_);
@@ -503,6 +522,18 @@ public:
             parrays_[i]->swap(i0, i1);
     }
 
+    // swap each pair of elements in all arrays, the arrays being possibly processed concurrently
+    template <typename ConcurrencyTag>
+    void swap(const std::vector<std::pair<size_t, size_t> >& pairs) const
+    {
+        CGAL::for_each<ConcurrencyTag>(parrays_,
+                                       [&](Base_property_array* parray) -> bool
+                                       {
+                                         parray->swap(pairs);
+                                         return true;
+                                       });
+    }
+
     // swap content with other Property_container
     void swap (Property_container& other)
     {
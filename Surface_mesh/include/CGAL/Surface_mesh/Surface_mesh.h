@@ -28,6 +28,7 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/circulator.h>
+#include <CGAL/for_each.h>
 #include <CGAL/Handle_hash_function.h>
 #include <CGAL/IO/Verbose_ostream.h>
 #include <CGAL/Iterator_range.h>
@@ -35,14 +36,23 @@
 
 #include <boost/cstdint.hpp>
 #include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/irange.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_sort.h>
+#endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 #include <vector>
@@ -497,6 +507,19 @@ private: //-------------------------------------------------- connectivity types
         Halfedge_index  halfedge_;
     };
 
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+    /// This type stores the halfedge connectivity as one property array per field,
+    /// so that a traversal only reads the field it needs
+    /// \sa `Halfedge_connectivity`
+    struct Halfedge_connectivity_arrays
+    {
+        Property_map<Halfedge_index, Face_index>      face_;
+        Property_map<Halfedge_index, Vertex_index>    vertex_;
+        Property_map<Halfedge_index, Halfedge_index>  next_halfedge_;
+        Property_map<Halfedge_index, Halfedge_index>  prev_halfedge_;
+    };
+#endif
+
 private: //------------------------------------------------------ iterator types
     template<typename Index_>
     class Index_iterator
@@ -1012,7 +1035,7 @@ public:
       size_type inf = (std::numeric_limits<size_type>::max)();
       if(recycle_ && (edges_freelist_ != inf)){
         size_type idx = edges_freelist_;
-        edges_freelist_ = (size_type)hconn_[Halfedge_index(edges_freelist_)].next_halfedge_;
+        edges_freelist_ = (size_type)next(Halfedge_index(edges_freelist_));
         --removed_edges_;
         eremoved_[Edge_index(Halfedge_index(idx))] = false;
         hprops_.reset(Halfedge_index(idx));
@@ -1089,6 +1112,25 @@ public:
         return add_face(v);
     }
 
+    /// adds the points and the polygons of a polygon soup at once.
+    /// Rather than adding the faces one by one, the halfedges of the polygons are paired by sorting
+    /// their pairs of vertices, and all the connectivity is then set in a single pass over the polygons.
+    /// The vertex and face indices are those of `points` and `polygons`, shifted respectively by
+    /// `number_of_vertices() + number_of_removed_vertices()` and `number_of_faces() + number_of_removed_faces()`.
+    /// Points that are not used by any polygon become isolated vertices.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel construction.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// The mesh does not depend on the concurrency tag.
+    /// \tparam PointRange a model of `RandomAccessRange` whose value type is convertible to `P`
+    /// \tparam PolygonRange a model of `RandomAccessRange` whose value type is a model of `RandomAccessRange`
+    /// whose value type is an integer type
+    ///
+    /// \pre The polygons, given by indices in `points`, describe a consistently oriented polygon mesh
+    /// (see `CGAL::Polygon_mesh_processing::is_polygon_soup_a_polygon_mesh()`).
+    template <typename ConcurrencyTag = Sequential_tag, typename PointRange, typename PolygonRange>
+    void add_polygon_soup(const PointRange& points, const PolygonRange& polygons);
+
     ///@}
 
 
@@ -1119,7 +1161,7 @@ public:
     void remove_edge(Edge_index e)
     {
         eremoved_[e] = true; ++removed_edges_; garbage_ = true;
-        hconn_[Halfedge_index((size_type)e << 1)].next_halfedge_ = Halfedge_index(edges_freelist_ );
+        set_next_only(Halfedge_index((size_type)e << 1), Halfedge_index(edges_freelist_));
         edges_freelist_ = ((size_type)e << 1);
     }
 
@@ -1241,17 +1283,17 @@ public:
     // translate indices in halfedge -> face, halfedge -> target, halfedge -> prev, and halfedge -> next
     for(size_type i = nh; i < nh+other.num_halfedges(); i++){
       Halfedge_index hi(i);
-      if(hconn_[hi].face_ != null_face()){
-        hconn_[hi].face_ = Face_index(size_type(hconn_[hi].face_)+nf);
+      if(face(hi) != null_face()){
+        set_face(hi, Face_index(size_type(face(hi))+nf));
       }
-      if( hconn_[hi].vertex_ != null_vertex()){
-        hconn_[hi].vertex_ = Vertex_index(size_type(hconn_[hi].vertex_)+nv);
+      if(target(hi) != null_vertex()){
+        set_target(hi, Vertex_index(size_type(target(hi))+nv));
       }
-      if(hconn_[hi].next_halfedge_ != null_halfedge()){
-        hconn_[hi].next_halfedge_ = Halfedge_index(size_type(hconn_[hi].next_halfedge_)+nh);
+      if(next(hi) != null_halfedge()){
+        set_next_only(hi, Halfedge_index(size_type(next(hi))+nh));
       }
-      if(hconn_[hi].prev_halfedge_ != null_halfedge()){
-        hconn_[hi].prev_halfedge_ = Halfedge_index(size_type(hconn_[hi].prev_halfedge_)+nh);
+      if(prev(hi) != null_halfedge()){
+        set_prev_only(hi, Halfedge_index(size_type(prev(hi))+nh));
       }
     }
     size_type inf_value = (std::numeric_limits<size_type>::max)();
@@ -1290,11 +1332,11 @@ public:
     if(other.edges_freelist_ != inf_value){
       Halfedge_index hi(nh+other.edges_freelist_);
       Halfedge_index inf((std::numeric_limits<size_type>::max)());
-      while(hconn_[hi].next_halfedge_ != inf){
-        hi = hconn_[hi].next_halfedge_;
+      while(next(hi) != inf){
+        hi = next(hi);
       }
       // append the halfedge free linked list of `this` to the copy of `other`
-      hconn_[hi].next_halfedge_ = Halfedge_index(edges_freelist_);
+      set_next_only(hi, Halfedge_index(edges_freelist_));
       // update the begin of the halfedge free linked list
       edges_freelist_ = nh + other.edges_freelist_;
     }
@@ -1392,10 +1434,16 @@ public:
     /// In case you store indices in an auxiliary data structure
     /// or in a property these indices are potentially no longer
     /// referring to the right elements.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel garbage collection.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// In parallel, the property arrays are compacted concurrently. The new indices do not
+    /// depend on the concurrency tag.
+    template <typename ConcurrencyTag = Sequential_tag>
     void collect_garbage();
 
     //undocumented convenience function that allows to get old-index->new-index information
-    template <typename Visitor>
+    template <typename ConcurrencyTag = Sequential_tag, typename Visitor>
     void collect_garbage(Visitor& visitor);
 
     /// controls the recycling or not of simplices previously marked as removed
@@ -1562,7 +1610,7 @@ public:
         size_type efl = edges_freelist_;
         size_type re = 0;
         while(efl != inf){
-          efl = (size_type)hconn_[Halfedge_index(efl)].next_halfedge_;
+          efl = (size_type)next(Halfedge_index(efl));
           re++;
         }
         valid = valid && ( re == removed_edges_ );
@@ -1611,10 +1659,10 @@ public:
           return false;
         }
 
-        Face_index f = hconn_[h].face_;
-        Vertex_index v = hconn_[h].vertex_;
-        Halfedge_index hn = hconn_[h].next_halfedge_;
-        Halfedge_index hp = hconn_[h].prev_halfedge_;
+        Face_index f = face(h);
+        Vertex_index v = target(h);
+        Halfedge_index hn = next(h);
+        Halfedge_index hp = prev(h);
 
         bool valid = true;
         // don't validate the face if this is a border halfedge
@@ -1698,51 +1746,83 @@ public:
     /// returns the vertex the halfedge `h` points to.
     Vertex_index target(Halfedge_index h) const
     {
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        return hconn_.vertex_[h];
+#else
         return hconn_[h].vertex_;
+#endif
     }
 
     /// sets the vertex the halfedge `h` points to to `v`.
     void set_target(Halfedge_index h, Vertex_index v)
     {
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        hconn_.vertex_[h] = v;
+#else
         hconn_[h].vertex_ = v;
+#endif
     }
 
     /// returns the face incident to halfedge `h`.
     Face_index face(Halfedge_index h) const
     {
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        return hconn_.face_[h];
+#else
         return hconn_[h].face_;
+#endif
     }
 
     /// sets the incident face to halfedge `h` to `f`.
     void set_face(Halfedge_index h, Face_index f)
     {
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        hconn_.face_[h] = f;
+#else
         hconn_[h].face_ = f;
+#endif
     }
 
     /// returns the next halfedge within the incident face.
     Halfedge_index next(Halfedge_index h) const
     {
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        return hconn_.next_halfedge_[h];
+#else
         return hconn_[h].next_halfedge_;
+#endif
     }
 
     /// returns the previous halfedge within the incident face.
     Halfedge_index prev(Halfedge_index h) const
     {
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        return hconn_.prev_halfedge_[h];
+#else
         return hconn_[h].prev_halfedge_;
+#endif
     }
 
     /// @cond CGAL_DOCUMENT_INTERNALS
     // sets the next halfedge of `h` within the face to `nh`.
     void set_next_only(Halfedge_index h, Halfedge_index nh)
     {
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+      hconn_.next_halfedge_[h] = nh;
+#else
       hconn_[h].next_halfedge_ = nh;
+#endif
     }
 
     // sets previous halfedge of `h` to `nh`.
     void set_prev_only(Halfedge_index h, Halfedge_index nh)
     {
       if(h != null_halfedge()){
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        hconn_.prev_halfedge_[h] = nh;
+#else
         hconn_[h].prev_halfedge_ = nh;
+#endif
       }
     }
     /// @endcond
@@ -2207,6 +2287,56 @@ private: //--------------------------------------------------- helper functions
     /// if `v` is a border vertex.
     void adjust_incoming_halfedge(Vertex_index v);
 
+    // computes the pairs of elements that `collect_garbage()` swaps to move the elements
+    // among the `n` first ones that are not removed to the front, and returns their number
+    template <typename Index>
+    static size_type compaction_swaps(const Property_map<Index, bool>& removed, const size_type n,
+                                      std::vector<std::pair<std::size_t, std::size_t> >& swaps)
+    {
+      if (n == 0)
+        return 0;
+
+      std::vector<bool> is_removed(removed.begin(), removed.begin() + n);
+      size_type i0 = 0, i1 = n-1;
+      while (1)
+      {
+        // find first removed and last un-removed
+        while (!is_removed[i0] && i0 < i1) ++i0;
+        while ( is_removed[i1] && i0 < i1) --i1;
+        if (i0 >= i1) break;
+
+        // swap
+        is_removed[i0] = false;
+        is_removed[i1] = true;
+        swaps.emplace_back(i0, i1);
+      }
+
+      return is_removed[i0] ? i0 : i0+1;
+    }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template <typename Visitor>
+    void collect_garbage_in_parallel(Visitor& visitor);
+#endif
+
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+    // adds the halfedge connectivity arrays if `create` is `true`, and fetches the existing ones otherwise
+    void init_halfedge_connectivity(bool create)
+    {
+      auto get_array = [this, create](auto& pmap, const std::string& name)
+      {
+        typedef typename std::decay_t<decltype(pmap)>::value_type Value;
+        pmap = create ? add_property_map<Halfedge_index, Value>(name).first
+                      : property_map<Halfedge_index, Value>(name).first;
+      };
+
+      get_array(hconn_.face_, "h:connectivity:face");
+      get_array(hconn_.vertex_, "h:connectivity:vertex");
+      get_array(hconn_.next_halfedge_, "h:connectivity:next");
+      get_array(hconn_.prev_halfedge_, "h:connectivity:prev");
+    }
+#endif
+
 private: //------------------------------------------------------- private data
     Properties::Property_container<Self, Vertex_index> vprops_;
     Properties::Property_container<Self, Halfedge_index> hprops_;
@@ -2214,7 +2344,11 @@ private: //------------------------------------------------------- private data
     Properties::Property_container<Self, Face_index> fprops_;
 
     Property_map<Vertex_index, Vertex_connectivity>      vconn_;
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+    Halfedge_connectivity_arrays                         hconn_;
+#else
     Property_map<Halfedge_index, Halfedge_connectivity>  hconn_;
+#endif
     Property_map<Face_index, Face_connectivity>          fconn_;
 
     Property_map<Vertex_index, bool>  vremoved_;
@@ -2287,7 +2421,11 @@ Surface_mesh()
     // allocate standard properties
     // same list is used in operator=() and assign()
     vconn_    = add_property_map<Vertex_index, Vertex_connectivity>("v:connectivity").first;
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+    init_halfedge_connectivity(true);
+#else
     hconn_    = add_property_map<Halfedge_index, Halfedge_connectivity>("h:connectivity").first;
+#endif
     fconn_    = add_property_map<Face_index, Face_connectivity>("f:connectivity").first;
     vpoint_   = add_property_map<Vertex_index, Point>("v:point").first;
     vremoved_ = add_property_map<Vertex_index, bool>("v:removed", false).first;
@@ -2318,7 +2456,11 @@ operator=(const Surface_mesh<P>& rhs)
 
         // property handles contain pointers, have to be reassigned
         vconn_    = property_map<Vertex_index, Vertex_connectivity>("v:connectivity").first;
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        init_halfedge_connectivity(false);
+#else
         hconn_    = property_map<Halfedge_index, Halfedge_connectivity>("h:connectivity").first;
+#endif
         fconn_    = property_map<Face_index, Face_connectivity>("f:connectivity").first;
         vremoved_ = property_map<Vertex_index, bool>("v:removed").first;
         eremoved_ = property_map<Edge_index, bool>("e:removed").first;
@@ -2357,7 +2499,11 @@ assign(const Surface_mesh<P>& rhs)
 
         // allocate standard properties
         vconn_    = add_property_map<Vertex_index, Vertex_connectivity>("v:connectivity").first;
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        init_halfedge_connectivity(true);
+#else
         hconn_    = add_property_map<Halfedge_index, Halfedge_connectivity>("h:connectivity").first;
+#endif
         fconn_    = add_property_map<Face_index, Face_connectivity>("f:connectivity").first;
         vpoint_   = add_property_map<Vertex_index, P>("v:point").first;
         vremoved_ = add_property_map<Vertex_index, bool>("v:removed", false).first;
@@ -2366,7 +2512,14 @@ assign(const Surface_mesh<P>& rhs)
 
         // copy properties from other mesh
         vconn_.array()     = rhs.vconn_.array();
+#ifdef CGAL_SURFACE_MESH_SOA_CONNECTIVITY
+        hconn_.face_.array()          = rhs.hconn_.face_.array();
+        hconn_.vertex_.array()        = rhs.hconn_.vertex_.array();
+        hconn_.next_halfedge_.array() = rhs.hconn_.next_halfedge_.array();
+        hconn_.prev_halfedge_.array() = rhs.hconn_.prev_halfedge_.array();
+#else
         hconn_.array()     = rhs.hconn_.array();
+#endif
         fconn_.array()     = rhs.fconn_.array();
         vpoint_.array()    = rhs.vpoint_.array();
         vremoved_.array()  = rhs.vremoved_.array();
@@ -2529,6 +2682,171 @@ Surface_mesh<P>::add_face(const Range& r)
 
   /// @endcond
 
+//-----------------------------------------------------------------------------
+template <typename P>
+template <typename ConcurrencyTag, typename PointRange, typename PolygonRange>
+void
+Surface_mesh<P>::
+add_polygon_soup(const PointRange& points, const PolygonRange& polygons)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  const size_type inf = (std::numeric_limits<size_type>::max)();
+  const size_type nv0 = num_vertices(), ne0 = num_edges(), nf0 = num_faces();
+  const size_type nv = size_type(points.size()), nf = size_type(polygons.size());
+
+  // the halfedges of the polygon `i` are numbered from `offsets[i]` to `offsets[i+1]-1`
+  std::vector<size_type> offsets(nf+1, 0);
+  for(size_type i=0; i<nf; ++i)
+    offsets[i+1] = offsets[i] + size_type(polygons[i].size());
+  const size_type nph = offsets[nf];
+
+  // sorting the halfedges by their smallest and largest vertex makes the two halfedges of an edge consecutive
+  struct Halfedge_key
+  {
+    size_type source, target, id;
+
+    size_type min() const { return (std::min)(source, target); }
+    size_type max() const { return (std::max)(source, target); }
+
+    bool same_edge(const Halfedge_key& other) const
+    {
+      return min() == other.min() && max() == other.max();
+    }
+
+    bool operator<(const Halfedge_key& other) const
+    {
+      if(min() != other.min())
+        return min() < other.min();
+      if(max() != other.max())
+        return max() < other.max();
+      return id < other.id;
+    }
+  };
+
+  std::vector<Halfedge_key> keys(nph);
+  CGAL::for_each<ConcurrencyTag>(boost::irange<size_type>(0, nf), [&](const size_type i) -> bool
+  {
+    const auto& polygon = polygons[i];
+    const size_type n = size_type(polygon.size());
+    for(size_type k=0; k<n; ++k)
+      keys[offsets[i]+k] = Halfedge_key{ size_type(polygon[k]), size_type(polygon[(k+1)%n]), offsets[i]+k };
+    return true;
+  });
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    tbb::parallel_sort(keys.begin(), keys.end());
+  else
+#endif
+    std::sort(keys.begin(), keys.end());
+
+  // an edge starts at each key which is not the second halfedge of the edge of the previous key:
+  // the edges are counted per block of keys, and then numbered from the partial sums of the counts
+  auto is_first = [&](const size_type j) { return j == 0 || !keys[j].same_edge(keys[j-1]); };
+
+  const size_type block_size = 1 << 16;
+  const size_type nb_blocks = (nph + block_size - 1) / block_size;
+  std::vector<size_type> first_edge(nb_blocks+1, 0);
+  CGAL::for_each<ConcurrencyTag>(boost::irange<size_type>(0, nb_blocks), [&](const size_type b) -> bool
+  {
+    for(size_type j=b*block_size, end=(std::min)(nph, (b+1)*block_size); j<end; ++j)
+      if(is_first(j))
+        ++first_edge[b+1];
+    return true;
+  });
+  for(size_type b=0; b<nb_blocks; ++b)
+    first_edge[b+1] += first_edge[b];
+  const size_type ne = first_edge[nb_blocks];
+
+  resize(nv0 + nv, ne0 + ne, nf0 + nf);
+
+  // the halfedge of the mesh of each halfedge of the polygons, and the incoming and outgoing border halfedges
+  // of each vertex, which are unique as the vertices are manifold
+  std::vector<size_type> halfedge_ids(nph);
+  std::vector<std::pair<Halfedge_index, Halfedge_index> > border_halfedges(nv);
+  CGAL::for_each<ConcurrencyTag>(boost::irange<size_type>(0, nb_blocks), [&](const size_type b) -> bool
+  {
+    size_type e = ne0 + first_edge[b];
+    for(size_type j=b*block_size, end=(std::min)(nph, (b+1)*block_size); j<end; ++j)
+    {
+      const Halfedge_key& key = keys[j];
+      if(is_first(j))
+      {
+        halfedge_ids[key.id] = 2*e;
+        if(j+1 == nph || is_first(j+1))
+        {
+          const Halfedge_index h(2*e+1);
+          set_target(h, Vertex_index(nv0 + key.source));
+          set_face(h, null_face());
+          border_halfedges[key.source].first = h;
+          border_halfedges[key.target].second = h;
+        }
+        ++e;
+      }
+      else
+      {
+        CGAL_precondition_msg(is_first(j-1) && keys[j-1].source == key.target,
+                              "An edge has more than two halfedges, or two halfedges with the same orientation.");
+        halfedge_ids[key.id] = 2*(e-1)+1;
+      }
+    }
+    return true;
+  });
+
+  // the incoming halfedge of an inner vertex is the first halfedge of the polygons pointing to it,
+  // whatever the order in which the polygons are processed
+  std::vector<std::atomic<size_type> > incoming_ids(nv);
+  CGAL::for_each<ConcurrencyTag>(boost::irange<size_type>(0, nv), [&](const size_type i) -> bool
+  {
+    incoming_ids[i].store(inf, std::memory_order_relaxed);
+    return true;
+  });
+
+  CGAL::for_each<ConcurrencyTag>(boost::irange<size_type>(0, nf), [&](const size_type i) -> bool
+  {
+    const auto& polygon = polygons[i];
+    const size_type n = size_type(polygon.size());
+    const Face_index f(nf0 + i);
+    set_halfedge(f, Halfedge_index(halfedge_ids[offsets[i]]));
+    for(size_type k=0; k<n; ++k)
+    {
+      const Halfedge_index h(halfedge_ids[offsets[i]+k]), hn(halfedge_ids[offsets[i]+(k+1)%n]);
+      const size_type v = size_type(polygon[(k+1)%n]);
+      set_target(h, Vertex_index(nv0 + v));
+      set_face(h, f);
+      set_next(h, hn);
+
+      size_type incoming = incoming_ids[v].load(std::memory_order_relaxed);
+      while(offsets[i]+k < incoming &&
+            !incoming_ids[v].compare_exchange_weak(incoming, offsets[i]+k, std::memory_order_relaxed));
+    }
+    return true;
+  });
+
+  CGAL::for_each<ConcurrencyTag>(boost::irange<size_type>(0, nv), [&](const size_type i) -> bool
+  {
+    const Vertex_index v(nv0 + i);
+    vpoint_[v] = points[i];
+
+    const std::pair<Halfedge_index, Halfedge_index>& border = border_halfedges[i];
+    if(border.first != null_halfedge())
+    {
+      CGAL_precondition_msg(border.second != null_halfedge(), "A vertex is not manifold.");
+      set_next(border.first, border.second);
+      set_halfedge(v, border.first);
+    }
+    else if(incoming_ids[i].load(std::memory_order_relaxed) != inf)
+    {
+      set_halfedge(v, Halfedge_index(halfedge_ids[incoming_ids[i].load(std::memory_order_relaxed)]));
+    }
+    return true;
+  });
+}
+
 //-----------------------------------------------------------------------------
 template <typename P>
 typename Surface_mesh<P>::size_type
@@ -2570,16 +2888,29 @@ degree(Face_index f) const
     return count;
 }
 
-template <typename P> template< typename Visitor>
+template <typename P> template <typename ConcurrencyTag, typename Visitor>
 void
 Surface_mesh<P>::
 collect_garbage(Visitor &visitor)
 {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     if (!has_garbage())
     {
       return;
     }
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      collect_garbage_in_parallel(visitor);
+      return;
+    }
+#endif
+
     int  i, i0, i1,
     nV(num_vertices()),
     nE(num_edges()),
@@ -2725,13 +3056,102 @@ struct Dummy_visitor{
 }
 #endif
 
-template <typename P>
+#ifdef CGAL_LINKED_WITH_TBB
+template <typename P> template <typename Visitor>
+void
+Surface_mesh<P>::
+collect_garbage_in_parallel(Visitor &visitor)
+{
+    typedef std::vector<std::pair<std::size_t, std::size_t> > Swaps;
+
+    const size_type nV0 = num_vertices(), nH0 = num_halfedges(), nF0 = num_faces();
+
+    // setup index mapping
+    Property_map<Vertex_index, Vertex_index>      vmap = add_property_map<Vertex_index, Vertex_index>("v:garbage-collection").first;
+    Property_map<Halfedge_index, Halfedge_index>  hmap = add_property_map<Halfedge_index, Halfedge_index>("h:garbage-collection").first;
+    Property_map<Face_index, Face_index>          fmap = add_property_map<Face_index, Face_index>("f:garbage-collection").first;
+    CGAL::for_each<Parallel_tag>(boost::irange<size_type>(0, nV0),
+                                 [&](const size_type i) -> bool { vmap[Vertex_index(i)] = Vertex_index(i); return true; });
+    CGAL::for_each<Parallel_tag>(boost::irange<size_type>(0, nH0),
+                                 [&](const size_type i) -> bool { hmap[Halfedge_index(i)] = Halfedge_index(i); return true; });
+    CGAL::for_each<Parallel_tag>(boost::irange<size_type>(0, nF0),
+                                 [&](const size_type i) -> bool { fmap[Face_index(i)] = Face_index(i); return true; });
+
+    // The elements are swapped as in the sequential version, so that they get the same indices,
+    // but the swaps are computed first and then applied to all property arrays concurrently.
+    Swaps vswaps, eswaps, hswaps, fswaps;
+    const size_type nV = compaction_swaps(vremoved_, nV0, vswaps);
+    const size_type nE = compaction_swaps(eremoved_, num_edges(), eswaps);
+    const size_type nH = 2*nE;
+    const size_type nF = compaction_swaps(fremoved_, nF0, fswaps);
+
+    hswaps.reserve(2*eswaps.size());
+    for (const std::pair<std::size_t, std::size_t>& p : eswaps)
+    {
+      hswaps.emplace_back(2*p.first,   2*p.second);
+      hswaps.emplace_back(2*p.first+1, 2*p.second+1);
+    }
+
+    tbb::parallel_invoke([&]{ vprops_.template swap<Parallel_tag>(vswaps); },
+                         [&]{ hprops_.template swap<Parallel_tag>(hswaps); },
+                         [&]{ eprops_.template swap<Parallel_tag>(eswaps); },
+                         [&]{ fprops_.template swap<Parallel_tag>(fswaps); });
+
+    // update vertex connectivity
+    CGAL::for_each<Parallel_tag>(boost::irange<size_type>(0, nV), [&](const size_type i) -> bool
+    {
+      const Vertex_index v(i);
+      if (!is_isolated(v))
+        set_halfedge(v, hmap[halfedge(v)]);
+      return true;
+    });
+
+    // update halfedge connectivity: `set_next()` writes the previous halfedge of the new next halfedge,
+    // which is a different field than the ones read and written for this halfedge
+    CGAL::for_each<Parallel_tag>(boost::irange<size_type>(0, nH), [&](const size_type i) -> bool
+    {
+      const Halfedge_index h(i);
+      set_target(h, vmap[target(h)]);
+      set_next(h, hmap[next(h)]);
+      if (!is_border(h))
+        set_face(h, fmap[face(h)]);
+      return true;
+    });
+
+    // update indices of faces
+    CGAL::for_each<Parallel_tag>(boost::irange<size_type>(0, nF), [&](const size_type i) -> bool
+    {
+      const Face_index f(i);
+      set_halfedge(f, hmap[halfedge(f)]);
+      return true;
+    });
+
+    //apply visitor before invalidating the maps
+    visitor(vmap, hmap, fmap);
+    // remove index maps
+    remove_property_map<Vertex_index>(vmap);
+    remove_property_map<Halfedge_index>(hmap);
+    remove_property_map<Face_index>(fmap);
+
+    // finally resize arrays
+    tbb::parallel_invoke([&]{ vprops_.resize(nV); vprops_.shrink_to_fit(); },
+                         [&]{ hprops_.resize(nH); hprops_.shrink_to_fit(); },
+                         [&]{ eprops_.resize(nE); eprops_.shrink_to_fit(); },
+                         [&]{ fprops_.resize(nF); fprops_.shrink_to_fit(); });
+
+    removed_vertices_ = removed_edges_ = removed_faces_ = 0;
+    vertices_freelist_ = edges_freelist_ = faces_freelist_ = -1;
+    garbage_ = false;
+}
+#endif
+
+template <typename P> template <typename ConcurrencyTag>
 void
 Surface_mesh<P>::
 collect_garbage()
 {
   collect_garbage_internal::Dummy_visitor visitor;
-  collect_garbage(visitor);
+  collect_garbage<ConcurrencyTag>(visitor);
 }
 
 
@@ -0,0 +1,203 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/IO/polygon_soup_io.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                        K;
+typedef K::Point_3                                            Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Sm;
+typedef Sm::Vertex_index                                      Vertex_index;
+typedef Sm::Halfedge_index                                    Halfedge_index;
+typedef Sm::Face_index                                        Face_index;
+
+typedef std::vector<std::size_t>                              Polygon;
+
+// Checks that two meshes are equal, index by index
+bool same_meshes(const Sm& a, const Sm& b)
+{
+  if(a.number_of_vertices() != b.number_of_vertices() ||
+     a.number_of_halfedges() != b.number_of_halfedges() ||
+     a.number_of_faces() != b.number_of_faces() ||
+     a.number_of_removed_vertices() != b.number_of_removed_vertices() ||
+     a.number_of_removed_faces() != b.number_of_removed_faces())
+    return false;
+
+  for(Vertex_index v : a.vertices())
+    if(a.point(v) != b.point(v) || a.halfedge(v) != b.halfedge(v))
+      return false;
+
+  for(Halfedge_index h : a.halfedges())
+    if(a.target(h) != b.target(h) || a.next(h) != b.next(h) || a.prev(h) != b.prev(h) || a.face(h) != b.face(h))
+      return false;
+
+  for(Face_index f : a.faces())
+    if(a.halfedge(f) != b.halfedge(f))
+      return false;
+
+  return true;
+}
+
+// The vertices of `f`, starting from the smallest one
+std::vector<Vertex_index> face_vertices(const Sm& sm, const Face_index f)
+{
+  std::vector<Vertex_index> vertices;
+  for(Halfedge_index h : CGAL::halfedges_around_face(sm.halfedge(f), sm))
+    vertices.push_back(sm.target(h));
+  std::rotate(vertices.begin(), std::min_element(vertices.begin(), vertices.end()), vertices.end());
+  return vertices;
+}
+
+void test_add_polygon_soup(const std::vector<Point_3>& points, const std::vector<Polygon>& polygons)
+{
+  std::cout << "  add_polygon_soup" << std::endl;
+
+  // Reference: the faces are added one by one
+  Sm ref;
+  for(const Point_3& p : points)
+    ref.add_vertex(p);
+  for(const Polygon& polygon : polygons)
+  {
+    std::vector<Vertex_index> vertices;
+    for(std::size_t i : polygon)
+      vertices.push_back(Vertex_index(Sm::size_type(i)));
+    assert(ref.add_face(vertices) != Sm::null_face());
+  }
+
+  Sm seq;
+  seq.add_polygon_soup(points, polygons);
+  assert(seq.is_valid(false));
+  assert(seq.number_of_vertices() == ref.number_of_vertices());
+  assert(seq.number_of_edges() == ref.number_of_edges());
+  assert(seq.number_of_faces() == ref.number_of_faces());
+
+  for(Vertex_index v : seq.vertices())
+  {
+    assert(seq.point(v) == ref.point(v));
+    assert(seq.is_border(v) == ref.is_border(v));
+    assert(seq.degree(v) == ref.degree(v));
+  }
+  for(Face_index f : seq.faces())
+    assert(face_vertices(seq, f) == face_vertices(ref, f));
+
+  std::size_t nb_border_halfedges = 0;
+  for(Halfedge_index h : seq.halfedges())
+    if(seq.is_border(h))
+      ++nb_border_halfedges;
+  std::size_t nb_ref_border_halfedges = 0;
+  for(Halfedge_index h : ref.halfedges())
+    if(ref.is_border(h))
+      ++nb_ref_border_halfedges;
+  assert(nb_border_halfedges == nb_ref_border_halfedges);
+
+  // The mesh does not depend on the concurrency tag
+  Sm par;
+  par.add_polygon_soup<CGAL::Parallel_if_available_tag>(points, polygons);
+  assert(same_meshes(seq, par));
+
+  // The soup is added next to the elements of the mesh, including the removed ones
+  Sm twice = seq;
+  CGAL::Euler::remove_face(twice.halfedge(*(twice.faces().begin())), twice);
+  const Sm::size_type nv = twice.number_of_vertices() + twice.number_of_removed_vertices();
+  const Sm::size_type nf = twice.number_of_faces() + twice.number_of_removed_faces();
+  twice.add_polygon_soup<CGAL::Parallel_if_available_tag>(points, polygons);
+  assert(twice.is_valid(false));
+  for(Face_index f : seq.faces())
+  {
+    std::vector<Vertex_index> vertices = face_vertices(seq, f);
+    for(Vertex_index& v : vertices)
+      v = Vertex_index(nv + Sm::size_type(v));
+    assert(face_vertices(twice, Face_index(nf + Sm::size_type(f))) == vertices);
+  }
+}
+
+void test_collect_garbage(const Sm& input)
+{
+  std::cout << "  collect_garbage" << std::endl;
+
+  Sm sm = input;
+  Sm::Property_map<Vertex_index, int> vid = sm.add_property_map<Vertex_index, int>("v:id").first;
+  Sm::Property_map<Face_index, int> fid = sm.add_property_map<Face_index, int>("f:id").first;
+  for(Vertex_index v : sm.vertices())
+    vid[v] = int(v);
+  for(Face_index f : sm.faces())
+    fid[f] = int(f);
+
+  // Removes a face out of seven, and the vertices left isolated
+  std::vector<Face_index> to_remove;
+  for(Face_index f : sm.faces())
+    if(std::size_t(f) % 7 == 0)
+      to_remove.push_back(f);
+  for(Face_index f : to_remove)
+    CGAL::Euler::remove_face(sm.halfedge(f), sm);
+  for(Vertex_index v : sm.vertices())
+    if(sm.is_isolated(v))
+      sm.remove_vertex(v);
+
+  // New indices do not depend on the concurrency tag
+  Sm seq = sm, par = sm;
+  seq.collect_garbage();
+  par.collect_garbage<CGAL::Parallel_if_available_tag>();
+
+  assert(!par.has_garbage());
+  assert(par.is_valid(false));
+  assert(same_meshes(seq, par));
+
+  Sm::Property_map<Vertex_index, int> seq_vid = seq.property_map<Vertex_index, int>("v:id").first;
+  Sm::Property_map<Vertex_index, int> par_vid = par.property_map<Vertex_index, int>("v:id").first;
+  for(Vertex_index v : par.vertices())
+    assert(seq_vid[v] == par_vid[v] && par.point(v) == input.point(Vertex_index(par_vid[v])));
+
+  Sm::Property_map<Face_index, int> seq_fid = seq.property_map<Face_index, int>("f:id").first;
+  Sm::Property_map<Face_index, int> par_fid = par.property_map<Face_index, int>("f:id").first;
+  for(Face_index f : par.faces())
+    assert(seq_fid[f] == par_fid[f] && par_fid[f] % 7 != 0);
+}
+
+int main(int argc, char** argv)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  // Several threads, even on a single core
+  tbb::global_control c(tbb::global_control::max_allowed_parallelism, 4);
+#endif
+
+  std::vector<std::string> filenames = { CGAL::data_file_path("meshes/elephant.off"),
+                                         CGAL::data_file_path("meshes/mech-holes-shark.off") };
+  if(argc > 1)
+    filenames.assign(argv + 1, argv + argc);
+
+  for(const std::string& f : filenames)
+  {
+    std::vector<Point_3> points;
+    std::vector<Polygon> polygons;
+    if(!CGAL::IO::read_polygon_soup(f, points, polygons))
+    {
+      std::cerr << "Invalid input: " << f << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << f << ": " << points.size() << " points, " << polygons.size() << " polygons" << std::endl;
+
+    test_add_polygon_soup(points, polygons);
+
+    Sm sm;
+    sm.add_polygon_soup(points, polygons);
+    test_collect_garbage(sm);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
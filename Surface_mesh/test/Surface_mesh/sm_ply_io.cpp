@@ -130,5 +130,40 @@ int main()
     }
   }
 
+  // binary vertices are read by blocks, possibly in parallel
+  {
+    in.close();
+    in.open(CGAL::data_file_path("meshes/colored_tetra.ply"));
+    SMesh colored;
+    CGAL::IO::read_PLY(in, colored);
+    assert((colored.property_map<SMesh::Vertex_index, CGAL::IO::Color>("v:color").second));
+    auto v_nmap = colored.add_property_map<SMesh::Vertex_index, Kernel::Vector_3>("v:normal").first;
+    for (SMesh::Vertex_index v : vertices(colored))
+      v_nmap[v] = Kernel::Vector_3(v.idx(), 0.5, -1);
+
+    out.open("out_colored.ply", std::ios::binary);
+    CGAL::IO::set_binary_mode(out);
+    CGAL::IO::write_PLY(out, colored);
+    out.close();
+
+    in.close();
+    in.open("out_colored.ply", std::ios::binary);
+    SMesh mesh_bis;
+    bool ok = CGAL::IO::read_PLY<CGAL::Parallel_if_available_tag>(in, mesh_bis);
+    assert(ok);
+    assert(mesh_bis.number_of_vertices() == colored.number_of_vertices());
+    assert(mesh_bis.number_of_faces() == colored.number_of_faces());
+
+    auto vcolors = colored.property_map<SMesh::Vertex_index, CGAL::IO::Color>("v:color").first;
+    auto vcolors_bis = mesh_bis.property_map<SMesh::Vertex_index, CGAL::IO::Color>("v:color").first;
+    auto v_nmap_bis = mesh_bis.property_map<SMesh::Vertex_index, Kernel::Vector_3>("v:normal").first;
+    for (SMesh::Vertex_index v : vertices(colored))
+    {
+      assert(colored.point(v) == mesh_bis.point(v));
+      assert(vcolors[v] == vcolors_bis[v]);
+      assert(v_nmap[v] == v_nmap_bis[v]);
+    }
+  }
+
   return 0;
 }
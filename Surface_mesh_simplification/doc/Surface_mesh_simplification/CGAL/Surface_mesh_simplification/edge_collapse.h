@@ -7,6 +7,8 @@ namespace Surface_mesh_simplification {
 Simplifies `tmesh` in-place by collapsing edges, and returns
 the number of edges effectively removed.
 
+@tparam ConcurrencyTag enables sequential versus parallel algorithm.
+                       Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 @tparam TriangleMesh a model of the `MutableFaceGraph` and `HalfedgeListGraph` concepts.
 @tparam StopPolicy a model of `StopPredicate`
 @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
@@ -109,8 +111,17 @@ and the remaining vertex is re-positioned.
 
 `visitor` is used to keep track of the simplification process. It has several member functions which
 are called at certain points in the simplification code.
+
+With `Parallel_tag`, the costs and placements are computed in parallel, and the cost and placement
+policies must thus support concurrent calls. The edges are then collapsed by rounds: each round
+gathers cheap edges whose one-rings are pairwise disjoint, tests them in parallel, and collapses the valid
+ones sequentially in the order of their costs. The order of the collapses is therefore only approximately
+the order of the sequential algorithm, but it does not depend on the scheduling of the threads.
+The stop predicate, the filter, and the visitor are always called sequentially.
 */
-template<class TriangleMesh, class StopPolicy, class NamedParameters = parameters::Default_named_parameters>
+template<class ConcurrencyTag = Sequential_tag,
+         class TriangleMesh, class StopPolicy,
+         class NamedParameters = parameters::Default_named_parameters>
 int edge_collapse(TriangleMesh& tmesh,
                   const StopPolicy& should_stop,
                   const NamedParameters& np = parameters::default_values());
@@ -0,0 +1,73 @@
+namespace CGAL {
+namespace Surface_mesh_simplification {
+
+/*!
+\ingroup PkgSurfaceMeshSimplificationRef
+
+Simplifies the triangle mesh stored in the file `input_filename` by collapsing edges, without loading
+it entirely in memory, and writes the result to `output_filename`. Both files are in the \ref IOStreamOFF.
+Returns the number of edges removed, or `-1` if a file could not be read or written.
+
+The mesh is split into spatial blocks along a regular grid, and each block is loaded in a `TriangleMesh`
+and simplified by `edge_collapse()` while its vertices shared with other blocks are locked.
+A second pass does the same with a grid shifted by half a block, so that the former borders
+of the blocks, which are now inside blocks, are simplified too.
+Only a few blocks are in memory at a time, along with a few bytes per vertex of the input.
+Intermediate files are written next to `output_filename` and removed afterwards.
+
+@tparam TriangleMesh a model of the `MutableFaceGraph` and `HalfedgeListGraph` concepts with an internal point property map,
+                     whose value type can be constructed from three `double`, used to simplify each block.
+@tparam ConcurrencyTag enables sequential versus parallel algorithm.
+                       Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+                       With `Parallel_tag`, several blocks are simplified at the same time.
+@tparam StopPolicy a model of `StopPredicate`
+@tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+@param input_filename the name of the input file, which must describe a triangle mesh
+@param output_filename the name of the output file
+@param should_stop the stop-condition policy, evaluated within each block. In the second pass,
+                   the initial number of edges of a block is scaled by the reduction of the first pass,
+                   so that ratio based policies such as `Edge_count_ratio_stop_predicate` keep their meaning.
+@param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+\cgalNamedParamsBegin
+  \cgalParamNBegin{maximum_number_of_faces}
+    \cgalParamDescription{the approximate number of faces of a block}
+    \cgalParamType{`std::size_t`}
+    \cgalParamDefault{`1000000`}
+  \cgalParamNEnd
+
+  \cgalParamNBegin{get_cost}
+    \cgalParamDescription{the policy which returns the collapse cost for an edge, copied for each block}
+    \cgalParamType{a model of the concept `GetCost`}
+    \cgalParamDefault{`CGAL::Surface_mesh_simplification::LindstromTurk_cost<TriangleMesh>`}
+  \cgalParamNEnd
+
+  \cgalParamNBegin{get_placement}
+    \cgalParamDescription{the policy which returns the placement (position of the replacement vertex) for an edge, copied for each block}
+    \cgalParamType{a model of the concept `GetPlacement`}
+    \cgalParamDefault{`CGAL::Surface_mesh_simplification::LindstromTurk_placement<TriangleMesh>`}
+  \cgalParamNEnd
+
+  \cgalParamNBegin{filter}
+    \cgalParamDescription{the policy which determines if an edge collapse should be accepted or rejected, copied for each block}
+    \cgalParamType{a model of the concept `Filter`}
+    \cgalParamDefault{a filter that always accepts}
+  \cgalParamNEnd
+\cgalNamedParamsEnd
+
+\pre The policies must not be bound to a given mesh, which excludes the Garland-Heckbert policies.
+
+\sa `edge_collapse()`
+*/
+template<class TriangleMesh,
+         class ConcurrencyTag = Sequential_tag,
+         class StopPolicy,
+         class NamedParameters = parameters::Default_named_parameters>
+int edge_collapse_out_of_core(const std::string& input_filename,
+                              const std::string& output_filename,
+                              const StopPolicy& should_stop,
+                              const NamedParameters& np = parameters::default_values());
+
+} // namespace Surface_mesh_simplification
+} /* namespace CGAL */
@@ -0,0 +1,45 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse_out_of_core.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Simple_cartesian<double>               Kernel;
+typedef Kernel::Point_3                              Point_3;
+typedef CGAL::Surface_mesh<Point_3>                  Surface_mesh;
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::string output_filename = (argc > 3) ? argv[3] : "out.off";
+
+  std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+  // The mesh is never loaded entirely: it is simplified by blocks of about 1000 faces,
+  // each block being stored in a Surface_mesh. The simplification stops in each block
+  // when the number of undirected edges drops below 10% of the initial count.
+  double stop_ratio = (argc > 2) ? std::stod(argv[2]) : 0.1;
+  SMS::Edge_count_ratio_stop_predicate<Surface_mesh> stop(stop_ratio);
+
+  int r = SMS::edge_collapse_out_of_core<Surface_mesh, CGAL::Parallel_if_available_tag>(
+            filename, output_filename, stop, CGAL::parameters::maximum_number_of_faces(1000));
+
+  std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+
+  if(r < 0)
+  {
+    std::cerr << "Failed to simplify: " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "\nFinished!\n" << r << " edges removed.\n";
+  std::cout << "Time elapsed: " << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count() << "ms" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -20,9 +20,13 @@
 #include <CGAL/assertions.h>
 #include <CGAL/Default.h>
 #include <CGAL/intersections.h>
+#include <CGAL/mutex.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
 #include <optional>
+#ifdef CGAL_HAS_THREADS
+#include <atomic>
+#endif
 
 #include <vector>
 #include <type_traits>
@@ -47,7 +51,7 @@ class Bounded_distance_placement
 
 private:
   template <typename Profile>
-  void initialize_tree(const Profile& profile) const
+  const AABB_tree* initialize_tree(const Profile& profile) const
   {
     static_assert(std::is_same<GeomTraits, typename Profile::Geom_traits>::value);
 
@@ -55,8 +59,6 @@ private:
     typedef typename boost::graph_traits<Triangle_mesh>::halfedge_descriptor  halfedge_descriptor;
     typedef typename boost::graph_traits<Triangle_mesh>::face_descriptor      face_descriptor;
 
-    CGAL_precondition(m_tree_ptr == nullptr);
-
     const Triangle_mesh& tm = profile.surface_mesh();
     const Geom_traits& gt = profile.geom_traits();
 
@@ -72,9 +74,31 @@ private:
                                        get(profile.vertex_point_map(), target(next(h, tm), tm))));
     }
 
-    m_tree_ptr = new AABB_tree(m_input_triangles.begin(), m_input_triangles.end());
-    const_cast<AABB_tree*>(m_tree_ptr)->build();
-    const_cast<AABB_tree*>(m_tree_ptr)->accelerate_distance_queries();
+    AABB_tree* tree_ptr = new AABB_tree(m_input_triangles.begin(), m_input_triangles.end());
+    tree_ptr->build();
+    tree_ptr->accelerate_distance_queries();
+    return tree_ptr;
+  }
+
+  // The tree is built from the mesh at the first call, which might be concurrent to other calls
+  template <typename Profile>
+  const AABB_tree& tree(const Profile& profile) const
+  {
+    const AABB_tree* tree_ptr = m_tree_ptr;
+    if(tree_ptr == nullptr)
+    {
+#ifdef CGAL_HAS_THREADS
+      CGAL_SCOPED_LOCK(m_tree_mutex);
+      tree_ptr = m_tree_ptr;
+      if(tree_ptr == nullptr)
+#endif
+      {
+        tree_ptr = initialize_tree(profile);
+        m_tree_ptr = tree_ptr;
+      }
+    }
+
+    return *tree_ptr;
   }
 
 public:
@@ -86,10 +110,19 @@ public:
       m_base_placement(placement)
   { }
 
+  // The tree is not shared: the copy builds its own at its first call
+  Bounded_distance_placement(const Bounded_distance_placement& other)
+    :
+      m_sq_threshold_dist(other.m_sq_threshold_dist),
+      m_tree_ptr(nullptr),
+      m_base_placement(other.m_base_placement)
+  { }
+
   ~Bounded_distance_placement()
   {
-    if(m_tree_ptr != nullptr)
-      delete m_tree_ptr;
+    const AABB_tree* tree_ptr = m_tree_ptr;
+    if(tree_ptr != nullptr)
+      delete tree_ptr;
   }
 
   template <typename Profile>
@@ -101,15 +134,12 @@ public:
     std::optional<typename Profile::Point> op = m_base_placement(profile);
     if(op)
     {
-      if(m_tree_ptr == nullptr)
-        initialize_tree(profile);
-
-      CGAL_assertion(m_tree_ptr != nullptr);
-      CGAL_assertion(!m_tree_ptr->empty());
+      const AABB_tree& input_tree = tree(profile);
+      CGAL_assertion(!input_tree.empty());
 
       const Point& p = *op;
 
-      const Point& cp = m_tree_ptr->best_hint(p).first;
+      const Point& cp = input_tree.best_hint(p).first;
 
       // We could do better by having access to the internal kd-tree
       // and call search_any_point with a fuzzy_sphere.
@@ -118,7 +148,7 @@ public:
       // any face closer than the threshold is intersected by
       // the sphere (avoid the inclusion of the mesh into the threshold sphere)
       if(CGAL::compare_squared_distance(p, cp, m_sq_threshold_dist) != LARGER ||
-         m_tree_ptr->do_intersect(CGAL::Sphere_3<Geom_traits>(p, m_sq_threshold_dist)))
+         input_tree.do_intersect(CGAL::Sphere_3<Geom_traits>(p, m_sq_threshold_dist)))
         return op;
 
       return std::optional<Point>();
@@ -129,7 +159,12 @@ public:
 
 private:
   const FT m_sq_threshold_dist;
+#ifdef CGAL_HAS_THREADS
+  mutable CGAL_MUTEX m_tree_mutex;
+  mutable std::atomic<const AABB_tree*> m_tree_ptr;
+#else
   mutable const AABB_tree* m_tree_ptr;
+#endif
   mutable std::vector<Triangle> m_input_triangles;
 
   const BasePlacement m_base_placement;
@@ -16,6 +16,7 @@
 #include <CGAL/boost/graph/properties.h>
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Surface_mesh_simplification/internal/Common.h>
 #include <CGAL/Surface_mesh_simplification/internal/Edge_collapse.h>
@@ -25,7 +26,8 @@ namespace CGAL {
 namespace Surface_mesh_simplification {
 namespace internal {
 
-template<bool use_relaxed_order,
+template<class ConcurrencyTag,
+         bool use_relaxed_order,
          class TM,
          class GT,
          class ShouldStop,
@@ -53,7 +55,7 @@ int edge_collapse(TM& tmesh,
 {
   typedef EdgeCollapse<TM, GT, ShouldStop,
                        VertexIndexMap, VertexPointMap, HalfedgeIndexMap, EdgeIsConstrainedMap,
-                       GetCost, GetPlacement, ShouldIgnore, Visitor,use_relaxed_order> Algorithm;
+                       GetCost, GetPlacement, ShouldIgnore, Visitor, use_relaxed_order, ConcurrencyTag> Algorithm;
 
   Algorithm algorithm(tmesh, traits, should_stop, vim, vpm, him, ecm, get_cost, get_placement, should_ignore, visitor);
 
@@ -82,7 +84,8 @@ struct Dummy_visitor
 
 } // namespace internal
 
-template<class TM, class ShouldStop,class NamedParameters = parameters::Default_named_parameters>
+template<class ConcurrencyTag = Sequential_tag,
+         class TM, class ShouldStop, class NamedParameters = parameters::Default_named_parameters>
 int edge_collapse(TM& tmesh,
                   const ShouldStop& should_stop,
                   const NamedParameters& np = parameters::default_values())
@@ -94,7 +97,7 @@ int edge_collapse(TM& tmesh,
   typedef typename internal_np::Lookup_named_param_def <
     internal_np::use_relaxed_order_t, NamedParameters, Tag_false> ::type  Use_relaxed_order;
 
-  return internal::edge_collapse<Use_relaxed_order::value>
+  return internal::edge_collapse<ConcurrencyTag, Use_relaxed_order::value>
                                 (tmesh, should_stop,
                                  choose_parameter<Geom_traits>(get_parameter(np, internal_np::geom_traits)),
                                  CGAL::get_initialized_vertex_index_map(tmesh, np),
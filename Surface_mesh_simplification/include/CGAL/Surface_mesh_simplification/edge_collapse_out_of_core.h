@@ -0,0 +1,665 @@
+// Copyright (c) 2024  GeometryFactory (France). All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+#ifndef CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_OUT_OF_CORE_H
+#define CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_OUT_OF_CORE_H
+
+#include <CGAL/license/Surface_mesh_simplification.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+
+#include <CGAL/Bbox_3.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/boost/graph/properties.h>
+#include <CGAL/IO/OFF/File_scanner_OFF.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <boost/range/irange.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CGAL {
+namespace Surface_mesh_simplification {
+namespace internal {
+
+// A triangle soup stored on disk: the points as triples of doubles and the triangles
+// as triples of point ids, both in binary files.
+struct Out_of_core_soup
+{
+  std::string points_filename;
+  std::string triangles_filename;
+  std::size_t nb_points = 0;
+  std::size_t nb_triangles = 0;
+  Bbox_3 bbox;
+};
+
+constexpr std::size_t ooc_no_id = (std::numeric_limits<std::size_t>::max)();
+
+template <typename T>
+void ooc_write(std::ostream& os, const T* data, std::size_t n)
+{
+  os.write(reinterpret_cast<const char*>(data), n * sizeof(T));
+}
+
+template <typename T>
+bool ooc_read(std::istream& is, T* data, std::size_t n)
+{
+  is.read(reinterpret_cast<char*>(data), n * sizeof(T));
+  return bool(is);
+}
+
+// Converts a triangle mesh in the OFF format to a soup, vertex by vertex and face by face
+inline bool ooc_read_OFF(const std::string& filename,
+                         Out_of_core_soup& soup)
+{
+  std::ifstream in(filename, std::ios::binary);
+  if(!in)
+    return false;
+
+  File_scanner_OFF scanner(in, false);
+  if(!in)
+    return false;
+
+  std::ofstream points(soup.points_filename, std::ios::binary);
+  std::ofstream triangles(soup.triangles_filename, std::ios::binary);
+
+  soup.nb_points = scanner.size_of_vertices();
+  soup.nb_triangles = scanner.size_of_facets();
+  soup.bbox = Bbox_3();
+
+  for(std::size_t i=0; i<soup.nb_points; ++i)
+  {
+    std::array<double, 3> p;
+    scanner.scan_vertex(p[0], p[1], p[2]);
+    scanner.skip_to_next_vertex(i);
+    if(!in)
+      return false;
+
+    soup.bbox += Bbox_3(p[0], p[1], p[2], p[0], p[1], p[2]);
+    ooc_write(points, p.data(), 3);
+  }
+
+  for(std::size_t i=0; i<soup.nb_triangles; ++i)
+  {
+    std::size_t size = 0;
+    scanner.scan_facet(size, i);
+    if(!in || size != 3)
+      return false;
+
+    std::array<std::size_t, 3> t;
+    for(std::size_t j=0; j<3; ++j)
+      scanner.scan_facet_vertex_index(t[j], j+1, i);
+    scanner.skip_to_next_facet(i);
+    if(!in)
+      return false;
+
+    ooc_write(triangles, t.data(), 3);
+  }
+
+  return bool(points) && bool(triangles);
+}
+
+// Writes a soup in the OFF format, streaming points and triangles from disk
+inline bool ooc_write_OFF(const Out_of_core_soup& soup,
+                          const std::string& filename)
+{
+  std::ofstream os(filename);
+  std::ifstream points(soup.points_filename, std::ios::binary);
+  std::ifstream triangles(soup.triangles_filename, std::ios::binary);
+  if(!os || !points || !triangles)
+    return false;
+
+  os.precision(17);
+  os << "OFF\n" << soup.nb_points << " " << soup.nb_triangles << " 0\n";
+
+  for(std::size_t i=0; i<soup.nb_points; ++i)
+  {
+    std::array<double, 3> p;
+    if(!ooc_read(points, p.data(), 3))
+      return false;
+    os << p[0] << " " << p[1] << " " << p[2] << "\n";
+  }
+
+  for(std::size_t i=0; i<soup.nb_triangles; ++i)
+  {
+    std::array<std::size_t, 3> t;
+    if(!ooc_read(triangles, t.data(), 3))
+      return false;
+    os << "3 " << t[0] << " " << t[1] << " " << t[2] << "\n";
+  }
+
+  return bool(os);
+}
+
+// A regular grid over the bounding box of the soup, possibly shifted by a fraction of a cell.
+// With a shift, there are `n+1` cells per axis, so that the whole box is still covered.
+struct Out_of_core_grid
+{
+  Out_of_core_grid(const Bbox_3& bbox, std::size_t n, double shift)
+    : m_bbox(bbox), m_n(n), m_shift(shift)
+  {
+    m_cells_per_axis = (shift == 0.) ? n : n + 1;
+  }
+
+  std::uint32_t cell(const std::array<double, 3>& p) const
+  {
+    std::uint32_t c = 0;
+    for(int i=2; i>=0; --i)
+    {
+      const double extent = m_bbox.max(i) - m_bbox.min(i);
+      std::size_t ci = 0;
+      if(extent > 0)
+      {
+        const double x = (p[i] - m_bbox.min(i)) / extent * double(m_n) + m_shift;
+        ci = (std::min)(std::size_t((std::max)(x, 0.)), m_cells_per_axis - 1);
+      }
+      c = c * std::uint32_t(m_cells_per_axis) + std::uint32_t(ci);
+    }
+    return c;
+  }
+
+private:
+  Bbox_3 m_bbox;
+  std::size_t m_n;
+  double m_shift;
+  std::size_t m_cells_per_axis;
+};
+
+// Keeps the locked vertices in place: a collapse between two locked vertices is refused,
+// and a collapse involving one locked vertex puts the remaining vertex at its position.
+// Such a collapse is also refused if it would connect the locked vertex to another
+// locked vertex, as the corresponding edge might already exist in another block.
+template <class BasePlacement, class VertexIdMap>
+class Locked_vertex_placement
+{
+public:
+  Locked_vertex_placement(const BasePlacement& base, const VertexIdMap& ids)
+    : m_base(base), m_ids(ids)
+  { }
+
+  template <typename Profile>
+  std::optional<typename Profile::Point> operator()(const Profile& profile) const
+  {
+    const bool locked_v0 = is_locked(profile.v0());
+    const bool locked_v1 = is_locked(profile.v1());
+
+    if(locked_v0 && locked_v1)
+      return std::nullopt;
+    if(locked_v0)
+      return can_move_to(profile.v0(), profile.v1(), profile.surface_mesh()) ? std::optional<typename Profile::Point>(profile.p0())
+                                                                             : std::nullopt;
+    if(locked_v1)
+      return can_move_to(profile.v1(), profile.v0(), profile.surface_mesh()) ? std::optional<typename Profile::Point>(profile.p1())
+                                                                             : std::nullopt;
+
+    return m_base(profile);
+  }
+
+private:
+  template <typename VD>
+  bool is_locked(VD v) const { return get(m_ids, v) != ooc_no_id; }
+
+  // whether the locked vertex `l` can replace `v` without creating an edge between two locked vertices
+  template <typename VD, typename TM>
+  bool can_move_to(VD l, VD v, const TM& tm) const
+  {
+    for(VD w : vertices_around_target(halfedge(v, tm), tm))
+      if(w != l && is_locked(w) && !halfedge(l, w, tm).second)
+        return false;
+    return true;
+  }
+
+  BasePlacement m_base;
+  VertexIdMap m_ids;
+};
+
+// The vertex kept by a collapse inherits the id of the locked vertex, if any. The id is read
+// before the collapse, as the other vertex does not exist anymore afterwards.
+template <class VertexIdMap>
+struct Vertex_id_visitor
+  : public Dummy_visitor
+{
+  Vertex_id_visitor(const VertexIdMap& ids) : m_ids(ids) { }
+
+  template <class Profile, class OPoint>
+  void OnCollapsing(const Profile& profile, const OPoint&) const
+  {
+    m_id = get(m_ids, profile.v0());
+    if(m_id == ooc_no_id)
+      m_id = get(m_ids, profile.v1());
+  }
+
+  template <class Profile, class VH>
+  void OnCollapsed(const Profile&, VH v) const
+  {
+    put(m_ids, v, m_id);
+  }
+
+private:
+  VertexIdMap m_ids;
+  mutable std::size_t m_id = ooc_no_id;
+};
+
+// Evaluates the stop predicate as if the block had `scale` times more edges initially,
+// which accounts for the edges that were removed by the first pass.
+template <class StopPolicy>
+struct Rescaled_stop_predicate
+{
+  Rescaled_stop_predicate(const StopPolicy& should_stop, double scale)
+    : m_should_stop(should_stop), m_scale(scale)
+  { }
+
+  template <typename F, typename Profile, typename size_type>
+  bool operator()(const F& current_cost,
+                  const Profile& profile,
+                  size_type initial_edge_count,
+                  size_type current_edge_count) const
+  {
+    return m_should_stop(current_cost, profile,
+                         size_type(std::ceil(m_scale * double(initial_edge_count))),
+                         current_edge_count);
+  }
+
+private:
+  const StopPolicy& m_should_stop;
+  double m_scale;
+};
+
+// Simplifies the soup `in` block by block, writing the result in `out`, and returns
+// the number of edges removed, or -1 if some file could not be read or written.
+//
+// Each triangle is assigned to the cell of its vertex with the smallest cell index. The
+// vertices shared by triangles of different blocks are locked, so that the blocks can be
+// simplified independently and their borders still match afterwards.
+template <class TriangleMesh, class ConcurrencyTag, class StopPolicy, class NamedParameters>
+int ooc_simplify_blocks(const Out_of_core_soup& in,
+                        Out_of_core_soup& out,
+                        const Out_of_core_grid& grid,
+                        const StopPolicy& should_stop,
+                        const NamedParameters& np,
+                        const std::string& prefix)
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef boost::graph_traits<TriangleMesh>                                    Graph_traits;
+  typedef typename Graph_traits::vertex_descriptor                             vertex_descriptor;
+  typedef typename Graph_traits::face_descriptor                               face_descriptor;
+  typedef typename boost::property_map<TriangleMesh, vertex_point_t>::type     Vertex_point_map;
+  typedef typename boost::property_traits<Vertex_point_map>::value_type        Point;
+  typedef typename boost::property_map<TriangleMesh,
+                                       dynamic_vertex_property_t<std::size_t> >::type Vertex_id_map;
+
+  const std::uint32_t no_cell = (std::numeric_limits<std::uint32_t>::max)();
+  const std::uint32_t shared = no_cell - 1;
+
+  // The cell of each point
+  std::vector<std::uint32_t> point_cell(in.nb_points);
+  {
+    std::ifstream points(in.points_filename, std::ios::binary);
+    for(std::size_t i=0; i<in.nb_points; ++i)
+    {
+      std::array<double, 3> p;
+      if(!ooc_read(points, p.data(), 3))
+        return -1;
+      point_cell[i] = grid.cell(p);
+    }
+  }
+
+  // Dispatch the triangles into one file per cell; the buffers are appended to the files
+  // when they are large enough, so that the number of open files stays bounded.
+  const std::size_t buffer_size = 3 * (1 << 16);
+  std::unordered_map<std::uint32_t, std::vector<std::size_t> > buffers;
+  std::unordered_map<std::uint32_t, std::size_t> cell_sizes;
+  std::vector<std::uint32_t>& owner = point_cell; // reused once the triangle cells are known
+
+  auto cell_filename = [&prefix](std::uint32_t c) { return prefix + ".cell" + std::to_string(c); };
+  auto flush = [&](std::uint32_t c, std::vector<std::size_t>& buffer) -> bool
+  {
+    std::ofstream os(cell_filename(c), std::ios::binary | std::ios::app);
+    ooc_write(os, buffer.data(), buffer.size());
+    buffer.clear();
+    return bool(os);
+  };
+
+  std::vector<std::uint32_t> triangle_cells(in.nb_triangles);
+  {
+    std::ifstream triangles(in.triangles_filename, std::ios::binary);
+    for(std::size_t i=0; i<in.nb_triangles; ++i)
+    {
+      std::array<std::size_t, 3> t;
+      if(!ooc_read(triangles, t.data(), 3) ||
+         t[0] >= in.nb_points || t[1] >= in.nb_points || t[2] >= in.nb_points)
+        return -1;
+
+      const std::uint32_t c = (std::min)({ point_cell[t[0]], point_cell[t[1]], point_cell[t[2]] });
+      triangle_cells[i] = c;
+
+      std::vector<std::size_t>& buffer = buffers[c];
+      buffer.insert(buffer.end(), t.begin(), t.end());
+      ++cell_sizes[c];
+      if(buffer.size() >= buffer_size && !flush(c, buffer))
+        return -1;
+    }
+  }
+
+  for(auto& b : buffers)
+    if(!b.second.empty() && !flush(b.first, b.second))
+      return -1;
+  buffers.clear();
+
+  // A point is shared if it is used by triangles of several cells
+  std::fill(owner.begin(), owner.end(), no_cell);
+  {
+    std::ifstream triangles(in.triangles_filename, std::ios::binary);
+    for(std::size_t i=0; i<in.nb_triangles; ++i)
+    {
+      std::array<std::size_t, 3> t;
+      if(!ooc_read(triangles, t.data(), 3))
+        return -1;
+      for(std::size_t id : t)
+      {
+        if(owner[id] == no_cell)
+          owner[id] = triangle_cells[i];
+        else if(owner[id] != triangle_cells[i])
+          owner[id] = shared;
+      }
+    }
+  }
+  std::vector<std::uint32_t>().swap(triangle_cells);
+
+  std::vector<std::uint32_t> cells;
+  cells.reserve(cell_sizes.size());
+  for(const auto& cs : cell_sizes)
+    cells.push_back(cs.first);
+  std::sort(cells.begin(), cells.end());
+
+  auto block_filename = [&prefix](std::size_t b) { return prefix + ".block" + std::to_string(b); };
+
+  // Simplify the blocks independently. Each block is read from its cell file, simplified,
+  // and written to its block file as a list of (id, point) followed by the triangles,
+  // where the id is the id of the point in `in` if the vertex is locked, and `ooc_no_id` otherwise.
+  std::vector<int> removed(cells.size(), -1);
+  CGAL::for_each<ConcurrencyTag>(boost::irange<std::size_t>(0, cells.size()), [&](std::size_t b) -> bool
+  {
+    const std::uint32_t c = cells[b];
+
+    std::vector<std::size_t> triangle_ids(3 * cell_sizes.at(c));
+    {
+      std::ifstream is(cell_filename(c), std::ios::binary);
+      if(!ooc_read(is, triangle_ids.data(), triangle_ids.size()))
+        return true;
+    }
+    std::remove(cell_filename(c).c_str());
+
+    std::vector<std::size_t> point_ids(triangle_ids);
+    std::sort(point_ids.begin(), point_ids.end());
+    point_ids.erase(std::unique(point_ids.begin(), point_ids.end()), point_ids.end());
+
+    TriangleMesh tm;
+    Vertex_point_map vpm = get(vertex_point, tm);
+    Vertex_id_map ids = get(dynamic_vertex_property_t<std::size_t>(), tm);
+
+    std::vector<vertex_descriptor> vds;
+    vds.reserve(point_ids.size());
+    {
+      std::ifstream points(in.points_filename, std::ios::binary);
+      for(std::size_t id : point_ids)
+      {
+        std::array<double, 3> p;
+        points.seekg(std::streamoff(3 * sizeof(double) * id));
+        if(!ooc_read(points, p.data(), 3))
+          return true;
+
+        vertex_descriptor v = add_vertex(tm);
+        put(vpm, v, Point(p[0], p[1], p[2]));
+        put(ids, v, (owner[id] == shared) ? id : ooc_no_id);
+        vds.push_back(v);
+      }
+    }
+
+    // The triangles that cannot be added to the mesh (e.g., around non-manifold vertices)
+    // are kept as they are, and their vertices are locked.
+    std::vector<std::array<std::size_t, 3> > kept_triangles;
+    for(std::size_t i=0; i<triangle_ids.size(); i+=3)
+    {
+      std::array<std::size_t, 3> t;
+      std::array<vertex_descriptor, 3> face;
+      for(std::size_t j=0; j<3; ++j)
+      {
+        t[j] = std::lower_bound(point_ids.begin(), point_ids.end(), triangle_ids[i+j]) - point_ids.begin();
+        face[j] = vds[t[j]];
+      }
+
+      if(Euler::add_face(face, tm) == Graph_traits::null_face())
+      {
+        for(std::size_t& k : t)
+        {
+          put(ids, vds[k], point_ids[k]);
+          k = point_ids[k];
+        }
+        kept_triangles.push_back(t);
+      }
+    }
+    std::vector<std::size_t>().swap(triangle_ids);
+    std::vector<vertex_descriptor>().swap(vds);
+    std::vector<std::size_t>().swap(point_ids);
+
+    Locked_vertex_placement<typename internal_np::Lookup_named_param_def<internal_np::get_placement_policy_t,
+                                                                          NamedParameters,
+                                                                          LindstromTurk_placement<TriangleMesh> >::type,
+                            Vertex_id_map>
+      placement(choose_parameter<LindstromTurk_placement<TriangleMesh> >(get_parameter(np, internal_np::get_placement_policy)), ids);
+
+    removed[b] = edge_collapse(tm, should_stop,
+                               parameters::get_cost(choose_parameter<LindstromTurk_cost<TriangleMesh> >(get_parameter(np, internal_np::get_cost_policy)))
+                                          .get_placement(placement)
+                                          .filter(choose_parameter<internal::Dummy_filter>(get_parameter(np, internal_np::filter)))
+                                          .visitor(Vertex_id_visitor<Vertex_id_map>(ids)));
+
+    // Write the block. The locked vertices of the kept triangles might have been replaced
+    // by another vertex during a collapse, so they are found from their ids.
+    std::ofstream os(block_filename(b), std::ios::binary);
+
+    Vertex_id_map local_ids = get(dynamic_vertex_property_t<std::size_t>(), tm);
+    std::unordered_map<std::size_t, std::size_t> local_locked_ids;
+    std::size_t nb_vertices = 0;
+    for(vertex_descriptor v : vertices(tm))
+    {
+      put(local_ids, v, nb_vertices);
+      if(get(ids, v) != ooc_no_id)
+        local_locked_ids.emplace(get(ids, v), nb_vertices);
+      ++nb_vertices;
+    }
+
+    ooc_write(os, &nb_vertices, 1);
+    for(vertex_descriptor v : vertices(tm))
+    {
+      const std::size_t id = get(ids, v);
+      const Point& p = get(vpm, v);
+      const std::array<double, 3> coords = { to_double(p.x()), to_double(p.y()), to_double(p.z()) };
+      ooc_write(os, &id, 1);
+      ooc_write(os, coords.data(), 3);
+    }
+
+    const std::size_t nb_triangles = faces(tm).size() + kept_triangles.size();
+    ooc_write(os, &nb_triangles, 1);
+    for(face_descriptor f : faces(tm))
+    {
+      for(vertex_descriptor v : vertices_around_face(halfedge(f, tm), tm))
+      {
+        const std::size_t local_id = get(local_ids, v);
+        ooc_write(os, &local_id, 1);
+      }
+    }
+    for(const std::array<std::size_t, 3>& t : kept_triangles)
+    {
+      for(std::size_t id : t)
+        ooc_write(os, &local_locked_ids.at(id), 1);
+    }
+
+    if(!os)
+      removed[b] = -1;
+
+    return true;
+  });
+
+  // Merge the blocks. A locked vertex appears in every block using it, but only once in `out`.
+  std::ofstream points(out.points_filename, std::ios::binary);
+  std::ofstream triangles(out.triangles_filename, std::ios::binary);
+  std::unordered_map<std::size_t, std::size_t> locked_ids;
+  out.nb_points = 0;
+  out.nb_triangles = 0;
+  out.bbox = Bbox_3();
+
+  int nb_removed = 0;
+  bool ok = true;
+  for(std::size_t b=0; b<cells.size(); ++b)
+  {
+    if(removed[b] < 0)
+    {
+      ok = false;
+      continue;
+    }
+    nb_removed += removed[b];
+
+    std::ifstream is(block_filename(b), std::ios::binary);
+
+    std::size_t nb_vertices = 0;
+    ok = ok && ooc_read(is, &nb_vertices, 1);
+
+    std::vector<std::size_t> new_ids(nb_vertices);
+    for(std::size_t i=0; ok && i<nb_vertices; ++i)
+    {
+      std::size_t id;
+      std::array<double, 3> p;
+      ok = ooc_read(is, &id, 1) && ooc_read(is, p.data(), 3);
+
+      if(id != ooc_no_id)
+      {
+        auto res = locked_ids.emplace(id, out.nb_points);
+        new_ids[i] = res.first->second;
+        if(!res.second)
+          continue;
+      }
+      else
+      {
+        new_ids[i] = out.nb_points;
+      }
+
+      ooc_write(points, p.data(), 3);
+      out.bbox += Bbox_3(p[0], p[1], p[2], p[0], p[1], p[2]);
+      ++out.nb_points;
+    }
+
+    std::size_t nb_triangles = 0;
+    ok = ok && ooc_read(is, &nb_triangles, 1);
+    for(std::size_t i=0; ok && i<nb_triangles; ++i)
+    {
+      std::array<std::size_t, 3> t;
+      ok = ooc_read(is, t.data(), 3);
+      for(std::size_t& id : t)
+        id = new_ids[id];
+      ooc_write(triangles, t.data(), 3);
+    }
+    out.nb_triangles += nb_triangles;
+
+    is.close();
+    std::remove(block_filename(b).c_str());
+  }
+
+  return (ok && points && triangles) ? nb_removed : -1;
+}
+
+} // namespace internal
+
+template<class TriangleMesh,
+         class ConcurrencyTag = Sequential_tag,
+         class StopPolicy,
+         class NamedParameters = parameters::Default_named_parameters>
+int edge_collapse_out_of_core(const std::string& input_filename,
+                              const std::string& output_filename,
+                              const StopPolicy& should_stop,
+                              const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  const std::size_t max_block_size =
+    choose_parameter(get_parameter(np, internal_np::maximum_number_of_faces), std::size_t(1000000));
+
+  const std::string prefix = output_filename + ".ooc";
+  std::vector<internal::Out_of_core_soup> soups(3);
+  for(std::size_t i=0; i<soups.size(); ++i)
+  {
+    soups[i].points_filename = prefix + ".points" + std::to_string(i);
+    soups[i].triangles_filename = prefix + ".triangles" + std::to_string(i);
+  }
+
+  auto clear = [&soups]()
+  {
+    for(const internal::Out_of_core_soup& soup : soups)
+    {
+      std::remove(soup.points_filename.c_str());
+      std::remove(soup.triangles_filename.c_str());
+    }
+  };
+
+  if(!internal::ooc_read_OFF(input_filename, soups[0]))
+  {
+    clear();
+    return -1;
+  }
+
+  // A surface crosses about n^2 cells of an n^3 grid
+  const std::size_t n = (std::min)(std::size_t(1000),
+                                   (std::max)(std::size_t(1),
+                                              std::size_t(std::ceil(std::sqrt(double(soups[0].nb_triangles) /
+                                                                              double((std::max)(max_block_size, std::size_t(1))))))));
+
+  int removed = internal::ooc_simplify_blocks<TriangleMesh, ConcurrencyTag>(
+                  soups[0], soups[1], internal::Out_of_core_grid(soups[0].bbox, n, 0.),
+                  should_stop, np, prefix);
+
+  internal::Out_of_core_soup* result = &soups[1];
+  if(removed >= 0 && n > 1)
+  {
+    const double scale = (soups[1].nb_triangles == 0) ? 1. : double(soups[0].nb_triangles) / double(soups[1].nb_triangles);
+    const int removed_2 = internal::ooc_simplify_blocks<TriangleMesh, ConcurrencyTag>(
+                            soups[1], soups[2], internal::Out_of_core_grid(soups[1].bbox, n, 0.5),
+                            internal::Rescaled_stop_predicate<StopPolicy>(should_stop, scale), np, prefix);
+    removed = (removed_2 < 0) ? -1 : removed + removed_2;
+    result = &soups[2];
+  }
+
+  if(removed >= 0 && !internal::ooc_write_OFF(*result, output_filename))
+    removed = -1;
+
+  clear();
+  return removed;
+}
+
+} // namespace Surface_mesh_simplification
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_OUT_OF_CORE_H
@@ -18,11 +18,17 @@
 
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/helpers.h>
+#include <CGAL/for_each.h>
 #include <CGAL/Modifiable_priority_queue.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 
+#include <boost/range/irange.hpp>
 #include <boost/scoped_array.hpp>
 
+#include <type_traits>
+#include <vector>
+
 namespace CGAL {
 namespace Surface_mesh_simplification {
 namespace internal {
@@ -91,7 +97,8 @@ template<class TM_,
          class GetPlacement_,
          class ShouldIgnore_,
          class VisitorT_,
-         bool use_relaxed_heap>
+         bool use_relaxed_heap,
+         class ConcurrencyTag_ = Sequential_tag>
 class EdgeCollapse
 {
   typedef EdgeCollapse                                                    Self;
@@ -108,6 +115,7 @@ public:
   typedef GetPlacement_                                                   Get_placement;
   typedef ShouldStop_                                                     Should_stop;
   typedef VisitorT_                                                       Visitor;
+  typedef ConcurrencyTag_                                                 Concurrency_tag;
 
   typedef Edge_profile<Triangle_mesh, Vertex_point_map, Geom_traits>      Profile;
 
@@ -221,15 +229,27 @@ public:
   const Vertex_point_map& vpm() const { return m_vpm; }
 
 private:
+  typedef std::set<halfedge_descriptor, Compare_id>                       Edge_set;
+
+  // With `Parallel_tag`, edges are collapsed by rounds of edges whose one-rings are disjoint
+  static constexpr bool is_parallel = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
   void collect();
   void loop();
+  void loop_in_rounds();
 
   bool is_collapse_topologically_valid(const Profile& profile);
   bool is_tetrahedron(const halfedge_descriptor h);
   bool is_open_triangle(const halfedge_descriptor h1);
   bool is_collapse_geometrically_valid(const Profile& profile, Placement_type placement);
   void collapse(const Profile& profile, Placement_type placement);
+  vertex_descriptor collapse_without_update(const Profile& profile, Placement_type placement);
   void update_neighbors(const vertex_descriptor v_kept);
+  void collect_neighbors(const vertex_descriptor v_kept, Edge_set& edges_to_update, Edge_set& edges_to_insert);
+  void update_costs(const Edge_set& edges_to_update, const Edge_set& edges_to_insert);
+  void compute_costs(const std::vector<halfedge_descriptor>& hs);
+
+  bool lock_one_rings(const halfedge_descriptor h, std::vector<bool>& is_locked, std::vector<vertex_descriptor>& locked);
 
   Profile create_profile(const halfedge_descriptor h) {
     return Profile(h, m_tm, m_traits, m_vim, m_vpm, m_him, m_has_border);
@@ -403,8 +423,8 @@ private:
   CGAL_SMS_DEBUG_CODE(unsigned m_step;)
 };
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 EdgeCollapse(Triangle_mesh& tmesh,
              const Geom_traits& traits,
              const Should_stop& should_stop,
@@ -445,9 +465,9 @@ EdgeCollapse(Triangle_mesh& tmesh,
 #endif
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 int
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 run()
 {
   CGAL_expensive_precondition(is_valid_polygon_mesh(m_tm) && CGAL::is_triangle_mesh(m_tm));
@@ -461,7 +481,10 @@ run()
   collect();
 
   // Then proceed to collapse each edge in turn
-  loop();
+  if(is_parallel)
+    loop_in_rounds();
+  else
+    loop();
 
   CGAL_SMS_TRACE(0, "Finished: " << (m_initial_edge_count - m_current_edge_count) << " edges removed.");
 
@@ -472,9 +495,9 @@ run()
   return r;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collect()
 {
   CGAL_SMS_TRACE(0, "collecting edges...");
@@ -492,6 +515,18 @@ collect()
 
   std::set<halfedge_descriptor> zero_length_edges;
 
+  // The costs are computed concurrently before the edges are inserted in the PQ
+  if(is_parallel)
+  {
+    std::vector<halfedge_descriptor> hs;
+    hs.reserve(m_initial_edge_count);
+    for(edge_descriptor e : edges(m_tm))
+      if(!is_constrained(halfedge(e, m_tm)))
+        hs.push_back(halfedge(e, m_tm));
+
+    compute_costs(hs);
+  }
+
   for(edge_descriptor e : edges(m_tm))
   {
     const halfedge_descriptor h = halfedge(e, m_tm);
@@ -507,7 +542,8 @@ collect()
     {
       Edge_data& data = get_data(h);
 
-      data.cost() = cost(profile);
+      if(!is_parallel)
+        data.cost() = cost(profile);
       insert_in_PQ(h, data);
 
       m_visitor.OnCollected(profile, data.cost());
@@ -581,9 +617,9 @@ collect()
   CGAL_SMS_TRACE(0, "Initial edge count: " << m_initial_edge_count);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 loop()
 {
   CGAL_SMS_TRACE(0, "Collapsing edges...");
@@ -670,9 +706,161 @@ loop()
   }
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+// Same as loop(), except that the edges are processed by rounds: each round pops from the PQ,
+// in order of increasing cost, edges whose one-rings are disjoint, tests them concurrently,
+// collapses them one after the other, and finally updates concurrently the costs of their
+// neighboring edges. The edges of a round are processed in order of increasing cost but
+// an edge can be collapsed before a cheaper edge that conflicted with it.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+loop_in_rounds()
+{
+  CGAL_SMS_TRACE(0, "Collapsing edges by rounds...");
+
+  enum Collapse_status { TOPOLOGICALLY_INVALID, GEOMETRICALLY_INVALID, VALID };
+
+  std::vector<bool> is_locked(num_vertices(m_tm), false);
+  std::vector<vertex_descriptor> locked;
+
+  std::vector<halfedge_descriptor> selected, conflicting;
+  std::vector<std::optional<Profile> > profiles;
+  std::vector<Placement_type> placements;
+  std::vector<Collapse_status> status;
+  std::vector<vertex_descriptor> kept_vertices;
+
+  bool stop = false;
+  while(!stop)
+  {
+    // (A) Select edges in order of increasing cost, skipping those in conflict with a selected edge.
+    // Rounds are a fraction of the remaining edges, so that the order stays close to the sequential one.
+    const std::size_t max_round_size = (std::max)(std::size_t(64), std::size_t(m_current_edge_count / 64));
+
+    std::optional<halfedge_descriptor> opt_h;
+    while(selected.size() < max_round_size &&
+          conflicting.size() < max_round_size &&
+          (opt_h = pop_from_PQ()))
+    {
+      CGAL_SMS_TRACE(1, "Popped " << edge_to_string(*opt_h));
+      CGAL_assertion(!is_constrained(*opt_h));
+
+      if(!get_data(*opt_h).cost())
+      {
+        CGAL_SMS_TRACE(1, edge_to_string(*opt_h) << " uncomputable cost." );
+        continue;
+      }
+
+      if(lock_one_rings(*opt_h, is_locked, locked))
+        selected.push_back(*opt_h);
+      else
+        conflicting.push_back(*opt_h);
+    }
+
+    for(vertex_descriptor v : locked)
+      is_locked[get(m_vim, v)] = false;
+    locked.clear();
+
+    // Conflicting edges go back to the PQ for the next rounds
+    for(halfedge_descriptor h : conflicting)
+      insert_in_PQ(h, get_data(h));
+    conflicting.clear();
+
+    if(selected.empty())
+      break;
+
+    // (B) Test the selected edges concurrently
+    const std::size_t n = selected.size();
+    profiles.clear();
+    profiles.resize(n);
+    placements.assign(n, Placement_type());
+    status.assign(n, TOPOLOGICALLY_INVALID);
+
+    CGAL::for_each<Concurrency_tag>(boost::irange<std::size_t>(0, n),
+                                    [&](const std::size_t i) -> bool
+                                    {
+                                      profiles[i].emplace(create_profile(selected[i]));
+                                      const Profile& profile = *profiles[i];
+                                      if(is_collapse_topologically_valid(profile))
+                                      {
+                                        placements[i] = get_placement(profile);
+                                        status[i] = is_collapse_geometrically_valid(profile, placements[i])
+                                                      ? VALID : GEOMETRICALLY_INVALID;
+                                      }
+                                      return true;
+                                    });
+
+    // (C) Collapse them one after the other
+    for(std::size_t i=0; i<n; ++i)
+    {
+      const Profile& profile = *profiles[i];
+      Cost_type cost = get_data(selected[i]).cost();
+
+      const bool should_stop = m_should_stop(*cost, profile, m_initial_edge_count, m_current_edge_count);
+
+      // The collapses of this round might have created cheaper edges: the remaining edges
+      // go back to the PQ and the stop condition is tested again in the next round
+      if(should_stop && !kept_vertices.empty())
+      {
+        for(std::size_t j=i; j<n; ++j)
+          insert_in_PQ(selected[j], get_data(selected[j]));
+        break;
+      }
+
+      m_visitor.OnSelected(profile, cost, m_initial_edge_count, m_current_edge_count);
+
+      if(should_stop)
+      {
+        m_visitor.OnStopConditionReached(profile);
+
+        CGAL_SMS_TRACE(0, "Stop condition reached with initial edge count=" << m_initial_edge_count
+                            << " current edge count=" << m_current_edge_count
+                            << " current edge: " << edge_to_string(selected[i]));
+        stop = true;
+        break;
+      }
+
+      if(status[i] == VALID)
+      {
+        if(m_should_ignore(profile, placements[i]) != std::nullopt)
+        {
+          kept_vertices.push_back(collapse_without_update(profile, placements[i]));
+        }
+        else
+        {
+          m_visitor.OnNonCollapsable(profile);
+
+          CGAL_SMS_TRACE(1, edge_to_string(selected[i]) << " NOT Collapsible" );
+        }
+      }
+      else if(status[i] == TOPOLOGICALLY_INVALID)
+      {
+        m_visitor.OnNonCollapsable(profile);
+
+        CGAL_SMS_TRACE(1, edge_to_string(selected[i]) << " NOT Collapsible" );
+      }
+    }
+
+    selected.clear();
+
+    // (D) Update the costs of the edges around the vertices kept
+    if(!stop)
+    {
+      Edge_set edges_to_update(Compare_id(this));
+      Edge_set edges_to_insert(Compare_id(this));
+
+      for(vertex_descriptor v : kept_vertices)
+        collect_neighbors(v, edges_to_update, edges_to_insert);
+
+      update_costs(edges_to_update, edges_to_insert);
+    }
+
+    kept_vertices.clear();
+  }
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_border_or_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -684,9 +872,9 @@ is_border_or_constrained(const vertex_descriptor v) const
   return false;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -705,9 +893,9 @@ is_constrained(const vertex_descriptor v) const
 // The link condition is as follows: for every vertex 'k' adjacent to both 'p and 'q',
 // "p,k,q" is a facet of the mesh.
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_topologically_valid(const Profile& profile)
 {
   bool res = true;
@@ -873,17 +1061,17 @@ is_collapse_topologically_valid(const Profile& profile)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_tetrahedron(const halfedge_descriptor h)
 {
   return CGAL::is_tetrahedron(h, m_tm);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_open_triangle(const halfedge_descriptor h1)
 {
   bool res = false;
@@ -912,9 +1100,9 @@ is_open_triangle(const halfedge_descriptor h1)
 // respective areas is no greater than a max value and the internal
 // dihedral angle formed by their supporting planes is no greater than
 // a given threshold
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, const Point& p3) const
 {
   bool res = false;
@@ -964,9 +1152,9 @@ are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, co
 }
 
 // Returns the directed halfedge connecting v0 to v1, if exists.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::halfedge_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::halfedge_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_connection(const vertex_descriptor v0,
                 const vertex_descriptor v1) const
 {
@@ -981,9 +1169,9 @@ find_connection(const vertex_descriptor v0,
 
 // Given the edge 'e' around the link for the collapsinge edge "v0-v1", finds the vertex that makes a triangle adjacent to 'e' but exterior to the link (i.e not containing v0 nor v1)
 // If 'e' is a null handle OR 'e' is a border edge, there is no such triangle and a null handle is returned.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::vertex_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
                                        const vertex_descriptor v0,
                                        const vertex_descriptor v1) const
@@ -1017,9 +1205,9 @@ find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
 // A collapse is geometrically valid if, in the resulting local mesh no two adjacent triangles form an internal dihedral angle
 // greater than a fixed threshold (i.e. triangles do not "fold" into each other)
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
 {
   bool res = false;
@@ -1116,11 +1304,21 @@ is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collapse(const Profile& profile,
          Placement_type placement)
+{
+  update_neighbors(collapse_without_update(profile, placement));
+}
+
+// Collapses the edge but does not update the cost of the neighboring edges, and returns the vertex kept
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+collapse_without_update(const Profile& profile,
+                        Placement_type placement)
 {
   CGAL_SMS_TRACE(1, "S" << m_step << ". Collapsing " << edge_to_string(profile.v0_v1()));
 
@@ -1214,24 +1412,34 @@ collapse(const Profile& profile,
   m_visitor.OnCollapsed(profile, v_res);
   internal::After_collapse_oracles_updater<Self>(*this)(profile, v_res);
 
-  update_neighbors(v_res);
-
   CGAL_SMS_DEBUG_CODE(++m_step;)
+
+  return v_res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 update_neighbors(const vertex_descriptor v_kept)
 {
   CGAL_SMS_TRACE(3,"Updating cost of neighboring edges...");
 
   // (A) collect all edges to update their cost: all those around each vertex adjacent to the vertex kept
-  typedef std::set<halfedge_descriptor, Compare_id>                       Edge_set;
-
   Edge_set edges_to_update(Compare_id(this));
   Edge_set edges_to_insert(Compare_id(this));
 
+  collect_neighbors(v_kept, edges_to_update, edges_to_insert);
+
+  update_costs(edges_to_update, edges_to_insert);
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+collect_neighbors(const vertex_descriptor v_kept,
+                  Edge_set& edges_to_update,
+                  Edge_set& edges_to_insert)
+{
   // (A.1) loop around all vertices adjacent to the vertex kept
   for(halfedge_descriptor h : halfedges_around_target(v_kept, m_tm))
   {
@@ -1252,13 +1460,34 @@ update_neighbors(const vertex_descriptor v_kept)
         edges_to_insert.insert(h2);
     }
   }
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+update_costs(const Edge_set& edges_to_update,
+             const Edge_set& edges_to_insert)
+{
+  // The costs are computed concurrently before the PQ is updated
+  if(is_parallel)
+  {
+    std::vector<halfedge_descriptor> hs(edges_to_update.begin(), edges_to_update.end());
+    for(halfedge_descriptor h : edges_to_insert)
+      if(!is_constrained(h))
+        hs.push_back(h);
+
+    compute_costs(hs);
+  }
 
   // (B) Proceed to update the costs.
   for(halfedge_descriptor h : edges_to_update)
   {
     Edge_data& data = get_data(h);
-    const Profile& profile = create_profile(h);
-    data.cost() = cost(profile);
+    if(!is_parallel)
+    {
+      const Profile& profile = create_profile(h);
+      data.cost() = cost(profile);
+    }
 
     CGAL_SMS_TRACE(3, edge_to_string(h) << " updated in the PQ");
 
@@ -1276,14 +1505,63 @@ update_neighbors(const vertex_descriptor v_kept)
       continue; //do not insert constrained edges
 
     Edge_data& data = get_data(h);
-    const Profile& profile = create_profile(h);
-    data.cost() = cost(profile);
+    if(!is_parallel)
+    {
+      const Profile& profile = create_profile(h);
+      data.cost() = cost(profile);
+    }
 
     CGAL_SMS_TRACE(3, edge_to_string(h) << " re-inserted in the PQ");
     insert_in_PQ(h, data);
   }
 }
 
+// Computes the cost of the primary edges `hs`, concurrently with `Parallel_tag`
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+compute_costs(const std::vector<halfedge_descriptor>& hs)
+{
+  CGAL::for_each<Concurrency_tag>(boost::irange<std::size_t>(0, hs.size()),
+                                  [&](const std::size_t i) -> bool
+                                  {
+                                    const halfedge_descriptor h = primary_edge(hs[i]);
+                                    get_data(h).cost() = cost(create_profile(h));
+                                    return true;
+                                  });
+}
+
+// Locks the vertices of the one-rings of the vertices of `h`, unless one of them is already locked.
+// Two edges whose one-rings are disjoint can be tested and collapsed independently:
+// neither collapse modifies a face, a position or a quadric read by the other.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+bool
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+lock_one_rings(const halfedge_descriptor h,
+               std::vector<bool>& is_locked,
+               std::vector<vertex_descriptor>& locked)
+{
+  const vertex_descriptor vs[2] = { source(h, m_tm), target(h, m_tm) };
+
+  for(vertex_descriptor v : vs)
+    for(halfedge_descriptor hv : halfedges_around_target(v, m_tm))
+      if(is_locked[get(m_vim, source(hv, m_tm))])
+        return false;
+
+  for(vertex_descriptor v : vs)
+    for(halfedge_descriptor hv : halfedges_around_target(v, m_tm))
+    {
+      const vertex_descriptor w = source(hv, m_tm);
+      if(!is_locked[get(m_vim, w)])
+      {
+        is_locked[get(m_vim, w)] = true;
+        locked.push_back(w);
+      }
+    }
+
+  return true;
+}
+
 } // namespace Surface_mesh_simplification
 } // namespace CGAL
 
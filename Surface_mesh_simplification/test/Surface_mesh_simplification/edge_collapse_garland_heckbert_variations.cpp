@@ -11,6 +11,7 @@
 #include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
 
 #include <array>
+#include <cassert>
 #include <chrono>
 #include <iostream>
 #include <fstream>
@@ -87,7 +88,7 @@ get_all_meshes(const std::vector<std::string>& filenames)
 // =================================================================================================
 // =================================================================================================
 
-template <typename Policy>
+template <typename Policy, typename ConcurrencyTag = CGAL::Sequential_tag>
 Surface_mesh edge_collapse(Surface_mesh& mesh,
                            const double ratio = 0.2)
 {
@@ -106,8 +107,8 @@ Surface_mesh edge_collapse(Surface_mesh& mesh,
 
   std::chrono::time_point<std::chrono::steady_clock> start_time = std::chrono::steady_clock::now();
 
-  SMS::edge_collapse(mesh, stop, CGAL::parameters::get_cost(cost)
-                                                  .get_placement(unbounded_placement));
+  SMS::edge_collapse<ConcurrencyTag>(mesh, stop, CGAL::parameters::get_cost(cost)
+                                                                  .get_placement(unbounded_placement));
 
   std::chrono::time_point<std::chrono::steady_clock> end_time = std::chrono::steady_clock::now();
 
@@ -176,13 +177,13 @@ void time_all_policies(const TriangleMesh& mesh,
 // =================================================================================================
 // =================================================================================================
 
-template <typename Policy, typename TriangleMesh>
+template <typename Policy, typename ConcurrencyTag = CGAL::Sequential_tag, typename TriangleMesh>
 double hausdorff_error(const TriangleMesh& mesh,
                        double ratio = 0.2)
 {
   // make a copy of the mesh so we can compare later
   TriangleMesh tmp = mesh;
-  edge_collapse<Policy>(tmp, ratio);
+  edge_collapse<Policy, ConcurrencyTag>(tmp, ratio);
 
   // arbitrary error bound
   CGAL::Bbox_3 bbox = CGAL::Polygon_mesh_processing::bbox(mesh);
@@ -225,6 +226,11 @@ void hausdorff_errors(const TriangleMesh& mesh,
     out << "prob plane   : " << errs[prob_plane_index] << std::endl;
     out << "classic tri  : " << errs[classic_tri_index] << std::endl;
     out << "prob tri     : " << errs[prob_tri_index] << std::endl;
+
+    // collapsing by rounds of independent edges should not noticeably degrade the result
+    const double parallel_err = hausdorff_error<Classic_plane, CGAL::Parallel_if_available_tag>(mesh, *it);
+    out << "classic plane (parallel): " << parallel_err << std::endl;
+    assert(parallel_err <= 2 * errs[classic_plane_index]);
   }
 }
 
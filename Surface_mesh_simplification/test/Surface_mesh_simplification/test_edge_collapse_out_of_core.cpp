@@ -0,0 +1,108 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse_out_of_core.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Midpoint_placement.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Simple_cartesian<double>                        Kernel;
+typedef Kernel::Point_3                                       Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Surface_mesh;
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+// The simplified mesh is a valid closed mesh if the input is, so the blocks are stitched back
+void check_output(const Surface_mesh& input, const std::string& filename)
+{
+  Surface_mesh output;
+  bool ok = CGAL::IO::read_polygon_mesh(filename, output);
+  assert(ok);
+  assert(CGAL::is_valid_polygon_mesh(output) && CGAL::is_triangle_mesh(output));
+  assert(CGAL::is_closed(output) == CGAL::is_closed(input));
+  assert(num_faces(output) < num_faces(input));
+}
+
+template <class ConcurrencyTag>
+void test_ratio(const std::string& filename, const Surface_mesh& input, double ratio, std::size_t block_size)
+{
+  std::cout << "  ratio " << ratio << ", blocks of about " << block_size << " faces" << std::endl;
+
+  SMS::Edge_count_ratio_stop_predicate<Surface_mesh> stop(ratio);
+  const int r = SMS::edge_collapse_out_of_core<Surface_mesh, ConcurrencyTag>(
+                  filename, "out_of_core.off", stop, CGAL::parameters::maximum_number_of_faces(block_size));
+
+  std::cout << "    " << r << " edges removed" << std::endl;
+  assert(r > 0);
+  check_output(input, "out_of_core.off");
+
+  // The ratio is kept roughly over both passes
+  Surface_mesh output;
+  CGAL::IO::read_polygon_mesh("out_of_core.off", output);
+  assert(std::size_t(r) == num_edges(input) - num_edges(output));
+  assert(num_edges(output) < 2 * ratio * num_edges(input));
+  assert(num_edges(output) > 0.5 * ratio * num_edges(input));
+}
+
+void test_edge_length(const std::string& filename, const Surface_mesh& input)
+{
+  std::cout << "  edge length" << std::endl;
+
+  double sq_length = 0;
+  for(Surface_mesh::Edge_index e : edges(input))
+    sq_length += CGAL::squared_distance(input.point(source(e, input)), input.point(target(e, input)));
+  sq_length /= double(num_edges(input));
+
+  // The edges are collapsed until the shortest edge is longer than the average length
+  SMS::Edge_length_stop_predicate<double> stop(std::sqrt(sq_length));
+  const int r = SMS::edge_collapse_out_of_core<Surface_mesh>(
+                  filename, "out_of_core.off", stop,
+                  CGAL::parameters::maximum_number_of_faces(num_faces(input) / 20)
+                                   .get_cost(SMS::Edge_length_cost<Surface_mesh>())
+                                   .get_placement(SMS::Midpoint_placement<Surface_mesh>()));
+
+  std::cout << "    " << r << " edges removed" << std::endl;
+  assert(r > 0);
+  check_output(input, "out_of_core.off");
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+
+  for(const std::string& f : { filename, CGAL::data_file_path("meshes/mech-holes-shark.off") })
+  {
+    Surface_mesh input;
+    if(!CGAL::IO::read_polygon_mesh(f, input) || !CGAL::is_triangle_mesh(input))
+    {
+      std::cerr << "Invalid input: " << f << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << f << ": " << num_faces(input) << " faces" << std::endl;
+
+    // A single block, then several blocks sequentially and in parallel
+    test_ratio<CGAL::Sequential_tag>(f, input, 0.2, num_faces(input));
+    test_ratio<CGAL::Sequential_tag>(f, input, 0.2, num_faces(input) / 20);
+    test_ratio<CGAL::Parallel_if_available_tag>(f, input, 0.2, num_faces(input) / 50);
+    test_edge_length(f, input);
+  }
+
+  // Unreadable input
+  SMS::Edge_count_ratio_stop_predicate<Surface_mesh> stop(0.5);
+  assert(SMS::edge_collapse_out_of_core<Surface_mesh>("does_not_exist.off", "out_of_core.off", stop) == -1);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
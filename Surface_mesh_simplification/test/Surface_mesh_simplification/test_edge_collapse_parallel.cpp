@@ -0,0 +1,199 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Edge_collapse_visitor_base.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Bounded_distance_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Midpoint_placement.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Simple_cartesian<double>                        Kernel;
+typedef Kernel::Point_3                                       Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Surface_mesh;
+typedef boost::graph_traits<Surface_mesh>::edge_descriptor    edge_descriptor;
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef SMS::LindstromTurk_placement<Surface_mesh>                  LT_placement;
+typedef SMS::Bounded_distance_placement<LT_placement, Kernel>       Bounded_placement;
+
+// Counts the collapses, which are reported sequentially even in parallel
+struct Counting_visitor : SMS::Edge_collapse_visitor_base<Surface_mesh>
+{
+  Counting_visitor(int& nb_collapsed, int& nb_stops)
+    : nb_collapsed(nb_collapsed), nb_stops(nb_stops)
+  { }
+
+  void OnCollapsed(const Profile&, vertex_descriptor) { ++nb_collapsed; }
+  void OnStopConditionReached(const Profile&) { ++nb_stops; }
+
+  int& nb_collapsed;
+  int& nb_stops;
+};
+
+bool same_points(const Surface_mesh& a, const Surface_mesh& b)
+{
+  if(a.number_of_vertices() != b.number_of_vertices() || a.number_of_faces() != b.number_of_faces())
+    return false;
+
+  Surface_mesh::Vertex_range::const_iterator va = a.vertices().begin(), vb = b.vertices().begin();
+  for(; va != a.vertices().end(); ++va, ++vb)
+    if(a.point(*va) != b.point(*vb))
+      return false;
+
+  return true;
+}
+
+void test_edge_count_stop(const Surface_mesh& input)
+{
+  std::cout << "  edge count stop" << std::endl;
+
+  const std::size_t threshold = num_edges(input) / 10;
+  SMS::Edge_count_stop_predicate<Surface_mesh> stop(threshold);
+
+  Surface_mesh seq = input;
+  const int r_seq = SMS::edge_collapse(seq, stop);
+
+  Surface_mesh par = input;
+  int nb_collapsed = 0, nb_stops = 0;
+  const int r_par = SMS::edge_collapse<CGAL::Parallel_if_available_tag>(
+                      par, stop, CGAL::parameters::visitor(Counting_visitor(nb_collapsed, nb_stops)));
+
+  std::cout << "    " << r_seq << " edges removed sequentially, " << r_par << " in parallel" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(par) && CGAL::is_triangle_mesh(par));
+  assert(nb_stops == 1);
+  assert(nb_collapsed > 0);
+
+  // Both stop as soon as the number of edges goes below the threshold
+  assert(edges(seq).size() < threshold && edges(par).size() < threshold);
+  assert(edges(par).size() + 3 >= threshold);
+  assert(std::size_t(r_par) == num_edges(input) - edges(par).size());
+
+  // Rounds do not depend on the scheduling of the tasks
+  Surface_mesh par_bis = input;
+  SMS::edge_collapse<CGAL::Parallel_if_available_tag>(par_bis, stop);
+  assert(same_points(par, par_bis));
+}
+
+void test_edge_length_stop(const Surface_mesh& input)
+{
+  std::cout << "  edge length stop" << std::endl;
+
+  double sq_length = 0;
+  for(edge_descriptor e : edges(input))
+    sq_length += CGAL::squared_distance(input.point(source(e, input)), input.point(target(e, input)));
+  sq_length /= double(num_edges(input));
+
+  // The edges are collapsed until the shortest edge is longer than twice the average length
+  SMS::Edge_length_stop_predicate<double> stop(2 * std::sqrt(sq_length));
+
+  Surface_mesh par = input;
+  int nb_collapsed = 0, nb_stops = 0;
+  const int r = SMS::edge_collapse<CGAL::Parallel_if_available_tag>(
+                  par, stop, CGAL::parameters::get_cost(SMS::Edge_length_cost<Surface_mesh>())
+                                              .get_placement(SMS::Midpoint_placement<Surface_mesh>())
+                                              .visitor(Counting_visitor(nb_collapsed, nb_stops)));
+
+  std::cout << "    " << r << " edges removed" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(par) && CGAL::is_triangle_mesh(par));
+  assert(r > 0);
+  assert(nb_stops <= 1);
+}
+
+void test_constrained_edges(const Surface_mesh& input)
+{
+  std::cout << "  constrained edges" << std::endl;
+
+  Surface_mesh par = input;
+
+  // Constrain every fifth edge and the border edges
+  Surface_mesh::Property_map<edge_descriptor, bool> ecm =
+    par.add_property_map<edge_descriptor, bool>("e:constrained", false).first;
+
+  std::size_t nb_constrained = 0;
+  for(edge_descriptor e : edges(par))
+  {
+    if(CGAL::is_border(e, par) || (std::size_t(e) % 5) == 0)
+    {
+      put(ecm, e, true);
+      ++nb_constrained;
+    }
+  }
+
+  SMS::Edge_count_stop_predicate<Surface_mesh> stop(num_edges(input) / 2);
+  SMS::edge_collapse<CGAL::Parallel_if_available_tag>(par, stop, CGAL::parameters::edge_is_constrained_map(ecm));
+
+  assert(CGAL::is_valid_polygon_mesh(par) && CGAL::is_triangle_mesh(par));
+
+  std::size_t nb_constrained_left = 0;
+  for(edge_descriptor e : edges(par))
+    if(get(ecm, e))
+      ++nb_constrained_left;
+
+  assert(nb_constrained_left == nb_constrained);
+}
+
+void test_bounded_distance(const Surface_mesh& input)
+{
+  std::cout << "  bounded distance placement" << std::endl;
+
+  CGAL::Bbox_3 bb;
+  for(Surface_mesh::Vertex_index v : input.vertices())
+    bb += input.point(v).bbox();
+  const double diag = std::sqrt(CGAL::square(bb.xmax() - bb.xmin()) +
+                                CGAL::square(bb.ymax() - bb.ymin()) +
+                                CGAL::square(bb.zmax() - bb.zmin()));
+
+  SMS::Edge_count_stop_predicate<Surface_mesh> stop(num_edges(input) / 10);
+
+  // The tree is lazily built by one of the concurrent calls
+  Surface_mesh seq = input, par = input;
+  Bounded_placement seq_placement(0.001 * diag), par_placement(0.001 * diag);
+  SMS::edge_collapse(seq, stop, CGAL::parameters::get_placement(seq_placement));
+  SMS::edge_collapse<CGAL::Parallel_if_available_tag>(par, stop, CGAL::parameters::get_placement(par_placement));
+
+  std::cout << "    " << vertices(seq).size() << " vertices left sequentially, "
+            << vertices(par).size() << " in parallel" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(par) && CGAL::is_triangle_mesh(par));
+  assert(vertices(par).size() < vertices(input).size());
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/armadillo.off");
+
+  for(const std::string& f : { filename, CGAL::data_file_path("meshes/mech-holes-shark.off") })
+  {
+    Surface_mesh input;
+    if(!CGAL::IO::read_polygon_mesh(f, input) || !CGAL::is_triangle_mesh(input))
+    {
+      std::cerr << "Invalid input: " << f << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << f << ": " << num_edges(input) << " edges" << std::endl;
+
+    test_edge_count_stop(input);
+    test_edge_length_stop(input);
+    test_constrained_edges(input);
+    test_bounded_distance(input);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
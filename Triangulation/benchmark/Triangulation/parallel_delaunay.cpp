@@ -0,0 +1,112 @@
+// Measures the scaling of the parallel insertion of Delaunay_triangulation
+// with the number of threads, compared to the sequential insertion.
+// Usage: parallel_delaunay [number of points] [maximal number of threads]
+
+#include <CGAL/Epick_d.h>
+#include <CGAL/Delaunay_triangulation.h>
+#include <CGAL/point_generators_d.h>
+#include <CGAL/Real_timer.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+//#define USE_DYNAMIC_KERNEL
+#define OUTPUT_STATS_IN_CSV
+
+#ifdef OUTPUT_STATS_IN_CSV
+static std::ofstream csv_file("parallel_stats.csv");
+#endif
+
+template<int D>
+void go(std::size_t N, int max_threads)
+{
+#ifdef USE_DYNAMIC_KERNEL
+  typedef CGAL::Epick_d<CGAL::Dynamic_dimension_tag>  K;
+  typedef CGAL::Dynamic_dimension_tag                 Dim;
+#else
+  typedef CGAL::Epick_d<CGAL::Dimension_tag<D> >      K;
+  typedef CGAL::Dimension_tag<D>                      Dim;
+#endif
+  typedef CGAL::Delaunay_triangulation<K>             DT;
+  typedef typename DT::Point                          Point;
+
+  typedef CGAL::Random_points_in_cube_d<Point>        Random_points_iterator;
+
+  // Generate points, reproducibly
+  std::vector<Point> points;
+  CGAL::Random rng(0);
+  Random_points_iterator rand_it(D, 1.0, rng);
+  std::copy_n(rand_it, N, std::back_inserter(points));
+
+  std::cout << "Delaunay triangulation of " << N <<
+    " points in dim " << D << ":" << std::endl;
+
+  CGAL::Real_timer timer;
+  timer.start();
+  DT dt(D);
+  dt.insert(points.begin(), points.end());
+  timer.stop();
+  double sequential_time = timer.time();
+  std::cout << "  Sequential: " << sequential_time << " seconds, "
+            << dt.number_of_finite_full_cells() << " finite simplices." << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Triangulation_data_structure<Dim,
+                                             CGAL::Triangulation_vertex<K>,
+                                             CGAL::Triangulation_full_cell<K>,
+                                             CGAL::Parallel_tag> TDS_parallel;
+  typedef CGAL::Delaunay_triangulation<K, TDS_parallel>   DT_parallel;
+  typedef typename DT_parallel::Lock_data_structure       Lock_data_structure;
+
+  // A few cells per axis are enough in high dimensions, as the grid has
+  // (cells per axis)^D cells
+  int num_grid_cells_per_axis = (D <= 3) ? 50 : (D == 4 ? 16 : 8);
+  std::vector<double> bbox_min(D, -1.), bbox_max(D, 1.);
+
+  for(int num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+  {
+    tbb::global_control c(tbb::global_control::max_allowed_parallelism, num_threads);
+    Lock_data_structure locking_ds(bbox_min.begin(), bbox_min.end(), bbox_max.begin(),
+                                   num_grid_cells_per_axis);
+    timer.reset();
+    timer.start();
+    DT_parallel pdt(D, &locking_ds);
+    pdt.insert(points.begin(), points.end());
+    timer.stop();
+    std::cout << "  Parallel with " << num_threads << " thread(s): " << timer.time()
+              << " seconds, speedup " << sequential_time / timer.time() << std::endl;
+
+#ifdef OUTPUT_STATS_IN_CSV
+    csv_file
+      << D << ";"
+      << N << ";"
+      << num_threads << ";"
+      << sequential_time << ";"
+      << timer.time() << "\n"
+      << std::flush;
+#endif
+  }
+#else
+  CGAL_USE(max_threads);
+  std::cout << "  TBB is not available: no parallel insertion." << std::endl;
+#endif
+}
+
+int main(int argc, char **argv)
+{
+  std::size_t N = (argc > 1) ? std::atoi(argv[1]) : 100000;
+  int max_threads = (argc > 2) ? std::atoi(argv[2])
+                               : (std::max)(1, int(std::thread::hardware_concurrency()));
+  go<3>(N, max_threads);
+  go<4>(N / 4, max_threads);
+  go<5>(N / 20, max_threads);
+  return 0;
+}
@@ -20,22 +20,155 @@
 #include <CGAL/Triangulation.h>
 #include <CGAL/Dimension.h>
 #include <CGAL/Default.h>
+#include <CGAL/Spatial_lock_grid_d.h>
+#include <CGAL/tags.h>
 
 #include <boost/container/small_vector.hpp>
 #include <CGAL/boost/iterator/transform_iterator.hpp>
+#include <boost/mpl/has_xxx.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/enumerable_thread_specific.h>
+# include <tbb/parallel_for.h>
+#endif
 
 #include <algorithm>
 
 namespace CGAL {
 
-template< typename DCTraits, typename _TDS = Default >
+namespace internal {
+namespace Triangulation {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Concurrency_tag, Concurrency_tag, false)
+
+// Concurrency tag of a triangulation data structure, `Sequential_tag` if it defines none
+template <class TDS, bool = Has_nested_type_Concurrency_tag<TDS>::value>
+struct Get_concurrency_tag
+{
+    typedef Sequential_tag type;
+};
+
+template <class TDS>
+struct Get_concurrency_tag<TDS, true>
+{
+    typedef typename TDS::Concurrency_tag type;
+};
+
+/************************************************
+// Class Delaunay_triangulation_lock_base
+// Two versions: Sequential (no locking) / Parallel (with locking)
+************************************************/
+
+// Sequential (without locking)
+template <typename Concurrency_tag, typename Lock_data_structure_>
+class Delaunay_triangulation_lock_base
+{
+public:
+    // If Lock_data_structure_ = Default => void
+    typedef typename Default::Get<
+        Lock_data_structure_, void>::type Lock_data_structure;
+
+protected:
+    Delaunay_triangulation_lock_base(Lock_data_structure * = nullptr) {}
+
+public:
+    bool is_parallel() const
+    {
+        return false;
+    }
+
+    // LOCKS (no-op functions)
+    template <typename Point_d, typename Geom_traits>
+    bool try_lock_point(const Point_d &, const Geom_traits &) const
+    { return true; }
+
+    void *get_lock_data_structure() const
+    {
+        return nullptr;
+    }
+
+    void set_lock_data_structure(void *) const {}
+
+    void unlock_all_elements() const {}
+};
+
+#ifdef CGAL_LINKED_WITH_TBB
+// Parallel (with locking)
+template <typename Lock_data_structure_>
+class Delaunay_triangulation_lock_base<Parallel_tag, Lock_data_structure_>
+{
+public:
+    // If Lock_data_structure_ = Default => use Spatial_lock_grid_d
+    typedef typename Default::Get<
+        Lock_data_structure_,
+        Spatial_lock_grid_d<Tag_priority_blocking> >::type Lock_data_structure;
+
+protected:
+    Delaunay_triangulation_lock_base(Lock_data_structure *lock_ds = nullptr)
+    : m_lock_ds(lock_ds)
+    {
+    }
+
+public:
+    bool is_parallel() const
+    {
+        return m_lock_ds != nullptr;
+    }
+
+    // LOCKS
+    // The coordinates of `p` are computed with `gt.compute_coordinate_d_object()`
+    template <typename Point_d, typename Geom_traits>
+    bool try_lock_point(const Point_d & p, const Geom_traits & gt) const
+    {
+        if( m_lock_ds == nullptr )
+            return true;
+        typename Geom_traits::Compute_coordinate_d coord = gt.compute_coordinate_d_object();
+        boost::container::small_vector<double, 8> coords(m_lock_ds->dimension());
+        for( int i = 0; i < m_lock_ds->dimension(); ++i )
+            coords[i] = CGAL::to_double(coord(p, i));
+        return m_lock_ds->try_lock(coords.begin(), coords.end());
+    }
+
+    Lock_data_structure *get_lock_data_structure() const
+    {
+        return m_lock_ds;
+    }
+
+    void set_lock_data_structure(Lock_data_structure *lock_ds) const
+    {
+        m_lock_ds = lock_ds;
+    }
+
+    void unlock_all_elements() const
+    {
+        if( m_lock_ds )
+            m_lock_ds->unlock_all_points_locked_by_this_thread();
+    }
+
+protected:
+    mutable Lock_data_structure *m_lock_ds;
+};
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace Triangulation
+} // namespace internal
+
+template< typename DCTraits, typename _TDS = Default, typename Lock_data_structure_ = Default >
 class Delaunay_triangulation
 : public Triangulation<DCTraits,
             typename Default::Get<_TDS, Triangulation_data_structure<
                              typename DCTraits::Dimension,
                              Triangulation_vertex<DCTraits>,
                              Triangulation_full_cell<DCTraits> >
-                    >::type >
+                    >::type >,
+  public internal::Triangulation::Delaunay_triangulation_lock_base<
+            typename internal::Triangulation::Get_concurrency_tag<
+                typename Default::Get<_TDS, Triangulation_data_structure<
+                             typename DCTraits::Dimension,
+                             Triangulation_vertex<DCTraits>,
+                             Triangulation_full_cell<DCTraits> >
+                    >::type >::type,
+            Lock_data_structure_>
 {
     typedef typename DCTraits::Dimension            Maximal_dimension_;
     typedef typename Default::Get<_TDS, Triangulation_data_structure<
@@ -44,7 +177,10 @@ class Delaunay_triangulation
                          Triangulation_full_cell<DCTraits> >
                 >::type                             TDS;
     typedef Triangulation<DCTraits, TDS>            Base;
-    typedef Delaunay_triangulation<DCTraits, _TDS>  Self;
+    typedef Delaunay_triangulation<DCTraits, _TDS, Lock_data_structure_>  Self;
+    typedef internal::Triangulation::Delaunay_triangulation_lock_base<
+                typename internal::Triangulation::Get_concurrency_tag<TDS>::type,
+                Lock_data_structure_>               Lock_base;
 
     typedef typename DCTraits::Side_of_oriented_sphere_d
                                                     Side_of_oriented_sphere_d;
@@ -54,6 +190,9 @@ public: // PUBLIC NESTED TYPES
 
     typedef DCTraits                                Geom_traits;
     typedef typename Base::Triangulation_ds         Triangulation_ds;
+    typedef typename internal::Triangulation::Get_concurrency_tag<TDS>::type
+                                                    Concurrency_tag;
+    typedef typename Lock_base::Lock_data_structure Lock_data_structure;
 
     typedef typename Base::Vertex                   Vertex;
     typedef typename Base::Full_cell                Full_cell;
@@ -157,6 +296,13 @@ public:
     {
     }
 
+    // With a `Parallel_tag` data structure, the range insertion is parallel
+    // if a lock data structure covering the points is given.
+    Delaunay_triangulation(int dim, Lock_data_structure *lock_ds, const Geom_traits &k = Geom_traits())
+    : Base(dim, k), Lock_base(lock_ds)
+    {
+    }
+
     // With this constructor,
     // the user can specify a Flat_orientation_d object to be used for
     // orienting simplices of a specific dimension
@@ -218,7 +364,14 @@ public:
     {
         size_type n = number_of_vertices();
         std::vector<Point> points(start, end);
-        spatial_sort(points.begin(), points.end(), geom_traits());
+        spatial_sort<Concurrency_tag>(points.begin(), points.end(), geom_traits());
+#ifdef CGAL_LINKED_WITH_TBB
+        if( this->is_parallel() )
+        {
+            parallel_insert(points);
+            return number_of_vertices() - n;
+        }
+#endif // CGAL_LINKED_WITH_TBB
         Full_cell_handle hint;
         for( typename std::vector<Point>::const_iterator p = points.begin(); p != points.end(); ++p )
         {
@@ -337,6 +490,13 @@ private:
             Conflict_traversal_pred_in_subspace;
     typedef Conflict_traversal_predicate<Conflict_pred_in_fullspace>
             Conflict_traversal_pred_in_fullspace;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    void parallel_insert(const std::vector<Point> &);
+    bool try_lock_vertex(Vertex_const_handle) const;
+    bool try_lock_full_cell(Full_cell_const_handle) const;
+    Vertex_handle insert_in_locked_zone(const Point &, Vertex_handle);
+#endif // CGAL_LINKED_WITH_TBB
 };
 
 // = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = =
@@ -344,9 +504,9 @@ private:
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - REMOVALS
 
-template< typename DCTraits, typename TDS >
-typename Delaunay_triangulation<DCTraits, TDS>::Full_cell_handle
-Delaunay_triangulation<DCTraits, TDS>
+template< typename DCTraits, typename TDS, typename LDS >
+typename Delaunay_triangulation<DCTraits, TDS, LDS>::Full_cell_handle
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::remove( Vertex_handle v )
 {
     CGAL_precondition( ! is_infinite(v) );
@@ -637,9 +797,9 @@ Delaunay_triangulation<DCTraits, TDS>
     return ret_s;
 }
 
-template< typename DCTraits, typename TDS >
+template< typename DCTraits, typename TDS, typename LDS >
 void
-Delaunay_triangulation<DCTraits, TDS>
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::remove_decrease_dimension(Vertex_handle v)
 {
     CGAL_precondition( current_dimension() >= 0 );
@@ -660,9 +820,9 @@ Delaunay_triangulation<DCTraits, TDS>
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - INSERTIONS
 
-template< typename DCTraits, typename TDS >
-typename Delaunay_triangulation<DCTraits, TDS>::Vertex_handle
-Delaunay_triangulation<DCTraits, TDS>
+template< typename DCTraits, typename TDS, typename LDS >
+typename Delaunay_triangulation<DCTraits, TDS, LDS>::Vertex_handle
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::insert(const Point & p, Locate_type lt, const Face & f, const Facet &, Full_cell_handle s)
 {
     switch( lt )
@@ -703,9 +863,9 @@ Inserts the point `p` in the Delaunay triangulation. Returns a handle to the
 must lie outside the affine hull of the Delaunay triangulation. This implies that
 `dt`.`current_dimension()` must be less than `dt`.`maximal_dimension()`.
 */
-template< typename DCTraits, typename TDS >
-typename Delaunay_triangulation<DCTraits, TDS>::Vertex_handle
-Delaunay_triangulation<DCTraits, TDS>
+template< typename DCTraits, typename TDS, typename LDS >
+typename Delaunay_triangulation<DCTraits, TDS, LDS>::Vertex_handle
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::insert_outside_affine_hull(const Point & p)
 {
     // we don't use Base::insert_outside_affine_hull(...) because here, we
@@ -764,9 +924,9 @@ Inserts the point `p` in the Delaunay triangulation. Returns a handle to the
 (possibly newly created) vertex at that position.
 \pre The point `p` must be in conflict with the full cell `c`.
 */
-template< typename DCTraits, typename TDS >
-typename Delaunay_triangulation<DCTraits, TDS>::Vertex_handle
-Delaunay_triangulation<DCTraits, TDS>
+template< typename DCTraits, typename TDS, typename LDS >
+typename Delaunay_triangulation<DCTraits, TDS, LDS>::Vertex_handle
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::insert_in_conflicting_cell(const Point & p, Full_cell_handle s)
 {
     CGAL_precondition(is_in_conflict(p, s));
@@ -781,13 +941,199 @@ Delaunay_triangulation<DCTraits, TDS>
     return insert_in_hole(p, cs.begin(), cs.end(), ft);
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+
+/*
+[Undocumented function]
+
+Inserts the spatially sorted `points`. The first points are inserted
+sequentially, until the triangulation has full dimension. The remaining
+ones are then inserted concurrently, each thread walking from the vertex it
+last inserted, as in the parallel insertion of `Delaunay_triangulation_3`.
+*/
+template< typename DCTraits, typename TDS, typename LDS >
+void
+Delaunay_triangulation<DCTraits, TDS, LDS>
+::parallel_insert(const std::vector<Point> & points)
+{
+    std::size_t i = 0, n = points.size();
+    // Insert "num_points_seq" points sequentially
+    // (or more if the dimension is not maximal after that)
+    std::size_t num_points_seq = (std::min)(n, std::size_t(100));
+    Vertex_handle hint;
+    Full_cell_handle s;
+    while( i < num_points_seq || ( current_dimension() < maximal_dimension() && i < n ) )
+    {
+        hint = insert(points[i++], s);
+        s = hint->full_cell();
+    }
+    if( i == n )
+        return;
+
+    tbb::enumerable_thread_specific<Vertex_handle> tls_hint(hint);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(i, n),
+                      [&](const tbb::blocked_range<std::size_t> & r)
+    {
+        Vertex_handle & hint = tls_hint.local();
+        for( std::size_t j = r.begin(); j != r.end(); ++j )
+        {
+            const Point & p = points[j];
+            for( ;; )
+            {
+                Vertex_handle v;
+                if( try_lock_vertex(hint) && this->try_lock_point(p, geom_traits()) )
+                    v = insert_in_locked_zone(p, hint);
+                this->unlock_all_elements();
+                if( Vertex_handle() != v )
+                {
+                    hint = v;
+                    break;
+                }
+            }
+        }
+    });
+}
+
+template< typename DCTraits, typename TDS, typename LDS >
+bool
+Delaunay_triangulation<DCTraits, TDS, LDS>
+::try_lock_vertex(Vertex_const_handle v) const
+{
+    // the full cells incident to the infinite vertex are locked by their finite vertices
+    return is_infinite(v) || this->try_lock_point(v->point(), geom_traits());
+}
+
+template< typename DCTraits, typename TDS, typename LDS >
+bool
+Delaunay_triangulation<DCTraits, TDS, LDS>
+::try_lock_full_cell(Full_cell_const_handle s) const
+{
+    for( int i = 0; i <= current_dimension(); ++i )
+        if( ! try_lock_vertex(s->vertex(i)) )
+            return false;
+    return true;
+}
+
+/*
+[Undocumented function]
+
+Inserts the point `p` in a triangulation of full dimension, by walking from
+`hint` and inserting `p` in the hole of its conflict zone. Every full cell
+that is read is first locked, so that the full cells that are modified are
+all locked by the calling thread. Returns the new vertex, or the vertex at
+`p` if there is one already, or the default handle if a full cell could not
+be locked.
+\pre `hint` and `p` are locked by the calling thread.
+*/
+template< typename DCTraits, typename TDS, typename LDS >
+typename Delaunay_triangulation<DCTraits, TDS, LDS>::Vertex_handle
+Delaunay_triangulation<DCTraits, TDS, LDS>
+::insert_in_locked_zone(const Point & p, Vertex_handle hint)
+{
+    CGAL_precondition( current_dimension() == maximal_dimension() );
+    const int cur_dim = current_dimension();
+    Orientation_d ori = geom_traits().orientation_d_object();
+
+    // visibility walk, which terminates in a Delaunay triangulation
+    Full_cell_handle s = hint->full_cell(), previous;
+    if( ! try_lock_full_cell(s) )
+        return Vertex_handle();
+    if( is_infinite(s) )
+    {
+        s = s->neighbor(s->index(infinite_vertex()));
+        if( ! try_lock_full_cell(s) )
+            return Vertex_handle();
+    }
+    while( ! is_infinite(s) )
+    {
+        Full_cell_handle next;
+        for( int i = 0; i <= cur_dim; ++i )
+        {
+            if( previous == s->neighbor(i) )
+                continue;
+            Substitute_point_in_vertex_iterator<
+              typename Full_cell::Vertex_handle_const_iterator>
+              spivi(s->vertex(i), &p);
+            if( NEGATIVE == ori(
+                  boost::make_transform_iterator(s->vertices_begin(), spivi),
+                  boost::make_transform_iterator(s->vertices_begin() + cur_dim + 1, spivi)) )
+            {
+                next = s->neighbor(i);
+                break;
+            }
+        }
+        if( Full_cell_handle() == next )
+        {
+            // |p| is in the closed full cell |s|
+            for( int i = 0; i <= cur_dim; ++i )
+                if( EQUAL == geom_traits().compare_lexicographically_d_object()(p, s->vertex(i)->point()) )
+                    return s->vertex(i);
+            break;
+        }
+        if( ! try_lock_full_cell(next) )
+            return Vertex_handle();
+        previous = s;
+        s = next;
+    }
+
+    // breadth first search of the conflict zone, as in gather_full_cells,
+    // where the full cells are locked before being visited
+    typedef std::vector<Full_cell_handle> Full_cell_h_vector;
+    CGAL_STATIC_THREAD_LOCAL_VARIABLE(Full_cell_h_vector, cs, 0);
+    CGAL_STATIC_THREAD_LOCAL_VARIABLE(Full_cell_h_vector, outside, 0);
+    cs.clear();
+    outside.clear();
+    Conflict_pred_in_fullspace c(*this, p, ori, geom_traits().side_of_oriented_sphere_d_object());
+    Facet ft;
+    bool locked = true;
+    s->tds_data().mark_visited();
+    cs.push_back(s);
+    for( std::size_t k = 0; locked && k < cs.size(); ++k )
+    {
+        for( int i = 0; i <= cur_dim; ++i )
+        {
+            Full_cell_handle n = cs[k]->neighbor(i);
+            if( ! try_lock_full_cell(n) )
+            {
+                locked = false;
+                break;
+            }
+            if( n->tds_data().is_visited() )
+                continue;
+            // the conflict predicate may look at the finite neighbor of an infinite full cell
+            if( is_infinite(n) && ! try_lock_full_cell(n->neighbor(n->index(infinite_vertex()))) )
+            {
+                locked = false;
+                break;
+            }
+            n->tds_data().mark_visited();
+            if( c(n) )
+                cs.push_back(n);
+            else
+            {
+                outside.push_back(n);
+                ft = Facet(cs[k], i);
+            }
+        }
+    }
+    for( Full_cell_handle fc : cs )
+        fc->tds_data().clear_visited();
+    for( Full_cell_handle fc : outside )
+        fc->tds_data().clear_visited();
+    if( ! locked )
+        return Vertex_handle();
+    return insert_in_hole(p, cs.begin(), cs.end(), ft);
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - GATHERING CONFLICTING SIMPLICES
 
 // NOT DOCUMENTED
-template< typename DCTraits, typename TDS >
+template< typename DCTraits, typename TDS, typename LDS >
 template< typename OrientationPred >
 Oriented_side
-Delaunay_triangulation<DCTraits, TDS>
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::perturbed_side_of_positive_sphere(const Point & p, Full_cell_const_handle s,
         const OrientationPred & ori) const
 {
@@ -840,9 +1186,9 @@ Delaunay_triangulation<DCTraits, TDS>
     return ON_NEGATIVE_SIDE;
 }
 
-template< typename DCTraits, typename TDS >
+template< typename DCTraits, typename TDS, typename LDS >
 bool
-Delaunay_triangulation<DCTraits, TDS>
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::is_in_conflict(const Point & p, Full_cell_const_handle s) const
 {
     CGAL_precondition( 2 <= current_dimension() );
@@ -860,10 +1206,10 @@ Delaunay_triangulation<DCTraits, TDS>
     }
 }
 
-template< typename DCTraits, typename TDS >
+template< typename DCTraits, typename TDS, typename LDS >
 template< typename OutputIterator >
-typename Delaunay_triangulation<DCTraits, TDS>::Facet
-Delaunay_triangulation<DCTraits, TDS>
+typename Delaunay_triangulation<DCTraits, TDS, LDS>::Facet
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::compute_conflict_zone(const Point & p, Full_cell_handle s, OutputIterator out) const
 {
     CGAL_precondition( 2 <= current_dimension() );
@@ -885,9 +1231,9 @@ Delaunay_triangulation<DCTraits, TDS>
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - VALIDITY
 
-template< typename DCTraits, typename TDS >
+template< typename DCTraits, typename TDS, typename LDS >
 bool
-Delaunay_triangulation<DCTraits, TDS>
+Delaunay_triangulation<DCTraits, TDS, LDS>
 ::is_valid(bool verbose, int level) const
 {
   if (!Base::is_valid(verbose, level))
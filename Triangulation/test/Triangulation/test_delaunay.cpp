@@ -102,6 +102,52 @@ void test(const int d, const string & type, const int N)
     assert( dt.is_valid() );
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+template<typename DC, typename Sequential_DC>
+void test_parallel(const int d, const int N)
+{
+    typedef typename DC::Point Point;
+    typedef typename DC::Lock_data_structure Lock_data_structure;
+
+    cerr << "\nBuilding Delaunay triangulation of dimension " << d << " with " << N << " points in parallel";
+    vector<Point> points;
+    srand(10);
+    for( int i = 0; i < N; ++i )
+    {
+        vector<double> coords(d);
+        for( int j = 0; j < d; ++j )
+            coords[j] = static_cast<double>(rand() % 100000)/10000;
+        points.push_back(Point(d, coords.begin(), coords.end()));
+    }
+    // Construct the locking data-structure, using the bounding-box of the points
+    vector<double> bbox_min(d, 0.), bbox_max(d, 10.);
+    Lock_data_structure locking_ds(bbox_min.begin(), bbox_min.end(), bbox_max.begin(), 10);
+    DC dt(d, &locking_ds);
+    dt.insert(points.begin(), points.end());
+    assert( dt.is_valid() );
+    assert( locking_ds.check_if_all_cells_are_unlocked() );
+
+    Sequential_DC sdt(d);
+    sdt.insert(points.begin(), points.end());
+    assert( dt.number_of_vertices() == sdt.number_of_vertices() );
+    assert( dt.number_of_full_cells() == sdt.number_of_full_cells() );
+
+    // Parallel insertion in a non empty triangulation
+    for( Point & p : points )
+    {
+        vector<double> coords(d);
+        for( int j = 0; j < d; ++j )
+            coords[j] = static_cast<double>(rand() % 100000)/10000;
+        p = Point(d, coords.begin(), coords.end());
+    }
+    dt.insert(points.begin(), points.end());
+    sdt.insert(points.begin(), points.end());
+    assert( dt.is_valid() );
+    assert( dt.number_of_vertices() == sdt.number_of_vertices() );
+    assert( dt.number_of_full_cells() == sdt.number_of_full_cells() );
+}
+#endif
+
 template< int D >
 void go(const int N)
 {
@@ -120,6 +166,20 @@ void go(const int N)
     typedef CGAL::Epeck_d<CGAL::Dynamic_dimension_tag> KE_dyn;
     typedef CGAL::Delaunay_triangulation<KE_dyn> TriangulationE_dyn;
     test<TriangulationE_dyn>(D, "exact dynamic", N);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    typedef CGAL::Triangulation_data_structure<CGAL::Dimension_tag<D>,
+                                               CGAL::Triangulation_vertex<KI>,
+                                               CGAL::Triangulation_full_cell<KI>,
+                                               CGAL::Parallel_tag> TDS_parallel;
+    typedef CGAL::Delaunay_triangulation<KI, TDS_parallel> Triangulation_parallel;
+    // The following test won't do things in parallel since it doesn't provide
+    // a lock data structure
+    test<Triangulation_parallel>(D, "inexact static parallel", N);
+    // This test performs parallel operations
+    if( D > 1 )
+        test_parallel<Triangulation_parallel, Triangulation>(D, 2000);
+#endif
 }
 
 int main(int argc, char **argv)
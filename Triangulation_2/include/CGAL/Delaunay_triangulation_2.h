@@ -19,6 +19,15 @@
 #include <CGAL/Triangulation_2.h>
 #include <CGAL/iterator.h>
 #include <CGAL/Object.h>
+#include <CGAL/Spatial_lock_grid_2.h>
+#include <CGAL/tags.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/enumerable_thread_specific.h>
+# include <tbb/parallel_for.h>
+#endif
 
 #ifndef CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 #include <CGAL/Spatial_sort_traits_adapter_2.h>
@@ -31,14 +40,133 @@
 
 namespace CGAL {
 
+namespace internal {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Concurrency_tag, Concurrency_tag, false)
+
+// Concurrency tag of a triangulation data structure, `Sequential_tag` if it defines none
+template <class Tds, bool = Has_nested_type_Concurrency_tag<Tds>::value>
+struct Get_concurrency_tag_2
+{
+  typedef Sequential_tag type;
+};
+
+template <class Tds>
+struct Get_concurrency_tag_2<Tds, true>
+{
+  typedef typename Tds::Concurrency_tag type;
+};
+
+/************************************************
+// Class Delaunay_triangulation_2_lock_base
+// Two versions: Sequential (no locking) / Parallel (with locking)
+************************************************/
+
+// Sequential (without locking)
+template <typename Concurrency_tag, typename Lock_data_structure_>
+class Delaunay_triangulation_2_lock_base
+{
+public:
+  // If Lock_data_structure_ = Default => void
+  typedef typename Default::Get<
+    Lock_data_structure_, void>::type Lock_data_structure;
+
+protected:
+  Delaunay_triangulation_2_lock_base(Lock_data_structure * = nullptr) {}
+
+public:
+  bool is_parallel() const
+  {
+    return false;
+  }
+
+  // LOCKS (no-op functions)
+  template <typename Point_2>
+  bool try_lock_point(const Point_2&) const
+  { return true; }
+
+  void *get_lock_data_structure() const
+  {
+    return nullptr;
+  }
+
+  void set_lock_data_structure(void *) const {}
+
+  void unlock_all_elements() const {}
+};
+
+#ifdef CGAL_LINKED_WITH_TBB
+// Parallel (with locking)
+template <typename Lock_data_structure_>
+class Delaunay_triangulation_2_lock_base<Parallel_tag, Lock_data_structure_>
+{
+public:
+  // If Lock_data_structure_ = Default => use Spatial_lock_grid_2
+  typedef typename Default::Get<
+    Lock_data_structure_,
+    Spatial_lock_grid_2<Tag_priority_blocking> >::type Lock_data_structure;
+
+protected:
+  Delaunay_triangulation_2_lock_base(Lock_data_structure *lock_ds = nullptr)
+    : m_lock_ds(lock_ds)
+  {
+  }
+
+public:
+  bool is_parallel() const
+  {
+    return m_lock_ds != nullptr;
+  }
+
+  // LOCKS
+  template <typename Point_2>
+  bool try_lock_point(const Point_2& p) const
+  {
+    return m_lock_ds == nullptr || m_lock_ds->try_lock(p);
+  }
+
+  Lock_data_structure *get_lock_data_structure() const
+  {
+    return m_lock_ds;
+  }
+
+  void set_lock_data_structure(Lock_data_structure *lock_ds) const
+  {
+    m_lock_ds = lock_ds;
+  }
+
+  void unlock_all_elements() const
+  {
+    if(m_lock_ds)
+      m_lock_ds->unlock_all_points_locked_by_this_thread();
+  }
+
+protected:
+  mutable Lock_data_structure *m_lock_ds;
+};
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace internal
+
 template < class Gt,
            class Tds = Triangulation_data_structure_2 <
                          Triangulation_vertex_base_2<Gt>,
-                         Triangulation_face_base_2<Gt> > >
+                         Triangulation_face_base_2<Gt> >,
+           class Lock_data_structure_ = Default >
 class Delaunay_triangulation_2
-    : public Triangulation_2<Gt,Tds>
+    : public Triangulation_2<Gt,Tds>,
+      public internal::Delaunay_triangulation_2_lock_base<
+               typename internal::Get_concurrency_tag_2<Tds>::type,
+               Lock_data_structure_>
 {
+  typedef internal::Delaunay_triangulation_2_lock_base<
+            typename internal::Get_concurrency_tag_2<Tds>::type,
+            Lock_data_structure_>                       Lock_base;
+
 public:
+  typedef typename internal::Get_concurrency_tag_2<Tds>::type Concurrency_tag;
+  typedef typename Lock_base::Lock_data_structure       Lock_data_structure;
+
   typedef Gt Geom_traits;
   typedef typename Geom_traits::Point_2       Point;
   typedef typename Geom_traits::Segment_2     Segment;
@@ -86,8 +214,8 @@ public:
   : Triangulation_2<Gt,Tds>(gt) {}
 
   Delaunay_triangulation_2(
-         const Delaunay_triangulation_2<Gt,Tds> &tr)
-       : Triangulation_2<Gt,Tds>(tr)
+         const Delaunay_triangulation_2 &tr)
+       : Triangulation_2<Gt,Tds>(tr), Lock_base(tr.get_lock_data_structure())
   {   CGAL_postcondition(is_valid());  }
 
   Delaunay_triangulation_2(Delaunay_triangulation_2&&) = default;
@@ -103,6 +231,19 @@ public:
   insert(first,last);
  }
 
+  // With a `Parallel_tag` data structure, the range insertion is parallel
+  // if a lock data structure covering the points is given.
+  Delaunay_triangulation_2(Lock_data_structure *lock_ds, const Gt& gt = Gt())
+    : Triangulation_2<Gt,Tds>(gt), Lock_base(lock_ds) {}
+
+  template <class InputIterator>
+  Delaunay_triangulation_2(InputIterator first, InputIterator last,
+                           Lock_data_structure *lock_ds, const Gt& gt = Gt())
+    : Triangulation_2<Gt,Tds>(gt), Lock_base(lock_ds)
+  {
+    insert(first,last);
+  }
+
 // CHECK -QUERY
   bool is_valid(bool verbose = false, int level = 0) const;
 
@@ -315,7 +456,17 @@ public:
     size_type n = this->number_of_vertices();
 
     std::vector<Point> points (first, last);
-    spatial_sort (points.begin(), points.end(), geom_traits());
+    spatial_sort<Concurrency_tag> (points.begin(), points.end(), geom_traits());
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (this->is_parallel()) {
+      parallel_insert(points.size(),
+                      [&points](std::size_t i) -> const Point& { return points[i]; },
+                      [](std::size_t, Vertex_handle) {});
+      return this->number_of_vertices() - n;
+    }
+#endif // CGAL_LINKED_WITH_TBB
+
     Face_handle f;
     for (typename std::vector<Point>::const_iterator p = points.begin(), end = points.end();
          p != end; ++p)
@@ -349,8 +500,17 @@ private:
     typedef typename Pointer_property_map<Point>::type Pmap;
     typedef Spatial_sort_traits_adapter_2<Geom_traits,Pmap> Search_traits;
 
-    spatial_sort(indices.begin(), indices.end(),
-                 Search_traits(make_property_map(points),geom_traits()));
+    spatial_sort<Concurrency_tag>(indices.begin(), indices.end(),
+                                  Search_traits(make_property_map(points),geom_traits()));
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (this->is_parallel()) {
+      parallel_insert(indices.size(),
+                      [&](std::size_t i) -> const Point& { return points[indices[i]]; },
+                      [&](std::size_t i, Vertex_handle v) { v->info() = infos[indices[i]]; });
+      return this->number_of_vertices() - n;
+    }
+#endif // CGAL_LINKED_WITH_TBB
 
     Vertex_handle v_hint;
     Face_handle hint;
@@ -395,6 +555,132 @@ public:
   }
 #endif //CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 
+#ifdef CGAL_LINKED_WITH_TBB
+private:
+  // Inserts the points `point_at(0)`, ..., `point_at(n-1)`, which are spatially sorted,
+  // and calls `on_insert(i, v)` with the vertex `v` of each point `point_at(i)`.
+  // The first points are inserted sequentially, until the triangulation has dimension 2.
+  // The remaining ones are then inserted concurrently, each thread walking from
+  // the vertex it last inserted, as in the parallel insertion of `Delaunay_triangulation_3`.
+  template <class PointAt, class OnInsert>
+  void parallel_insert(std::size_t n, PointAt point_at, OnInsert on_insert)
+  {
+    std::size_t i = 0;
+    // Insert "num_points_seq" points sequentially
+    // (or more if dim < 2 after that)
+    std::size_t num_points_seq = (std::min)(n, std::size_t(100));
+    Vertex_handle hint;
+    Face_handle f;
+    while (i < num_points_seq || (this->dimension() < 2 && i < n)) {
+      hint = insert(point_at(i), f);
+      on_insert(i, hint);
+      f = hint->face();
+      ++i;
+    }
+
+    tbb::enumerable_thread_specific<Vertex_handle> tls_hint(hint);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(i, n),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      Vertex_handle& hint = tls_hint.local();
+      for (std::size_t j = r.begin(); j != r.end(); ++j) {
+        const Point& p = point_at(j);
+        for (;;) {
+          Vertex_handle v;
+          if (try_lock_vertex(hint) && this->try_lock_point(p))
+            v = insert_in_locked_zone(p, hint);
+          this->unlock_all_elements();
+          if (v != Vertex_handle()) {
+            on_insert(j, v);
+            hint = v;
+            break;
+          }
+        }
+      }
+    });
+  }
+
+  bool try_lock_vertex(Vertex_handle v) const
+  {
+    // the faces incident to the infinite vertex are locked by their finite vertices
+    return this->is_infinite(v) || this->try_lock_point(v->point());
+  }
+
+  bool try_lock_face(Face_handle f) const
+  {
+    return try_lock_vertex(f->vertex(0))
+        && try_lock_vertex(f->vertex(1))
+        && try_lock_vertex(f->vertex(2));
+  }
+
+  // Inserts `p` in a triangulation of dimension 2, by walking from `hint` and starring
+  // the boundary of the conflict zone of `p`. Every face that is read is first locked,
+  // so that the faces that are modified are all locked by the calling thread.
+  // Returns the new vertex, or the vertex at `p` if there is one already, or
+  // the default handle if a face could not be locked.
+  // \pre `hint` and `p` are locked by the calling thread.
+  Vertex_handle insert_in_locked_zone(const Point& p, Vertex_handle hint)
+  {
+    CGAL_precondition(this->dimension() == 2);
+
+    // visibility walk, which terminates in a Delaunay triangulation
+    Face_handle f = hint->face(), previous;
+    if (!try_lock_face(f)) return Vertex_handle();
+    if (this->is_infinite(f)) {
+      f = f->neighbor(f->index(this->infinite_vertex()));
+      if (!try_lock_face(f)) return Vertex_handle();
+    }
+    while (!this->is_infinite(f)) {
+      Face_handle next;
+      for (int i = 0; i < 3; ++i) {
+        Face_handle n = f->neighbor(i);
+        if (n != previous &&
+            this->orientation(f->vertex(ccw(i))->point(), f->vertex(cw(i))->point(), p) == NEGATIVE) {
+          next = n;
+          break;
+        }
+      }
+      if (next == Face_handle()) {
+        // p is in the closed face f
+        for (int i = 0; i < 3; ++i)
+          if (this->xy_equal(p, f->vertex(i)->point()))
+            return f->vertex(i);
+        break;
+      }
+      if (!try_lock_face(next)) return Vertex_handle();
+      previous = f;
+      f = next;
+    }
+
+    // conflict zone, with its boundary edges in counterclockwise order, as in get_conflicts_and_boundary
+    std::vector<Face_handle> conflicts(1, f);
+    std::vector<Edge> boundary;
+    std::vector<std::pair<Face_handle, int> > stack;
+    for (int i = 2; i >= 0; --i)
+      stack.push_back(std::make_pair(f, i));
+    while (!stack.empty()) {
+      Face_handle fh = stack.back().first;
+      int i = stack.back().second;
+      stack.pop_back();
+      Face_handle fn = fh->neighbor(i);
+      if (!try_lock_face(fn)) return Vertex_handle();
+      int j = fn->index(fh);
+      if (!test_conflict(p, fn)) {
+        boundary.push_back(Edge(fn, j));
+      } else {
+        conflicts.push_back(fn);
+        stack.push_back(std::make_pair(fn, cw(j)));
+        stack.push_back(std::make_pair(fn, ccw(j)));
+      }
+    }
+
+    return this->star_hole(p, boundary.begin(), boundary.end(),
+                           conflicts.begin(), conflicts.end());
+  }
+
+public:
+#endif // CGAL_LINKED_WITH_TBB
+
   template <class OutputItFaces, class OutputItBoundaryEdges>
   std::pair<OutputItFaces,OutputItBoundaryEdges>
   get_conflicts_and_boundary(const Point  &p,
@@ -618,9 +904,9 @@ protected:
   }
 };
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline bool
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 test_conflict(const Point  &p, Face_handle fh) const
 {
   // return true  if P is inside the circumcircle of fh
@@ -639,17 +925,17 @@ test_conflict(const Point  &p, Face_handle fh) const
   return false;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline bool
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 does_conflict(const Point  &p, Face_handle fh) const
 {
   return test_conflict(p,fh);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline bool
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 find_conflicts(const Point  &p,
                std::list<Face_handle>& conflicts,
                Face_handle start) const
@@ -658,9 +944,9 @@ find_conflicts(const Point  &p,
   return (! conflicts.empty());
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 bool
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 is_valid(bool verbose, int level) const
 {
   bool result = Triangulation_2<Gt,Tds>::is_valid(verbose, level);
@@ -678,9 +964,9 @@ is_valid(bool verbose, int level) const
   return result;
 }
 
-template < class Gt, class Tds >
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+template < class Gt, class Tds, class Lds >
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 nearest_vertex(const Point  &p, Face_handle f) const
 {
   switch (this->dimension()) {
@@ -698,9 +984,9 @@ nearest_vertex(const Point  &p, Face_handle f) const
   return Vertex_handle();
 }
 
-template < class Gt, class Tds >
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+template < class Gt, class Tds, class Lds >
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 nearest_vertex_2D(const Point& p, Face_handle f) const
 {
   CGAL_precondition(this->dimension() == 2);
@@ -724,9 +1010,9 @@ nearest_vertex_2D(const Point& p, Face_handle f) const
   return nn;
 }
 
-template < class Gt, class Tds >
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+template < class Gt, class Tds, class Lds >
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 nearest_vertex_1D(const Point& p) const
 {
   typename Geom_traits::Compare_distance_2
@@ -742,9 +1028,9 @@ nearest_vertex_1D(const Point& p) const
   return nn;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 look_nearest_neighbor(const Point& p,
                       Face_handle f,
                       int i,
@@ -767,10 +1053,10 @@ look_nearest_neighbor(const Point& p,
 }
 
 //DUALITY
-template<class Gt, class Tds>
+template < class Gt, class Tds, class Lds >
 inline
-typename Delaunay_triangulation_2<Gt,Tds>::Point
-Delaunay_triangulation_2<Gt,Tds>::
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Point
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 dual(Face_handle f) const
 {
   CGAL_precondition(this->_tds.is_face(f));
@@ -778,9 +1064,9 @@ dual(Face_handle f) const
   return circumcenter(f);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 Object
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 dual(const Edge &e) const
 {
   CGAL_precondition(this->_tds.is_edge(e.first,e.second));
@@ -820,17 +1106,17 @@ dual(const Edge &e) const
   return make_object(r);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline Object
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 dual(const Edge_circulator& ec) const
 {
   return dual(*ec);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline Object
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 dual(const Finite_edges_iterator& ei) const
 {
   return dual(*ei);
@@ -839,10 +1125,10 @@ dual(const Finite_edges_iterator& ei) const
 ///////////////////////////////////////////////////////////////
 //  INSERT
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 insert(const Point  &p, Face_handle start)
 {
   Locate_type lt;
@@ -851,19 +1137,19 @@ insert(const Point  &p, Face_handle start)
   return insert(p, lt, loc, li);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 push_back(const Point &p)
 {
   return insert(p);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 insert(const Point  &p, Locate_type lt, Face_handle loc, int li)
 {
   Vertex_handle v = Triangulation_2<Gt,Tds>::insert(p,lt,loc,li);
@@ -871,11 +1157,11 @@ insert(const Point  &p, Locate_type lt, Face_handle loc, int li)
   return(v);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 template < class OutputItFaces >
 inline
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 insert_and_give_new_faces(const Point  &p,
                           OutputItFaces oif,
                           Face_handle start)
@@ -899,11 +1185,11 @@ insert_and_give_new_faces(const Point  &p,
   return v;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 template < class OutputItFaces >
 inline
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 insert_and_give_new_faces(const Point  &p,
                           Locate_type lt,
                           Face_handle loc, int li,
@@ -928,9 +1214,9 @@ insert_and_give_new_faces(const Point  &p,
   return v;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 restore_Delaunay(Vertex_handle v)
 {
   if(this->dimension() <= 1) return;
@@ -949,9 +1235,9 @@ restore_Delaunay(Vertex_handle v)
 }
 
 #ifndef CGAL_DT2_USE_RECURSIVE_PROPAGATING_FLIP
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 non_recursive_propagating_flip(Face_handle f, int i)
 {
   std::stack<Edge> edges;
@@ -976,9 +1262,9 @@ non_recursive_propagating_flip(Face_handle f, int i)
   }
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 propagating_flip(const Face_handle& f,int i, int depth)
 {
 #ifdef CGAL_DT2_IMMEDIATELY_NON_RECURSIVE_PROPAGATING_FLIP
@@ -1003,9 +1289,9 @@ propagating_flip(const Face_handle& f,int i, int depth)
 #endif
 }
 #else
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 propagating_flip(const Face_handle& f,int i)
 {
   Face_handle n = f->neighbor(i);
@@ -1023,10 +1309,10 @@ propagating_flip(const Face_handle& f,int i)
 ///////////////////////////////////////////////////////////////
 //  REMOVE    see INRIA RResearch Report 7104
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 template <class OutputItFaces>
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_and_give_new_faces(Vertex_handle v, OutputItFaces fit)
 {
   CGAL_precondition(v != Vertex_handle());
@@ -1062,9 +1348,9 @@ remove_and_give_new_faces(Vertex_handle v, OutputItFaces fit)
   return;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove(Vertex_handle v)
 {
   int d;
@@ -1085,9 +1371,9 @@ remove(Vertex_handle v)
   this->delete_vertex(v);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree_init(Vertex_handle v, std::vector<Face_handle> &f,
                    std::vector<Vertex_handle> &w, std::vector<int> &i,
                    int &d, int &maxd)
@@ -1119,9 +1405,9 @@ remove_degree_init(Vertex_handle v, std::vector<Face_handle> &f,
   // all vertices finite but possibly w[0]
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree_triangulate(Vertex_handle v,
                           std::vector<Face_handle> &f,
                           std::vector<Vertex_handle> &w,
@@ -1143,9 +1429,9 @@ remove_degree_triangulate(Vertex_handle v,
   }
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree_d(Vertex_handle v, std::vector<Face_handle> &,
                 std::vector<Vertex_handle> &,
                 std::vector<int> &,int)
@@ -1159,9 +1445,9 @@ remove_degree_d(Vertex_handle v, std::vector<Face_handle> &,
   return;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree3(Vertex_handle, std::vector<Face_handle> &f,
                std::vector<Vertex_handle> &, std::vector<int> &i)
 {
@@ -1182,9 +1468,9 @@ remove_degree3(Vertex_handle, std::vector<Face_handle> &f,
   return;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree4(Vertex_handle, std::vector<Face_handle> &f,
                std::vector<Vertex_handle> &w, std::vector<int> &i)
 {
@@ -1221,9 +1507,9 @@ remove_degree4(Vertex_handle, std::vector<Face_handle> &f,
   return;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree5(Vertex_handle v, std::vector<Face_handle> &f,
                std::vector<Vertex_handle> &w, std::vector<int> &i)
 {
@@ -1273,9 +1559,9 @@ remove_degree5(Vertex_handle v, std::vector<Face_handle> &f,
   return;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::remove_degree5_star
+Delaunay_triangulation_2<Gt,Tds,Lds>::remove_degree5_star
 (
  Vertex_handle &,
  Face_handle & f0, Face_handle & f1, Face_handle & f2,
@@ -1296,9 +1582,9 @@ Delaunay_triangulation_2<Gt,Tds>::remove_degree5_star
   this->tds().delete_face(f4);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree6(Vertex_handle v, std::vector<Face_handle> &f,
                std::vector<Vertex_handle> &w, std::vector<int> &i)
 {
@@ -1429,9 +1715,9 @@ remove_degree6(Vertex_handle v, std::vector<Face_handle> &f,
   }
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::remove_degree6_star(
+Delaunay_triangulation_2<Gt,Tds,Lds>::remove_degree6_star(
   Vertex_handle &,
   Face_handle & f0, Face_handle & f1, Face_handle & f2,
   Face_handle & f3, Face_handle & f4, Face_handle & f5,
@@ -1452,9 +1738,9 @@ Delaunay_triangulation_2<Gt,Tds>::remove_degree6_star(
   this->tds().delete_face(f5);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::remove_degree6_N(
+Delaunay_triangulation_2<Gt,Tds,Lds>::remove_degree6_N(
   Vertex_handle &,
   Face_handle & f0, Face_handle & f1, Face_handle & f2,
   Face_handle & f3, Face_handle & f4, Face_handle & f5,
@@ -1476,9 +1762,9 @@ Delaunay_triangulation_2<Gt,Tds>::remove_degree6_N(
   this->tds().delete_face(f3);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::remove_degree6_antiN(
+Delaunay_triangulation_2<Gt,Tds,Lds>::remove_degree6_antiN(
   Vertex_handle &,
   Face_handle & f0, Face_handle & f1, Face_handle & f2,
   Face_handle & f3, Face_handle & f4, Face_handle & f5,
@@ -1500,9 +1786,9 @@ Delaunay_triangulation_2<Gt,Tds>::remove_degree6_antiN(
   this->tds().delete_face(f5);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::remove_degree6_diamond(
+Delaunay_triangulation_2<Gt,Tds,Lds>::remove_degree6_diamond(
   Vertex_handle &,
   Face_handle & f0, Face_handle & f1, Face_handle & f2,
   Face_handle & f3, Face_handle & f4, Face_handle & f5,
@@ -1529,9 +1815,9 @@ Delaunay_triangulation_2<Gt,Tds>::remove_degree6_diamond(
   this->tds().delete_face(f5);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree7(Vertex_handle v,std::vector<Face_handle> &f,
                std::vector<Vertex_handle> &w, std::vector<int> &i)
 {
@@ -1929,9 +2215,9 @@ remove_degree7(Vertex_handle v,std::vector<Face_handle> &f,
           }}}}}
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 rotate7(int j, std::vector<Vertex_handle> &w,
         std::vector<Face_handle> &f, std::vector<int> &i)
 {
@@ -1946,9 +2232,9 @@ rotate7(int j, std::vector<Vertex_handle> &w,
   w[kk]=ww;f[kk]=ff;i[kk]=ii;
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree7_star   (Vertex_handle &, int j,
 std::vector<Face_handle> &f, std::vector<Vertex_handle> &w, std::vector<int> &i)
 { // removing a degree 7 vertex, staring from w[j]
@@ -1968,9 +2254,9 @@ std::vector<Face_handle> &f, std::vector<Vertex_handle> &w, std::vector<int> &i)
   this->tds().delete_face(f[0]);
   this->tds().delete_face(f[6]);
 }
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree7_zigzag (Vertex_handle &, int j,
  std::vector<Face_handle> &f,std::vector<Vertex_handle> &w, std::vector<int> &i)
 { // removing a degree 7 vertex, zigzag, w[j] = middle point
@@ -2000,9 +2286,9 @@ remove_degree7_zigzag (Vertex_handle &, int j,
   this->tds().delete_face(f[0]);
   this->tds().delete_face(f[6]);
 }
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree7_leftdelta(Vertex_handle &, int j,
  std::vector<Face_handle> &f,std::vector<Vertex_handle> &w, std::vector<int> &i)
 { // removing a degree 7 vertex, left delta from w[j]
@@ -2029,9 +2315,9 @@ remove_degree7_leftdelta(Vertex_handle &, int j,
   this->tds().delete_face(f[6]);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree7_rightdelta(Vertex_handle &, int j,
  std::vector<Face_handle> &f,std::vector<Vertex_handle> &w, std::vector<int> &i)
 { // removing a degree 7 vertex, right delta from w[j]
@@ -2057,9 +2343,9 @@ remove_degree7_rightdelta(Vertex_handle &, int j,
   this->tds().delete_face(f[0]);
   this->tds().delete_face(f[6]);
 }
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree7_leftfan(Vertex_handle &, int j,
  std::vector<Face_handle> &f,std::vector<Vertex_handle> &w, std::vector<int> &i)
 { // removing a degree 7 vertex, left fan from w[j]
@@ -2083,9 +2369,9 @@ remove_degree7_leftfan(Vertex_handle &, int j,
   this->tds().delete_face(f[5]);
 }
 
-template < class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 inline void
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 remove_degree7_rightfan(Vertex_handle &, int j,
  std::vector<Face_handle> &f,std::vector<Vertex_handle> &w, std::vector<int> &i)
 { // removing a degree 7 vertex, right fan from w[j]
@@ -2112,9 +2398,9 @@ remove_degree7_rightfan(Vertex_handle &, int j,
 ///////////////////////////////////////////////////////////////
 //  DISPLACEMENT
 
-template <class Gt, class Tds >
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+template < class Gt, class Tds, class Lds >
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 move_if_no_collision(Vertex_handle v, const Point &p)
 {
   CGAL_precondition(!this->is_infinite(v));
@@ -2242,9 +2528,9 @@ move_if_no_collision(Vertex_handle v, const Point &p)
   return v;
 }
 
-template <class Gt, class Tds >
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+template < class Gt, class Tds, class Lds >
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 move(Vertex_handle v, const Point &p)
 {
   CGAL_precondition(!this->is_infinite(v));
@@ -2257,9 +2543,9 @@ move(Vertex_handle v, const Point &p)
   return v;
 }
 
-template <class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 bool
-Delaunay_triangulation_2<Gt,Tds>::
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 is_delaunay_after_displacement(Vertex_handle v, const Point &p) const
 {
   CGAL_precondition(!this->is_infinite(v));
@@ -2310,10 +2596,10 @@ is_delaunay_after_displacement(Vertex_handle v, const Point &p) const
   return true;
 }
 
-template <class Gt, class Tds >
+template < class Gt, class Tds, class Lds >
 template <class OutputItFaces>
-typename Delaunay_triangulation_2<Gt,Tds>::Vertex_handle
-Delaunay_triangulation_2<Gt,Tds>::
+typename Delaunay_triangulation_2<Gt,Tds,Lds>::Vertex_handle
+Delaunay_triangulation_2<Gt,Tds,Lds>::
 move_if_no_collision_and_give_new_faces(Vertex_handle v,
                                         const Point &p,
                                         OutputItFaces oif)
@@ -2425,7 +2711,7 @@ move_if_no_collision_and_give_new_faces(Vertex_handle v,
   }
 
   std::set<Face_handle> faces_set;
-  inserted = Delaunay_triangulation_2<Gt,Tds>::insert(p, lt, loc, li);
+  inserted = Delaunay_triangulation_2<Gt,Tds,Lds>::insert(p, lt, loc, li);
   Face_circulator fc = this->incident_faces(inserted), done(fc);
   do { faces_set.insert(fc); } while(++fc != done);
 
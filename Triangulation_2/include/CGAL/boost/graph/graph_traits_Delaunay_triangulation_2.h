@@ -19,9 +19,9 @@
 // treat a CGAL Delaunay_triangulation_2 object as a boost graph "as is". No
 // wrapper is needed for the Delaunay_triangulation_2 object.
 
-#define CGAL_2D_TRIANGULATION_TEMPLATE_PARAMETERS typename GT, typename TDS
-#define CGAL_2D_TRIANGULATION CGAL::Delaunay_triangulation_2<GT, TDS>
-#define CGAL_2D_TRIANGULATION_TEMPLATES GT, TDS
+#define CGAL_2D_TRIANGULATION_TEMPLATE_PARAMETERS typename GT, typename TDS, typename LDS
+#define CGAL_2D_TRIANGULATION CGAL::Delaunay_triangulation_2<GT, TDS, LDS>
+#define CGAL_2D_TRIANGULATION_TEMPLATES GT, TDS, LDS
 
 #include <CGAL/boost/graph/internal/graph_traits_2D_triangulation.h>
 
@@ -13,8 +13,8 @@
 
 #include <CGAL/Delaunay_triangulation_2.h>
 
-#define CGAL_2D_TRIANGULATION_TEMPLATE_PARAMETERS typename GT, typename TDS
-#define CGAL_2D_TRIANGULATION CGAL::Delaunay_triangulation_2<GT, TDS>
+#define CGAL_2D_TRIANGULATION_TEMPLATE_PARAMETERS typename GT, typename TDS, typename LDS
+#define CGAL_2D_TRIANGULATION CGAL::Delaunay_triangulation_2<GT, TDS, LDS>
 
 #include <CGAL/boost/graph/internal/properties_2D_triangulation.h>
 
@@ -0,0 +1,76 @@
+// Copyright (c) 2014  INRIA Sophia-Antipolis (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Clement Jamin
+
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+template <class Parallel_triangulation, class Sequential_triangulation>
+void
+_test_cls_parallel_delaunay_triangulation_2(const Parallel_triangulation &,
+                                            const Sequential_triangulation &)
+{
+  typedef Parallel_triangulation                                Cls;
+  typedef typename Cls::Point                                   Point;
+  typedef typename Cls::Finite_vertices_iterator                Finite_vertices_iterator;
+
+  CGAL::Random rnd;
+  std::cout << "Seed: " << rnd.get_seed() << std::endl;
+
+  // random points, and points on a grid, which have many cocircular and duplicate points
+  const int num_insert = 20000;
+  std::vector<Point> points;
+  CGAL::Random_points_in_square_2<Point> gen(1., rnd);
+  for(int i=0; i!=num_insert; ++i)
+    points.push_back(*gen++);
+  for(int i=0; i!=num_insert; ++i)
+    points.push_back(Point(rnd.get_int(-100, 101) / 100., rnd.get_int(-100, 101) / 100.));
+
+  // Construct the locking data-structure, using the bounding-box of the points
+  typename Cls::Lock_data_structure locking_ds(CGAL::Bbox_2(-1., -1., 1., 1.), 50);
+
+  // Construct the triangulation in parallel
+  std::cout << "Construction and parallel insertion" << std::endl;
+  Cls tr(points.begin(), points.end(), &locking_ds);
+  std::cout << "Triangulation has " << tr.number_of_vertices() << " vertices" << std::endl;
+  assert(tr.is_valid());
+  assert(locking_ds.check_if_all_cells_are_unlocked());
+
+  Sequential_triangulation str(points.begin(), points.end());
+  assert(tr.number_of_vertices() == str.number_of_vertices());
+  assert(tr.number_of_faces() == str.number_of_faces());
+
+  // Parallel insertion in a non empty triangulation, with infos
+  std::cout << "Parallel insertion with info" << std::endl;
+  for(Finite_vertices_iterator vit = tr.finite_vertices_begin(); vit != tr.finite_vertices_end(); ++vit)
+    vit->info() = -1;
+  std::vector<std::pair<Point, int> > points_with_info;
+  for(int i=0; i!=num_insert; ++i)
+    points_with_info.push_back(std::make_pair(*gen++, i));
+  tr.insert(points_with_info.begin(), points_with_info.end());
+  assert(tr.is_valid());
+  assert(tr.number_of_vertices() == str.number_of_vertices() + num_insert);
+  int num_with_info = 0;
+  for(Finite_vertices_iterator vit = tr.finite_vertices_begin(); vit != tr.finite_vertices_end(); ++vit)
+    if(vit->info() >= 0 && points_with_info[vit->info()].first == vit->point())
+      ++num_with_info;
+  assert(num_with_info == num_insert);
+
+  tr.clear();
+  assert(tr.is_valid());
+  assert(tr.dimension()==-1);
+  assert(tr.number_of_vertices()==0);
+}
@@ -35,9 +35,12 @@
 #include <CGAL/Cartesian.h>
 #include <CGAL/Triangulation_data_structure_2.h>
 #include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
 
 #include <CGAL/_test_traits.h>
 #include <CGAL/_test_cls_delaunay_triangulation_2.h>
+#include <CGAL/_test_cls_parallel_delaunay_triangulation_2.h>
 
 
 // Explicit instantiation of the whole class :
@@ -77,6 +80,22 @@ int main()
 
   _test_cls_delaunay_triangulation_2( Cls4() );
 
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Testing Delaunay Triangulation_2 " <<  std::endl;
+  std::cout << " with a parallel Triangulation_data_structure_2 : " << std::endl;
+  typedef CGAL::Exact_predicates_inexact_constructions_kernel       Gt5;
+  typedef CGAL::Triangulation_vertex_base_with_info_2<int, Gt5>     Vb5;
+  typedef CGAL::Triangulation_data_structure_2<
+    Vb5, CGAL::Triangulation_face_base_2<Gt5>, CGAL::Parallel_tag>  Tds_parallel;
+  typedef CGAL::Delaunay_triangulation_2<Gt5, Tds_parallel>         Cls_parallel;
+  typedef CGAL::Delaunay_triangulation_2<Gt5>                       Cls_sequential;
+  // The following test won't do things in parallel since it doesn't provide
+  // a lock data structure
+  _test_cls_delaunay_triangulation_2( Cls_parallel() );
+  // This test performs parallel operations
+  _test_cls_parallel_delaunay_triangulation_2( Cls_parallel(), Cls_sequential() );
+#endif
+
   std::cout << "done" << std::endl;
   return 0;
 }